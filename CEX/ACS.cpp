@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MacFromName.h"
 #include "MemoryTools.h"
+#include "ParallelTuner.h"
 #include "SHAKE.h"
 #include <wmmintrin.h>
 
@@ -89,6 +90,8 @@ ACS::ACS(StreamAuthenticators AuthenticatorType)
 {
 #if !defined(CEX_AVX_INTRINSICS)
 	throw CryptoSymmetricException(StreamCipherConvert::ToName(StreamCiphers::RCS), std::string("Constructor"), std::string("AVX is not supported on this system!"), ErrorCodes::NotSupported);
+#else
+	ParallelTuner::Apply(Enumeral(), m_parallelProfile);
 #endif
 }
 
@@ -382,7 +385,7 @@ void ACS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 
 	bctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 	const size_t AVX512BLK = 16 * BLOCK_SIZE;
 	if (Length >= AVX512BLK)
 	{
@@ -428,7 +431,7 @@ void ACS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX512BLK;
 		}
 	}
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
 	if (Length >= AVX2BLK)
 	{
@@ -458,7 +461,7 @@ void ACS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX2BLK;
 		}
 	}
-#elif defined(__AVX__)
+#elif defined(CEX_KERNEL_SIMD128)
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
 	if (Length >= AVXBLK)
 	{
@@ -1,4 +1,5 @@
 #include "AHX.h"
+#include "CpuDetect.h"
 #include "KdfFromName.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
@@ -285,7 +286,11 @@ void AHX::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 
 void AHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-	if (m_ahxState->Encryption)
+	if (WideProfile() != SimdProfiles::None)
+	{
+		TransformW(Input, InOffset, Output, OutOffset, 4);
+	}
+	else if (m_ahxState->Encryption)
 	{
 		Encrypt512(Input, InOffset, Output, OutOffset);
 	}
@@ -297,7 +302,11 @@ void AHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vec
 
 void AHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-	if (m_ahxState->Encryption)
+	if (WideProfile() != SimdProfiles::None)
+	{
+		TransformW(Input, InOffset, Output, OutOffset, 8);
+	}
+	else if (m_ahxState->Encryption)
 	{
 		Encrypt1024(Input, InOffset, Output, OutOffset);
 	}
@@ -309,7 +318,11 @@ void AHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::ve
 
 void AHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-	if (m_ahxState->Encryption)
+	if (WideProfile() != SimdProfiles::None)
+	{
+		TransformW(Input, InOffset, Output, OutOffset, 16);
+	}
+	else if (m_ahxState->Encryption)
 	{
 		Encrypt2048(Input, InOffset, Output, OutOffset);
 	}
@@ -627,6 +640,52 @@ void AHX::Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vect
 	Encrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
 }
 
+void AHX::TransformW(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Blocks)
+{
+	const __m128i* PRKEYS = m_ahxState->RoundKeys.data();
+	const size_t KEYCNT = m_ahxState->RoundKeys.size();
+
+	// the inverse cipher uses the same engine with the inverted round-key schedule
+	switch (WideProfile())
+	{
+#if defined(CEX_KERNEL_VAES512)
+		case SimdProfiles::Simd512:
+		{
+			if (m_ahxState->Encryption)
+			{
+				EncryptW512(PRKEYS, KEYCNT, Input.data() + InOffset, Output.data() + OutOffset, Blocks);
+			}
+			else
+			{
+				DecryptW512(PRKEYS, KEYCNT, Input.data() + InOffset, Output.data() + OutOffset, Blocks);
+			}
+
+			break;
+		}
+#endif
+#if defined(CEX_KERNEL_VAES256)
+		case SimdProfiles::Simd256:
+		{
+			if (m_ahxState->Encryption)
+			{
+				EncryptW256(PRKEYS, KEYCNT, Input.data() + InOffset, Output.data() + OutOffset, Blocks);
+			}
+			else
+			{
+				DecryptW256(PRKEYS, KEYCNT, Input.data() + InOffset, Output.data() + OutOffset, Blocks);
+			}
+
+			break;
+		}
+#endif
+		default:
+		{
+			// the wide profile is none when no vaes engine is compiled
+			throw CryptoSymmetricException(Name(), std::string("TransformW"), std::string("The wide transform is not supported on this system!"), ErrorCodes::NotSupported);
+		}
+	}
+}
+
 //~~~Helpers~~~//
 
 std::vector<SymmetricKeySize> AHX::CalculateKeySizes(BlockCipherExtensions Extension)
@@ -693,5 +752,40 @@ std::vector<SymmetricKeySize> AHX::CalculateKeySizes(BlockCipherExtensions Exten
 	return keys;
 }
 
+SimdProfiles AHX::WideDetect()
+{
+	SimdProfiles prf;
+
+	prf = SimdProfiles::None;
+
+#if defined(CEX_KERNEL_VAES256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		CpuDetect dtc;
+
+		if (dtc.VAES())
+		{
+#	if defined(CEX_KERNEL_VAES512)
+			prf = SMDPRF;
+#	else
+			prf = SimdProfiles::Simd256;
+#	endif
+		}
+	}
+#endif
+
+	return prf;
+}
+
+SimdProfiles AHX::WideProfile()
+{
+	// thread-safe static initialization; resolved on the first call
+	static const SimdProfiles PROFILE = WideDetect();
+
+	return PROFILE;
+}
+
 NAMESPACE_BLOCKEND
 
@@ -37,9 +37,12 @@
 
 #include "IBlockCipher.h"
 #include "Intrinsics.h"
+#include "SimdProfiles.h"
 
 NAMESPACE_BLOCK
 
+using Enumeration::SimdProfiles;
+
 //#if defined(__AVX__)
 
 /// <summary>
@@ -86,6 +89,7 @@ NAMESPACE_BLOCK
 /// <item><description>The Info parameter in a symmetric key container is a user-definable cipher tweak, this can be used to create a unique cipher-text output with a secondary secret.</description></item>
 /// <item><description>Extended mode is set through the constructors BlockCipherExtensions parameter to either None for standard mode, or HKDF(SHA2-256), HKDF(SHA2-512), cSHAKE256, cSHAKE512, or cSHAKE1024 for extended mode operation.</description></item>
 /// <item><description>It is recommended that in extended mode, the key expansion functions security match the key size used; ex. with a 256-bit key use SHAKE-256, or HKDF(SHA2-512) for a 512-bit key.</description></item>
+/// <item><description>On processors with the VAES instructions, the Transform512, Transform1024, and Transform2048 functions use a 256-bit (AVX2) or 512-bit (AVX512) wide AES engine that processes two or four blocks per round instruction, in both standard and extended modes; the engine is selected at run-time.</description></item>
 /// </list>
 ///
 /// <description>Guiding Publications:</description>
@@ -321,6 +325,17 @@ private:
 	static void ExpandSubBlock(std::vector<__m128i> &Key, size_t Index, size_t Offset);
 	static void SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<AhxState> &State, std::unique_ptr<IKdf> &Generator);
 	static void StandardExpand(const SecureVector<byte> &Key, std::unique_ptr<AhxState> &State);
+	static SimdProfiles WideDetect();
+	static SimdProfiles WideProfile();
+
+#if defined(CEX_KERNEL_VAES256)
+	static void DecryptW256(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks);
+	static void EncryptW256(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks);
+#endif
+#if defined(CEX_KERNEL_VAES512)
+	static void DecryptW512(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks);
+	static void EncryptW512(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks);
+#endif
 
 	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
@@ -330,6 +345,7 @@ private:
 	void Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
+	void TransformW(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Blocks);
 };
 
 //#endif
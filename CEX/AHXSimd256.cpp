@@ -0,0 +1,162 @@
+#include "AHX.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_VAES256) && !defined(__AVX2__)
+#	error "AHXSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2 -mvaes)"
+#endif
+#if defined(CEX_KERNEL_VAES256) && !defined(CEX_COMPILER_MSC) && !defined(__VAES__)
+#	error "AHXSimd256.cpp must be compiled with the VAES instructions enabled (-mvaes)"
+#endif
+
+NAMESPACE_BLOCK
+
+#if defined(CEX_KERNEL_VAES256)
+
+void AHX::DecryptW256(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks)
+{
+	// processes 8 blocks per pass in four registers, then 2 blocks per pass; Blocks must be a multiple of 2
+	const size_t RNDCNT = KeyCount - 2;
+	__m256i K[MAX_ROUNDS + 1];
+	__m256i X0;
+	__m256i X1;
+	__m256i X2;
+	__m256i X3;
+	size_t i;
+	size_t j;
+
+	// broadcast the round-keys to both lanes
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm256_broadcastsi128_si256(RoundKeys[i]);
+	}
+
+	i = 0;
+
+	while (Blocks - i >= 8)
+	{
+		X0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE)));
+		X1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE) + 32));
+		X2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE) + 64));
+		X3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE) + 96));
+
+		X0 = _mm256_xor_si256(X0, K[0]);
+		X1 = _mm256_xor_si256(X1, K[0]);
+		X2 = _mm256_xor_si256(X2, K[0]);
+		X3 = _mm256_xor_si256(X3, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm256_aesdec_epi128(X0, K[j]);
+			X1 = _mm256_aesdec_epi128(X1, K[j]);
+			X2 = _mm256_aesdec_epi128(X2, K[j]);
+			X3 = _mm256_aesdec_epi128(X3, K[j]);
+		}
+
+		X0 = _mm256_aesdeclast_epi128(X0, K[j]);
+		X1 = _mm256_aesdeclast_epi128(X1, K[j]);
+		X2 = _mm256_aesdeclast_epi128(X2, K[j]);
+		X3 = _mm256_aesdeclast_epi128(X3, K[j]);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE)), X0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE) + 32), X1);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE) + 64), X2);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE) + 96), X3);
+		i += 8;
+	}
+
+	while (Blocks - i >= 2)
+	{
+		X0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE)));
+		X0 = _mm256_xor_si256(X0, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm256_aesdec_epi128(X0, K[j]);
+		}
+
+		X0 = _mm256_aesdeclast_epi128(X0, K[j]);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE)), X0);
+		i += 2;
+	}
+
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm256_setzero_si256();
+	}
+}
+
+void AHX::EncryptW256(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks)
+{
+	// processes 8 blocks per pass in four registers, then 2 blocks per pass; Blocks must be a multiple of 2
+	const size_t RNDCNT = KeyCount - 2;
+	__m256i K[MAX_ROUNDS + 1];
+	__m256i X0;
+	__m256i X1;
+	__m256i X2;
+	__m256i X3;
+	size_t i;
+	size_t j;
+
+	// broadcast the round-keys to both lanes
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm256_broadcastsi128_si256(RoundKeys[i]);
+	}
+
+	i = 0;
+
+	while (Blocks - i >= 8)
+	{
+		X0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE)));
+		X1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE) + 32));
+		X2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE) + 64));
+		X3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE) + 96));
+
+		X0 = _mm256_xor_si256(X0, K[0]);
+		X1 = _mm256_xor_si256(X1, K[0]);
+		X2 = _mm256_xor_si256(X2, K[0]);
+		X3 = _mm256_xor_si256(X3, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm256_aesenc_epi128(X0, K[j]);
+			X1 = _mm256_aesenc_epi128(X1, K[j]);
+			X2 = _mm256_aesenc_epi128(X2, K[j]);
+			X3 = _mm256_aesenc_epi128(X3, K[j]);
+		}
+
+		X0 = _mm256_aesenclast_epi128(X0, K[j]);
+		X1 = _mm256_aesenclast_epi128(X1, K[j]);
+		X2 = _mm256_aesenclast_epi128(X2, K[j]);
+		X3 = _mm256_aesenclast_epi128(X3, K[j]);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE)), X0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE) + 32), X1);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE) + 64), X2);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE) + 96), X3);
+		i += 8;
+	}
+
+	while (Blocks - i >= 2)
+	{
+		X0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (i * BLOCK_SIZE)));
+		X0 = _mm256_xor_si256(X0, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm256_aesenc_epi128(X0, K[j]);
+		}
+
+		X0 = _mm256_aesenclast_epi128(X0, K[j]);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + (i * BLOCK_SIZE)), X0);
+		i += 2;
+	}
+
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm256_setzero_si256();
+	}
+}
+
+#endif
+
+NAMESPACE_BLOCKEND
\ No newline at end of file
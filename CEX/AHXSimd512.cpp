@@ -0,0 +1,162 @@
+#include "AHX.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_VAES512) && !defined(__AVX512__)
+#	error "AHXSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f -mvaes)"
+#endif
+#if defined(CEX_KERNEL_VAES512) && !defined(CEX_COMPILER_MSC) && !defined(__VAES__)
+#	error "AHXSimd512.cpp must be compiled with the VAES instructions enabled (-mvaes)"
+#endif
+
+NAMESPACE_BLOCK
+
+#if defined(CEX_KERNEL_VAES512)
+
+void AHX::DecryptW512(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks)
+{
+	// processes 16 blocks per pass in four registers, then 4 blocks per pass; Blocks must be a multiple of 4
+	const size_t RNDCNT = KeyCount - 2;
+	__m512i K[MAX_ROUNDS + 1];
+	__m512i X0;
+	__m512i X1;
+	__m512i X2;
+	__m512i X3;
+	size_t i;
+	size_t j;
+
+	// broadcast the round-keys to all four lanes
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm512_broadcast_i32x4(RoundKeys[i]);
+	}
+
+	i = 0;
+
+	while (Blocks - i >= 16)
+	{
+		X0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE)));
+		X1 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE) + 64));
+		X2 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE) + 128));
+		X3 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE) + 192));
+
+		X0 = _mm512_xor_si512(X0, K[0]);
+		X1 = _mm512_xor_si512(X1, K[0]);
+		X2 = _mm512_xor_si512(X2, K[0]);
+		X3 = _mm512_xor_si512(X3, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm512_aesdec_epi128(X0, K[j]);
+			X1 = _mm512_aesdec_epi128(X1, K[j]);
+			X2 = _mm512_aesdec_epi128(X2, K[j]);
+			X3 = _mm512_aesdec_epi128(X3, K[j]);
+		}
+
+		X0 = _mm512_aesdeclast_epi128(X0, K[j]);
+		X1 = _mm512_aesdeclast_epi128(X1, K[j]);
+		X2 = _mm512_aesdeclast_epi128(X2, K[j]);
+		X3 = _mm512_aesdeclast_epi128(X3, K[j]);
+
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE)), X0);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE) + 64), X1);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE) + 128), X2);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE) + 192), X3);
+		i += 16;
+	}
+
+	while (Blocks - i >= 4)
+	{
+		X0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE)));
+		X0 = _mm512_xor_si512(X0, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm512_aesdec_epi128(X0, K[j]);
+		}
+
+		X0 = _mm512_aesdeclast_epi128(X0, K[j]);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE)), X0);
+		i += 4;
+	}
+
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm512_setzero_si512();
+	}
+}
+
+void AHX::EncryptW512(const __m128i* RoundKeys, size_t KeyCount, const byte* Input, byte* Output, size_t Blocks)
+{
+	// processes 16 blocks per pass in four registers, then 4 blocks per pass; Blocks must be a multiple of 4
+	const size_t RNDCNT = KeyCount - 2;
+	__m512i K[MAX_ROUNDS + 1];
+	__m512i X0;
+	__m512i X1;
+	__m512i X2;
+	__m512i X3;
+	size_t i;
+	size_t j;
+
+	// broadcast the round-keys to all four lanes
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm512_broadcast_i32x4(RoundKeys[i]);
+	}
+
+	i = 0;
+
+	while (Blocks - i >= 16)
+	{
+		X0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE)));
+		X1 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE) + 64));
+		X2 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE) + 128));
+		X3 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE) + 192));
+
+		X0 = _mm512_xor_si512(X0, K[0]);
+		X1 = _mm512_xor_si512(X1, K[0]);
+		X2 = _mm512_xor_si512(X2, K[0]);
+		X3 = _mm512_xor_si512(X3, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm512_aesenc_epi128(X0, K[j]);
+			X1 = _mm512_aesenc_epi128(X1, K[j]);
+			X2 = _mm512_aesenc_epi128(X2, K[j]);
+			X3 = _mm512_aesenc_epi128(X3, K[j]);
+		}
+
+		X0 = _mm512_aesenclast_epi128(X0, K[j]);
+		X1 = _mm512_aesenclast_epi128(X1, K[j]);
+		X2 = _mm512_aesenclast_epi128(X2, K[j]);
+		X3 = _mm512_aesenclast_epi128(X3, K[j]);
+
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE)), X0);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE) + 64), X1);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE) + 128), X2);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE) + 192), X3);
+		i += 16;
+	}
+
+	while (Blocks - i >= 4)
+	{
+		X0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (i * BLOCK_SIZE)));
+		X0 = _mm512_xor_si512(X0, K[0]);
+
+		for (j = 1; j <= RNDCNT; ++j)
+		{
+			X0 = _mm512_aesenc_epi128(X0, K[j]);
+		}
+
+		X0 = _mm512_aesenclast_epi128(X0, K[j]);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + (i * BLOCK_SIZE)), X0);
+		i += 4;
+	}
+
+	for (i = 0; i < KeyCount; ++i)
+	{
+		K[i] = _mm512_setzero_si512();
+	}
+}
+
+#endif
+
+NAMESPACE_BLOCKEND
\ No newline at end of file
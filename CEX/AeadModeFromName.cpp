@@ -4,6 +4,7 @@
 #include "CryptoSymmetricException.h"
 #include "EAX.h"
 #include "GCM.h"
+#include "OCB.h"
 
 NAMESPACE_HELPER
 
@@ -35,6 +36,11 @@ IAeadMode* AeadModeFromName::GetInstance(IBlockCipher* Cipher, AeadModes CipherM
 				mptr = new GCM(Cipher);
 				break;
 			}
+			case AeadModes::OCB:
+			{
+				mptr = new OCB(Cipher);
+				break;
+			}
 			default:
 			{
 				throw CryptoException(CLASS_NAME, std::string("GetInstance"), std::string("The AEAD cipher mode is not supported!"), ErrorCodes::InvalidParam);
@@ -75,6 +81,11 @@ IAeadMode* AeadModeFromName::GetInstance(BlockCiphers CipherType, AeadModes Ciph
 				mptr = new GCM(CipherType);
 				break;
 			}
+			case AeadModes::OCB:
+			{
+				mptr = new OCB(CipherType);
+				break;
+			}
 			default:
 			{		
 				throw CryptoCipherModeException(CLASS_NAME, std::string("GetInstance"), std::string("The AEAD cipher mode type is not supported!"), ErrorCodes::InvalidParam);
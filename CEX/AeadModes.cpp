@@ -14,6 +14,9 @@ std::string AeadModeConvert::ToName(AeadModes Enumeral)
 		case AeadModes::GCM:
 			name = std::string("GCM");
 			break;
+		case AeadModes::OCB:
+			name = std::string("OCB");
+			break;
 		default:
 			name = std::string("None");
 			break;
@@ -34,6 +37,10 @@ AeadModes AeadModeConvert::FromName(std::string &Name)
 	{
 		tname = AeadModes::GCM;
 	}
+	else if (Name == std::string("OCB"))
+	{
+		tname = AeadModes::OCB;
+	}
 	else
 	{
 		tname = AeadModes::None;
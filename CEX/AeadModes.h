@@ -21,7 +21,11 @@ enum class AeadModes : byte
 	/// <summary>
 	/// Galois Counter AEAD Mode
 	/// </summary>
-	GCM = 6
+	GCM = 6,
+	/// <summary>
+	/// Offset CodeBook AEAD Mode (OCB3)
+	/// </summary>
+	OCB = 7
 };
 
 class AeadModeConvert
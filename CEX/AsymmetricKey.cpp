@@ -2,6 +2,16 @@
 #include "ArrayTools.h"
 #include "IntegerTools.h"
 
+#if defined(CEX_OS_POSIX)
+#	include <sys/types.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#elif defined(CEX_OS_WINDOWS)
+#	include <windows.h>
+#endif
+
 NAMESPACE_ASYMMETRIC
 
 using Enumeration::ErrorCodes;
@@ -21,13 +31,21 @@ public:
 	AsymmetricKeyTypes KeyClass;
 	AsymmetricPrimitives Primitive;
 	AsymmetricParameters Parameters;
+	const byte* View;
+	size_t ViewSize;
+	void* MapBase;
+	size_t MapSize;
 
 	AsymmetricKeyState(const std::vector<byte> &Poly, AsymmetricPrimitives PrimitiveType, AsymmetricKeyTypes AsymmetricKeyType, AsymmetricParameters ParameterType)
 		:
 		Polynomial(Lock(Poly)),
 		Primitive(PrimitiveType),
 		KeyClass(AsymmetricKeyType),
-		Parameters(ParameterType)
+		Parameters(ParameterType),
+		View(nullptr),
+		ViewSize(0),
+		MapBase(nullptr),
+		MapSize(0)
 	{
 	}
 
@@ -36,7 +54,24 @@ public:
 		Polynomial(Poly),
 		Primitive(AsymmetricType),
 		KeyClass(AsymmetricKeyType),
-		Parameters(ParameterType)
+		Parameters(ParameterType),
+		View(nullptr),
+		ViewSize(0),
+		MapBase(nullptr),
+		MapSize(0)
+	{
+	}
+
+	AsymmetricKeyState(const byte* Poly, size_t Length, AsymmetricPrimitives AsymmetricType, AsymmetricKeyTypes AsymmetricKeyType, AsymmetricParameters ParameterType)
+		:
+		Polynomial(0),
+		Primitive(AsymmetricType),
+		KeyClass(AsymmetricKeyType),
+		Parameters(ParameterType),
+		View(Poly),
+		ViewSize(Length),
+		MapBase(nullptr),
+		MapSize(0)
 	{
 	}
 
@@ -45,7 +80,11 @@ public:
 		KeyClass(static_cast<AsymmetricKeyTypes>(KeyStream[0])),
 		Parameters(static_cast<AsymmetricParameters>(KeyStream[1])),
 		Primitive(static_cast<AsymmetricPrimitives>(KeyStream[2])),
-		Polynomial(KeyStream.begin() + 3, KeyStream.end())
+		Polynomial(KeyStream.begin() + HEADER_SIZE, KeyStream.end()),
+		View(nullptr),
+		ViewSize(0),
+		MapBase(nullptr),
+		MapSize(0)
 	{
 	}
 
@@ -54,7 +93,11 @@ public:
 		KeyClass(static_cast<AsymmetricKeyTypes>(KeyStream[0])),
 		Parameters(static_cast<AsymmetricParameters>(KeyStream[1])),
 		Primitive(static_cast<AsymmetricPrimitives>(KeyStream[2])),
-		Polynomial(KeyStream.begin() + 3, KeyStream.end())
+		Polynomial(KeyStream.begin() + HEADER_SIZE, KeyStream.end()),
+		View(nullptr),
+		ViewSize(0),
+		MapBase(nullptr),
+		MapSize(0)
 	{
 	}
 
@@ -63,9 +106,104 @@ public:
 		Reset();
 	}
 
+	void Map(const std::string &FilePath)
+	{
+		const byte* ptr;
+
+		MapBase = nullptr;
+		MapSize = 0;
+
+#if defined(CEX_OS_POSIX)
+
+		struct stat fst;
+		int fd;
+
+		fd = ::open(FilePath.c_str(), O_RDONLY);
+
+		if (fd != -1)
+		{
+			if (::fstat(fd, &fst) == 0 && fst.st_size > static_cast<off_t>(HEADER_SIZE))
+			{
+				MapSize = static_cast<size_t>(fst.st_size);
+				MapBase = ::mmap(nullptr, MapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+				if (MapBase == MAP_FAILED)
+				{
+					MapBase = nullptr;
+				}
+#	if defined(MADV_WILLNEED)
+				else
+				{
+					::madvise(MapBase, MapSize, MADV_WILLNEED);
+				}
+#	endif
+			}
+
+			::close(fd);
+		}
+
+#elif defined(CEX_OS_WINDOWS)
+
+		HANDLE hfile;
+		HANDLE hmap;
+		LARGE_INTEGER flen;
+
+		hfile = ::CreateFileA(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (hfile != INVALID_HANDLE_VALUE)
+		{
+			if (::GetFileSizeEx(hfile, &flen) != 0 && flen.QuadPart > static_cast<LONGLONG>(HEADER_SIZE))
+			{
+				hmap = ::CreateFileMappingA(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				if (hmap != nullptr)
+				{
+					MapSize = static_cast<size_t>(flen.QuadPart);
+					MapBase = ::MapViewOfFile(hmap, FILE_MAP_READ, 0, 0, 0);
+					::CloseHandle(hmap);
+				}
+			}
+
+			::CloseHandle(hfile);
+		}
+
+#else
+
+		throw CryptoAsymmetricException(CLASS_NAME, std::string("Map"), std::string("Memory-mapped keys are not supported on this platform!"), ErrorCodes::NotSupported);
+
+#endif
+
+		if (MapBase == nullptr)
+		{
+			MapSize = 0;
+			throw CryptoAsymmetricException(CLASS_NAME, std::string("Map"), std::string("The key file could not be mapped!"), ErrorCodes::BadRead);
+		}
+
+		ptr = reinterpret_cast<const byte*>(MapBase);
+		KeyClass = static_cast<AsymmetricKeyTypes>(ptr[0]);
+		Parameters = static_cast<AsymmetricParameters>(ptr[1]);
+		Primitive = static_cast<AsymmetricPrimitives>(ptr[2]);
+		View = ptr + HEADER_SIZE;
+		ViewSize = MapSize - HEADER_SIZE;
+	}
+
 	void Reset()
 	{
 		Clear(Polynomial);
+
+		if (MapBase != nullptr)
+		{
+#if defined(CEX_OS_POSIX)
+			::munmap(MapBase, MapSize);
+#elif defined(CEX_OS_WINDOWS)
+			::UnmapViewOfFile(MapBase);
+#endif
+			MapBase = nullptr;
+			MapSize = 0;
+		}
+
+		View = nullptr;
+		ViewSize = 0;
 		Primitive = AsymmetricPrimitives::None;
 		KeyClass = AsymmetricKeyTypes::None;
 		Parameters = AsymmetricParameters::None;
@@ -90,6 +228,21 @@ AsymmetricKey::AsymmetricKey(const SecureVector<byte> &Polynomial, AsymmetricPri
 {
 }
 
+AsymmetricKey::AsymmetricKey(const byte* Polynomial, size_t Length, AsymmetricPrimitives PrimitiveType, AsymmetricKeyTypes CipherKeyType, AsymmetricParameters ParameterType)
+	:
+	m_keyState((Polynomial != nullptr && Length != 0 && PrimitiveType != AsymmetricPrimitives::None && ParameterType != AsymmetricParameters::None &&
+		(CipherKeyType == AsymmetricKeyTypes::CipherPublicKey || CipherKeyType == AsymmetricKeyTypes::SignaturePublicKey)) ?
+		new AsymmetricKeyState(Polynomial, Length, PrimitiveType, CipherKeyType, ParameterType) :
+		throw CryptoAsymmetricException(CLASS_NAME, std::string("Constructor"), std::string("The types can not be none, the polynomial can not be empty, and only public keys can be viewed!"), Enumeration::ErrorCodes::InvalidParam))
+{
+}
+
+AsymmetricKey::AsymmetricKey(AsymmetricKeyState* State)
+	:
+	m_keyState(State)
+{
+}
+
 AsymmetricKey::~AsymmetricKey()
 {
 	Reset();
@@ -114,12 +267,32 @@ const AsymmetricParameters AsymmetricKey::Parameters()
 
 const std::vector<byte> AsymmetricKey::Polynomial()
 {
+	if (m_keyState->View != nullptr)
+	{
+		return std::vector<byte>(m_keyState->View, m_keyState->View + m_keyState->ViewSize);
+	}
+
 	std::vector<byte> tmp = Unlock(m_keyState->Polynomial);
 	return tmp;
 }
 
+const byte* AsymmetricKey::PolynomialView()
+{
+	return (m_keyState->View != nullptr) ? m_keyState->View : m_keyState->Polynomial.data();
+}
+
+const size_t AsymmetricKey::PolynomialSize()
+{
+	return (m_keyState->View != nullptr) ? m_keyState->ViewSize : m_keyState->Polynomial.size();
+}
+
 const SecureVector<byte> &AsymmetricKey::SecurePolynomial()
 {
+	if (m_keyState->View != nullptr && m_keyState->Polynomial.size() != m_keyState->ViewSize)
+	{
+		m_keyState->Polynomial.assign(m_keyState->View, m_keyState->View + m_keyState->ViewSize);
+	}
+
 	return m_keyState->Polynomial;
 }
 
@@ -134,22 +307,41 @@ void AsymmetricKey::Reset()
 
 AsymmetricKey* AsymmetricKey::DeSerialize(SecureVector<byte> &KeyStream)
 {
-	AsymmetricKey* tmpk = new AsymmetricKey(SecureVector<byte>(KeyStream.begin() + 3, KeyStream.end()), 
-		static_cast<AsymmetricPrimitives>(KeyStream[2]),
-		static_cast<AsymmetricKeyTypes>(KeyStream[0]),
-		static_cast<AsymmetricParameters>(KeyStream[1]));
+	if (KeyStream.size() <= HEADER_SIZE)
+	{
+		throw CryptoAsymmetricException(CLASS_NAME, std::string("DeSerialize"), std::string("The key-stream is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	// the state copies the polynomial directly from the key-stream
+	AsymmetricKey* tmpk = new AsymmetricKey(new AsymmetricKeyState(KeyStream));
 
 	return tmpk;
 }
 
+AsymmetricKey* AsymmetricKey::Map(const std::string &FilePath)
+{
+	std::unique_ptr<AsymmetricKeyState> tmps(new AsymmetricKeyState(nullptr, 0, AsymmetricPrimitives::None, AsymmetricKeyTypes::None, AsymmetricParameters::None));
+
+	tmps->Map(FilePath);
+
+	if (tmps->Primitive == AsymmetricPrimitives::None || tmps->Parameters == AsymmetricParameters::None ||
+		(tmps->KeyClass != AsymmetricKeyTypes::CipherPublicKey && tmps->KeyClass != AsymmetricKeyTypes::SignaturePublicKey))
+	{
+		throw CryptoAsymmetricException(CLASS_NAME, std::string("Map"), std::string("The key file does not contain a valid public key!"), ErrorCodes::InvalidKey);
+	}
+
+	return new AsymmetricKey(tmps.release());
+}
+
 SecureVector<byte> AsymmetricKey::Serialize(AsymmetricKey &KeyParams)
 {
 	SecureVector<byte> tmpr(0);
 
+	tmpr.reserve(HEADER_SIZE + KeyParams.PolynomialSize());
 	ArrayTools::AppendValue(static_cast<byte>(KeyParams.KeyClass()), tmpr);
 	ArrayTools::AppendValue(static_cast<byte>(KeyParams.Parameters()), tmpr);
 	ArrayTools::AppendValue(static_cast<byte>(KeyParams.PrimitiveType()), tmpr);
-	ArrayTools::AppendVector(KeyParams.Polynomial(), tmpr);
+	ArrayTools::AppendObject(KeyParams.PolynomialView(), tmpr, KeyParams.PolynomialSize());
 
 	return tmpr;
 }
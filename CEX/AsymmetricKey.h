@@ -17,16 +17,21 @@ using Enumeration::AsymmetricParameters;
 /// An Asymmetric primitive key container.
 /// <para>Contains the keys polynomial vector, the key classification, primitive type, and the primitives parameter-set type name.
 /// Internal storage uses a secure-vector, which can be accessed directly using SecurePolynomial, or return a standard-vector copy with the Polynomial accessor.<para>
+/// <para>A public key can also be a read-only view of a caller-owned buffer, or of a memory-mapped serialized key file (see Map).
+/// A view is never copied; PolynomialView returns a pointer to the key that can be read in place by the asymmetric primitives.</para>
 /// </summary>
 class AsymmetricKey final : public IAsymmetricKey
 {
 private:
 
 	static const std::string CLASS_NAME;
+	static const size_t HEADER_SIZE = 3;
 
 	class AsymmetricKeyState;
 	std::unique_ptr<AsymmetricKeyState> m_keyState;
 
+	explicit AsymmetricKey(AsymmetricKeyState* State);
+
 public:
 
 	//~~~Constructor~~~//
@@ -70,6 +75,21 @@ public:
 	/// <exception cref="CryptoAsymmetricException">Thrown if invalid parameters are passed</exception>
 	AsymmetricKey(const SecureVector<byte> &Polynomial, AsymmetricPrimitives PrimitiveType, AsymmetricKeyTypes KeyClass, AsymmetricParameters ParameterType);
 
+	/// <summary>
+	/// Initialize an AsymmetricKey container as a read-only view of a caller-owned public key.
+	/// <para>The polynomial is not copied; the buffer must remain valid and unchanged for the lifetime of this key.
+	/// Only public key classes can be viewed, private keys must use the secure-vector storage.</para>
+	/// </summary>
+	/// 
+	/// <param name="Polynomial">A pointer to the asymmetric primitives public key polynomial</param>
+	/// <param name="Length">The length of the polynomial in bytes</param>
+	/// <param name="PrimitiveType">The keys asymmetric primitives enumeration name</param>
+	/// <param name="KeyClass">The asymmetric primitives key classification enumeration name</param>
+	/// <param name="ParameterType">The asymmetric primitives parameter-set enumeration name</param>
+	///
+	/// <exception cref="CryptoAsymmetricException">Thrown if invalid parameters are passed, or the key is a private key</exception>
+	AsymmetricKey(const byte* Polynomial, size_t Length, AsymmetricPrimitives PrimitiveType, AsymmetricKeyTypes KeyClass, AsymmetricParameters ParameterType);
+
 	/// <summary>
 	/// Destructor: finalize this class
 	/// </summary>
@@ -98,7 +118,18 @@ public:
 	const std::vector<byte> Polynomial() override;
 
 	/// <summary>
-	/// Read Only: Returns a reference to the internal asymmetric keys secure-vector polynomial
+	/// Read Only: Returns a pointer to the keys polynomial; the internal secure-vector, or the external view
+	/// </summary>
+	const byte* PolynomialView();
+
+	/// <summary>
+	/// Read Only: The size of the keys polynomial in bytes
+	/// </summary>
+	const size_t PolynomialSize();
+
+	/// <summary>
+	/// Read Only: Returns a reference to the internal asymmetric keys secure-vector polynomial.
+	/// <para>A view-backed key is copied to the secure-vector on the first call.</para>
 	/// </summary>
 	const SecureVector<byte> &SecurePolynomial();
 
@@ -120,6 +151,19 @@ public:
 	/// <returns>A populated AsymmetricKey container</returns>
 	static AsymmetricKey* DeSerialize(SecureVector<byte> &KeyStream);
 
+	/// <summary>
+	/// Memory-map a serialized public key file and return a pointer to a read-only AsymmetricKey view.
+	/// <para>The file contains a key-stream written by Serialize. The mapping is page-aligned and shared through the page cache,
+	/// the polynomial is read in place and is not copied. The file is unmapped when the key is reset or destroyed.</para>
+	/// </summary>
+	/// 
+	/// <param name="FilePath">The full path to the serialized public key file</param>
+	/// 
+	/// <returns>A read-only AsymmetricKey view of the mapped key</returns>
+	///
+	/// <exception cref="CryptoAsymmetricException">Thrown if the file can not be mapped, or does not contain a public key</exception>
+	static AsymmetricKey* Map(const std::string &FilePath);
+
 	/// <summary>
 	/// Serialize an AsymmetricKey into a secure-vector key-stream
 	/// </summary>
@@ -482,7 +482,7 @@ void BCG::Permute(std::vector<byte> &Output, size_t OutOffset, size_t Length, st
 {
 	size_t bctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512) || defined(CEX_KERNEL_VAES256)
 
 	const size_t AVX512BLK = 16 * BLOCK_SIZE;
 
@@ -491,7 +491,7 @@ void BCG::Permute(std::vector<byte> &Output, size_t OutOffset, size_t Length, st
 		const size_t PBKALN = Length - (Length % AVX512BLK);
 		std::vector<byte> tmpc(AVX512BLK);
 
-		// stagger counters and process 8 blocks with avx512
+		// stagger counters and process 16 blocks; a vaes engine transforms these in wide registers
 		while (bctr != PBKALN)
 		{
 			MemoryTools::COPY128(Counter, 0, tmpc, 0);
@@ -531,7 +531,7 @@ void BCG::Permute(std::vector<byte> &Output, size_t OutOffset, size_t Length, st
 		}
 	}
 
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
 
@@ -564,7 +564,9 @@ void BCG::Permute(std::vector<byte> &Output, size_t OutOffset, size_t Length, st
 		}
 	}
 
-#elif defined(__AVX__)
+#endif
+
+#if defined(CEX_KERNEL_SIMD128)
 
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
 
@@ -4,6 +4,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_DIGEST
 
@@ -54,6 +55,7 @@ Blake256::Blake256(bool Parallel)
 	}
 
 	Reset();
+	ParallelTuner::Apply(Digests::Blake256, m_parallelProfile);
 }
 
 Blake256::Blake256(BlakeParams &Params)
@@ -84,6 +86,7 @@ Blake256::Blake256(BlakeParams &Params)
 	}
 
 	Reset();
+	ParallelTuner::Apply(Digests::Blake256, m_parallelProfile);
 }
 
 Blake256::~Blake256()
@@ -554,15 +557,20 @@ void Blake256::Permute(const std::vector<byte> &Input, size_t InOffset, Blake2sS
 		Blake::IV256[6] ^ State.F[0],
 		Blake::IV256[7] ^ State.F[1] };
 
-#if defined(__AVX__)
-	Blake::PermuteR10P512V(Input, InOffset, State.H, iv);
-#else
-#	if defined(CEX_DIGEST_COMPACT)
+#if defined(CEX_KERNEL_SIMD128)
+	if (CpuDetect::SimdProfile() != SimdProfiles::None)
+	{
+		Blake::PermuteR10P512V(Input.data() + InOffset, State.H.data(), iv.data());
+	}
+	else
+#endif
+	{
+#if defined(CEX_DIGEST_COMPACT)
 		Blake::PermuteR10P512C(Input, InOffset, State.H, iv);
-#	else
+#else
 		Blake::PermuteR10P512U(Input, InOffset, State.H, iv);
-#	endif
 #endif
+	}
 }
 
 void Blake256::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, size_t Length, Blake2sState &State)
@@ -4,6 +4,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_DIGEST
 
@@ -55,6 +56,7 @@ Blake512::Blake512(bool Parallel)
 	}
 
 	Reset();
+	ParallelTuner::Apply(Digests::Blake512, m_parallelProfile);
 }
 
 Blake512::Blake512(BlakeParams &Params)
@@ -86,6 +88,7 @@ Blake512::Blake512(BlakeParams &Params)
 	}
 
 	Reset();
+	ParallelTuner::Apply(Digests::Blake512, m_parallelProfile);
 }
 
 Blake512::~Blake512()
@@ -553,15 +556,20 @@ void Blake512::Permute(const std::vector<byte> &Input, size_t InOffset, Blake2bS
 		Blake::IV512[6] ^ State.F[0],
 		Blake::IV512[7] ^ State.F[1] };
 
-#if defined(__AVX__)
-	Blake::PermuteR12P1024V(Input, InOffset, State.H, iv);
-#else
-#	if defined(CEX_DIGEST_COMPACT)
+#if defined(CEX_KERNEL_SIMD128)
+	if (CpuDetect::SimdProfile() != SimdProfiles::None)
+	{
+		Blake::PermuteR12P1024V(Input.data() + InOffset, State.H.data(), iv.data());
+	}
+	else
+#endif
+	{
+#if defined(CEX_DIGEST_COMPACT)
 		Blake::PermuteR12P1024C(Input, InOffset, State.H, iv);
-#	else
+#else
 		Blake::PermuteR12P1024U(Input, InOffset, State.H, iv);
-#	endif
 #endif
+	}
 }
 
 void Blake512::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, ulong Length, Blake2bState &State)
@@ -0,0 +1,1443 @@
+#include "Blake.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD128) && !defined(__SSE4_1__) && !defined(CEX_COMPILER_MSC)
+#	error "BlakeSimd128.cpp must be compiled with the SSE4.1 instruction set enabled (-msse4.1)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD128)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_DIGEST
+
+#if defined(CEX_KERNEL_SIMD128)
+
+// Misra exception: this is a common extension of the Intel intrinsics api
+#define _mm_roti_epi32(r, c) ( \
+	(8==-(c)) ? _mm_shuffle_epi8(r,R8) \
+	: (16==-(c)) ? _mm_shuffle_epi8(r,R16) \
+	: _mm_xor_si128(_mm_srli_epi32( (r), -(c) ),_mm_slli_epi32( (r), 32-(-(c)) )) )
+
+// Misra exception: this is a common extension of the Intel intrinsics api
+#define _mm_roti_epi64(x, c) \
+	(-(c) == 32) ? _mm_shuffle_epi32((x), _MM_SHUFFLE(2,3,0,1))  \
+	: (-(c) == 24) ? _mm_shuffle_epi8((x), R24) \
+	: (-(c) == 16) ? _mm_shuffle_epi8((x), R16) \
+	: (-(c) == 63) ? _mm_xor_si128(_mm_srli_epi64((x), -(c)), _mm_add_epi64((x), (x)))  \
+	: _mm_xor_si128(_mm_srli_epi64((x), -(c)), _mm_slli_epi64((x), 64-(-(c))))
+
+namespace
+{
+	// the diagonal rotations have internal linkage, so that no helper is shared with the baseline translation units
+
+	void Diagonalize(__m128i &RL2, __m128i &RL3, __m128i &RL4, __m128i &RH2, __m128i &RH3, __m128i &RH4)
+	{
+		__m128i T0 = _mm_alignr_epi8(RH2, RL2, 8);
+		__m128i T1 = _mm_alignr_epi8(RL2, RH2, 8);
+		RL2 = T0;
+		RH2 = T1;
+		T0 = RL3;
+		RL3 = RH3;
+		RH3 = T0;
+		T0 = _mm_alignr_epi8(RH4, RL4, 8);
+		T1 = _mm_alignr_epi8(RL4, RH4, 8);
+		RL4 = T1;
+		RH4 = T0;
+	}
+
+	void UnDiagonalize(__m128i &RL2, __m128i &RL3, __m128i &RL4, __m128i &RH2, __m128i &RH3, __m128i &RH4)
+	{
+		__m128i T0 = _mm_alignr_epi8(RL2, RH2, 8);
+		__m128i T1 = _mm_alignr_epi8(RH2, RL2, 8);
+		RL2 = T0;
+		RH2 = T1;
+		T0 = RL3;
+		RL3 = RH3;
+		RH3 = T0;
+		T0 = _mm_alignr_epi8(RL4, RH4, 8);
+		T1 = _mm_alignr_epi8(RH4, RL4, 8);
+		RL4 = T1;
+		RH4 = T0;
+	}
+}
+
+//~~~Blake2-256~~~//
+
+void Blake::PermuteR10P512V(const byte* Input, uint* State, const uint* IV)
+{
+	__m128i R1, R2, R3, R4;
+	__m128i B1, B2, B3, B4;
+	__m128i FF0, FF1;
+	__m128i T0, T1, T2;
+
+	const __m128i R8 = _mm_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1);
+	const __m128i R16 = _mm_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+	const __m128i M0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input));
+	const __m128i M1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 16));
+	const __m128i M2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 32));
+	const __m128i M3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 48));
+
+	R1 = FF0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State));
+	R2 = FF1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 4));
+	R3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IV));
+	R4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IV + 4));
+
+	// round 0
+	// lm 0.1
+	B1 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(M0), _mm_castsi128_ps(M1), _MM_SHUFFLE(2, 0, 2, 0)));
+	// g1
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 0.2
+	B2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(M0), _mm_castsi128_ps(M1), _MM_SHUFFLE(3, 1, 3, 1)));
+	// g2
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+
+	// diag
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 0.3
+	B3 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(M2), _mm_castsi128_ps(M3), _MM_SHUFFLE(2, 0, 2, 0)));
+	// g1
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 0.4
+	B4 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(M2), _mm_castsi128_ps(M3), _MM_SHUFFLE(3, 1, 3, 1)));
+	// g2
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 1
+	// lm 1.1
+	T0 = _mm_blend_epi16(M1, M2, 0x0C);
+	T1 = _mm_slli_si128(M3, 4);
+	T2 = _mm_blend_epi16(T0, T1, 0xF0);
+	B1 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 1, 0, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 1.2
+	T0 = _mm_shuffle_epi32(M2, _MM_SHUFFLE(0, 0, 2, 0));
+	T1 = _mm_blend_epi16(M1, M3, 0xC0);
+	T2 = _mm_blend_epi16(T0, T1, 0xF0);
+	B2 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 3, 0, 1));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 1.3
+	T0 = _mm_slli_si128(M1, 4);
+	T1 = _mm_blend_epi16(M2, T0, 0x30);
+	T2 = _mm_blend_epi16(M0, T1, 0xF0);
+	B3 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 3, 0, 1));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 1.4
+	T0 = _mm_unpackhi_epi32(M0, M1);
+	T1 = _mm_slli_si128(M3, 4);
+	T2 = _mm_blend_epi16(T0, T1, 0x0C);
+	B4 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 3, 0, 1));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 2
+	// lm 2.1
+	T0 = _mm_unpackhi_epi32(M2, M3);
+	T1 = _mm_blend_epi16(M3, M1, 0x0C);
+	T2 = _mm_blend_epi16(T0, T1, 0x0F);
+	B1 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(3, 1, 0, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 2.2
+	T0 = _mm_unpacklo_epi32(M2, M0);
+	T1 = _mm_blend_epi16(T0, M0, 0xF0);
+	T2 = _mm_slli_si128(M3, 8);
+	B2 = _mm_blend_epi16(T1, T2, 0xC0);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 2.3
+	T0 = _mm_blend_epi16(M0, M2, 0x3C);
+	T1 = _mm_srli_si128(M1, 12);
+	T2 = _mm_blend_epi16(T0, T1, 0x03);
+	B3 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(1, 0, 3, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 2.4
+	T0 = _mm_slli_si128(M3, 4);
+	T1 = _mm_blend_epi16(M0, M1, 0x33);
+	T2 = _mm_blend_epi16(T1, T0, 0xC0);
+	B4 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(0, 1, 2, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 3
+	// lm 3.1
+	T0 = _mm_unpackhi_epi32(M0, M1);
+	T1 = _mm_unpackhi_epi32(T0, M2);
+	T2 = _mm_blend_epi16(T1, M3, 0x0C);
+	B1 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(3, 1, 0, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 3.2
+	T0 = _mm_slli_si128(M2, 8);
+	T1 = _mm_blend_epi16(M3, M0, 0x0C);
+	T2 = _mm_blend_epi16(T1, T0, 0xC0);
+	B2 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 0, 1, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 3.3
+	T0 = _mm_blend_epi16(M0, M1, 0x0F);
+	T1 = _mm_blend_epi16(T0, M3, 0xC0);
+	B3 = _mm_shuffle_epi32(T1, _MM_SHUFFLE(3, 0, 1, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 3.4
+	T0 = _mm_unpacklo_epi32(M0, M2);
+	T1 = _mm_unpackhi_epi32(M1, M2);
+	B4 = _mm_unpacklo_epi64(T1, T0);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 4
+	// lm 4.1
+	T0 = _mm_unpacklo_epi64(M1, M2);
+	T1 = _mm_unpackhi_epi64(M0, M2);
+	T2 = _mm_blend_epi16(T0, T1, 0x33);
+	B1 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 0, 1, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 4.2
+	T0 = _mm_unpackhi_epi64(M1, M3);
+	T1 = _mm_unpacklo_epi64(M0, M1);
+	B2 = _mm_blend_epi16(T0, T1, 0x33);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 4.3
+	T0 = _mm_unpackhi_epi64(M3, M1);
+	T1 = _mm_unpackhi_epi64(M2, M0);
+	B3 = _mm_blend_epi16(T1, T0, 0x33);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 4.4
+	T0 = _mm_blend_epi16(M0, M2, 0x03);
+	T1 = _mm_slli_si128(T0, 8);
+	T2 = _mm_blend_epi16(T1, M3, 0x0F);
+	B4 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(1, 2, 0, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 5
+	// lm 5.1
+	T0 = _mm_unpackhi_epi32(M0, M1);
+	T1 = _mm_unpacklo_epi32(M0, M2);
+	B1 = _mm_unpacklo_epi64(T0, T1);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 5.2
+	T0 = _mm_srli_si128(M2, 4);
+	T1 = _mm_blend_epi16(M0, M3, 0x03);
+	B2 = _mm_blend_epi16(T1, T0, 0x3C);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 5.3
+	T0 = _mm_blend_epi16(M1, M0, 0x0C);
+	T1 = _mm_srli_si128(M3, 4);
+	T2 = _mm_blend_epi16(T0, T1, 0x30);
+	B3 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(1, 2, 3, 0));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 5.4
+	T0 = _mm_unpacklo_epi64(M1, M2);
+	T1 = _mm_shuffle_epi32(M3, _MM_SHUFFLE(0, 2, 0, 1));
+	B4 = _mm_blend_epi16(T0, T1, 0x33);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 6
+	// lm 6.1
+	T0 = _mm_slli_si128(M1, 12);
+	T1 = _mm_blend_epi16(M0, M3, 0x33);
+	B1 = _mm_blend_epi16(T1, T0, 0xC0);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 6.2
+	T0 = _mm_blend_epi16(M3, M2, 0x30);
+	T1 = _mm_srli_si128(M1, 4);
+	T2 = _mm_blend_epi16(T0, T1, 0x03);
+	B2 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(2, 1, 3, 0));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 6.3
+	T0 = _mm_unpacklo_epi64(M0, M2);
+	T1 = _mm_srli_si128(M1, 4);
+	B3 = _mm_shuffle_epi32(_mm_blend_epi16(T0, T1, 0x0C), _MM_SHUFFLE(2, 3, 1, 0));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 6.4
+	T0 = _mm_unpackhi_epi32(M1, M2);
+	T1 = _mm_unpackhi_epi64(M0, T0);
+	B4 = _mm_shuffle_epi32(T1, _MM_SHUFFLE(3, 0, 1, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 7
+	// lm 7.1
+	T0 = _mm_unpackhi_epi32(M0, M1);
+	T1 = _mm_blend_epi16(T0, M3, 0x0F);
+	B1 = _mm_shuffle_epi32(T1, _MM_SHUFFLE(2, 0, 3, 1));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 7.2
+	T0 = _mm_blend_epi16(M2, M3, 0x30);
+	T1 = _mm_srli_si128(M0, 4);
+	T2 = _mm_blend_epi16(T0, T1, 0x03);
+	B2 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(1, 0, 2, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 7.3
+	T0 = _mm_unpackhi_epi64(M0, M3);
+	T1 = _mm_unpacklo_epi64(M1, M2);
+	T2 = _mm_blend_epi16(T0, T1, 0x3C);
+	B3 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(0, 2, 3, 1));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 7.4
+	T0 = _mm_unpacklo_epi32(M0, M1);
+	T1 = _mm_unpackhi_epi32(M1, M2);
+	B4 = _mm_unpacklo_epi64(T0, T1);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 8
+	// lm 8.1
+	T0 = _mm_unpackhi_epi32(M1, M3);
+	T1 = _mm_unpacklo_epi64(T0, M0);
+	T2 = _mm_blend_epi16(T1, M2, 0xC0);
+	B1 = _mm_shufflehi_epi16(T2, _MM_SHUFFLE(1, 0, 3, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 8.2
+	T0 = _mm_unpackhi_epi32(M0, M3);
+	T1 = _mm_blend_epi16(M2, T0, 0xF0);
+	B2 = _mm_shuffle_epi32(T1, _MM_SHUFFLE(0, 2, 1, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 8.3
+	T0 = _mm_blend_epi16(M2, M0, 0x0C);
+	T1 = _mm_slli_si128(T0, 4);
+	B3 = _mm_blend_epi16(T1, M3, 0x0F);
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 8.4
+	T0 = _mm_blend_epi16(M1, M0, 0x30);
+	B4 = _mm_shuffle_epi32(T0, _MM_SHUFFLE(1, 0, 3, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	// round 9
+	// lm 9.1
+	T0 = _mm_blend_epi16(M0, M2, 0x03);
+	T1 = _mm_blend_epi16(M1, M2, 0x30);
+	T2 = _mm_blend_epi16(T1, T0, 0x0F);
+	B1 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(1, 3, 0, 2));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B1), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 9.2
+	T0 = _mm_slli_si128(M0, 4);
+	T1 = _mm_blend_epi16(M1, T0, 0xC0);
+	B2 = _mm_shuffle_epi32(T1, _MM_SHUFFLE(1, 2, 0, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B2), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(2, 1, 0, 3));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(0, 3, 2, 1));
+
+	// lm 9.3
+	T0 = _mm_unpackhi_epi32(M0, M3);
+	T1 = _mm_unpacklo_epi32(M2, M3);
+	T2 = _mm_unpackhi_epi64(T0, T1);
+	B3 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(3, 0, 2, 1));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B3), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -16);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -12);
+
+	// lm 9.4
+	T0 = _mm_blend_epi16(M3, M2, 0xC0);
+	T1 = _mm_unpacklo_epi32(M0, M3);
+	T2 = _mm_blend_epi16(T0, T1, 0x0F);
+	B4 = _mm_shuffle_epi32(T2, _MM_SHUFFLE(0, 1, 2, 3));
+	R1 = _mm_add_epi32(_mm_add_epi32(R1, B4), R2);
+	R4 = _mm_xor_si128(R4, R1);
+	R4 = _mm_roti_epi32(R4, -8);
+	R3 = _mm_add_epi32(R3, R4);
+	R2 = _mm_xor_si128(R2, R3);
+	R2 = _mm_roti_epi32(R2, -7);
+	R4 = _mm_shuffle_epi32(R4, _MM_SHUFFLE(0, 3, 2, 1));
+	R3 = _mm_shuffle_epi32(R3, _MM_SHUFFLE(1, 0, 3, 2));
+	R2 = _mm_shuffle_epi32(R2, _MM_SHUFFLE(2, 1, 0, 3));
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State), _mm_xor_si128(FF0, _mm_xor_si128(R1, R3)));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 4), _mm_xor_si128(FF1, _mm_xor_si128(R2, R4)));
+}
+
+//~~~Blake2-512~~~//
+
+void Blake::PermuteR12P1024V(const byte* Input, ulong* State, const ulong* IV)
+{
+	const __m128i M0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input));
+	const __m128i M1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 16));
+	const __m128i M2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 32));
+	const __m128i M3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 48));
+	const __m128i M4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 64));
+	const __m128i M5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 80));
+	const __m128i M6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 96));
+	const __m128i M7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 112));
+	const __m128i R16 = _mm_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+	const __m128i R24 = _mm_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+	__m128i RL1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State));
+	__m128i RH1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 2));
+	__m128i RL2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 4));
+	__m128i RH2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 6));
+	__m128i RL3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IV));
+	__m128i RH3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IV + 2));
+	__m128i RL4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IV + 4));
+	__m128i RH4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IV + 6));
+	__m128i B0, B1;
+
+	// round 0
+	// lm 0.1
+	B0 = _mm_unpacklo_epi64(M0, M1);
+	B1 = _mm_unpacklo_epi64(M2, M3);
+	// g1
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	// lm 0.2
+	B0 = _mm_unpackhi_epi64(M0, M1);
+	B1 = _mm_unpackhi_epi64(M2, M3);
+	// g2
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+	// diag
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// lm 0.3
+	B0 = _mm_unpacklo_epi64(M4, M5);
+	B1 = _mm_unpacklo_epi64(M6, M7);
+	// g1
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	// lm 0.4
+	B0 = _mm_unpackhi_epi64(M4, M5);
+	B1 = _mm_unpackhi_epi64(M6, M7);
+	// g2
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+	// undiag
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 2
+	B0 = _mm_unpacklo_epi64(M7, M2);
+	B1 = _mm_unpackhi_epi64(M4, M6);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M5, M4);
+	B1 = _mm_alignr_epi8(M3, M7, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_shuffle_epi32(M0, _MM_SHUFFLE(1, 0, 3, 2));
+	B1 = _mm_unpackhi_epi64(M5, M2);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M6, M1);
+	B1 = _mm_unpackhi_epi64(M3, M1);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 3
+	B0 = _mm_alignr_epi8(M6, M5, 8);
+	B1 = _mm_unpackhi_epi64(M2, M7);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M4, M0);
+	B1 = _mm_blend_epi16(M1, M6, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_blend_epi16(M5, M1, 0xF0);
+	B1 = _mm_unpackhi_epi64(M3, M4);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M7, M3);
+	B1 = _mm_alignr_epi8(M2, M0, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 4
+	B0 = _mm_unpackhi_epi64(M3, M1);
+	B1 = _mm_unpackhi_epi64(M6, M5);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M4, M0);
+	B1 = _mm_unpacklo_epi64(M6, M7);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_blend_epi16(M1, M2, 0xF0);
+	B1 = _mm_blend_epi16(M2, M7, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M3, M5);
+	B1 = _mm_unpacklo_epi64(M0, M4);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 5
+	B0 = _mm_unpackhi_epi64(M4, M2);
+	B1 = _mm_unpacklo_epi64(M1, M5);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_blend_epi16(M0, M3, 0xF0);
+	B1 = _mm_blend_epi16(M2, M7, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_blend_epi16(M7, M5, 0xF0);
+	B1 = _mm_blend_epi16(M3, M1, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_alignr_epi8(M6, M0, 8);
+	B1 = _mm_blend_epi16(M4, M6, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 6
+	B0 = _mm_unpacklo_epi64(M1, M3);
+	B1 = _mm_unpacklo_epi64(M0, M4);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M6, M5);
+	B1 = _mm_unpackhi_epi64(M5, M1);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_blend_epi16(M2, M3, 0xF0);
+	B1 = _mm_unpackhi_epi64(M7, M0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M6, M2);
+	B1 = _mm_blend_epi16(M7, M4, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 7
+	B0 = _mm_blend_epi16(M6, M0, 0xF0);
+	B1 = _mm_unpacklo_epi64(M7, M2);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M2, M7);
+	B1 = _mm_alignr_epi8(M5, M6, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_unpacklo_epi64(M0, M3);
+	B1 = _mm_shuffle_epi32(M4, _MM_SHUFFLE(1, 0, 3, 2));
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M3, M1);
+	B1 = _mm_blend_epi16(M1, M5, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 8
+	B0 = _mm_unpackhi_epi64(M6, M3);
+	B1 = _mm_blend_epi16(M6, M1, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_alignr_epi8(M7, M5, 8);
+	B1 = _mm_unpackhi_epi64(M0, M4);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_unpackhi_epi64(M2, M7);
+	B1 = _mm_unpacklo_epi64(M4, M1);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M0, M2);
+	B1 = _mm_unpacklo_epi64(M3, M5);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 9
+	B0 = _mm_unpacklo_epi64(M3, M7);
+	B1 = _mm_alignr_epi8(M0, M5, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M7, M4);
+	B1 = _mm_alignr_epi8(M4, M1, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = M6;
+	B1 = _mm_alignr_epi8(M5, M0, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_blend_epi16(M1, M3, 0xF0);
+	B1 = M2;
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 10
+	B0 = _mm_unpacklo_epi64(M5, M4);
+	B1 = _mm_unpackhi_epi64(M3, M0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M1, M2);
+	B1 = _mm_blend_epi16(M3, M2, 0xF0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_unpackhi_epi64(M7, M4);
+	B1 = _mm_unpackhi_epi64(M1, M6);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_alignr_epi8(M7, M5, 8);
+	B1 = _mm_unpacklo_epi64(M6, M0);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 11
+	B0 = _mm_unpacklo_epi64(M0, M1);
+	B1 = _mm_unpacklo_epi64(M2, M3);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M0, M1);
+	B1 = _mm_unpackhi_epi64(M2, M3);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_unpacklo_epi64(M4, M5);
+	B1 = _mm_unpacklo_epi64(M6, M7);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpackhi_epi64(M4, M5);
+	B1 = _mm_unpackhi_epi64(M6, M7);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	// round 12
+	B0 = _mm_unpacklo_epi64(M7, M2);
+	B1 = _mm_unpackhi_epi64(M4, M6);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M5, M4);
+	B1 = _mm_alignr_epi8(M3, M7, 8);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	Diagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	B0 = _mm_shuffle_epi32(M0, _MM_SHUFFLE(1, 0, 3, 2));
+	B1 = _mm_unpackhi_epi64(M5, M2);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -32);
+	RH4 = _mm_roti_epi64(RH4, -32);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -24);
+	RH2 = _mm_roti_epi64(RH2, -24);
+
+	B0 = _mm_unpacklo_epi64(M6, M1);
+	B1 = _mm_unpackhi_epi64(M3, M1);
+	RL1 = _mm_add_epi64(_mm_add_epi64(RL1, B0), RL2);
+	RH1 = _mm_add_epi64(_mm_add_epi64(RH1, B1), RH2);
+	RL4 = _mm_xor_si128(RL4, RL1);
+	RH4 = _mm_xor_si128(RH4, RH1);
+	RL4 = _mm_roti_epi64(RL4, -16);
+	RH4 = _mm_roti_epi64(RH4, -16);
+	RL3 = _mm_add_epi64(RL3, RL4);
+	RH3 = _mm_add_epi64(RH3, RH4);
+	RL2 = _mm_xor_si128(RL2, RL3);
+	RH2 = _mm_xor_si128(RH2, RH3);
+	RL2 = _mm_roti_epi64(RL2, -63);
+	RH2 = _mm_roti_epi64(RH2, -63);
+
+	UnDiagonalize(RL2, RL3, RL4, RH2, RH3, RH4);
+
+	RL1 = _mm_xor_si128(RL3, RL1);
+	RH1 = _mm_xor_si128(RH3, RH1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State), _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State)), RL1));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 2), _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 2)), RH1));
+	RL2 = _mm_xor_si128(RL4, RL2);
+	RH2 = _mm_xor_si128(RH4, RH2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 4), _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 4)), RL2));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 6), _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 6)), RH2));
+}
+
+#undef _mm_roti_epi32
+#undef _mm_roti_epi64
+
+#endif
+
+NAMESPACE_DIGESTEND
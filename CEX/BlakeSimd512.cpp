@@ -0,0 +1,328 @@
+#include "Blake.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD512) && !defined(__AVX512__)
+#	error "BlakeSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+#	include "UInt512.h"
+#	include "ULong512.h"
+#endif
+
+NAMESPACE_DIGEST
+
+#if defined(CEX_KERNEL_SIMD512)
+
+using Numeric::UInt512;
+using Numeric::ULong512;
+
+namespace
+{
+	// the little-endian conversions are repeated here with internal linkage, 
+	// so that no helper is shared with the baseline translation units
+
+	uint LeBytesTo32(const byte* Input)
+	{
+		return static_cast<uint>(Input[0]) |
+			(static_cast<uint>(Input[1]) << 8) |
+			(static_cast<uint>(Input[2]) << 16) |
+			(static_cast<uint>(Input[3]) << 24);
+	}
+
+	ulong LeBytesTo64(const byte* Input)
+	{
+		return static_cast<ulong>(LeBytesTo32(Input)) | (static_cast<ulong>(LeBytesTo32(Input + 4)) << 32);
+	}
+}
+
+//~~~Blake2-256~~~//
+
+void Blake::PermuteR10P16x512H(const byte* Input, uint* State, const uint* IV)
+{
+	UInt512 M[16];
+	UInt512 R[16];
+	UInt512 S;
+	uint tmp[16];
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < 8; ++i)
+	{
+		R[i].Load(State, i * 16);
+		R[i + 8].Load(IV, i * 16);
+	}
+
+	// word i of every lane is gathered into one register, lane n reads the block at Input + (n * 64)
+	for (i = 0; i < 16; ++i)
+	{
+		for (j = 0; j < 16; ++j)
+		{
+			tmp[j] = LeBytesTo32(Input + (j * 64) + (i * sizeof(uint)));
+		}
+
+		M[i].Load(tmp, 0);
+	}
+
+	for (i = 0; i < 10; ++i)
+	{
+		// round n
+		R[0] += R[4] + M[Sigma256[(i * 16)]];
+		R[12] ^= R[0];
+		R[12] = ((R[12] >> 16) | (R[12] << (32 - 16)));
+		R[8] += R[12];
+		R[4] ^= R[8];
+		R[4] = ((R[4] >> 12) | (R[4] << (32 - 12)));
+		R[0] += R[4] + M[Sigma256[(i * 16) + 1]];
+		R[12] ^= R[0];
+		R[12] = ((R[12] >> 8) | (R[12] << (32 - 8)));
+		R[8] += R[12];
+		R[4] ^= R[8];
+		R[4] = ((R[4] >> 7) | (R[4] << (32 - 7)));
+
+		R[1] += R[5] + M[Sigma256[(i * 16) + 2]];
+		R[13] ^= R[1];
+		R[13] = ((R[13] >> 16) | (R[13] << (32 - 16)));
+		R[9] += R[13];
+		R[5] ^= R[9];
+		R[5] = ((R[5] >> 12) | (R[5] << (32 - 12)));
+		R[1] += R[5] + M[Sigma256[(i * 16) + 3]];
+		R[13] ^= R[1];
+		R[13] = ((R[13] >> 8) | (R[13] << (32 - 8)));
+		R[9] += R[13];
+		R[5] ^= R[9];
+		R[5] = ((R[5] >> 7) | (R[5] << (32 - 7)));
+
+		R[2] += R[6] + M[Sigma256[(i * 16) + 4]];
+		R[14] ^= R[2];
+		R[14] = ((R[14] >> 16) | (R[14] << (32 - 16)));
+		R[10] += R[14];
+		R[6] ^= R[10];
+		R[6] = ((R[6] >> 12) | (R[6] << (32 - 12)));
+		R[2] += R[6] + M[Sigma256[(i * 16) + 5]];
+		R[14] ^= R[2];
+		R[14] = ((R[14] >> 8) | (R[14] << (32 - 8)));
+		R[10] += R[14];
+		R[6] ^= R[10];
+		R[6] = ((R[6] >> 7) | (R[6] << (32 - 7)));
+
+		R[3] += R[7] + M[Sigma256[(i * 16) + 6]];
+		R[15] ^= R[3];
+		R[15] = ((R[15] >> 16) | (R[15] << (32 - 16)));
+		R[11] += R[15];
+		R[7] ^= R[11];
+		R[7] = ((R[7] >> 12) | (R[7] << (32 - 12)));
+		R[3] += R[7] + M[Sigma256[(i * 16) + 7]];
+		R[15] ^= R[3];
+		R[15] = ((R[15] >> 8) | (R[15] << (32 - 8)));
+		R[11] += R[15];
+		R[7] ^= R[11];
+		R[7] = ((R[7] >> 7) | (R[7] << (32 - 7)));
+
+		R[0] += R[5] + M[Sigma256[(i * 16) + 8]];
+		R[15] ^= R[0];
+		R[15] = ((R[15] >> 16) | (R[15] << (32 - 16)));
+		R[10] += R[15];
+		R[5] ^= R[10];
+		R[5] = ((R[5] >> 12) | (R[5] << (32 - 12)));
+		R[0] += R[5] + M[Sigma256[(i * 16) + 9]];
+		R[15] ^= R[0];
+		R[15] = ((R[15] >> 8) | (R[15] << (32 - 8)));
+		R[10] += R[15];
+		R[5] ^= R[10];
+		R[5] = ((R[5] >> 7) | (R[5] << (32 - 7)));
+
+		R[1] += R[6] + M[Sigma256[(i * 16) + 10]];
+		R[12] ^= R[1];
+		R[12] = ((R[12] >> 16) | (R[12] << (32 - 16)));
+		R[11] += R[12];
+		R[6] ^= R[11];
+		R[6] = ((R[6] >> 12) | (R[6] << (32 - 12)));
+		R[1] += R[6] + M[Sigma256[(i * 16) + 11]];
+		R[12] ^= R[1];
+		R[12] = ((R[12] >> 8) | (R[12] << (32 - 8)));
+		R[11] += R[12];
+		R[6] ^= R[11];
+		R[6] = ((R[6] >> 7) | (R[6] << (32 - 7)));
+
+		R[2] += R[7] + M[Sigma256[(i * 16) + 12]];
+		R[13] ^= R[2];
+		R[13] = ((R[13] >> 16) | (R[13] << (32 - 16)));
+		R[8] += R[13];
+		R[7] ^= R[8];
+		R[7] = ((R[7] >> 12) | (R[7] << (32 - 12)));
+		R[2] += R[7] + M[Sigma256[(i * 16) + 13]];
+		R[13] ^= R[2];
+		R[13] = ((R[13] >> 8) | (R[13] << (32 - 8)));
+		R[8] += R[13];
+		R[7] ^= R[8];
+		R[7] = ((R[7] >> 7) | (R[7] << (32 - 7)));
+
+		R[3] += R[4] + M[Sigma256[(i * 16) + 14]];
+		R[14] ^= R[3];
+		R[14] = ((R[14] >> 16) | (R[14] << (32 - 16)));
+		R[9] += R[14];
+		R[4] ^= R[9];
+		R[4] = ((R[4] >> 12) | (R[4] << (32 - 12)));
+		R[3] += R[4] + M[Sigma256[(i * 16) + 15]];
+		R[14] ^= R[3];
+		R[14] = ((R[14] >> 8) | (R[14] << (32 - 8)));
+		R[9] += R[14];
+		R[4] ^= R[9];
+		R[4] = ((R[4] >> 7) | (R[4] << (32 - 7)));
+	}
+
+	for (i = 0; i < 8; ++i)
+	{
+		S.Load(State, i * 16);
+		S ^= R[i] ^ R[i + 8];
+		S.Store(State, i * 16);
+	}
+}
+
+//~~~Blake2-512~~~//
+
+void Blake::PermuteR12P8x1024H(const byte* Input, ulong* State, const ulong* IV)
+{
+	ULong512 M[16];
+	ULong512 R[16];
+	ULong512 S;
+	ulong tmp[8];
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < 8; ++i)
+	{
+		R[i].Load(State, i * 8);
+		R[i + 8].Load(IV, i * 8);
+	}
+
+	// word i of every lane is gathered into one register, lane n reads the block at Input + (n * 128)
+	for (i = 0; i < 16; ++i)
+	{
+		for (j = 0; j < 8; ++j)
+		{
+			tmp[j] = LeBytesTo64(Input + (j * 128) + (i * sizeof(ulong)));
+		}
+
+		M[i].Load(tmp, 0);
+	}
+
+	for (i = 0; i < 12; ++i)
+	{
+		// round 0
+		R[0] += R[4] + M[Sigma512[(i * 16)]];
+		R[12] ^= R[0];
+		R[12] = ((R[12] >> 32) | (R[12] << (64 - 32)));
+		R[8] += R[12];
+		R[4] ^= R[8];
+		R[4] = ((R[4] >> 24) | (R[4] << (64 - 24)));
+		R[0] += R[4] + M[Sigma512[(i * 16) + 1]];
+		R[12] ^= R[0];
+		R[12] = ((R[12] >> 16) | (R[12] << (64 - 16)));
+		R[8] += R[12];
+		R[4] ^= R[8];
+		R[4] = ((R[4] >> 63) | (R[4] << (64 - 63)));
+
+		R[1] += R[5] + M[Sigma512[(i * 16) + 2]];
+		R[13] ^= R[1];
+		R[13] = ((R[13] >> 32) | (R[13] << (64 - 32)));
+		R[9] += R[13];
+		R[5] ^= R[9];
+		R[5] = ((R[5] >> 24) | (R[5] << (64 - 24)));
+		R[1] += R[5] + M[Sigma512[(i * 16) + 3]];
+		R[13] ^= R[1];
+		R[13] = ((R[13] >> 16) | (R[13] << (64 - 16)));
+		R[9] += R[13];
+		R[5] ^= R[9];
+		R[5] = ((R[5] >> 63) | (R[5] << (64 - 63)));
+
+		R[2] += R[6] + M[Sigma512[(i * 16) + 4]];
+		R[14] ^= R[2];
+		R[14] = ((R[14] >> 32) | (R[14] << (64 - 32)));
+		R[10] += R[14];
+		R[6] ^= R[10];
+		R[6] = ((R[6] >> 24) | (R[6] << (64 - 24)));
+		R[2] += R[6] + M[Sigma512[(i * 16) + 5]];
+		R[14] ^= R[2];
+		R[14] = ((R[14] >> 16) | (R[14] << (64 - 16)));
+		R[10] += R[14];
+		R[6] ^= R[10];
+		R[6] = ((R[6] >> 63) | (R[6] << (64 - 63)));
+
+		R[3] += R[7] + M[Sigma512[(i * 16) + 6]];
+		R[15] ^= R[3];
+		R[15] = ((R[15] >> 32) | (R[15] << (64 - 32)));
+		R[11] += R[15];
+		R[7] ^= R[11];
+		R[7] = ((R[7] >> 24) | (R[7] << (64 - 24)));
+		R[3] += R[7] + M[Sigma512[(i * 16) + 7]];
+		R[15] ^= R[3];
+		R[15] = ((R[15] >> 16) | (R[15] << (64 - 16)));
+		R[11] += R[15];
+		R[7] ^= R[11];
+		R[7] = ((R[7] >> 63) | (R[7] << (64 - 63)));
+
+		R[0] += R[5] + M[Sigma512[(i * 16) + 8]];
+		R[15] ^= R[0];
+		R[15] = ((R[15] >> 32) | (R[15] << (64 - 32)));
+		R[10] += R[15];
+		R[5] ^= R[10];
+		R[5] = ((R[5] >> 24) | (R[5] << (64 - 24)));
+		R[0] += R[5] + M[Sigma512[(i * 16) + 9]];
+		R[15] ^= R[0];
+		R[15] = ((R[15] >> 16) | (R[15] << (64 - 16)));
+		R[10] += R[15];
+		R[5] ^= R[10];
+		R[5] = ((R[5] >> 63) | (R[5] << (64 - 63)));
+
+		R[1] += R[6] + M[Sigma512[(i * 16) + 10]];
+		R[12] ^= R[1];
+		R[12] = ((R[12] >> 32) | (R[12] << (64 - 32)));
+		R[11] += R[12];
+		R[6] ^= R[11];
+		R[6] = ((R[6] >> 24) | (R[6] << (64 - 24)));
+		R[1] += R[6] + M[Sigma512[(i * 16) + 11]];
+		R[12] ^= R[1];
+		R[12] = ((R[12] >> 16) | (R[12] << (64 - 16)));
+		R[11] += R[12];
+		R[6] ^= R[11];
+		R[6] = ((R[6] >> 63) | (R[6] << (64 - 63)));
+
+		R[2] += R[7] + M[Sigma512[(i * 16) + 12]];
+		R[13] ^= R[2];
+		R[13] = ((R[13] >> 32) | (R[13] << (64 - 32)));
+		R[8] += R[13];
+		R[7] ^= R[8];
+		R[7] = ((R[7] >> 24) | (R[7] << (64 - 24)));
+		R[2] += R[7] + M[Sigma512[(i * 16) + 13]];
+		R[13] ^= R[2];
+		R[13] = ((R[13] >> 16) | (R[13] << (64 - 16)));
+		R[8] += R[13];
+		R[7] ^= R[8];
+		R[7] = ((R[7] >> 63) | (R[7] << (64 - 63)));
+
+		R[3] += R[4] + M[Sigma512[(i * 16) + 14]];
+		R[14] ^= R[3];
+		R[14] = ((R[14] >> 32) | (R[14] << (64 - 32)));
+		R[9] += R[14];
+		R[4] ^= R[9];
+		R[4] = ((R[4] >> 24) | (R[4] << (64 - 24)));
+		R[3] += R[4] + M[Sigma512[(i * 16) + 15]];
+		R[14] ^= R[3];
+		R[14] = ((R[14] >> 16) | (R[14] << (64 - 16)));
+		R[9] += R[14];
+		R[4] ^= R[9];
+		R[4] = ((R[4] >> 63) | (R[4] << (64 - 63)));
+	}
+
+	for (i = 0; i < 8; ++i)
+	{
+		S.Load(State, i * 8);
+		S ^= R[i] ^ R[i + 8];
+		S.Store(State, i * 8);
+	}
+}
+
+#endif
+
+NAMESPACE_DIGESTEND
@@ -1,8 +1,10 @@
 #include "CBC.h"
 #include "BlockCipherFromName.h"
 #include "IntegerTools.h"
+#include "LaneScheduler.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_MODE
 
@@ -52,6 +54,7 @@ CBC::CBC(BlockCiphers CipherType)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CBC), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::CBC, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 CBC::CBC(IBlockCipher* Cipher)
@@ -61,6 +64,7 @@ CBC::CBC(IBlockCipher* Cipher)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CBC), std::string("Constructor"), std::string("The cipher type can not be null!"), ErrorCodes::IllegalOperation)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::CBC, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 CBC::~CBC()
@@ -165,6 +169,60 @@ void CBC::DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Decrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void CBC::EncryptBatch(const std::vector<std::vector<byte>> &Nonces, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	size_t i;
+	size_t tlen;
+
+	if (!IsInitialized() || !IsEncryption())
+	{
+		throw CryptoCipherModeException(Name(), std::string("EncryptBatch"), std::string("The cipher mode has not been initialized for encryption!"), ErrorCodes::NotInitialized);
+	}
+	if (Nonces.size() != Input.size())
+	{
+		throw CryptoCipherModeException(Name(), std::string("EncryptBatch"), std::string("The nonce and input arrays must be the same size!"), ErrorCodes::InvalidSize);
+	}
+
+	tlen = 0;
+
+	for (i = 0; i < Input.size(); ++i)
+	{
+		if (Nonces[i].size() != BLOCK_SIZE)
+		{
+			throw CryptoCipherModeException(Name(), std::string("EncryptBatch"), std::string("Invalid nonce size; each nonce must be the block-size in length!"), ErrorCodes::InvalidNonce);
+		}
+		if (Input[i].size() % BLOCK_SIZE != 0)
+		{
+			throw CryptoCipherModeException(Name(), std::string("EncryptBatch"), std::string("The message length must be evenly divisible by the block-size!"), ErrorCodes::InvalidSize);
+		}
+
+		tlen += Input[i].size();
+	}
+
+	Output.resize(Input.size());
+
+	for (i = 0; i < Input.size(); ++i)
+	{
+		Output[i].resize(Input[i].size());
+	}
+
+	if (m_parallelProfile.IsParallel() && tlen >= m_parallelProfile.ParallelBlockSize() && Input.size() >= m_parallelProfile.ParallelMaxDegree() * LaneScheduler::MAX_LANES)
+	{
+		const size_t MSGCNT = Input.size();
+		const size_t THDCNT = m_parallelProfile.ParallelMaxDegree();
+
+		// each thread interleaves the chains of a contiguous range of messages
+		Utility::ParallelTools::ParallelFor(0, THDCNT, [this, &Nonces, &Input, &Output, MSGCNT, THDCNT](size_t i)
+		{
+			this->EncryptLanes(Nonces, Input, Output, (MSGCNT * i) / THDCNT, (MSGCNT * (i + 1)) / THDCNT);
+		});
+	}
+	else
+	{
+		EncryptLanes(Nonces, Input, Output, 0, Input.size());
+	}
+}
+
 void CBC::EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
 {
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
@@ -277,7 +335,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 
 	bctr = BlockCount;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 	if (bctr > 15)
 	{
 		// 512bit avx512
@@ -300,7 +358,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 			m_blockCipher->Transform2048(Input, InOffset, Output, OutOffset);
 			// xor the set
 			MemoryTools::XOR1024(tmpv, 0, Output, OutOffset);
-			MemoryTools::XOR1024(tmpv + 128, 0, Output, OutOffset + 128);
+			MemoryTools::XOR1024(tmpv, 128, Output, OutOffset + 128);
 			// swap iv
 			MemoryTools::Copy(tmpn, 0, tmpv, 0, AVX512BLK);
 			InOffset += AVX512BLK;
@@ -311,7 +369,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 
 		MemoryTools::COPY128(tmpn, 0, Iv, 0);
 	}
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 	if (bctr > 7)
 	{
 		// 256bit avx2
@@ -344,7 +402,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 
 		MemoryTools::COPY128(tmpn, 0, Iv, 0);
 	}
-#elif defined(__AVX__)
+#elif defined(CEX_KERNEL_SIMD128)
 	if (bctr > 3)
 	{
 		// 128bit avx
@@ -400,6 +458,26 @@ void CBC::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	MemoryTools::COPY128(Output, OutOffset, m_cbcState->IV, 0);
 }
 
+void CBC::EncryptLanes(const std::vector<std::vector<byte>> &Nonces, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, size_t Start, size_t End)
+{
+	// the nonce is the first chain value, each ciphertext block is the next
+	LaneScheduler::Process(m_blockCipher.get(), Start, End,
+		[&Nonces, &Input](size_t Message, std::vector<byte> &State, size_t Offset)
+		{
+			MemoryTools::COPY128(Nonces[Message], 0, State, Offset);
+
+			return Input[Message].size() / BLOCK_SIZE;
+		},
+		[&Input](size_t Message, size_t Block, std::vector<byte> &State, size_t Offset)
+		{
+			MemoryTools::XOR128(Input[Message], Block * BLOCK_SIZE, State, Offset);
+		},
+		[&Output](size_t Message, size_t Block, const std::vector<byte> &State, size_t Offset)
+		{
+			MemoryTools::COPY128(State, Offset, Output[Message], Block * BLOCK_SIZE);
+		});
+}
+
 void CBC::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
 {
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the the block-size!");
@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_MODE
 
@@ -55,6 +56,7 @@ CFB::CFB(BlockCiphers CipherType, size_t RegisterSize)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CFB), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
 	m_parallelProfile(m_blockCipher->BlockSize(), false, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::CFB, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 CFB::CFB(IBlockCipher* Cipher, size_t RegisterSize)
@@ -64,6 +66,7 @@ CFB::CFB(IBlockCipher* Cipher, size_t RegisterSize)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CFB), std::string("Constructor"), std::string("The cipher type can not be null!"), ErrorCodes::IllegalOperation)),
 	m_parallelProfile(m_blockCipher->BlockSize(), false, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::CFB, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 CFB::~CFB()
@@ -1,10 +1,12 @@
 #include "CMAC.h"
 #include "IntegerTools.h"
+#include "LaneScheduler.h"
 
 NAMESPACE_MAC
 
 using Enumeration::BlockCipherConvert;
 using Cipher::Block::Mode::CBC;
+using Cipher::Block::Mode::LaneScheduler;
 using Utility::IntegerTools;
 using Enumeration::MacConvert;
 using Utility::MemoryTools;
@@ -134,6 +136,11 @@ const bool CMAC::IsInitialized()
 	return m_isInitialized;
 }
 
+const size_t CMAC::LaneCount()
+{
+	return UPDATE_LANES;
+}
+
 //~~~Public Functions~~~//
 
 void CMAC::Clear()
@@ -162,6 +169,57 @@ void CMAC::Compute(const std::vector<byte> &Input, std::vector<byte> &Output)
 	Finalize(Output, 0);
 }
 
+void CMAC::Compute(const std::vector<std::vector<byte>> &Inputs, std::vector<std::vector<byte>> &Outputs)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoMacException(Name(), std::string("Compute"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	const std::vector<byte> K1 = m_luKey->Key();
+	const std::vector<byte> K2 = m_luKey->Nonce();
+	const size_t TAGLEN = TagSize();
+	std::vector<byte> tmpf(BLOCK_SIZE);
+
+	Outputs.resize(Inputs.size());
+
+	// each chain starts from a zero block, an empty message is a single padded block
+	LaneScheduler::Process(m_cbcMode->Engine(), 0, Inputs.size(),
+		[&Inputs](size_t Message, std::vector<byte> &State, size_t Offset)
+		{
+			MemoryTools::Clear(State, Offset, BLOCK_SIZE);
+
+			return (Inputs[Message].size() == 0) ? 1 : (Inputs[Message].size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+		},
+		[&Inputs, &K1, &K2, &tmpf](size_t Message, size_t Block, std::vector<byte> &State, size_t Offset)
+		{
+			const size_t RMDLEN = Inputs[Message].size() - (Block * BLOCK_SIZE);
+
+			if (RMDLEN > BLOCK_SIZE)
+			{
+				MemoryTools::XOR128(Inputs[Message], Block * BLOCK_SIZE, State, Offset);
+			}
+			else
+			{
+				// the final block is padded if partial, and mixed with the sub-key
+				MemoryTools::Copy(Inputs[Message], Block * BLOCK_SIZE, tmpf, 0, RMDLEN);
+				Pad(tmpf, RMDLEN, BLOCK_SIZE);
+				MemoryTools::XOR128((RMDLEN == BLOCK_SIZE) ? K1 : K2, 0, tmpf, 0);
+				MemoryTools::XOR128(tmpf, 0, State, Offset);
+			}
+		},
+		[&Inputs, &Outputs, TAGLEN](size_t Message, size_t Block, const std::vector<byte> &State, size_t Offset)
+		{
+			if ((Block + 1) * BLOCK_SIZE >= Inputs[Message].size())
+			{
+				Outputs[Message].resize(TAGLEN);
+				MemoryTools::Copy(State, Offset, Outputs[Message], 0, TAGLEN);
+			}
+		});
+
+	MemoryTools::Clear(tmpf, 0, tmpf.size());
+}
+
 size_t CMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (!IsInitialized())
@@ -301,6 +359,37 @@ void CMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 	}
 }
 
+void CMAC::UpdateLanes(std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoMacException(Name(), std::string("UpdateLanes"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (Input.size() < UPDATE_LANES * BLOCK_SIZE || Output.size() < UPDATE_LANES * BLOCK_SIZE)
+	{
+		throw CryptoMacException(Name(), std::string("UpdateLanes"), std::string("The lane arrays are too short!"), ErrorCodes::InvalidSize);
+	}
+
+	if (m_cmacState->Position == BLOCK_SIZE)
+	{
+		// the first lane continues the CBC chain, as the next EncryptBlock call would have
+		MemoryTools::COPY128(m_cbcMode->IV(), 0, Input, 0);
+		MemoryTools::XOR128(m_cmacState->Buffer, 0, Input, 0);
+		LaneScheduler::Transform(m_cbcMode->Engine(), Input, Output, UPDATE_LANES);
+		MemoryTools::COPY128(Output, 0, m_cbcMode->IV(), 0);
+		MemoryTools::COPY128(Output, 0, m_cmacState->State, 0);
+		m_cmacState->Position = 0;
+	}
+	else
+	{
+		LaneScheduler::Transform(m_cbcMode->Engine(), Input, Output, UPDATE_LANES);
+	}
+
+	// the chain value does not leave the MAC
+	MemoryTools::Clear(Input, 0, BLOCK_SIZE);
+	MemoryTools::Clear(Output, 0, BLOCK_SIZE);
+}
+
 //~~~Private Functions~~~//
 
 void CMAC::DoubleLu(const std::vector<byte> &Input, std::vector<byte> &Output)
@@ -349,5 +438,4 @@ uint CMAC::ShiftLeft(const std::vector<byte> &Input, std::vector<byte> &Output)
 	return bit;
 }
 
-
 NAMESPACE_MACEND
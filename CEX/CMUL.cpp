@@ -1,6 +1,7 @@
 #include "CMUL.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 #	include "Intrinsics.h"
 #endif
 
@@ -1110,7 +1111,7 @@ void CMUL::PermuteR128P128C(std::array<ulong, CMUL_STATE_SIZE> &State, std::arra
 
 void CMUL::PermuteR128P128V(std::array<ulong, CMUL_STATE_SIZE> &State, std::array<byte, CMUL_BLOCK_SIZE> &Output)
 {
-#if defined(__AVX2__)
+#if defined(CEX_AVX_INTRINSICS)
 
 	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
 	__m128i A;
@@ -1171,4 +1172,200 @@ void CMUL::PermuteR128P128V(std::array<ulong, CMUL_STATE_SIZE> &State, std::arra
 #endif
 }
 
+void CMUL::PermuteR128P512V(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output)
+{
+#if defined(CEX_AVX_INTRINSICS)
+
+	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m128i H;
+	__m128i L;
+	__m128i M;
+	__m128i X;
+
+	X = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Output.data()));
+	X = _mm_shuffle_epi8(X, MASK);
+	H = _mm_setzero_si128();
+	L = _mm_setzero_si128();
+	M = _mm_setzero_si128();
+
+	// the 4 blocks are multiplied by H^4..H^1, the last entries in the table
+	MultiplyBlocksV(Table, CMUL_TABLE_SIZE - 4, Input, InOffset, X, 4, L, M, H);
+	X = ReduceV(L, M, H);
+	X = _mm_shuffle_epi8(X, MASK);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data()), X);
+
+#else
+	PermuteBlocksC(Table, Input, InOffset, Output, 4);
+#endif
+}
+
+void CMUL::PermuteR128P1024V(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output)
+{
+#if defined(CEX_KERNEL_VPCLMUL512)
+	if (WideProfile() == SimdProfiles::Simd512)
+	{
+		PermuteW512(Table.data(), Input.data() + InOffset, Output.data());
+		return;
+	}
+#endif
+
+#if defined(CEX_AVX_INTRINSICS)
+
+	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m128i H;
+	__m128i L;
+	__m128i M;
+	__m128i X;
+
+	X = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Output.data()));
+	X = _mm_shuffle_epi8(X, MASK);
+	H = _mm_setzero_si128();
+	L = _mm_setzero_si128();
+	M = _mm_setzero_si128();
+
+	MultiplyBlocksV(Table, 0, Input, InOffset, X, 8, L, M, H);
+	X = ReduceV(L, M, H);
+	X = _mm_shuffle_epi8(X, MASK);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data()), X);
+
+#else
+	PermuteBlocksC(Table, Input, InOffset, Output, 8);
+#endif
+}
+
+SimdProfiles CMUL::WideProfile()
+{
+	// thread-safe static initialization; resolved on the first call
+	static const SimdProfiles PROFILE = WideDetect();
+
+	return PROFILE;
+}
+
+//~~~Private Functions~~~//
+
+void CMUL::PermuteBlocksC(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output, size_t BlockCount)
+{
+	// the last table entry is H^1
+	std::array<ulong, CMUL_STATE_SIZE> state = { Table[(CMUL_TABLE_SIZE - 1) * CMUL_STATE_SIZE], Table[((CMUL_TABLE_SIZE - 1) * CMUL_STATE_SIZE) + 1] };
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < BlockCount; ++i)
+	{
+		for (j = 0; j < CMUL_BLOCK_SIZE; ++j)
+		{
+			Output[j] ^= Input[InOffset + (i * CMUL_BLOCK_SIZE) + j];
+		}
+
+#if defined(CEX_DIGEST_COMPACT)
+		PermuteR128P128C(state, Output);
+#else
+		PermuteR128P128U(state, Output);
+#endif
+	}
+}
+
+SimdProfiles CMUL::WideDetect()
+{
+	SimdProfiles prf;
+
+	prf = SimdProfiles::None;
+
+#if defined(CEX_KERNEL_VPCLMUL512)
+	if (CpuDetect::SimdProfile() == SimdProfiles::Simd512)
+	{
+		CpuDetect dtc;
+
+		if (dtc.AVX512BW() && dtc.VPCLMULQDQ())
+		{
+			prf = SimdProfiles::Simd512;
+		}
+	}
+#endif
+
+	return prf;
+}
+
+#if defined(CEX_AVX_INTRINSICS)
+
+void CMUL::MultiplyBlocksV(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, size_t TableOffset, const std::vector<byte> &Input, size_t InOffset,
+	const __m128i &State, size_t BlockCount, __m128i &Low, __m128i &Middle, __m128i &High)
+{
+	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m128i A;
+	__m128i B;
+	size_t i;
+
+	for (i = 0; i < BlockCount; ++i)
+	{
+		A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + (i * CMUL_BLOCK_SIZE)));
+		A = _mm_shuffle_epi8(A, MASK);
+
+		if (i == 0)
+		{
+			A = _mm_xor_si128(A, State);
+		}
+
+		// swapping the state words forms the 128-bit key
+		B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Table.data() + ((TableOffset + i) * CMUL_STATE_SIZE)));
+		B = _mm_shuffle_epi32(B, 0x4E);
+
+		// accumulate the unreduced products
+		Low = _mm_xor_si128(Low, _mm_clmulepi64_si128(A, B, 0x00));
+		Middle = _mm_xor_si128(Middle, _mm_clmulepi64_si128(A, B, 0x01));
+		Middle = _mm_xor_si128(Middle, _mm_clmulepi64_si128(A, B, 0x10));
+		High = _mm_xor_si128(High, _mm_clmulepi64_si128(A, B, 0x11));
+	}
+}
+
+__m128i CMUL::ReduceV(__m128i Low, __m128i Middle, __m128i High)
+{
+	__m128i T0;
+	__m128i T1;
+	__m128i T2;
+	__m128i T3;
+	__m128i T4;
+	__m128i T5;
+
+	T0 = Low;
+	T1 = Middle;
+	T3 = High;
+	T2 = _mm_slli_si128(T1, 8);
+	T1 = _mm_srli_si128(T1, 8);
+	T0 = _mm_xor_si128(T0, T2);
+	T3 = _mm_xor_si128(T3, T1);
+	T4 = _mm_srli_epi32(T0, 31);
+	T0 = _mm_slli_epi32(T0, 1);
+	T5 = _mm_srli_epi32(T3, 31);
+	T3 = _mm_slli_epi32(T3, 1);
+	T2 = _mm_srli_si128(T4, 12);
+	T5 = _mm_slli_si128(T5, 4);
+	T4 = _mm_slli_si128(T4, 4);
+	T0 = _mm_or_si128(T0, T4);
+	T3 = _mm_or_si128(T3, T5);
+	T3 = _mm_or_si128(T3, T2);
+	T4 = _mm_slli_epi32(T0, 31);
+	T5 = _mm_slli_epi32(T0, 30);
+	T2 = _mm_slli_epi32(T0, 25);
+	T4 = _mm_xor_si128(T4, T5);
+	T4 = _mm_xor_si128(T4, T2);
+	T5 = _mm_srli_si128(T4, 4);
+	T3 = _mm_xor_si128(T3, T5);
+	T4 = _mm_slli_si128(T4, 12);
+	T0 = _mm_xor_si128(T0, T4);
+	T3 = _mm_xor_si128(T3, T0);
+	T4 = _mm_srli_epi32(T0, 1);
+	T1 = _mm_srli_epi32(T0, 2);
+	T2 = _mm_srli_epi32(T0, 7);
+	T3 = _mm_xor_si128(T3, T1);
+	T3 = _mm_xor_si128(T3, T2);
+	T3 = _mm_xor_si128(T3, T4);
+
+	return T3;
+}
+
+#endif
+
 NAMESPACE_NUMERICEND
\ No newline at end of file
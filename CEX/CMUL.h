@@ -20,9 +20,15 @@
 #define CEX_CMUL_H
 
 #include "CexDomain.h"
+#include "SimdProfiles.h"
+#if defined(CEX_AVX_INTRINSICS)
+#	include "Intrinsics.h"
+#endif
 
 NAMESPACE_NUMERIC
 
+using Enumeration::SimdProfiles;
+
 class CMUL
 {
 public:
@@ -37,6 +43,11 @@ public:
 	/// </summary>
 	static const size_t CMUL_STATE_SIZE = 2;
 
+	/// <summary>
+	/// The number of precomputed powers of H in the multi-block key table
+	/// </summary>
+	static const size_t CMUL_TABLE_SIZE = 8;
+
 	/// <summary>
 	/// The compact form of the 128 round (standard) CMUL permutation function.
 	/// <para>This function has been optimized for a small memory consumption.
@@ -65,6 +76,47 @@ public:
 	/// <param name="State">The permutations uint64 state array</param>
 	/// <param name="Output">The output buffer receiving the permuted state</param>
 	static void PermuteR128P128V(std::array<ulong, CMUL_STATE_SIZE> &State, std::array<byte, CMUL_BLOCK_SIZE> &Output);
+
+	/// <summary>
+	/// The 4 block aggregated form of the vectorized CMUL permutation function.
+	/// <para>Multiplies 4 consecutive input blocks by H^4..H^1 taken from the key table, the first block is combined with the output state,
+	/// and a single reduction is performed on the sum of the products. This function uses the SIMD instructions.</para>
+	/// </summary>
+	/// 
+	/// <param name="Table">The key table containing the powers H^8..H^1, in descending order</param>
+	/// <param name="Input">The input array containing the message blocks</param>
+	/// <param name="InOffset">The starting offset within the input array</param>
+	/// <param name="Output">The output buffer containing the running state, and receiving the permuted state</param>
+	static void PermuteR128P512V(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output);
+
+	/// <summary>
+	/// The 8 block aggregated form of the vectorized CMUL permutation function.
+	/// <para>Multiplies 8 consecutive input blocks by H^8..H^1 taken from the key table, the first block is combined with the output state,
+	/// and a single reduction is performed on the sum of the products. 
+	/// Uses the 512-bit VPCLMULQDQ kernel when the processor supports AVX512 (F and BW) and VPCLMULQDQ, otherwise the 128-bit SIMD instructions.</para>
+	/// </summary>
+	/// 
+	/// <param name="Table">The key table containing the powers H^8..H^1, in descending order</param>
+	/// <param name="Input">The input array containing the message blocks</param>
+	/// <param name="InOffset">The starting offset within the input array</param>
+	/// <param name="Output">The output buffer containing the running state, and receiving the permuted state</param>
+	static void PermuteR128P1024V(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output);
+
+private:
+
+	static void PermuteBlocksC(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output, size_t BlockCount);
+	static SimdProfiles WideDetect();
+	static SimdProfiles WideProfile();
+
+#if defined(CEX_KERNEL_VPCLMUL512)
+	static void PermuteW512(const ulong* Table, const byte* Input, byte* Output);
+#endif
+
+#if defined(CEX_AVX_INTRINSICS)
+	static void MultiplyBlocksV(const std::array<ulong, CMUL_STATE_SIZE * CMUL_TABLE_SIZE> &Table, size_t TableOffset, const std::vector<byte> &Input, size_t InOffset, 
+		const __m128i &State, size_t BlockCount, __m128i &Low, __m128i &Middle, __m128i &High);
+	static __m128i ReduceV(__m128i Low, __m128i Middle, __m128i High);
+#endif
 };
 
 NAMESPACE_NUMERICEND
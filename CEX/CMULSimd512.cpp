@@ -0,0 +1,113 @@
+#include "CMUL.h"
+#if defined(CEX_KERNEL_VPCLMUL512)
+#	include "Intrinsics.h"
+#endif
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_VPCLMUL512) && !defined(__AVX512__)
+#	error "CMULSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f -mavx512bw -mvpclmulqdq)"
+#endif
+#if defined(CEX_KERNEL_VPCLMUL512) && !defined(CEX_COMPILER_MSC) && (!defined(__VPCLMULQDQ__) || !defined(__AVX512BW__))
+#	error "CMULSimd512.cpp must be compiled with the AVX512BW and VPCLMULQDQ instructions enabled (-mavx512bw -mvpclmulqdq)"
+#endif
+
+NAMESPACE_NUMERIC
+
+#if defined(CEX_KERNEL_VPCLMUL512)
+
+void CMUL::PermuteW512(const ulong* Table, const byte* Input, byte* Output)
+{
+	// multiplies 8 blocks by H^8..H^1 in two registers of four lanes, the unreduced products are folded and reduced once;
+	// the kernel uses only raw pointers and intrinsics, no out-of-line code is shared with the baseline translation units
+	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m512i MASKW = _mm512_broadcast_i32x4(MASK);
+	__m512i A0;
+	__m512i A1;
+	__m512i B0;
+	__m512i B1;
+	__m512i HW;
+	__m512i LW;
+	__m512i MW;
+	__m128i H;
+	__m128i L;
+	__m128i M;
+	__m128i T0;
+	__m128i T1;
+	__m128i T2;
+	__m128i T3;
+	__m128i T4;
+	__m128i T5;
+	__m128i X;
+
+	X = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Output));
+	X = _mm_shuffle_epi8(X, MASK);
+
+	// each 512-bit register holds 4 blocks, the state is added to the first block
+	A0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input));
+	A1 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (4 * CMUL_BLOCK_SIZE)));
+	A0 = _mm512_shuffle_epi8(A0, MASKW);
+	A1 = _mm512_shuffle_epi8(A1, MASKW);
+	A0 = _mm512_xor_si512(A0, _mm512_inserti32x4(_mm512_setzero_si512(), X, 0));
+
+	// H^8..H^5 and H^4..H^1, the swapped state words form the 128-bit key
+	B0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Table));
+	B1 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Table + (4 * CMUL_STATE_SIZE)));
+	B0 = _mm512_shuffle_epi32(B0, static_cast<_MM_PERM_ENUM>(0x4E));
+	B1 = _mm512_shuffle_epi32(B1, static_cast<_MM_PERM_ENUM>(0x4E));
+
+	LW = _mm512_xor_si512(_mm512_clmulepi64_epi128(A0, B0, 0x00), _mm512_clmulepi64_epi128(A1, B1, 0x00));
+	MW = _mm512_xor_si512(_mm512_clmulepi64_epi128(A0, B0, 0x01), _mm512_clmulepi64_epi128(A0, B0, 0x10));
+	MW = _mm512_xor_si512(MW, _mm512_clmulepi64_epi128(A1, B1, 0x01));
+	MW = _mm512_xor_si512(MW, _mm512_clmulepi64_epi128(A1, B1, 0x10));
+	HW = _mm512_xor_si512(_mm512_clmulepi64_epi128(A0, B0, 0x11), _mm512_clmulepi64_epi128(A1, B1, 0x11));
+
+	// fold the 4 lanes of unreduced products
+	L = _mm_xor_si128(_mm512_extracti32x4_epi32(LW, 0), _mm512_extracti32x4_epi32(LW, 1));
+	L = _mm_xor_si128(L, _mm_xor_si128(_mm512_extracti32x4_epi32(LW, 2), _mm512_extracti32x4_epi32(LW, 3)));
+	M = _mm_xor_si128(_mm512_extracti32x4_epi32(MW, 0), _mm512_extracti32x4_epi32(MW, 1));
+	M = _mm_xor_si128(M, _mm_xor_si128(_mm512_extracti32x4_epi32(MW, 2), _mm512_extracti32x4_epi32(MW, 3)));
+	H = _mm_xor_si128(_mm512_extracti32x4_epi32(HW, 0), _mm512_extracti32x4_epi32(HW, 1));
+	H = _mm_xor_si128(H, _mm_xor_si128(_mm512_extracti32x4_epi32(HW, 2), _mm512_extracti32x4_epi32(HW, 3)));
+
+	// the reduction is repeated here rather than calling ReduceV, which is built with the baseline instruction set
+	T0 = L;
+	T1 = M;
+	T3 = H;
+	T2 = _mm_slli_si128(T1, 8);
+	T1 = _mm_srli_si128(T1, 8);
+	T0 = _mm_xor_si128(T0, T2);
+	T3 = _mm_xor_si128(T3, T1);
+	T4 = _mm_srli_epi32(T0, 31);
+	T0 = _mm_slli_epi32(T0, 1);
+	T5 = _mm_srli_epi32(T3, 31);
+	T3 = _mm_slli_epi32(T3, 1);
+	T2 = _mm_srli_si128(T4, 12);
+	T5 = _mm_slli_si128(T5, 4);
+	T4 = _mm_slli_si128(T4, 4);
+	T0 = _mm_or_si128(T0, T4);
+	T3 = _mm_or_si128(T3, T5);
+	T3 = _mm_or_si128(T3, T2);
+	T4 = _mm_slli_epi32(T0, 31);
+	T5 = _mm_slli_epi32(T0, 30);
+	T2 = _mm_slli_epi32(T0, 25);
+	T4 = _mm_xor_si128(T4, T5);
+	T4 = _mm_xor_si128(T4, T2);
+	T5 = _mm_srli_si128(T4, 4);
+	T3 = _mm_xor_si128(T3, T5);
+	T4 = _mm_slli_si128(T4, 12);
+	T0 = _mm_xor_si128(T0, T4);
+	T3 = _mm_xor_si128(T3, T0);
+	T4 = _mm_srli_epi32(T0, 1);
+	T1 = _mm_srli_epi32(T0, 2);
+	T2 = _mm_srli_epi32(T0, 7);
+	T3 = _mm_xor_si128(T3, T1);
+	T3 = _mm_xor_si128(T3, T2);
+	T3 = _mm_xor_si128(T3, T4);
+
+	X = _mm_shuffle_epi8(T3, MASK);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output), X);
+}
+
+#endif
+
+NAMESPACE_NUMERICEND
@@ -5,12 +5,6 @@
 #include "Keccak.h"
 #include "MemoryTools.h"
 #include "ProviderFromName.h"
-#if defined(__AVX2__)
-#	include "ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "ULong512.h"
-#endif
 
 NAMESPACE_DRBG
 
@@ -21,12 +15,6 @@ using Digest::Keccak;
 using Utility::MemoryTools;
 using Enumeration::ProviderConvert;
 using Enumeration::ShakeModeConvert;
-#if defined(__AVX2__)
-using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-using Numeric::ULong512;
-#endif
 
 class CSG::CsgState
 {
@@ -231,10 +219,15 @@ CSG::~CSG()
 
 const bool CSG::HasMultiLane()
 {
-	CpuDetect dtc;
 	bool ret;
 
-	ret = (dtc.AVX2() || dtc.AVX512F()) ? true : false;
+	ret = false;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	ret = (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512) ? true : false;
+#endif
 
 	return ret;
 }
@@ -441,19 +434,19 @@ void CSG::Initialize(ISymmetricKey &Parameters)
 
 void CSG::Reset(std::unique_ptr<CsgState> &State)
 {
-#if defined(__AVX512__)
-	if (State->IsParallel && State->State.size() != 8)
-	{
-		State->State.resize(8);
-		State->Buffer.resize(State->Rate * 8);
-	}
-#elif defined(__AVX2__)
-	if (State->IsParallel && State->State.size() != 4)
+	size_t lanes;
+
+	if (State->IsParallel)
 	{
-		State->State.resize(4);
-		State->Buffer.resize(State->Rate * 4);
+		// the lane count is fixed by the widest permutation the processor supports
+		lanes = (CpuDetect::SimdProfile() == SimdProfiles::Simd512) ? 8 : 4;
+
+		if (State->State.size() != lanes)
+		{
+			State->State.resize(lanes);
+			State->Buffer.resize(State->Rate * lanes);
+		}
 	}
-#endif
 
 	State->Reset();
 }
@@ -729,50 +722,56 @@ void CSG::PermuteW(std::unique_ptr<CsgState> &State)
 {
 	size_t i;
 
-#if defined(__AVX512__)
-
-	for (i = 0; i < Keccak::KECCAK_STATE_SIZE; ++i)
-	{
-		tmpW[i].Load(State->State[0][i], State->State[1][i], State->State[2][i], State->State[3][i], State->State[4][i], State->State[5][i], State->State[6][i], State->State[7][i]);
-	}
-
-	if (State->ShakeMode != ShakeModes::SHAKE1024)
-	{
-		Keccak::PermuteR24P8x1600H(tmpW);
-	}
-	else
-	{
-		Keccak::PermuteR48P8x1600H(tmpW);
-	}
-
-	for (i = 0; i < Keccak::KECCAK_STATE_SIZE; ++i)
-	{
-		tmpW[i].Store(State->State[7][i], State->State[6][i], State->State[5][i], State->State[4][i], State->State[3][i], State->State[2][i], State->State[1][i], State->State[0][i]);
-	}
-
-#elif defined(__AVX__)
+#if defined(CEX_KERNEL_SIMD256)
 
-	std::vector<ULong256> tmpW(Keccak::KECCAK_STATE_SIZE);
+	// the lane states are interleaved, word i of lane k is at (i * lanes) + k
+	const size_t LANES = State->State.size();
+	std::vector<ulong> tmp(LANES * Keccak::KECCAK_STATE_SIZE);
+	size_t k;
 
 	for (i = 0; i < Keccak::KECCAK_STATE_SIZE; ++i)
 	{
-		tmpW[i].Load(State->State[0][i], State->State[1][i], State->State[2][i], State->State[3][i]);
+		for (k = 0; k < LANES; ++k)
+		{
+			tmp[(i * LANES) + k] = State->State[k][i];
+		}
 	}
 
-	if (State->ShakeMode != ShakeModes::SHAKE1024)
+#	if defined(CEX_KERNEL_SIMD512)
+	if (LANES == 8)
 	{
-		Keccak::PermuteR24P4x1600H(tmpW);
+		if (State->ShakeMode != ShakeModes::SHAKE1024)
+		{
+			Keccak::PermuteR24P8x1600H(tmp.data());
+		}
+		else
+		{
+			Keccak::PermuteR48P8x1600H(tmp.data());
+		}
 	}
 	else
+#	endif
 	{
-		Keccak::PermuteR48P4x1600H(tmpW);
+		if (State->ShakeMode != ShakeModes::SHAKE1024)
+		{
+			Keccak::PermuteR24P4x1600H(tmp.data());
+		}
+		else
+		{
+			Keccak::PermuteR48P4x1600H(tmp.data());
+		}
 	}
 
 	for (i = 0; i < Keccak::KECCAK_STATE_SIZE; ++i)
 	{
-		tmpW[i].Store(State->State[3][i], State->State[2][i], State->State[1][i], State->State[0][i]);
+		for (k = 0; k < LANES; ++k)
+		{
+			State->State[k][i] = tmp[(i * LANES) + k];
+		}
 	}
 
+	MemoryTools::Clear(tmp, 0, tmp.size() * sizeof(ulong));
+
 #else
 
 	// sequential fallback -not used, internal testing only
@@ -1,17 +1,13 @@
 #include "CSX256.h"
 #include "ChaCha.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MacFromName.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 #include "SHAKE.h"
 
-#if defined(__AVX2__)
-#	include "UInt256.h"
-#elif defined(__AVX__)
-#	include "UInt128.h"
-#endif
-
 NAMESPACE_STREAM
 
 using Utility::IntegerTools;
@@ -73,6 +69,7 @@ CSX256::CSX256(StreamAuthenticators AuthenticatorType)
 		Helper::MacFromName::GetInstance(AuthenticatorType)),
 	m_parallelProfile(BLOCK_SIZE, true, STATE_PRECACHED, true)
 {
+	ParallelTuner::Apply(Enumeral(), m_parallelProfile);
 }
 
 CSX256::~CSX256()
@@ -369,11 +366,15 @@ void CSX256::Generate(std::unique_ptr<CSX256State> &State, std::array<uint, 2> &
 
 	ctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD128)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
 
 	const size_t AVX512BLK = 16 * BLOCK_SIZE;
 
-	if (Length >= AVX512BLK)
+	if (SMDPRF == SimdProfiles::Simd512 && Length >= AVX512BLK)
 	{
 		const size_t SEGALN = Length - (Length % AVX512BLK);
 		std::array<uint, 32> tmpc;
@@ -429,14 +430,17 @@ void CSX256::Generate(std::unique_ptr<CSX256State> &State, std::array<uint, 2> &
 			MemoryTools::Copy(Counter, 0, tmpc, 15, 4);
 			MemoryTools::Copy(Counter, 1, tmpc, 31, 4);
 			IntegerTools::LeIncrementW(Counter);
-			ChaCha::PermuteP16x512H(Output, OutOffset + ctr, tmpc, State->State, ROUND_COUNT);
+			ChaCha::PermuteP16x512H(Output.data() + OutOffset + ctr, tmpc.data(), State->State.data(), ROUND_COUNT);
 			ctr += AVX512BLK;
 		}
 	}
-#elif defined(__AVX2__)
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
 
-	if (Length >= AVX2BLK)
+	if (SMDPRF == SimdProfiles::Simd256 && Length >= AVX2BLK)
 	{
 		const size_t SEGALN = Length - (Length % AVX2BLK);
 		std::array<uint, 16> tmpc;
@@ -468,17 +472,20 @@ void CSX256::Generate(std::unique_ptr<CSX256State> &State, std::array<uint, 2> &
 			MemoryTools::Copy(Counter, 0, tmpc, 7, 4);
 			MemoryTools::Copy(Counter, 1, tmpc, 15, 4);
 			IntegerTools::LeIncrementW(Counter);
-			ChaCha::PermuteP8x512H(Output, OutOffset + ctr, tmpc, State->State, ROUND_COUNT);
+			ChaCha::PermuteP8x512H(Output.data() + OutOffset + ctr, tmpc.data(), State->State.data(), ROUND_COUNT);
 			ctr += AVX2BLK;
 		}
 	}
-#elif defined(__AVX__)
+#endif
+
+#if defined(CEX_KERNEL_SIMD128)
+
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
 
-	if (Length >= AVXBLK)
+	if (SMDPRF == SimdProfiles::Simd128 && Length >= AVXBLK)
 	{
 		const size_t SEGALN = Length - (Length % AVXBLK);
-		std::array<uint, 8>;
+		std::array<uint, 8> tmpc;
 
 		// process 4 blocks (uses sse intrinsics if available)
 		while (ctr != SEGALN)
@@ -495,7 +502,7 @@ void CSX256::Generate(std::unique_ptr<CSX256State> &State, std::array<uint, 2> &
 			MemoryTools::Copy(Counter, 0, tmpc, 3, 4);
 			MemoryTools::Copy(Counter, 1, tmpc, 7, 4);
 			IntegerTools::LeIncrementW(Counter);
-			ChaCha::PermuteP4x512H(Output, OutOffset + ctr, tmpc, State->State, ROUND_COUNT);
+			ChaCha::PermuteP4x512H(Output.data() + OutOffset + ctr, tmpc.data(), State->State.data(), ROUND_COUNT);
 			ctr += AVXBLK;
 		}
 	}
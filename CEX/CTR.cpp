@@ -2,6 +2,7 @@
 #include "BlockCipherFromName.h"
 #include "IntegerTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_MODE
 
@@ -51,6 +52,7 @@ CTR::CTR(BlockCiphers CipherType)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CTR), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::CTR, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 CTR::CTR(IBlockCipher* Cipher)
@@ -60,6 +62,7 @@ CTR::CTR(IBlockCipher* Cipher)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CTR), std::string("Constructor"), std::string("The cipher type can not be null!"), ErrorCodes::IllegalOperation)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::CTR, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 CTR::~CTR()
@@ -263,14 +266,14 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 {
 	size_t bctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512) || defined(CEX_KERNEL_VAES256)
 	const size_t AVX512BLK = 16 * BLOCK_SIZE;
 	if (Length >= AVX512BLK)
 	{
 		const size_t PBKALN = Length - (Length % AVX512BLK);
 		std::vector<byte> tmpc(AVX512BLK);
 
-		// stagger counters and process 8 blocks with avx512
+		// stagger counters and process 16 blocks; a vaes engine transforms these in wide registers
 		while (bctr != PBKALN)
 		{
 			MemoryTools::COPY128(Counter, 0, tmpc, 0);
@@ -309,7 +312,7 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX512BLK;
 		}
 	}
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
 	if (Length >= AVX2BLK)
 	{
@@ -339,7 +342,8 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX2BLK;
 		}
 	}
-#elif defined(__AVX__)
+#endif
+#if defined(CEX_KERNEL_SIMD128)
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
 	if (Length >= AVXBLK)
 	{
@@ -381,6 +385,21 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 	}
 }
 
+void CTR::NextCounters(std::vector<byte> &Output, size_t OutOffset, size_t Count)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(Output.size() - OutOffset >= Count * BLOCK_SIZE, "The output array is too small!");
+
+	size_t i;
+
+	// copy the next counter blocks in sequence, the mode continues from the counter that follows them
+	for (i = 0; i < Count; ++i)
+	{
+		MemoryTools::COPY128(m_ctrState->Nonce, 0, Output, OutOffset + (i * BLOCK_SIZE));
+		IntegerTools::BeIncrement8(m_ctrState->Nonce);
+	}
+}
+
 void CTR::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t OUTLEN = Output.size() - OutOffset < Length ? Output.size() - OutOffset : Length;
@@ -104,6 +104,10 @@ class CTR final : public ICipherMode
 {
 private:
 
+	// the EAX and GCM single-pass loops draw their counter blocks through NextCounters
+	friend class EAX;
+	friend class GCM;
+
 	static const size_t BLOCK_SIZE = 16;
 
 	class CtrState;
@@ -203,7 +207,7 @@ public:
 	const std::string Name() override;
 
 	/// <summary>
-	/// Read Only: The CTR initialization vector (exposed for MCS)
+	/// Read Only: The CTR counter; the next counter block to be encrypted (exposed for MCS)
 	/// </summary>
 	const std::vector<byte> &Nonce();
 
@@ -304,6 +308,7 @@ private:
 
 	void Encrypt(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter);
+	void NextCounters(std::vector<byte> &Output, size_t OutOffset, size_t Count);
 	void ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
 	void ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
 };
@@ -516,6 +516,10 @@ typedef unsigned char byte;
 // Note, that this may cause cache evictions on CPUs with a small code-cache, timing should be tested on the target CPU before implementing
 //#define CEX_CIPHER_COMPACT
 
+// toggles the NTRU-Prime ring multiplications from the karatsuba form to the reference O(p^2) schoolbook form
+// both forms produce identical output, the schoolbook is retained for verification and constrained code-size targets
+//#define CEX_NTRUP_SCHOOLBOOK
+
 // enables/disables OS rotation intrinsics
 #if defined(CEX_FAST_ROTATE) && defined(CEX_HAS_MINSSE)
 #	define CEX_FASTROTATE_ENABLED
@@ -552,8 +556,8 @@ typedef unsigned char byte;
 //FMAPS	__AVX5124FMAPS__			Vector instructions for deep learning floating - point single precision
 //VPOPCNT	__AVX512VPOPCNTDQ__		?
 
-// Note: AVX512 is currently untested, this flag enables support on a compliant system
-//#define CEX_AVX512_SUPPORTED
+// Enables the AVX512 kernels; these are built in their own translation units and are only used when the processor and the operating system report AVX512F
+#define CEX_AVX512_SUPPORTED
 
 #if defined(__AVX512F__) && (__AVX512F__ == 1) && defined(CEX_AVX512_SUPPORTED)
 #	include <immintrin.h>
@@ -567,6 +571,91 @@ typedef unsigned char byte;
 #	define CEX_AVX_SUPPORTED
 #endif
 
+// Run-time SIMD dispatch
+// The wide Blake, ChaCha, Dilithium NTT, Keccak, McEliece elimination, ModuleLWE NTT, NTRU-Prime, Poly1305, Rijndael bitsliced, Serpent, SHA2, Skein-512 and Threefish kernels are compiled in their own translation units (BlakeSimd128.cpp, ChaChaSimd256.cpp, KeccakSimd512.cpp..), 
+// the 256 and 512-bit units are built with the matching instruction-set flag (/arch:AVX2, /arch:AVX512 or -mavx2, -mavx512f), the 128-bit units require SSE4.1 (-msse4.1, MSVC needs no flag), 
+// and the widest kernel supported by the processor is selected once at run-time through CpuDetect::SimdProfile().
+// The library itself is built for the baseline instruction set (SSE2), and will use the SSE4.1, AVX2 or AVX512 kernels on the processors that support them.
+// The kernel units take raw pointers and use only their own SIMD wrappers and internal helpers, so that no inline or template code built for a wider instruction set is shared with the baseline.
+// Removing this flag restores the compile-time selection, where only the kernels enabled by the global instruction-set flag are built.
+#if defined(CEX_ARCH_X86_X64)
+#	define CEX_SIMD_DISPATCH
+#endif
+
+#if defined(CEX_SIMD_DISPATCH)
+#	define CEX_KERNEL_SIMD128
+#	define CEX_KERNEL_SIMD256
+#	if defined(CEX_AVX512_SUPPORTED)
+#		define CEX_KERNEL_SIMD512
+#	endif
+#else
+#	if defined(__SSE4_1__) || defined(__AVX__)
+#		define CEX_KERNEL_SIMD128
+#	endif
+#	if defined(__AVX2__)
+#		define CEX_KERNEL_SIMD256
+#	endif
+#	if defined(__AVX512__)
+#		define CEX_KERNEL_SIMD512
+#	endif
+#endif
+
+// The 128-bit AES-NI, carry-less multiply and random-seed paths (AHX, ACS, CMUL, RDP) are selected at run-time with CpuDetect, 
+// in a dispatch build they are compiled at the baseline instruction set; MSVC accepts these intrinsics at any /arch setting, GCC and Clang need -maes -mpclmul -mrdrnd -mrdseed.
+#if defined(CEX_SIMD_DISPATCH) && (defined(CEX_COMPILER_MSC) || defined(__AES__))
+#	if !defined(CEX_AVX_INTRINSICS)
+#		define CEX_AVX_INTRINSICS
+#	endif
+#endif
+
+// SIMD wrapper instruction-set tag
+// The SIMD wrapper classes (UInt128, UInt256, ULong512..) are declared inside an inline namespace named after the instruction set of the translation unit, 
+// so the inline members instantiated in a kernel unit built with /arch:AVX2 or /arch:AVX512 have a different mangled name than the same members built for the baseline, 
+// and the linker can never substitute a wider instruction-set copy into a baseline caller.
+#if defined(__AVX512F__)
+#	define CEX_SIMD_ISA Avx512
+#elif defined(__AVX2__)
+#	define CEX_SIMD_ISA Avx2
+#elif defined(__AVX__)
+#	define CEX_SIMD_ISA Avx
+#elif defined(__SSE4_1__)
+#	define CEX_SIMD_ISA Sse41
+#else
+#	define CEX_SIMD_ISA Sse2
+#endif
+
+// VAES wide AES engines
+// The AHX transforms in AHXSimd256.cpp and AHXSimd512.cpp encrypt two or four blocks per instruction with the vector AES instructions, 
+// and are built with the AVX2 and AVX512 instruction-set flags (/arch:AVX2, /arch:AVX512 or -mavx2 -mvaes, -mavx512f -mvaes).
+// The engines are used when the SIMD profile is AVX2 or AVX512 and the processor reports VAES (CpuDetect::VAES()).
+#if defined(CEX_SIMD_DISPATCH)
+#	if defined(CEX_KERNEL_SIMD256)
+#		define CEX_KERNEL_VAES256
+#	endif
+#	if defined(CEX_KERNEL_SIMD512)
+#		define CEX_KERNEL_VAES512
+#	endif
+#elif defined(__VAES__)
+#	if defined(__AVX2__)
+#		define CEX_KERNEL_VAES256
+#	endif
+#	if defined(__AVX512__)
+#		define CEX_KERNEL_VAES512
+#	endif
+#endif
+
+// VPCLMULQDQ wide GHASH kernel
+// The 8 block GHASH multiply in CMULSimd512.cpp performs four carry-less multiplies per instruction with the 512-bit VPCLMULQDQ instructions, 
+// and is built with the AVX512 instruction-set flag (/arch:AVX512 or -mavx512f -mavx512bw -mvpclmulqdq).
+// The kernel is used by CMUL::PermuteR128P1024V when the SIMD profile is AVX512 and the processor reports AVX512BW and VPCLMULQDQ.
+#if defined(CEX_SIMD_DISPATCH)
+#	if defined(CEX_KERNEL_SIMD512)
+#		define CEX_KERNEL_VPCLMUL512
+#	endif
+#elif defined(__VPCLMULQDQ__) && defined(__AVX512__)
+#	define CEX_KERNEL_VPCLMUL512
+#endif
+
 // EOF
 #endif
 
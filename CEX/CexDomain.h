@@ -72,6 +72,8 @@
 #define NAMESPACE_NETWORKEND } } 
 #define NAMESPACE_NUMERIC namespace CEX { namespace Numeric {
 #define NAMESPACE_NUMERICEND } } 
+#define NAMESPACE_NUMERICSIMD namespace CEX { namespace Numeric { inline namespace CEX_SIMD_ISA {
+#define NAMESPACE_NUMERICSIMDEND } } } 
 #define NAMESPACE_PRNG namespace CEX { namespace Prng {
 #define NAMESPACE_PRNGEND } } 
 #define NAMESPACE_PROCESSING namespace CEX { namespace Processing {
@@ -2,31 +2,11 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 
-#if defined(__AVX__)
-#	include "UInt128.h"
-#endif
-#if defined(__AVX__)
-#	include "UInt256.h"
-#endif
-#if defined(__AVX512__)
-#	include "UInt512.h"
-#endif
-
 NAMESPACE_STREAM
 
 using Utility::IntegerTools;
 using Utility::MemoryTools;
 
-#if defined(__AVX__)
-using Numeric::UInt128;
-#endif
-#if defined(__AVX2__)
-using Numeric::UInt256;
-#endif
-#if defined(__AVX512__)
-using Numeric::UInt512;
-#endif
-
 void ChaCha::PermuteP512C(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 2> &Counter, std::array<uint, 14> &State, size_t Rounds)
 {
 	std::array<uint, 16> S;
@@ -810,305 +790,4 @@ void ChaCha::PermuteR20P512U(std::vector<byte> &Output, size_t OutOffset, std::a
 	IntegerTools::Le32ToBytes(X15 + State[13], Output, OutOffset + 60);
 }
 
-#if defined(__AVX__)
-
-void ChaCha::PermuteP4x512H(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 8> &Counter, std::array<uint, 14> &State, size_t Rounds)
-{
-	std::array<UInt128, 16> X{ UInt128(State[0]), UInt128(State[1]), UInt128(State[2]), UInt128(State[3]),
-		UInt128(State[4]), UInt128(State[5]), UInt128(State[6]), UInt128(State[7]), 
-		UInt128(State[8]), UInt128(State[9]), UInt128(State[10]), UInt128(State[11]), 
-		UInt128(Counter, 0), UInt128(Counter, 4), UInt128(State[12]), UInt128(State[13]) };
-
-	while (Rounds != 0)
-	{
-		X[0] += X[4];
-		X[12] = UInt128::RotL32(X[12] ^ X[0], 16);
-		X[8] += X[12];
-		X[4] = UInt128::RotL32(X[4] ^ X[8], 12);
-		X[0] += X[4];
-		X[12] = UInt128::RotL32(X[12] ^ X[0], 8);
-		X[8] += X[12];
-		X[4] = UInt128::RotL32(X[4] ^ X[8], 7);
-		X[1] += X[5];
-		X[13] = UInt128::RotL32(X[13] ^ X[1], 16);
-		X[9] += X[13];
-		X[5] = UInt128::RotL32(X[5] ^ X[9], 12);
-		X[1] += X[5];
-		X[13] = UInt128::RotL32(X[13] ^ X[1], 8);
-		X[9] += X[13];
-		X[5] = UInt128::RotL32(X[5] ^ X[9], 7);
-		X[2] += X[6];
-		X[14] = UInt128::RotL32(X[14] ^ X[2], 16);
-		X[10] += X[14];
-		X[6] = UInt128::RotL32(X[6] ^ X[10], 12);
-		X[2] += X[6];
-		X[14] = UInt128::RotL32(X[14] ^ X[2], 8);
-		X[10] += X[14];
-		X[6] = UInt128::RotL32(X[6] ^ X[10], 7);
-		X[3] += X[7];
-		X[15] = UInt128::RotL32(X[15] ^ X[3], 16);
-		X[11] += X[15];
-		X[7] = UInt128::RotL32(X[7] ^ X[11], 12);
-		X[3] += X[7];
-		X[15] = UInt128::RotL32(X[15] ^ X[3], 8);
-		X[11] += X[15];
-		X[7] = UInt128::RotL32(X[7] ^ X[11], 7);
-		X[0] += X[5];
-		X[15] = UInt128::RotL32(X[15] ^ X[0], 16);
-		X[10] += X[15];
-		X[5] = UInt128::RotL32(X[5] ^ X[10], 12);
-		X[0] += X[5];
-		X[15] = UInt128::RotL32(X[15] ^ X[0], 8);
-		X[10] += X[15];
-		X[5] = UInt128::RotL32(X[5] ^ X[10], 7);
-		X[1] += X[6];
-		X[12] = UInt128::RotL32(X[12] ^ X[1], 16);
-		X[11] += X[12];
-		X[6] = UInt128::RotL32(X[6] ^ X[11], 12);
-		X[1] += X[6];
-		X[12] = UInt128::RotL32(X[12] ^ X[1], 8);
-		X[11] += X[12];
-		X[6] = UInt128::RotL32(X[6] ^ X[11], 7);
-		X[2] += X[7];
-		X[13] = UInt128::RotL32(X[13] ^ X[2], 16);
-		X[8] += X[13];
-		X[7] = UInt128::RotL32(X[7] ^ X[8], 12);
-		X[2] += X[7];
-		X[13] = UInt128::RotL32(X[13] ^ X[2], 8);
-		X[8] += X[13];
-		X[7] = UInt128::RotL32(X[7] ^ X[8], 7);
-		X[3] += X[4];
-		X[14] = UInt128::RotL32(X[14] ^ X[3], 16);
-		X[9] += X[14];
-		X[4] = UInt128::RotL32(X[4] ^ X[9], 12);
-		X[3] += X[4];
-		X[14] = UInt128::RotL32(X[14] ^ X[3], 8);
-		X[9] += X[14];
-		X[4] = UInt128::RotL32(X[4] ^ X[9], 7);
-		Rounds -= 2;
-	}
-
-	X[0] += UInt128(State[0]);
-	X[1] += UInt128(State[1]);
-	X[2] += UInt128(State[2]);
-	X[3] += UInt128(State[3]);
-	X[4] += UInt128(State[4]);
-	X[5] += UInt128(State[5]);
-	X[6] += UInt128(State[6]);
-	X[7] += UInt128(State[7]);
-	X[8] += UInt128(State[8]);
-	X[9] += UInt128(State[9]);
-	X[10] += UInt128(State[10]);
-	X[11] += UInt128(State[11]);
-	X[12] += UInt128(Counter, 0);
-	X[13] += UInt128(Counter, 4);
-	X[14] += UInt128(State[12]);
-	X[15] += UInt128(State[13]);
-
-	Store4xUL512(X, Output, OutOffset);
-}
-
-#endif
-
-#if defined(__AVX2__)
-
-void ChaCha::PermuteP8x512H(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 16> &Counter, std::array<uint, 14> &State, size_t Rounds)
-{
-	std::array<UInt256, 16> X{ UInt256(State[0]), UInt256(State[1]), UInt256(State[2]), UInt256(State[3]),
-		UInt256(State[4]), UInt256(State[5]), UInt256(State[6]), UInt256(State[7]),
-		UInt256(State[8]), UInt256(State[9]), UInt256(State[10]), UInt256(State[11]),
-		UInt256(Counter, 0), UInt256(Counter, 8), UInt256(State[12]), UInt256(State[13]) };
-
-	while (Rounds != 0)
-	{
-		X[0] += X[4];
-		X[12] = UInt256::RotL32(X[12] ^ X[0], 16);
-		X[8] += X[12];
-		X[4] = UInt256::RotL32(X[4] ^ X[8], 12);
-		X[0] += X[4];
-		X[12] = UInt256::RotL32(X[12] ^ X[0], 8);
-		X[8] += X[12];
-		X[4] = UInt256::RotL32(X[4] ^ X[8], 7);
-		X[1] += X[5];
-		X[13] = UInt256::RotL32(X[13] ^ X[1], 16);
-		X[9] += X[13];
-		X[5] = UInt256::RotL32(X[5] ^ X[9], 12);
-		X[1] += X[5];
-		X[13] = UInt256::RotL32(X[13] ^ X[1], 8);
-		X[9] += X[13];
-		X[5] = UInt256::RotL32(X[5] ^ X[9], 7);
-		X[2] += X[6];
-		X[14] = UInt256::RotL32(X[14] ^ X[2], 16);
-		X[10] += X[14];
-		X[6] = UInt256::RotL32(X[6] ^ X[10], 12);
-		X[2] += X[6];
-		X[14] = UInt256::RotL32(X[14] ^ X[2], 8);
-		X[10] += X[14];
-		X[6] = UInt256::RotL32(X[6] ^ X[10], 7);
-		X[3] += X[7];
-		X[15] = UInt256::RotL32(X[15] ^ X[3], 16);
-		X[11] += X[15];
-		X[7] = UInt256::RotL32(X[7] ^ X[11], 12);
-		X[3] += X[7];
-		X[15] = UInt256::RotL32(X[15] ^ X[3], 8);
-		X[11] += X[15];
-		X[7] = UInt256::RotL32(X[7] ^ X[11], 7);
-		X[0] += X[5];
-		X[15] = UInt256::RotL32(X[15] ^ X[0], 16);
-		X[10] += X[15];
-		X[5] = UInt256::RotL32(X[5] ^ X[10], 12);
-		X[0] += X[5];
-		X[15] = UInt256::RotL32(X[15] ^ X[0], 8);
-		X[10] += X[15];
-		X[5] = UInt256::RotL32(X[5] ^ X[10], 7);
-		X[1] += X[6];
-		X[12] = UInt256::RotL32(X[12] ^ X[1], 16);
-		X[11] += X[12];
-		X[6] = UInt256::RotL32(X[6] ^ X[11], 12);
-		X[1] += X[6];
-		X[12] = UInt256::RotL32(X[12] ^ X[1], 8);
-		X[11] += X[12];
-		X[6] = UInt256::RotL32(X[6] ^ X[11], 7);
-		X[2] += X[7];
-		X[13] = UInt256::RotL32(X[13] ^ X[2], 16);
-		X[8] += X[13];
-		X[7] = UInt256::RotL32(X[7] ^ X[8], 12);
-		X[2] += X[7];
-		X[13] = UInt256::RotL32(X[13] ^ X[2], 8);
-		X[8] += X[13];
-		X[7] = UInt256::RotL32(X[7] ^ X[8], 7);
-		X[3] += X[4];
-		X[14] = UInt256::RotL32(X[14] ^ X[3], 16);
-		X[9] += X[14];
-		X[4] = UInt256::RotL32(X[4] ^ X[9], 12);
-		X[3] += X[4];
-		X[14] = UInt256::RotL32(X[14] ^ X[3], 8);
-		X[9] += X[14];
-		X[4] = UInt256::RotL32(X[4] ^ X[9], 7);
-		Rounds -= 2;
-	}
-
-	X[0] += UInt256(State[0]);
-	X[1] += UInt256(State[1]);
-	X[2] += UInt256(State[2]);
-	X[3] += UInt256(State[3]);
-	X[4] += UInt256(State[4]);
-	X[5] += UInt256(State[5]);
-	X[6] += UInt256(State[6]);
-	X[7] += UInt256(State[7]);
-	X[8] += UInt256(State[8]);
-	X[9] += UInt256(State[9]);
-	X[10] += UInt256(State[10]);
-	X[11] += UInt256(State[11]);
-	X[12] += UInt256(Counter, 0);
-	X[13] += UInt256(Counter, 8);
-	X[14] += UInt256(State[12]);
-	X[15] += UInt256(State[13]);
-
-	Store8xUL512(X, Output, OutOffset);
-}
-
-#endif
-
-#if defined(__AVX512__)
-
-void ChaCha::PermuteP16x512H(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 32> &Counter, std::array<uint, 14> &State, size_t Rounds)
-{
-	std::array<UInt512, 16> X{ UInt512(State[0]), UInt512(State[1]), UInt512(State[2]), UInt512(State[3]),
-		UInt512(State[4]), UInt512(State[5]), UInt512(State[6]), UInt512(State[7]),
-		UInt512(State[8]), UInt512(State[9]), UInt512(State[10]), UInt512(State[11]),
-		UInt512(Counter, 0), UInt512(Counter, 16), UInt512(State[12]), UInt512(State[13]) };
-
-	while (Rounds != 0)
-	{
-		X[0] += X[4];
-		X[12] = UInt512::RotL32(X[12] ^ X[0], 16);
-		X[8] += X[12];
-		X[4] = UInt512::RotL32(X[4] ^ X[8], 12);
-		X[0] += X[4];
-		X[12] = UInt512::RotL32(X[12] ^ X[0], 8);
-		X[8] += X[12];
-		X[4] = UInt512::RotL32(X[4] ^ X[8], 7);
-		X[1] += X[5];
-		X[13] = UInt512::RotL32(X[13] ^ X[1], 16);
-		X[9] += X[13];
-		X[5] = UInt512::RotL32(X[5] ^ X[9], 12);
-		X[1] += X[5];
-		X[13] = UInt512::RotL32(X[13] ^ X[1], 8);
-		X[9] += X[13];
-		X[5] = UInt512::RotL32(X[5] ^ X[9], 7);
-		X[2] += X[6];
-		X[14] = UInt512::RotL32(X[14] ^ X[2], 16);
-		X[10] += X[14];
-		X[6] = UInt512::RotL32(X[6] ^ X[10], 12);
-		X[2] += X[6];
-		X[14] = UInt512::RotL32(X[14] ^ X[2], 8);
-		X[10] += X[14];
-		X[6] = UInt512::RotL32(X[6] ^ X[10], 7);
-		X[3] += X[7];
-		X[15] = UInt512::RotL32(X[15] ^ X[3], 16);
-		X[11] += X[15];
-		X[7] = UInt512::RotL32(X[7] ^ X[11], 12);
-		X[3] += X[7];
-		X[15] = UInt512::RotL32(X[15] ^ X[3], 8);
-		X[11] += X[15];
-		X[7] = UInt512::RotL32(X[7] ^ X[11], 7);
-		X[0] += X[5];
-		X[15] = UInt512::RotL32(X[15] ^ X[0], 16);
-		X[10] += X[15];
-		X[5] = UInt512::RotL32(X[5] ^ X[10], 12);
-		X[0] += X[5];
-		X[15] = UInt512::RotL32(X[15] ^ X[0], 8);
-		X[10] += X[15];
-		X[5] = UInt512::RotL32(X[5] ^ X[10], 7);
-		X[1] += X[6];
-		X[12] = UInt512::RotL32(X[12] ^ X[1], 16);
-		X[11] += X[12];
-		X[6] = UInt512::RotL32(X[6] ^ X[11], 12);
-		X[1] += X[6];
-		X[12] = UInt512::RotL32(X[12] ^ X[1], 8);
-		X[11] += X[12];
-		X[6] = UInt512::RotL32(X[6] ^ X[11], 7);
-		X[2] += X[7];
-		X[13] = UInt512::RotL32(X[13] ^ X[2], 16);
-		X[8] += X[13];
-		X[7] = UInt512::RotL32(X[7] ^ X[8], 12);
-		X[2] += X[7];
-		X[13] = UInt512::RotL32(X[13] ^ X[2], 8);
-		X[8] += X[13];
-		X[7] = UInt512::RotL32(X[7] ^ X[8], 7);
-		X[3] += X[4];
-		X[14] = UInt512::RotL32(X[14] ^ X[3], 16);
-		X[9] += X[14];
-		X[4] = UInt512::RotL32(X[4] ^ X[9], 12);
-		X[3] += X[4];
-		X[14] = UInt512::RotL32(X[14] ^ X[3], 8);
-		X[9] += X[14];
-		X[4] = UInt512::RotL32(X[4] ^ X[9], 7);
-		Rounds -= 2;
-	}
-
-	// last round
-	X[0] += UInt512(State[0]);
-	X[1] += UInt512(State[1]);
-	X[2] += UInt512(State[2]);
-	X[3] += UInt512(State[3]);
-	X[4] += UInt512(State[4]);
-	X[5] += UInt512(State[5]);
-	X[6] += UInt512(State[6]);
-	X[7] += UInt512(State[7]);
-	X[8] += UInt512(State[8]);
-	X[9] += UInt512(State[9]);
-	X[10] += UInt512(State[10]);
-	X[11] += UInt512(State[11]);
-	X[12] += UInt512(Counter, 0);
-	X[13] += UInt512(Counter, 16);
-	X[14] += UInt512(State[12]);
-	X[15] += UInt512(State[13]);
-
-	Store16xUL512(X, Output, OutOffset);
-}
-
-#endif
-
 NAMESPACE_STREAMEND
\ No newline at end of file
@@ -29,79 +29,16 @@ NAMESPACE_STREAM
 /// The compact forms of the permutations have the suffix C, and are optimized for performance and low memory consumption 
 /// (enabled in the cipher functions by adding the CEX_CIPHER_COMPACT to the CexConfig file). \n
 /// The Unrolled forms are optimized for speed and timing neutrality (suffix U). \n
-/// The H suffix denotes functions that take an SIMD wrapper class (UIntXXX) to process state in SIMD parallel blocks.</para>
+/// The H suffix denotes functions that process state in SIMD parallel blocks with an SIMD wrapper class (UIntXXX).</para>
 /// <para>This class contains wide forms of the functions; PermuteP4x512H and PermuteP8x512H, which use the AVX and AVX2 instruction sets. \n
 /// An experimental function using AVX512 instructions is also implemented; PermuteP16x512H. \n
-/// These functions are not visible until run-time on some compiler platforms unless the compiler flag (__AVX__, __AVX2__ or __AVX512__) is explicitly declared.</para>
+/// The wide forms are compiled in their own translation units (ChaChaSimd128, ChaChaSimd256 and ChaChaSimd512), each built with its instruction set enabled; \n
+/// they take raw pointers so that no container or utility code is instantiated with a wider instruction set. \n
+/// When CEX_SIMD_DISPATCH is defined the callers select a wide form at run-time with CpuDetect::SimdProfile(), 
+/// otherwise they are only visible when the compiler flag (__AVX__, __AVX2__ or __AVX512__) is explicitly declared.</para>
 /// </summary>
 class ChaCha
 {
-private:
-
-	template<typename T>
-	static void Store4xUL512(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
-	{
-		std::array<uint, 4> tmp;
-		size_t i;
-
-		for (i = 0; i < 16; ++i)
-		{
-			State[i].Store(tmp, 0);
-			IntegerTools::Le32ToBytes(tmp[0], Output, OutOffset + (i * 4));
-			IntegerTools::Le32ToBytes(tmp[1], Output, OutOffset + (i * 4) + 64);
-			IntegerTools::Le32ToBytes(tmp[2], Output, OutOffset + (i * 4) + 128);
-			IntegerTools::Le32ToBytes(tmp[3], Output, OutOffset + (i * 4) + 192);
-		}
-	}
-
-	template<typename T>
-	static void Store8xUL512(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
-	{
-		std::array<uint, 8> tmp;
-		size_t i;
-
-		for (i = 0; i < 16; ++i)
-		{
-			State[i].Store(tmp, 0);
-			IntegerTools::Le32ToBytes(tmp[0], Output, OutOffset + (i * 4));
-			IntegerTools::Le32ToBytes(tmp[1], Output, OutOffset + (i * 4) + 64);
-			IntegerTools::Le32ToBytes(tmp[2], Output, OutOffset + (i * 4) + 128);
-			IntegerTools::Le32ToBytes(tmp[3], Output, OutOffset + (i * 4) + 192);
-			IntegerTools::Le32ToBytes(tmp[4], Output, OutOffset + (i * 4) + 256);
-			IntegerTools::Le32ToBytes(tmp[5], Output, OutOffset + (i * 4) + 320);
-			IntegerTools::Le32ToBytes(tmp[6], Output, OutOffset + (i * 4) + 384);
-			IntegerTools::Le32ToBytes(tmp[7], Output, OutOffset + (i * 4) + 448);
-		}
-	}
-
-	template<typename T>
-	static void Store16xUL512(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
-	{
-		std::array<uint, 16> tmp;
-		size_t i;
-
-		for (i = 0; i < 16; ++i)
-		{
-			State[i].Store(tmp, 0);
-			IntegerTools::Le32ToBytes(tmp[0], Output, OutOffset + (i * 4));
-			IntegerTools::Le32ToBytes(tmp[1], Output, OutOffset + (i * 4) + 64);
-			IntegerTools::Le32ToBytes(tmp[2], Output, OutOffset + (i * 4) + 128);
-			IntegerTools::Le32ToBytes(tmp[3], Output, OutOffset + (i * 4) + 192);
-			IntegerTools::Le32ToBytes(tmp[4], Output, OutOffset + (i * 4) + 256);
-			IntegerTools::Le32ToBytes(tmp[5], Output, OutOffset + (i * 4) + 320);
-			IntegerTools::Le32ToBytes(tmp[6], Output, OutOffset + (i * 4) + 384);
-			IntegerTools::Le32ToBytes(tmp[7], Output, OutOffset + (i * 4) + 448);
-			IntegerTools::Le32ToBytes(tmp[8], Output, OutOffset + (i * 4) + 512);
-			IntegerTools::Le32ToBytes(tmp[9], Output, OutOffset + (i * 4) + 576);
-			IntegerTools::Le32ToBytes(tmp[10], Output, OutOffset + (i * 4) + 640);
-			IntegerTools::Le32ToBytes(tmp[11], Output, OutOffset + (i * 4) + 704);
-			IntegerTools::Le32ToBytes(tmp[12], Output, OutOffset + (i * 4) + 768);
-			IntegerTools::Le32ToBytes(tmp[13], Output, OutOffset + (i * 4) + 832);
-			IntegerTools::Le32ToBytes(tmp[14], Output, OutOffset + (i * 4) + 896);
-			IntegerTools::Le32ToBytes(tmp[15], Output, OutOffset + (i * 4) + 960);
-		}
-	}
-
 public:
 
 	/// <summary>
@@ -129,51 +66,48 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PermuteR20P512U(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 2> &Counter, std::array<uint, 14> &State);
 
-#if defined(__AVX__)
+#if defined(CEX_KERNEL_SIMD128)
 
 	/// <summary>
 	/// The horizontally vectorized form of the ChaCha permutation function.
 	/// <para>This function processes 4*64 blocks of input in parallel using AVX instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Output">The output message array</param>
-	/// <param name="OutOffset">The starting offset within the Output array</param>
-	/// <param name="Counter">The cipher counter array</param>
-	/// <param name="State">The permutations state array</param>
+	/// <param name="Output">The output buffer; receives 4 consecutive 64 byte blocks</param>
+	/// <param name="Counter">The 4 low counter words followed by the 4 high counter words</param>
+	/// <param name="State">The 14 word permutation state</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 20</param>
-	static void PermuteP4x512H(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 8> &Counter, std::array<uint, 14> &State, size_t Rounds);
+	static void PermuteP4x512H(byte* Output, const uint* Counter, const uint* State, size_t Rounds);
 
 #endif
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized form of the ChaCha permutation function.
 	/// <para>This function processes 8*64 blocks of input in parallel using AVX2 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Output">The output message array</param>
-	/// <param name="OutOffset">The starting offset within the Output array</param>
-	/// <param name="Counter">The cipher counter array</param>
-	/// <param name="State">The permutations state array</param>
+	/// <param name="Output">The output buffer; receives 8 consecutive 64 byte blocks</param>
+	/// <param name="Counter">The 8 low counter words followed by the 8 high counter words</param>
+	/// <param name="State">The 14 word permutation state</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 20</param>
-	static void PermuteP8x512H(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 16> &Counter, std::array<uint, 14> &State, size_t Rounds);
+	static void PermuteP8x512H(byte* Output, const uint* Counter, const uint* State, size_t Rounds);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized form of the ChaCha permutation function.
 	/// <para>This function processes 16*64 blocks of input in parallel using AVX512 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Output">The output message array</param>
-	/// <param name="OutOffset">The starting offset within the Output array</param>
-	/// <param name="Counter">The cipher counter array</param>
-	/// <param name="State">The permutations state array</param>
+	/// <param name="Output">The output buffer; receives 16 consecutive 64 byte blocks</param>
+	/// <param name="Counter">The 16 low counter words followed by the 16 high counter words</param>
+	/// <param name="State">The 14 word permutation state</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 20</param>
-	static void PermuteP16x512H(std::vector<byte> &Output, size_t OutOffset, std::array<uint, 32> &Counter, std::array<uint, 14> &State, size_t Rounds);
+	static void PermuteP16x512H(byte* Output, const uint* Counter, const uint* State, size_t Rounds);
 
 #endif
 
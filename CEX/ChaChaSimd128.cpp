@@ -0,0 +1,140 @@
+#include "ChaCha.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD128) && !defined(__SSE4_1__) && !defined(CEX_COMPILER_MSC)
+#	error "ChaChaSimd128.cpp must be compiled with the SSE4.1 instruction set enabled (-msse4.1)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD128)
+#	include "Intrinsics.h"
+#	include "UInt128.h"
+#endif
+
+NAMESPACE_STREAM
+
+#if defined(CEX_KERNEL_SIMD128)
+
+using Numeric::UInt128;
+
+namespace
+{
+	// writes lane n of the 16 state registers as the n-th 64 byte block of output, in little-endian byte order
+	void StoreLanes(const UInt128* State, byte* Output)
+	{
+		uint tmp[4];
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < 16; ++i)
+		{
+			State[i].Store(tmp, 0);
+
+			for (j = 0; j < 4; ++j)
+			{
+				Output[(j * 64) + (i * 4)] = static_cast<byte>(tmp[j]);
+				Output[(j * 64) + (i * 4) + 1] = static_cast<byte>(tmp[j] >> 8);
+				Output[(j * 64) + (i * 4) + 2] = static_cast<byte>(tmp[j] >> 16);
+				Output[(j * 64) + (i * 4) + 3] = static_cast<byte>(tmp[j] >> 24);
+			}
+		}
+	}
+}
+
+void ChaCha::PermuteP4x512H(byte* Output, const uint* Counter, const uint* State, size_t Rounds)
+{
+	UInt128 X[16] = { UInt128(State[0]), UInt128(State[1]), UInt128(State[2]), UInt128(State[3]),
+		UInt128(State[4]), UInt128(State[5]), UInt128(State[6]), UInt128(State[7]), 
+		UInt128(State[8]), UInt128(State[9]), UInt128(State[10]), UInt128(State[11]), 
+		UInt128(Counter, 0), UInt128(Counter, 4), UInt128(State[12]), UInt128(State[13]) };
+
+	while (Rounds != 0)
+	{
+		X[0] += X[4];
+		X[12] = UInt128::RotL32(X[12] ^ X[0], 16);
+		X[8] += X[12];
+		X[4] = UInt128::RotL32(X[4] ^ X[8], 12);
+		X[0] += X[4];
+		X[12] = UInt128::RotL32(X[12] ^ X[0], 8);
+		X[8] += X[12];
+		X[4] = UInt128::RotL32(X[4] ^ X[8], 7);
+		X[1] += X[5];
+		X[13] = UInt128::RotL32(X[13] ^ X[1], 16);
+		X[9] += X[13];
+		X[5] = UInt128::RotL32(X[5] ^ X[9], 12);
+		X[1] += X[5];
+		X[13] = UInt128::RotL32(X[13] ^ X[1], 8);
+		X[9] += X[13];
+		X[5] = UInt128::RotL32(X[5] ^ X[9], 7);
+		X[2] += X[6];
+		X[14] = UInt128::RotL32(X[14] ^ X[2], 16);
+		X[10] += X[14];
+		X[6] = UInt128::RotL32(X[6] ^ X[10], 12);
+		X[2] += X[6];
+		X[14] = UInt128::RotL32(X[14] ^ X[2], 8);
+		X[10] += X[14];
+		X[6] = UInt128::RotL32(X[6] ^ X[10], 7);
+		X[3] += X[7];
+		X[15] = UInt128::RotL32(X[15] ^ X[3], 16);
+		X[11] += X[15];
+		X[7] = UInt128::RotL32(X[7] ^ X[11], 12);
+		X[3] += X[7];
+		X[15] = UInt128::RotL32(X[15] ^ X[3], 8);
+		X[11] += X[15];
+		X[7] = UInt128::RotL32(X[7] ^ X[11], 7);
+		X[0] += X[5];
+		X[15] = UInt128::RotL32(X[15] ^ X[0], 16);
+		X[10] += X[15];
+		X[5] = UInt128::RotL32(X[5] ^ X[10], 12);
+		X[0] += X[5];
+		X[15] = UInt128::RotL32(X[15] ^ X[0], 8);
+		X[10] += X[15];
+		X[5] = UInt128::RotL32(X[5] ^ X[10], 7);
+		X[1] += X[6];
+		X[12] = UInt128::RotL32(X[12] ^ X[1], 16);
+		X[11] += X[12];
+		X[6] = UInt128::RotL32(X[6] ^ X[11], 12);
+		X[1] += X[6];
+		X[12] = UInt128::RotL32(X[12] ^ X[1], 8);
+		X[11] += X[12];
+		X[6] = UInt128::RotL32(X[6] ^ X[11], 7);
+		X[2] += X[7];
+		X[13] = UInt128::RotL32(X[13] ^ X[2], 16);
+		X[8] += X[13];
+		X[7] = UInt128::RotL32(X[7] ^ X[8], 12);
+		X[2] += X[7];
+		X[13] = UInt128::RotL32(X[13] ^ X[2], 8);
+		X[8] += X[13];
+		X[7] = UInt128::RotL32(X[7] ^ X[8], 7);
+		X[3] += X[4];
+		X[14] = UInt128::RotL32(X[14] ^ X[3], 16);
+		X[9] += X[14];
+		X[4] = UInt128::RotL32(X[4] ^ X[9], 12);
+		X[3] += X[4];
+		X[14] = UInt128::RotL32(X[14] ^ X[3], 8);
+		X[9] += X[14];
+		X[4] = UInt128::RotL32(X[4] ^ X[9], 7);
+		Rounds -= 2;
+	}
+
+	X[0] += UInt128(State[0]);
+	X[1] += UInt128(State[1]);
+	X[2] += UInt128(State[2]);
+	X[3] += UInt128(State[3]);
+	X[4] += UInt128(State[4]);
+	X[5] += UInt128(State[5]);
+	X[6] += UInt128(State[6]);
+	X[7] += UInt128(State[7]);
+	X[8] += UInt128(State[8]);
+	X[9] += UInt128(State[9]);
+	X[10] += UInt128(State[10]);
+	X[11] += UInt128(State[11]);
+	X[12] += UInt128(Counter, 0);
+	X[13] += UInt128(Counter, 4);
+	X[14] += UInt128(State[12]);
+	X[15] += UInt128(State[13]);
+
+	StoreLanes(X, Output);
+}
+
+#endif
+
+NAMESPACE_STREAMEND
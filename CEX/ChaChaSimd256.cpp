@@ -0,0 +1,139 @@
+#include "ChaCha.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "ChaChaSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "UInt256.h"
+#endif
+
+NAMESPACE_STREAM
+
+#if defined(CEX_KERNEL_SIMD256)
+
+using Numeric::UInt256;
+
+namespace
+{
+	// writes lane n of the 16 state registers as the n-th 64 byte block of output, in little-endian byte order
+	void StoreLanes(const UInt256* State, byte* Output)
+	{
+		uint tmp[8];
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < 16; ++i)
+		{
+			State[i].Store(tmp, 0);
+
+			for (j = 0; j < 8; ++j)
+			{
+				Output[(j * 64) + (i * 4)] = static_cast<byte>(tmp[j]);
+				Output[(j * 64) + (i * 4) + 1] = static_cast<byte>(tmp[j] >> 8);
+				Output[(j * 64) + (i * 4) + 2] = static_cast<byte>(tmp[j] >> 16);
+				Output[(j * 64) + (i * 4) + 3] = static_cast<byte>(tmp[j] >> 24);
+			}
+		}
+	}
+}
+
+void ChaCha::PermuteP8x512H(byte* Output, const uint* Counter, const uint* State, size_t Rounds)
+{
+	UInt256 X[16] = { UInt256(State[0]), UInt256(State[1]), UInt256(State[2]), UInt256(State[3]),
+		UInt256(State[4]), UInt256(State[5]), UInt256(State[6]), UInt256(State[7]),
+		UInt256(State[8]), UInt256(State[9]), UInt256(State[10]), UInt256(State[11]),
+		UInt256(Counter, 0), UInt256(Counter, 8), UInt256(State[12]), UInt256(State[13]) };
+
+	while (Rounds != 0)
+	{
+		X[0] += X[4];
+		X[12] = UInt256::RotL32(X[12] ^ X[0], 16);
+		X[8] += X[12];
+		X[4] = UInt256::RotL32(X[4] ^ X[8], 12);
+		X[0] += X[4];
+		X[12] = UInt256::RotL32(X[12] ^ X[0], 8);
+		X[8] += X[12];
+		X[4] = UInt256::RotL32(X[4] ^ X[8], 7);
+		X[1] += X[5];
+		X[13] = UInt256::RotL32(X[13] ^ X[1], 16);
+		X[9] += X[13];
+		X[5] = UInt256::RotL32(X[5] ^ X[9], 12);
+		X[1] += X[5];
+		X[13] = UInt256::RotL32(X[13] ^ X[1], 8);
+		X[9] += X[13];
+		X[5] = UInt256::RotL32(X[5] ^ X[9], 7);
+		X[2] += X[6];
+		X[14] = UInt256::RotL32(X[14] ^ X[2], 16);
+		X[10] += X[14];
+		X[6] = UInt256::RotL32(X[6] ^ X[10], 12);
+		X[2] += X[6];
+		X[14] = UInt256::RotL32(X[14] ^ X[2], 8);
+		X[10] += X[14];
+		X[6] = UInt256::RotL32(X[6] ^ X[10], 7);
+		X[3] += X[7];
+		X[15] = UInt256::RotL32(X[15] ^ X[3], 16);
+		X[11] += X[15];
+		X[7] = UInt256::RotL32(X[7] ^ X[11], 12);
+		X[3] += X[7];
+		X[15] = UInt256::RotL32(X[15] ^ X[3], 8);
+		X[11] += X[15];
+		X[7] = UInt256::RotL32(X[7] ^ X[11], 7);
+		X[0] += X[5];
+		X[15] = UInt256::RotL32(X[15] ^ X[0], 16);
+		X[10] += X[15];
+		X[5] = UInt256::RotL32(X[5] ^ X[10], 12);
+		X[0] += X[5];
+		X[15] = UInt256::RotL32(X[15] ^ X[0], 8);
+		X[10] += X[15];
+		X[5] = UInt256::RotL32(X[5] ^ X[10], 7);
+		X[1] += X[6];
+		X[12] = UInt256::RotL32(X[12] ^ X[1], 16);
+		X[11] += X[12];
+		X[6] = UInt256::RotL32(X[6] ^ X[11], 12);
+		X[1] += X[6];
+		X[12] = UInt256::RotL32(X[12] ^ X[1], 8);
+		X[11] += X[12];
+		X[6] = UInt256::RotL32(X[6] ^ X[11], 7);
+		X[2] += X[7];
+		X[13] = UInt256::RotL32(X[13] ^ X[2], 16);
+		X[8] += X[13];
+		X[7] = UInt256::RotL32(X[7] ^ X[8], 12);
+		X[2] += X[7];
+		X[13] = UInt256::RotL32(X[13] ^ X[2], 8);
+		X[8] += X[13];
+		X[7] = UInt256::RotL32(X[7] ^ X[8], 7);
+		X[3] += X[4];
+		X[14] = UInt256::RotL32(X[14] ^ X[3], 16);
+		X[9] += X[14];
+		X[4] = UInt256::RotL32(X[4] ^ X[9], 12);
+		X[3] += X[4];
+		X[14] = UInt256::RotL32(X[14] ^ X[3], 8);
+		X[9] += X[14];
+		X[4] = UInt256::RotL32(X[4] ^ X[9], 7);
+		Rounds -= 2;
+	}
+
+	X[0] += UInt256(State[0]);
+	X[1] += UInt256(State[1]);
+	X[2] += UInt256(State[2]);
+	X[3] += UInt256(State[3]);
+	X[4] += UInt256(State[4]);
+	X[5] += UInt256(State[5]);
+	X[6] += UInt256(State[6]);
+	X[7] += UInt256(State[7]);
+	X[8] += UInt256(State[8]);
+	X[9] += UInt256(State[9]);
+	X[10] += UInt256(State[10]);
+	X[11] += UInt256(State[11]);
+	X[12] += UInt256(Counter, 0);
+	X[13] += UInt256(Counter, 8);
+	X[14] += UInt256(State[12]);
+	X[15] += UInt256(State[13]);
+
+	StoreLanes(X, Output);
+}
+
+#endif
+
+NAMESPACE_STREAMEND
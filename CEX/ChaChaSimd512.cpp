@@ -0,0 +1,140 @@
+#include "ChaCha.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD512) && !defined(__AVX512__)
+#	error "ChaChaSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+#	include "UInt512.h"
+#endif
+
+NAMESPACE_STREAM
+
+#if defined(CEX_KERNEL_SIMD512)
+
+using Numeric::UInt512;
+
+namespace
+{
+	// writes lane n of the 16 state registers as the n-th 64 byte block of output, in little-endian byte order
+	void StoreLanes(const UInt512* State, byte* Output)
+	{
+		uint tmp[16];
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < 16; ++i)
+		{
+			State[i].Store(tmp, 0);
+
+			for (j = 0; j < 16; ++j)
+			{
+				Output[(j * 64) + (i * 4)] = static_cast<byte>(tmp[j]);
+				Output[(j * 64) + (i * 4) + 1] = static_cast<byte>(tmp[j] >> 8);
+				Output[(j * 64) + (i * 4) + 2] = static_cast<byte>(tmp[j] >> 16);
+				Output[(j * 64) + (i * 4) + 3] = static_cast<byte>(tmp[j] >> 24);
+			}
+		}
+	}
+}
+
+void ChaCha::PermuteP16x512H(byte* Output, const uint* Counter, const uint* State, size_t Rounds)
+{
+	UInt512 X[16] = { UInt512(State[0]), UInt512(State[1]), UInt512(State[2]), UInt512(State[3]),
+		UInt512(State[4]), UInt512(State[5]), UInt512(State[6]), UInt512(State[7]),
+		UInt512(State[8]), UInt512(State[9]), UInt512(State[10]), UInt512(State[11]),
+		UInt512(Counter, 0), UInt512(Counter, 16), UInt512(State[12]), UInt512(State[13]) };
+
+	while (Rounds != 0)
+	{
+		X[0] += X[4];
+		X[12] = UInt512::RotL32(X[12] ^ X[0], 16);
+		X[8] += X[12];
+		X[4] = UInt512::RotL32(X[4] ^ X[8], 12);
+		X[0] += X[4];
+		X[12] = UInt512::RotL32(X[12] ^ X[0], 8);
+		X[8] += X[12];
+		X[4] = UInt512::RotL32(X[4] ^ X[8], 7);
+		X[1] += X[5];
+		X[13] = UInt512::RotL32(X[13] ^ X[1], 16);
+		X[9] += X[13];
+		X[5] = UInt512::RotL32(X[5] ^ X[9], 12);
+		X[1] += X[5];
+		X[13] = UInt512::RotL32(X[13] ^ X[1], 8);
+		X[9] += X[13];
+		X[5] = UInt512::RotL32(X[5] ^ X[9], 7);
+		X[2] += X[6];
+		X[14] = UInt512::RotL32(X[14] ^ X[2], 16);
+		X[10] += X[14];
+		X[6] = UInt512::RotL32(X[6] ^ X[10], 12);
+		X[2] += X[6];
+		X[14] = UInt512::RotL32(X[14] ^ X[2], 8);
+		X[10] += X[14];
+		X[6] = UInt512::RotL32(X[6] ^ X[10], 7);
+		X[3] += X[7];
+		X[15] = UInt512::RotL32(X[15] ^ X[3], 16);
+		X[11] += X[15];
+		X[7] = UInt512::RotL32(X[7] ^ X[11], 12);
+		X[3] += X[7];
+		X[15] = UInt512::RotL32(X[15] ^ X[3], 8);
+		X[11] += X[15];
+		X[7] = UInt512::RotL32(X[7] ^ X[11], 7);
+		X[0] += X[5];
+		X[15] = UInt512::RotL32(X[15] ^ X[0], 16);
+		X[10] += X[15];
+		X[5] = UInt512::RotL32(X[5] ^ X[10], 12);
+		X[0] += X[5];
+		X[15] = UInt512::RotL32(X[15] ^ X[0], 8);
+		X[10] += X[15];
+		X[5] = UInt512::RotL32(X[5] ^ X[10], 7);
+		X[1] += X[6];
+		X[12] = UInt512::RotL32(X[12] ^ X[1], 16);
+		X[11] += X[12];
+		X[6] = UInt512::RotL32(X[6] ^ X[11], 12);
+		X[1] += X[6];
+		X[12] = UInt512::RotL32(X[12] ^ X[1], 8);
+		X[11] += X[12];
+		X[6] = UInt512::RotL32(X[6] ^ X[11], 7);
+		X[2] += X[7];
+		X[13] = UInt512::RotL32(X[13] ^ X[2], 16);
+		X[8] += X[13];
+		X[7] = UInt512::RotL32(X[7] ^ X[8], 12);
+		X[2] += X[7];
+		X[13] = UInt512::RotL32(X[13] ^ X[2], 8);
+		X[8] += X[13];
+		X[7] = UInt512::RotL32(X[7] ^ X[8], 7);
+		X[3] += X[4];
+		X[14] = UInt512::RotL32(X[14] ^ X[3], 16);
+		X[9] += X[14];
+		X[4] = UInt512::RotL32(X[4] ^ X[9], 12);
+		X[3] += X[4];
+		X[14] = UInt512::RotL32(X[14] ^ X[3], 8);
+		X[9] += X[14];
+		X[4] = UInt512::RotL32(X[4] ^ X[9], 7);
+		Rounds -= 2;
+	}
+
+	// last round
+	X[0] += UInt512(State[0]);
+	X[1] += UInt512(State[1]);
+	X[2] += UInt512(State[2]);
+	X[3] += UInt512(State[3]);
+	X[4] += UInt512(State[4]);
+	X[5] += UInt512(State[5]);
+	X[6] += UInt512(State[6]);
+	X[7] += UInt512(State[7]);
+	X[8] += UInt512(State[8]);
+	X[9] += UInt512(State[9]);
+	X[10] += UInt512(State[10]);
+	X[11] += UInt512(State[11]);
+	X[12] += UInt512(Counter, 0);
+	X[13] += UInt512(Counter, 16);
+	X[14] += UInt512(State[12]);
+	X[15] += UInt512(State[13]);
+
+	StoreLanes(X, Output);
+}
+
+#endif
+
+NAMESPACE_STREAMEND
@@ -32,6 +32,9 @@ std::string CipherModeConvert::ToName(CipherModes Enumeral)
 	case CipherModes::ICM:
 		name = std::string("ICM");
 		break;
+	case CipherModes::OCB:
+		name = std::string("OCB");
+		break;
 	case CipherModes::OFB:
 		name = std::string("OFB");
 		break;
@@ -79,6 +82,10 @@ CipherModes CipherModeConvert::FromName(std::string &Name)
 	{
 		tname = CipherModes::ICM;
 	}
+	else if (Name == std::string("OCB"))
+	{
+		tname = CipherModes::OCB;
+	}
 	else if (Name == std::string("OFB"))
 	{
 		tname = CipherModes::OFB;
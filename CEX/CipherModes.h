@@ -47,6 +47,10 @@ enum class CipherModes : byte
 	/// </summary>
 	ICM = 8,
 	/// <summary>
+	/// Offset CodeBook AEAD Mode (OCB3)
+	/// </summary>
+	OCB = 9,
+	/// <summary>
 	/// Output FeedBack Mode
 	/// </summary>
 	OFB = 10
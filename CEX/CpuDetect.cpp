@@ -90,6 +90,11 @@ const bool CpuDetect::AVX512F()
 	return HasFeature(CpuidFlags::CPUID_AVX512F); 
 }
 
+const bool CpuDetect::AVX512BW()
+{
+	return HasFeature(CpuidFlags::CPUID_AVX512BW);
+}
+
 const bool CpuDetect::BMT2()
 {
 	return HasFeature(CpuidFlags::CPUID_BMI2); 
@@ -269,6 +274,14 @@ const bool CpuDetect::SHA()
 	return HasFeature(CpuidFlags::CPUID_SHA);
 }
 
+SimdProfiles CpuDetect::SimdProfile()
+{
+	// thread-safe static initialization; resolved on the first call
+	static const SimdProfiles PROFILE = SimdDetect();
+
+	return PROFILE;
+}
+
 const bool CpuDetect::SMAP() 
 { 
 	return HasFeature(CpuidFlags::CPUID_SMAP); 
@@ -314,11 +327,21 @@ CpuDetect::CpuVendors CpuDetect::Vendor()
 	return m_cpuVendor; 
 }
 
+const bool CpuDetect::VAES()
+{
+	return HasFeature(CpuidFlags::CPUID_VAES);
+}
+
 const size_t CpuDetect::VirtualCores()
 { 
 	return m_virtCores; 
 }
 
+const bool CpuDetect::VPCLMULQDQ()
+{
+	return HasFeature(CpuidFlags::CPUID_VPCLMULQDQ);
+}
+
 const bool CpuDetect::XOP() 
 { 
 	return HasFeature(CpuidFlags::CPUID_XOP);
@@ -376,7 +399,7 @@ void CpuDetect::Cpuid(int Flag, std::array<uint, 4> &Output)
 #	if defined(CEX_COMPILER_MSC)
 	__cpuid((int*)Output.data(), Flag);
 #	elif defined(CEX_COMPILER_GCC) || defined(CEX_COMPILER_CLANG)
-	__get_cpuid(Flag, Output[0], Output[1], Output[2], Output[3]);
+	__get_cpuid(Flag, &Output[0], &Output[1], &Output[2], &Output[3]);
 #	endif
 #endif
 }
@@ -408,7 +431,7 @@ void CpuDetect::Initialize()
 		m_cpuVendorString = VendorString(cpuInfo);
 		m_cpuVendor = VendorName(m_cpuVendorString);
 
-		std::memset(cpuInfo.data(), 0, 4);
+		std::memset(cpuInfo.data(), 0, 16);
 		Cpuid(1, cpuInfo);
 
 		m_hyperThread = ReadBits(cpuInfo[3], 28, 1) != 0;
@@ -418,22 +441,27 @@ void CpuDetect::Initialize()
 		m_physCores = (m_hyperThread == true && m_virtCores > 1) ? (m_virtCores / 2) : m_virtCores;
 		m_logicalPerCore = (m_virtCores > m_physCores) ? (m_virtCores / m_physCores) : 1;
 		// f1 ecx, edx
-		std::memcpy(&m_x86CpuFlags[0], &cpuInfo[2], 2 * sizeof(ulong));
+		std::memcpy(&m_x86CpuFlags[0], &cpuInfo[2], 2 * sizeof(uint));
 
 		if (m_cpuVendor == CpuVendors::INTEL)
 		{
 			m_cacheLineSize = 8 * ReadBits(cpuInfo[1], 16, 8);
 		}
 
+		// the structured extended features (avx2, avx512, vaes, vpclmulqdq) are reported in leaf 7 by both intel and amd
 		if (SUBLVL >= 7)
 		{
 			std::memset(cpuInfo.data(), 0, 16);
 			CpuidSublevel(7, 0, cpuInfo);
 			// f7 ebx, ecx
-			std::memcpy(&m_x86CpuFlags[2], &cpuInfo[1], 2 * sizeof(ulong));
+			std::memcpy(&m_x86CpuFlags[2], &cpuInfo[1], 2 * sizeof(uint));
 		}
 
-		if (SUBLVL >= 5)
+		std::memset(cpuInfo.data(), 0, 16);
+		Cpuid(0x80000000UL, cpuInfo);
+
+		// the extended leaves are bounded by the extended maximum, not the standard leaf count
+		if (cpuInfo[0] >= 0x80000005UL)
 		{
 			std::memset(cpuInfo.data(), 0, 16);
 			Cpuid(0x80000005UL, cpuInfo);
@@ -446,7 +474,7 @@ void CpuDetect::Initialize()
 			std::memset(cpuInfo.data(), 0, 16);
 			Cpuid(0x80000001UL, cpuInfo);
 			// f8..1 ecx, edx
-			std::memcpy(&m_x86CpuFlags[4], &cpuInfo[2], 2 * sizeof(ulong));
+			std::memcpy(&m_x86CpuFlags[4], &cpuInfo[2], 2 * sizeof(uint));
 			StoreTopology();
 		}
 	}
@@ -505,6 +533,7 @@ void CpuDetect::PrintCpuStats()
 	std::cout << "AVX: " << BoolStr(AVX()) << std::endl;
 	std::cout << "AVX2: " << BoolStr(AVX2()) << std::endl;
 	std::cout << "AVX512F: " << BoolStr(AVX512F()) << std::endl;
+	std::cout << "AVX512BW: " << BoolStr(AVX512BW()) << std::endl;
 	std::cout << "AESNI: " << BoolStr(AESNI()) << std::endl;
 	std::cout << "BMT2: " << BoolStr(BMT2()) << std::endl;
 	std::cout << "BusRefFrequency: " << BusRefFrequency() << std::endl;
@@ -546,6 +575,7 @@ void CpuDetect::PrintCpuStats()
 	std::cout << "SSE42: " << BoolStr(SSE42()) << std::endl;
 	std::cout << "Vendor: " << ((Vendor() == CpuVendors::UNKNOWN) ? "Unknown" : ((Vendor() == CpuVendors::AMD) ? "AMD" : "Intel")) << std::endl;
 	std::cout << "VirtualCores: " << VirtualCores() << std::endl;
+	std::cout << "VPCLMULQDQ: " << BoolStr(VPCLMULQDQ()) << std::endl;
 	std::cout << "XOP: " << BoolStr(XOP()) << std::endl;
 }
 
@@ -555,6 +585,51 @@ uint CpuDetect::ReadBits(uint Value, int Index, int Length)
 	return (Value & mask) >> Index;
 }
 
+SimdProfiles CpuDetect::SimdDetect()
+{
+	SimdProfiles prf;
+
+	prf = SimdProfiles::None;
+
+#if defined(CEX_ARCH_X86_X64)
+
+	CpuDetect dtc;
+	std::array<uint, 4> cpuInfo;
+	ulong xcr;
+
+	xcr = 0;
+	Cpuid(1, cpuInfo);
+
+	// the os must save the extended registers: xmm/ymm (0x06), and opmask/zmm (0xE0)
+	if ((cpuInfo[2] & (1 << 27)) && (cpuInfo[2] & (1 << 28)))
+	{
+		xcr = static_cast<ulong>(_xgetbv(_XCR_XFEATURE_ENABLED_MASK));
+	}
+
+#	if defined(CEX_KERNEL_SIMD512)
+	if (prf == SimdProfiles::None && dtc.AVX512F() && (xcr & 0xE6) == 0xE6)
+	{
+		prf = SimdProfiles::Simd512;
+	}
+#	endif
+#	if defined(CEX_KERNEL_SIMD256)
+	if (prf == SimdProfiles::None && dtc.AVX2() && (xcr & 0x06) == 0x06)
+	{
+		prf = SimdProfiles::Simd256;
+	}
+#	endif
+#	if defined(CEX_KERNEL_SIMD128)
+	if (prf == SimdProfiles::None && dtc.SSE41())
+	{
+		prf = SimdProfiles::Simd128;
+	}
+#	endif
+
+#endif
+
+	return prf;
+}
+
 void CpuDetect::StoreSerialNumber()
 {
 	std::array<uint, 4> cpuInfo;
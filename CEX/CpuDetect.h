@@ -2,9 +2,12 @@
 #define CEX_CPUDETECT_H
 
 #include "CexDomain.h"
+#include "SimdProfiles.h"
 
 NAMESPACE_ROOT
 
+using Enumeration::SimdProfiles;
+
 /// <summary>
 /// Detects Cpu features and capabilities
 /// </summary>
@@ -67,7 +70,10 @@ private:
 		CPUID_ADX = 64 + 19, // ebx 18
 		CPUID_SMAP = 64 + 20, // ebx 20
 		CPUID_SHA = 64 + 29, // ebx 29
-		CPUID_PREFETCH = 64 + 32, // ebx 32 -index 2, 3
+		CPUID_AVX512BW = 64 + 30, // ebx 30
+		CPUID_PREFETCH = 64 + 32, // ebx 32
+		CPUID_VAES = 64 + 32 + 9, // ecx 9
+		CPUID_VPCLMULQDQ = 64 + 32 + 10, // ecx 10 -index 2, 3
 		// EAX=80000001
 		CPUID_ABM = 128 + 5, // ecx 5
 		CPUID_SSE4A = 128 + 6, // ecx 6
@@ -167,6 +173,13 @@ public:
 	/// <returns>Returns true if the feature is available</returns>
 	const bool AVX512F();
 
+	/// <summary>
+	/// AVX512 Byte and Word instructions detected
+	/// </summary>
+	///
+	/// <returns>Returns true if the feature is available</returns>
+	const bool AVX512BW();
+
 	/// <summary>
 	/// Bit Manipulation Instruction Set 2
 	/// </summary>
@@ -366,6 +379,15 @@ public:
 	/// <returns>Returns true if the feature is available</returns>
 	const bool SHA();
 
+	/// <summary>
+	/// The SIMD profile used by the run-time dispatched permutation kernels.
+	/// <para>The widest instruction set that is supported by the processor, saved by the operating system, and compiled into the library (see CEX_SIMD_DISPATCH).
+	/// The profile is resolved once, on the first call, and is constant for the lifetime of the process.</para>
+	/// </summary>
+	///
+	/// <returns>Returns the selected SIMD profile</returns>
+	static SimdProfiles SimdProfile();
+
 	/// <summary>
 	/// Supervisor Mode Access Prevention
 	/// </summary>
@@ -429,6 +451,13 @@ public:
 	/// <returns>Returns the CPU vendors string</returns>
 	CpuVendors Vendor();
 
+	/// <summary>
+	/// Vector AES instructions available; the AES-NI round instructions operating on 256 and 512 bit registers
+	/// </summary>
+	///
+	/// <returns>Returns true if the feature is available</returns>
+	const bool VAES();
+
 	/// <summary>
 	/// The total number of threads available using hyperthreading
 	/// </summary>
@@ -436,6 +465,13 @@ public:
 	/// <returns>Returns the total number of virtual and physical cores</returns>
 	const size_t VirtualCores();
 
+	/// <summary>
+	/// Vector carry-less multiply instructions available; the PCLMULQDQ instruction operating on 256 and 512 bit registers
+	/// </summary>
+	///
+	/// <returns>Returns true if the feature is available</returns>
+	const bool VPCLMULQDQ();
+
 	/// <summary>
 	/// Returns true if the AMD eXtended Operations feature set is detected
 	/// </summary>
@@ -456,6 +492,7 @@ private:
 	size_t MaxLogicalPerCores();
 	void PrintCpuStats();
 	static uint ReadBits(uint Value, int Index, int Length);
+	static SimdProfiles SimdDetect();
 	void StoreSerialNumber();
 	void StoreTopology();
 	const CpuVendors VendorName(std::string &Name);
@@ -1,4 +1,5 @@
 #include "DLMNPolyMath.h"
+#include "CpuDetect.h"
 #include "Keccak.h"
 #include "MemoryTools.h"
 
@@ -471,6 +472,26 @@ void DLMNPolyMath::PolyDecompose(std::array<uint, 256> &A1, std::array<uint, 256
 {
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyDecomposeV16(A1, A0, A);
+		return;
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyDecomposeV(A1, A0, A);
+		return;
+	}
+#endif
+
 	for (i = 0; i < A1.size(); ++i)
 	{
 		A1[i] = Decompose(A[i], A0[i]);
@@ -562,6 +583,16 @@ void DLMNPolyMath::PolyFreeze(std::array<uint, 256> &A)
 
 void DLMNPolyMath::PolyInvNttMontgomery(std::array<uint, 256> &A)
 {
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		InvNttV(A);
+		return;
+	}
+#endif
+
 	InvNttFromInvMont(A);
 }
 
@@ -570,6 +601,24 @@ uint DLMNPolyMath::PolyMakeHint(std::array<uint, 256> &H, const std::array<uint,
 	size_t i;
 	uint s;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		return PolyMakeHintV16(H, A0, A1);
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		return PolyMakeHintV(H, A0, A1);
+	}
+#endif
+
 	s = 0;
 
 	for (i = 0; i < H.size(); ++i)
@@ -583,6 +632,26 @@ uint DLMNPolyMath::PolyMakeHint(std::array<uint, 256> &H, const std::array<uint,
 
 void DLMNPolyMath::PolyNtt(std::array<uint, 256> &A)
 {
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		NttV16(A);
+		return;
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		NttV(A, 128, 1);
+		return;
+	}
+#endif
+
 	Ntt(A);
 }
 
@@ -590,6 +659,26 @@ void DLMNPolyMath::PolyPointwiseInvMontgomery(std::array<uint, 256> &C, const st
 {
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyPointwiseInvMontgomeryV16(C, A, B);
+		return;
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyPointwiseInvMontgomeryV(C, A, B);
+		return;
+	}
+#endif
+
 	for (i = 0; i < C.size(); ++i)
 	{
 		C[i] = MontgomeryReduce(static_cast<ulong>(A[i]) * B[i]);
@@ -610,6 +699,26 @@ void DLMNPolyMath::PolyReduce(std::array<uint, 256> &A)
 {
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyReduceV16(A);
+		return;
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyReduceV(A);
+		return;
+	}
+#endif
+
 	for (i = 0; i < A.size(); ++i)
 	{
 		A[i] = Reduce32(A[i]);
@@ -1327,6 +1436,82 @@ void DLMNPolyMath::Challenge(std::array<uint, 256> &C, const std::vector<byte> &
 	}
 }
 
+bool DLMNPolyMath::ChallengeSample(std::array<uint, 256> &C, const std::vector<byte> &Stream, size_t Offset, size_t Length)
+{
+	// samples the challenge from a pre-squeezed stream, returns false if the stream is exhausted
+	ulong signs;
+	size_t b;
+	size_t i;
+	size_t pos;
+
+	signs = 0;
+
+	for (i = 0; i < 8; ++i)
+	{
+		signs |= static_cast<ulong>(Stream[Offset + i]) << 8 * i;
+	}
+
+	pos = 8;
+	MemoryTools::Clear(C, 0, C.size() * sizeof(uint));
+
+	for (i = 196; i < 256; ++i)
+	{
+		do
+		{
+			if (pos >= Length)
+			{
+				return false;
+			}
+
+			b = (size_t)Stream[Offset + pos];
+			++pos;
+		} while (b > i);
+
+		C[i] = C[b];
+		C[b] = 1;
+		C[b] ^= static_cast<uint>(~(signs &1) + 1) &(1 ^ (DILITHIUM_Q - 1));
+		signs >>= 1;
+	}
+
+	return true;
+}
+
+void DLMNPolyMath::ChallengeW(std::vector<std::array<uint, 256>> &C, const std::vector<byte> &Mu, const std::vector<std::vector<std::array<uint, 256>>> &W1, size_t Count)
+{
+	// the lane-batched form of Challenge; Mu holds Count consecutive digests, and two rate blocks 
+	// are squeezed from each lane, which satisfies the sampler in all but a negligible number of cases
+	const size_t MULEN = Mu.size() / Count;
+	const size_t INPLEN = MULEN + (W1[0].size() * DILITHIUM_POLW1_SIZE_PACKED);
+	const size_t OUTLEN = 2 * Keccak::KECCAK256_RATE_SIZE;
+	std::vector<byte> inbuf(Count * INPLEN);
+	std::vector<byte> mu(MULEN);
+	std::vector<byte> outbuf(Count * OUTLEN);
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < Count; ++i)
+	{
+		MemoryTools::Copy(Mu, i * MULEN, inbuf, i * INPLEN, MULEN);
+
+		for (j = 0; j < W1[i].size(); ++j)
+		{
+			PolyW1Pack(inbuf, (i * INPLEN) + MULEN + (j * DILITHIUM_POLW1_SIZE_PACKED), W1[i][j]);
+		}
+	}
+
+	XOFW(inbuf, 0, INPLEN, outbuf, 0, OUTLEN, Count, Keccak::KECCAK256_RATE_SIZE);
+
+	for (i = 0; i < Count; ++i)
+	{
+		if (!ChallengeSample(C[i], outbuf, i * OUTLEN, OUTLEN))
+		{
+			// the stream was exhausted, continue the squeeze sequentially
+			MemoryTools::Copy(Mu, i * MULEN, mu, 0, MULEN);
+			Challenge(C[i], mu, W1[i]);
+		}
+	}
+}
+
 void DLMNPolyMath::ExpandMat(std::vector<std::vector<std::array<uint, 256>>> &Matrix, const std::vector<byte> &Rho)
 {
 	size_t i;
@@ -1341,4 +1526,107 @@ void DLMNPolyMath::ExpandMat(std::vector<std::vector<std::array<uint, 256>>> &Ma
 	}
 }
 
+// expanded keys //
+
+void DLMNPolyMath::ClearExpanded(DlmExpandedPrivateKey &PrivateKey)
+{
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < PrivateKey.Matrix.size(); ++i)
+	{
+		for (j = 0; j < PrivateKey.Matrix[i].size(); ++j)
+		{
+			MemoryTools::Clear(PrivateKey.Matrix[i][j], 0, PrivateKey.Matrix[i][j].size() * sizeof(uint));
+		}
+	}
+
+	for (i = 0; i < PrivateKey.S1Hat.size(); ++i)
+	{
+		MemoryTools::Clear(PrivateKey.S1Hat[i], 0, PrivateKey.S1Hat[i].size() * sizeof(uint));
+	}
+
+	for (i = 0; i < PrivateKey.S2Hat.size(); ++i)
+	{
+		MemoryTools::Clear(PrivateKey.S2Hat[i], 0, PrivateKey.S2Hat[i].size() * sizeof(uint));
+	}
+
+	for (i = 0; i < PrivateKey.T0Hat.size(); ++i)
+	{
+		MemoryTools::Clear(PrivateKey.T0Hat[i], 0, PrivateKey.T0Hat[i].size() * sizeof(uint));
+	}
+
+	MemoryTools::Clear(PrivateKey.Key, 0, PrivateKey.Key.size());
+	MemoryTools::Clear(PrivateKey.Tr, 0, PrivateKey.Tr.size());
+	PrivateKey.Matrix.clear();
+	PrivateKey.S1Hat.clear();
+	PrivateKey.S2Hat.clear();
+	PrivateKey.T0Hat.clear();
+	PrivateKey.Key.clear();
+	PrivateKey.Tr.clear();
+}
+
+void DLMNPolyMath::ClearExpanded(DlmExpandedPublicKey &PublicKey)
+{
+	PublicKey.Matrix.clear();
+	PublicKey.T1Hat.clear();
+	PublicKey.Tr.clear();
+}
+
+// batched hashing //
+
+void DLMNPolyMath::XOFW(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Count, size_t Rate)
+{
+	// processes Count consecutive inputs of InLength bytes, writing Count consecutive outputs of OutLength bytes
+	size_t i;
+
+	i = 0;
+
+#if defined(CEX_KERNEL_SIMD256)
+
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+#	if defined(CEX_KERNEL_SIMD512)
+
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		while (Count - i >= 8)
+		{
+			Keccak::XOFR24P8x1600(Input, InOffset + (i * InLength), InLength, Output, OutOffset + (i * OutLength), OutLength, Rate);
+			i += 8;
+		}
+	}
+
+#	endif
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		while (Count - i >= 4)
+		{
+			Keccak::XOFR24P4x1600(Input, InOffset + (i * InLength), InLength, Output, OutOffset + (i * OutLength), OutLength, Rate);
+			i += 4;
+		}
+
+		if (Count - i > 1)
+		{
+			// pad a partial group to a full vector
+			std::vector<byte> tmpi(4 * InLength, 0x00);
+			std::vector<byte> tmpo(4 * OutLength);
+
+			MemoryTools::Copy(Input, InOffset + (i * InLength), tmpi, 0, (Count - i) * InLength);
+			Keccak::XOFR24P4x1600(tmpi, 0, InLength, tmpo, 0, OutLength, Rate);
+			MemoryTools::Copy(tmpo, 0, Output, OutOffset + (i * OutLength), (Count - i) * OutLength);
+			i = Count;
+		}
+	}
+
+#endif
+
+	while (i != Count)
+	{
+		Keccak::XOFR24P1600(Input, InOffset + (i * InLength), InLength, Output, OutOffset + (i * OutLength), OutLength, Rate);
+		++i;
+	}
+}
+
 NAMESPACE_DILITHIUMEND
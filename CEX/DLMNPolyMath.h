@@ -58,8 +58,61 @@ private:
 	// roots of unity in order needed by inverse ntt
 	static const uint ZetasInv[DILITHIUM_N];
 
+#if defined(CEX_KERNEL_SIMD256)
+
+	static void InvNttV(std::array<uint, 256> &P);
+
+	static void NttV(std::array<uint, 256> &P, size_t Length, size_t Index);
+
+	static void PolyDecomposeV(std::array<uint, 256> &A1, std::array<uint, 256> &A0, const std::array<uint, 256> &A);
+
+	static uint PolyMakeHintV(std::array<uint, 256> &H, const std::array<uint, 256> &A0, const std::array<uint, 256> &A1);
+
+	static void PolyPointwiseInvMontgomeryV(std::array<uint, 256> &C, const std::array<uint, 256> &A, const std::array<uint, 256> &B);
+
+	static void PolyReduceV(std::array<uint, 256> &A);
+
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+
+	static void NttV16(std::array<uint, 256> &P);
+
+	static void PolyDecomposeV16(std::array<uint, 256> &A1, std::array<uint, 256> &A0, const std::array<uint, 256> &A);
+
+	static uint PolyMakeHintV16(std::array<uint, 256> &H, const std::array<uint, 256> &A0, const std::array<uint, 256> &A1);
+
+	static void PolyPointwiseInvMontgomeryV16(std::array<uint, 256> &C, const std::array<uint, 256> &A, const std::array<uint, 256> &B);
+
+	static void PolyReduceV16(std::array<uint, 256> &A);
+
+#endif
+
 public:
 
+	/// <summary>
+	/// A private key in its signing form: the expanded matrix A, and the NTT domain secret vectors
+	/// </summary>
+	typedef struct
+	{
+		std::vector<std::vector<std::array<uint, 256>>> Matrix;
+		std::vector<std::array<uint, 256>> S1Hat;
+		std::vector<std::array<uint, 256>> S2Hat;
+		std::vector<std::array<uint, 256>> T0Hat;
+		std::vector<byte> Key;
+		std::vector<byte> Tr;
+	} DlmExpandedPrivateKey;
+
+	/// <summary>
+	/// A public key in its verification form: the expanded matrix A, the NTT domain t1 * 2^d, and CRH(rho, t1)
+	/// </summary>
+	typedef struct
+	{
+		std::vector<std::vector<std::array<uint, 256>>> Matrix;
+		std::vector<std::array<uint, 256>> T1Hat;
+		std::vector<byte> Tr;
+	} DlmExpandedPublicKey;
+
 	// ntt.c //
 
 	static void InvNttFromInvMont(std::array<uint, 256> &P);
@@ -196,7 +249,21 @@ public:
 
 	static void Challenge(std::array<uint, 256> &C, const std::vector<byte> &Mu, const std::vector<std::array<uint, 256>> &W1);
 
+	static bool ChallengeSample(std::array<uint, 256> &C, const std::vector<byte> &Stream, size_t Offset, size_t Length);
+
+	static void ChallengeW(std::vector<std::array<uint, 256>> &C, const std::vector<byte> &Mu, const std::vector<std::vector<std::array<uint, 256>>> &W1, size_t Count);
+
 	static void ExpandMat(std::vector<std::vector<std::array<uint, 256>>> &Matrix, const std::vector<byte> &Rho);
+
+	// expanded keys //
+
+	static void ClearExpanded(DlmExpandedPrivateKey &PrivateKey);
+
+	static void ClearExpanded(DlmExpandedPublicKey &PublicKey);
+
+	// batched hashing //
+
+	static void XOFW(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Count, size_t Rate);
 };
 
 NAMESPACE_DILITHIUMEND
@@ -0,0 +1,325 @@
+#include "DLMNPolyMath.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "DLMNPolyMathSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_DILITHIUM
+
+#if defined(CEX_KERNEL_SIMD256)
+
+namespace
+{
+	// the montgomery product of 8 coefficient pairs, Q holds the modulus and QInv -q^(-1) mod 2^32
+	__m256i MontgomeryReduceV(const __m256i &A, const __m256i &B, const __m256i &Q, const __m256i &QInv)
+	{
+		// the 64-bit products of the even and odd lanes are reduced separately, then merged
+		__m256i pe;
+		__m256i po;
+		__m256i te;
+		__m256i to;
+
+		pe = _mm256_mul_epu32(A, B);
+		po = _mm256_mul_epu32(_mm256_srli_epi64(A, 32), _mm256_srli_epi64(B, 32));
+		te = _mm256_mul_epu32(_mm256_mul_epu32(pe, QInv), Q);
+		to = _mm256_mul_epu32(_mm256_mul_epu32(po, QInv), Q);
+		te = _mm256_srli_epi64(_mm256_add_epi64(pe, te), 32);
+		to = _mm256_add_epi64(po, to);
+
+		return _mm256_blend_epi32(te, to, 0xAA);
+	}
+
+	void InvNttButterflyV(__m256i &A, __m256i &B, const __m256i &Zeta, const __m256i &Q, const __m256i &QInv)
+	{
+		const __m256i Q256 = _mm256_slli_epi32(Q, 8);
+		__m256i t;
+
+		t = A;
+		A = _mm256_add_epi32(t, B);
+		B = MontgomeryReduceV(Zeta, _mm256_sub_epi32(_mm256_add_epi32(t, Q256), B), Q, QInv);
+	}
+
+	void NttButterflyV(__m256i &A, __m256i &B, const __m256i &Zeta, const __m256i &Q, const __m256i &QInv)
+	{
+		const __m256i Q2 = _mm256_slli_epi32(Q, 1);
+		__m256i t;
+
+		t = MontgomeryReduceV(Zeta, B, Q, QInv);
+		B = _mm256_sub_epi32(_mm256_add_epi32(A, Q2), t);
+		A = _mm256_add_epi32(A, t);
+	}
+}
+
+void DLMNPolyMath::InvNttV(std::array<uint, 256> &P)
+{
+	const uint F = ((static_cast<ulong>(DILITHIUM_MONT) * DILITHIUM_MONT % DILITHIUM_Q) * (DILITHIUM_Q - 1) % DILITHIUM_Q) * ((DILITHIUM_Q - 1) >> 8) % DILITHIUM_Q;
+	const __m256i IDX1 = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+	const __m256i IDX2 = _mm256_setr_epi32(0, 0, 2, 2, 1, 1, 3, 3);
+	const __m256i IDX4 = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+	const __m256i Q = _mm256_set1_epi32(DILITHIUM_Q);
+	const __m256i QINV = _mm256_set1_epi32(DILITHIUM_QINV);
+	__m256i a;
+	__m256i b;
+	__m256i v0;
+	__m256i v1;
+	__m256i z;
+	size_t j;
+	size_t k;
+	size_t len;
+	size_t start;
+
+	// len 1: butterflies on the even and odd coefficients of 16 consecutive values
+	for (j = 0, k = 0; j < P.size(); j += 16, k += 8)
+	{
+		v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + 8));
+		a = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(v0), _mm256_castsi256_ps(v1), 0x88));
+		b = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(v0), _mm256_castsi256_ps(v1), 0xDD));
+		z = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ZetasInv + k)), IDX1);
+		InvNttButterflyV(a, b, z, Q, QINV);
+		v0 = _mm256_castps_si256(_mm256_unpacklo_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		v1 = _mm256_castps_si256(_mm256_unpackhi_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), v0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + 8), v1);
+	}
+
+	// len 2: 64-bit interleave
+	for (j = 0; j < P.size(); j += 16, k += 4)
+	{
+		v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + 8));
+		a = _mm256_unpacklo_epi64(v0, v1);
+		b = _mm256_unpackhi_epi64(v0, v1);
+		z = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ZetasInv + k))), IDX2);
+		InvNttButterflyV(a, b, z, Q, QINV);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), _mm256_unpacklo_epi64(a, b));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + 8), _mm256_unpackhi_epi64(a, b));
+	}
+
+	// len 4: 128-bit interleave
+	for (j = 0; j < P.size(); j += 16, k += 2)
+	{
+		v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + 8));
+		a = _mm256_permute2x128_si256(v0, v1, 0x20);
+		b = _mm256_permute2x128_si256(v0, v1, 0x31);
+		z = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ZetasInv + k))), IDX4);
+		InvNttButterflyV(a, b, z, Q, QINV);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), _mm256_permute2x128_si256(a, b, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + 8), _mm256_permute2x128_si256(a, b, 0x31));
+	}
+
+	for (len = 8; len < P.size(); len <<= 1)
+	{
+		for (start = 0; start < P.size(); start += 2 * len)
+		{
+			z = _mm256_set1_epi32(ZetasInv[k]);
+			++k;
+
+			for (j = start; j < start + len; j += 8)
+			{
+				a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+				b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + len));
+				InvNttButterflyV(a, b, z, Q, QINV);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), a);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + len), b);
+			}
+		}
+	}
+
+	z = _mm256_set1_epi32(F);
+
+	for (j = 0; j < P.size(); j += 8)
+	{
+		a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), MontgomeryReduceV(z, a, Q, QINV));
+	}
+}
+
+void DLMNPolyMath::NttV(std::array<uint, 256> &P, size_t Length, size_t Index)
+{
+	const __m256i IDX1 = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+	const __m256i IDX2 = _mm256_setr_epi32(0, 0, 2, 2, 1, 1, 3, 3);
+	const __m256i IDX4 = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+	const __m256i Q = _mm256_set1_epi32(DILITHIUM_Q);
+	const __m256i QINV = _mm256_set1_epi32(DILITHIUM_QINV);
+	__m256i a;
+	__m256i b;
+	__m256i v0;
+	__m256i v1;
+	__m256i z;
+	size_t j;
+	size_t k;
+	size_t len;
+	size_t start;
+
+	k = Index;
+	len = Length;
+
+	for (; len >= 8; len >>= 1)
+	{
+		for (start = 0; start < P.size(); start += 2 * len)
+		{
+			z = _mm256_set1_epi32(Zetas[k]);
+			++k;
+
+			for (j = start; j < start + len; j += 8)
+			{
+				a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+				b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + len));
+				NttButterflyV(a, b, z, Q, QINV);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), a);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + len), b);
+			}
+		}
+	}
+
+	// len 4: 128-bit interleave
+	for (j = 0; j < P.size(); j += 16, k += 2)
+	{
+		v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + 8));
+		a = _mm256_permute2x128_si256(v0, v1, 0x20);
+		b = _mm256_permute2x128_si256(v0, v1, 0x31);
+		z = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Zetas + k))), IDX4);
+		NttButterflyV(a, b, z, Q, QINV);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), _mm256_permute2x128_si256(a, b, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + 8), _mm256_permute2x128_si256(a, b, 0x31));
+	}
+
+	// len 2: 64-bit interleave
+	for (j = 0; j < P.size(); j += 16, k += 4)
+	{
+		v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + 8));
+		a = _mm256_unpacklo_epi64(v0, v1);
+		b = _mm256_unpackhi_epi64(v0, v1);
+		z = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Zetas + k))), IDX2);
+		NttButterflyV(a, b, z, Q, QINV);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), _mm256_unpacklo_epi64(a, b));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + 8), _mm256_unpackhi_epi64(a, b));
+	}
+
+	// len 1: butterflies on the even and odd coefficients of 16 consecutive values
+	for (j = 0; j < P.size(); j += 16, k += 8)
+	{
+		v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j));
+		v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P.data() + j + 8));
+		a = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(v0), _mm256_castsi256_ps(v1), 0x88));
+		b = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(v0), _mm256_castsi256_ps(v1), 0xDD));
+		z = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Zetas + k)), IDX1);
+		NttButterflyV(a, b, z, Q, QINV);
+		v0 = _mm256_castps_si256(_mm256_unpacklo_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		v1 = _mm256_castps_si256(_mm256_unpackhi_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j), v0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(P.data() + j + 8), v1);
+	}
+}
+
+void DLMNPolyMath::PolyDecomposeV(std::array<uint, 256> &A1, std::array<uint, 256> &A0, const std::array<uint, 256> &A)
+{
+	const __m256i ALPHA = _mm256_set1_epi32(DILITHIUM_ALPHA);
+	const __m256i AH1 = _mm256_set1_epi32((DILITHIUM_ALPHA / 2) + 1);
+	const __m256i AL1 = _mm256_set1_epi32((DILITHIUM_ALPHA / 2) - 1);
+	const __m256i MASK = _mm256_set1_epi32(0x0007FFFFL);
+	const __m256i ONE = _mm256_set1_epi32(1);
+	const __m256i Q = _mm256_set1_epi32(DILITHIUM_Q);
+	__m256i a;
+	__m256i t;
+	__m256i u;
+	size_t i;
+
+	for (i = 0; i < A1.size(); i += 8)
+	{
+		a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A.data() + i));
+		// centralized remainder mod ALPHA
+		t = _mm256_and_si256(a, MASK);
+		t = _mm256_add_epi32(t, _mm256_slli_epi32(_mm256_srli_epi32(a, 19), 9));
+		t = _mm256_sub_epi32(t, AH1);
+		t = _mm256_add_epi32(t, _mm256_and_si256(_mm256_srai_epi32(t, 31), ALPHA));
+		t = _mm256_sub_epi32(t, AL1);
+		a = _mm256_sub_epi32(a, t);
+		// divide by ALPHA, subtracting one where a - 1 is negative
+		u = _mm256_srli_epi32(_mm256_sub_epi32(a, ONE), 31);
+		a = _mm256_add_epi32(_mm256_srli_epi32(a, 19), ONE);
+		a = _mm256_sub_epi32(a, u);
+		// border case
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(A0.data() + i), _mm256_sub_epi32(_mm256_add_epi32(Q, t), _mm256_srli_epi32(a, 4)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(A1.data() + i), _mm256_and_si256(a, _mm256_set1_epi32(0x0F)));
+	}
+}
+
+uint DLMNPolyMath::PolyMakeHintV(std::array<uint, 256> &H, const std::array<uint, 256> &A0, const std::array<uint, 256> &A1)
+{
+	const __m256i GLO = _mm256_set1_epi32(DILITHIUM_GAMMA2);
+	const __m256i GHI = _mm256_set1_epi32(DILITHIUM_Q - DILITHIUM_GAMMA2);
+	const __m256i ONE = _mm256_set1_epi32(1);
+	__m256i a0;
+	__m256i a1;
+	__m256i h;
+	__m256i m;
+	__m256i sum;
+	size_t i;
+	uint s;
+
+	s = 0;
+	sum = _mm256_setzero_si256();
+
+	for (i = 0; i < H.size(); i += 8)
+	{
+		a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A0.data() + i));
+		a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A1.data() + i));
+		// unsigned a0 <= GAMMA2, a0 > Q - GAMMA2, or a0 == Q - GAMMA2 and a1 == 0
+		m = _mm256_cmpeq_epi32(_mm256_min_epu32(a0, GLO), a0);
+		m = _mm256_or_si256(m, _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(a0, GHI), GHI), _mm256_set1_epi32(-1)));
+		m = _mm256_or_si256(m, _mm256_and_si256(_mm256_cmpeq_epi32(a0, GHI), _mm256_cmpeq_epi32(a1, _mm256_setzero_si256())));
+		h = _mm256_andnot_si256(m, ONE);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(H.data() + i), h);
+		sum = _mm256_add_epi32(sum, h);
+	}
+
+	sum = _mm256_hadd_epi32(sum, sum);
+	sum = _mm256_hadd_epi32(sum, sum);
+	s = static_cast<uint>(_mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4));
+
+	return s;
+}
+
+void DLMNPolyMath::PolyPointwiseInvMontgomeryV(std::array<uint, 256> &C, const std::array<uint, 256> &A, const std::array<uint, 256> &B)
+{
+	const __m256i Q = _mm256_set1_epi32(DILITHIUM_Q);
+	const __m256i QINV = _mm256_set1_epi32(DILITHIUM_QINV);
+	size_t i;
+
+	for (i = 0; i < C.size(); i += 8)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(C.data() + i), MontgomeryReduceV(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(A.data() + i)),
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(B.data() + i)), Q, QINV));
+	}
+}
+
+void DLMNPolyMath::PolyReduceV(std::array<uint, 256> &A)
+{
+	const __m256i MASK = _mm256_set1_epi32(0x007FFFFFUL);
+	__m256i a;
+	__m256i t;
+	size_t i;
+
+	for (i = 0; i < A.size(); i += 8)
+	{
+		a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A.data() + i));
+		t = _mm256_and_si256(a, MASK);
+		a = _mm256_srli_epi32(a, 23);
+		t = _mm256_add_epi32(t, _mm256_sub_epi32(_mm256_slli_epi32(a, 13), a));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(A.data() + i), t);
+	}
+}
+
+#endif
+
+NAMESPACE_DILITHIUMEND
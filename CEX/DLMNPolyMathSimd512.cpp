@@ -0,0 +1,164 @@
+#include "DLMNPolyMath.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD512) && !defined(__AVX512__)
+#	error "DLMNPolyMathSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_DILITHIUM
+
+#if defined(CEX_KERNEL_SIMD512)
+
+namespace
+{
+	// the montgomery product of 16 coefficient pairs, Q holds the modulus and QInv -q^(-1) mod 2^32
+	__m512i MontgomeryReduceV16(const __m512i &A, const __m512i &B, const __m512i &Q, const __m512i &QInv)
+	{
+		__m512i pe;
+		__m512i po;
+		__m512i te;
+		__m512i to;
+
+		pe = _mm512_mul_epu32(A, B);
+		po = _mm512_mul_epu32(_mm512_srli_epi64(A, 32), _mm512_srli_epi64(B, 32));
+		te = _mm512_mul_epu32(_mm512_mul_epu32(pe, QInv), Q);
+		to = _mm512_mul_epu32(_mm512_mul_epu32(po, QInv), Q);
+		te = _mm512_srli_epi64(_mm512_add_epi64(pe, te), 32);
+		to = _mm512_add_epi64(po, to);
+
+		return _mm512_mask_blend_epi32(0xAAAA, te, to);
+	}
+}
+
+void DLMNPolyMath::NttV16(std::array<uint, 256> &P)
+{
+	const __m512i Q = _mm512_set1_epi32(DILITHIUM_Q);
+	const __m512i Q2 = _mm512_set1_epi32(2 * DILITHIUM_Q);
+	const __m512i QINV = _mm512_set1_epi32(DILITHIUM_QINV);
+	__m512i a16;
+	__m512i b16;
+	__m512i t16;
+	__m512i z16;
+	size_t j;
+	size_t k;
+	size_t len;
+	size_t start;
+
+	k = 1;
+	len = 128;
+
+	for (; len >= 16; len >>= 1)
+	{
+		for (start = 0; start < P.size(); start += 2 * len)
+		{
+			z16 = _mm512_set1_epi32(Zetas[k]);
+			++k;
+
+			for (j = start; j < start + len; j += 16)
+			{
+				a16 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(P.data() + j));
+				b16 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(P.data() + j + len));
+				t16 = MontgomeryReduceV16(z16, b16, Q, QINV);
+				_mm512_storeu_si512(reinterpret_cast<__m512i*>(P.data() + j + len), _mm512_sub_epi32(_mm512_add_epi32(a16, Q2), t16));
+				_mm512_storeu_si512(reinterpret_cast<__m512i*>(P.data() + j), _mm512_add_epi32(a16, t16));
+			}
+		}
+	}
+
+	// the remaining layers fit in 256-bit registers
+	NttV(P, len, k);
+}
+
+void DLMNPolyMath::PolyDecomposeV16(std::array<uint, 256> &A1, std::array<uint, 256> &A0, const std::array<uint, 256> &A)
+{
+	const __m512i ALPHA = _mm512_set1_epi32(DILITHIUM_ALPHA);
+	const __m512i AH1 = _mm512_set1_epi32((DILITHIUM_ALPHA / 2) + 1);
+	const __m512i AL1 = _mm512_set1_epi32((DILITHIUM_ALPHA / 2) - 1);
+	const __m512i MASK = _mm512_set1_epi32(0x0007FFFFL);
+	const __m512i ONE = _mm512_set1_epi32(1);
+	const __m512i Q = _mm512_set1_epi32(DILITHIUM_Q);
+	__m512i a;
+	__m512i t;
+	__m512i u;
+	size_t i;
+
+	for (i = 0; i < A1.size(); i += 16)
+	{
+		a = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(A.data() + i));
+		t = _mm512_and_si512(a, MASK);
+		t = _mm512_add_epi32(t, _mm512_slli_epi32(_mm512_srli_epi32(a, 19), 9));
+		t = _mm512_sub_epi32(t, AH1);
+		t = _mm512_add_epi32(t, _mm512_and_si512(_mm512_srai_epi32(t, 31), ALPHA));
+		t = _mm512_sub_epi32(t, AL1);
+		a = _mm512_sub_epi32(a, t);
+		u = _mm512_srli_epi32(_mm512_sub_epi32(a, ONE), 31);
+		a = _mm512_add_epi32(_mm512_srli_epi32(a, 19), ONE);
+		a = _mm512_sub_epi32(a, u);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(A0.data() + i), _mm512_sub_epi32(_mm512_add_epi32(Q, t), _mm512_srli_epi32(a, 4)));
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(A1.data() + i), _mm512_and_si512(a, _mm512_set1_epi32(0x0F)));
+	}
+}
+
+uint DLMNPolyMath::PolyMakeHintV16(std::array<uint, 256> &H, const std::array<uint, 256> &A0, const std::array<uint, 256> &A1)
+{
+	const __m512i GLO = _mm512_set1_epi32(DILITHIUM_GAMMA2);
+	const __m512i GHI = _mm512_set1_epi32(DILITHIUM_Q - DILITHIUM_GAMMA2);
+	__m512i a0;
+	__m512i a1;
+	__m512i h;
+	__mmask16 m;
+	size_t i;
+	uint s;
+
+	s = 0;
+
+	for (i = 0; i < H.size(); i += 16)
+	{
+		a0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(A0.data() + i));
+		a1 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(A1.data() + i));
+		m = _mm512_cmple_epu32_mask(a0, GLO) | _mm512_cmpgt_epu32_mask(a0, GHI) | (_mm512_cmpeq_epi32_mask(a0, GHI) & _mm512_cmpeq_epi32_mask(a1, _mm512_setzero_si512()));
+		h = _mm512_maskz_set1_epi32(static_cast<__mmask16>(~m), 1);
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(H.data() + i), h);
+		s += static_cast<uint>(_mm512_reduce_add_epi32(h));
+	}
+
+	return s;
+}
+
+void DLMNPolyMath::PolyPointwiseInvMontgomeryV16(std::array<uint, 256> &C, const std::array<uint, 256> &A, const std::array<uint, 256> &B)
+{
+	const __m512i Q = _mm512_set1_epi32(DILITHIUM_Q);
+	const __m512i QINV = _mm512_set1_epi32(DILITHIUM_QINV);
+	size_t i;
+
+	for (i = 0; i < C.size(); i += 16)
+	{
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(C.data() + i), MontgomeryReduceV16(
+			_mm512_loadu_si512(reinterpret_cast<const __m512i*>(A.data() + i)),
+			_mm512_loadu_si512(reinterpret_cast<const __m512i*>(B.data() + i)), Q, QINV));
+	}
+}
+
+void DLMNPolyMath::PolyReduceV16(std::array<uint, 256> &A)
+{
+	const __m512i MASK = _mm512_set1_epi32(0x007FFFFFUL);
+	__m512i a;
+	__m512i t;
+	size_t i;
+
+	for (i = 0; i < A.size(); i += 16)
+	{
+		a = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(A.data() + i));
+		t = _mm512_and_si512(a, MASK);
+		a = _mm512_srli_epi32(a, 23);
+		t = _mm512_add_epi32(t, _mm512_sub_epi32(_mm512_slli_epi32(a, 13), a));
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(A.data() + i), t);
+	}
+}
+
+#endif
+
+NAMESPACE_DILITHIUMEND
@@ -73,23 +73,63 @@ void DLTMK4Q8380417N256::Generate(std::vector<byte> &PublicKey, std::vector<byte
 	DLMNPolyMath::PackSk(PrivateKey, rho, key, tr, s1, s2, t0, DILITHIUM_ETA, DILITHIUM_POLETA_SIZE_PACKED, DILITHIUM_POLT0_SIZE_PACKED);
 }
 
-void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng)
+void DLTMK4Q8380417N256::ExpandPrivateKey(DLMNPolyMath::DlmExpandedPrivateKey &Expanded, const std::vector<byte> &PrivateKey)
 {
 	std::vector<byte> rho(DILITHIUM_SEED_SIZE);
-	std::vector<byte> tr(DILITHIUM_CRH_SIZE);
-	std::vector<byte> key(DILITHIUM_SEED_SIZE);
+
+	Expanded.Matrix.assign(DILITHIUM_K, std::vector<std::array<uint, 256>>(DILITHIUM_L));
+	Expanded.S1Hat.resize(DILITHIUM_L);
+	Expanded.S2Hat.resize(DILITHIUM_K);
+	Expanded.T0Hat.resize(DILITHIUM_K);
+	Expanded.Key.resize(DILITHIUM_SEED_SIZE);
+	Expanded.Tr.resize(DILITHIUM_CRH_SIZE);
+
+	DLMNPolyMath::UnpackSk(rho, Expanded.Key, Expanded.Tr, Expanded.S1Hat, Expanded.S2Hat, Expanded.T0Hat, PrivateKey, DILITHIUM_ETA, DILITHIUM_POLETA_SIZE_PACKED, DILITHIUM_POLT0_SIZE_PACKED);
+
+	// expand matrix and transform vectors 
+	DLMNPolyMath::ExpandMat(Expanded.Matrix, rho);
+	DLMNPolyMath::PolyVecNtt(Expanded.S1Hat);
+	DLMNPolyMath::PolyVecNtt(Expanded.S2Hat);
+	DLMNPolyMath::PolyVecNtt(Expanded.T0Hat);
+}
+
+void DLTMK4Q8380417N256::ExpandPublicKey(DLMNPolyMath::DlmExpandedPublicKey &Expanded, const std::vector<byte> &PublicKey)
+{
+	std::vector<byte> rho(DILITHIUM_SEED_SIZE);
+
+	Expanded.Matrix.assign(DILITHIUM_K, std::vector<std::array<uint, 256>>(DILITHIUM_L));
+	Expanded.T1Hat.resize(DILITHIUM_K);
+	Expanded.Tr.resize(DILITHIUM_CRH_SIZE);
+
+	DLMNPolyMath::UnpackPk(rho, Expanded.T1Hat, PublicKey, DILITHIUM_POLT1_SIZE_PACKED);
+	// CRH(rho, t1)
+	XOF(PublicKey, 0, DILITHIUM_PUBLICKEY_SIZE, Expanded.Tr, 0, DILITHIUM_CRH_SIZE, Keccak::KECCAK256_RATE_SIZE);
+
+	// expand matrix and transform t1 * 2^d
+	DLMNPolyMath::ExpandMat(Expanded.Matrix, rho);
+	DLMNPolyMath::PolyVecShiftL(Expanded.T1Hat);
+	DLMNPolyMath::PolyVecNtt(Expanded.T1Hat);
+}
+
+void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng)
+{
+	DLMNPolyMath::DlmExpandedPrivateKey sk;
+
+	ExpandPrivateKey(sk, PrivateKey);
+	Sign(Signature, Message, sk, Rng);
+	DLMNPolyMath::ClearExpanded(sk);
+}
+
+void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const DLMNPolyMath::DlmExpandedPrivateKey &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng)
+{
 	std::vector<byte> mu(DILITHIUM_CRH_SIZE);
 	std::vector<byte> rhoprime(DILITHIUM_CRH_SIZE);
 	std::vector<byte> sbuf(0);
 	std::array<uint, 256> c;
 	std::array<uint, 256> chat;
-	std::vector<std::vector<std::array<uint, 256>>> mat(DILITHIUM_K, std::vector<std::array<uint, 256>>(DILITHIUM_L));
-	std::vector<std::array<uint, 256>> s1(DILITHIUM_L);
 	std::vector<std::array<uint, 256>> y(DILITHIUM_L);
 	std::vector<std::array<uint, 256>> yhat(DILITHIUM_L);
 	std::vector<std::array<uint, 256>> z(DILITHIUM_L);
-	std::vector<std::array<uint, 256>> t0(DILITHIUM_K);
-	std::vector<std::array<uint, 256>> s2(DILITHIUM_K);
 	std::vector<std::array<uint, 256>> w(DILITHIUM_K);
 	std::vector<std::array<uint, 256>> w0(DILITHIUM_K);
 	std::vector<std::array<uint, 256>> w1(DILITHIUM_K);
@@ -101,7 +141,6 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 	ushort nonce;
 
 	nonce = 0;
-	DLMNPolyMath::UnpackSk(rho, key, tr, s1, s2, t0, PrivateKey, DILITHIUM_ETA, DILITHIUM_POLETA_SIZE_PACKED, DILITHIUM_POLT0_SIZE_PACKED);
 
 	// copy tr and message into the signedmsg buffer,
 	// backwards since message and signedmsg can be equal in SUPERCOP API 
@@ -112,7 +151,7 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 
 	for (i = 0; i < DILITHIUM_CRH_SIZE; ++i)
 	{
-		Signature[DILITHIUM_SIGNATURE_SIZE - DILITHIUM_CRH_SIZE + i] = tr[i];
+		Signature[DILITHIUM_SIGNATURE_SIZE - DILITHIUM_CRH_SIZE + i] = PrivateKey.Tr[i];
 	}
 
 	// compute CRH(tr, msg) 
@@ -125,18 +164,12 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 #else
 
 	sbuf.resize(DILITHIUM_SEED_SIZE + DILITHIUM_CRH_SIZE);
-	MemoryTools::Copy(key, 0, sbuf, 0, key.size());
-	MemoryTools::Copy(mu, 0, sbuf, key.size(), mu.size());
+	MemoryTools::Copy(PrivateKey.Key, 0, sbuf, 0, PrivateKey.Key.size());
+	MemoryTools::Copy(mu, 0, sbuf, PrivateKey.Key.size(), mu.size());
 	XOF(sbuf, 0, DILITHIUM_SEED_SIZE + DILITHIUM_CRH_SIZE, rhoprime, 0, DILITHIUM_CRH_SIZE, Keccak::KECCAK256_RATE_SIZE);
 
 #endif
 
-	// expand matrix and transform vectors 
-	DLMNPolyMath::ExpandMat(mat, rho);
-	DLMNPolyMath::PolyVecNtt(s1);
-	DLMNPolyMath::PolyVecNtt(s2);
-	DLMNPolyMath::PolyVecNtt(t0);
-
 	while (true)
 	{
 		// sample intermediate vector y 
@@ -152,7 +185,7 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 
 		for (i = 0; i < DILITHIUM_K; ++i)
 		{
-			DLMNPolyMath::PolyVecPointwiseAccInvMontgomery(w[i], mat[i], yhat);
+			DLMNPolyMath::PolyVecPointwiseAccInvMontgomery(w[i], PrivateKey.Matrix[i], yhat);
 			DLMNPolyMath::PolyReduce(w[i]);
 			DLMNPolyMath::PolyInvNttMontgomery(w[i]);
 		}
@@ -168,7 +201,7 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 		// do not reveal secret information 
 		for (i = 0; i < DILITHIUM_K; ++i)
 		{
-			DLMNPolyMath::PolyPointwiseInvMontgomery(cs2[i], chat, s2[i]);
+			DLMNPolyMath::PolyPointwiseInvMontgomery(cs2[i], chat, PrivateKey.S2Hat[i]);
 			DLMNPolyMath::PolyInvNttMontgomery(cs2[i]);
 		}
 
@@ -183,7 +216,7 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 		// compute z, reject if it reveals secret 
 		for (i = 0; i < DILITHIUM_L; ++i)
 		{
-			DLMNPolyMath::PolyPointwiseInvMontgomery(z[i], chat, s1[i]);
+			DLMNPolyMath::PolyPointwiseInvMontgomery(z[i], chat, PrivateKey.S1Hat[i]);
 			DLMNPolyMath::PolyInvNttMontgomery(z[i]);
 		}
 
@@ -198,7 +231,7 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 		// compute hints for w1 
 		for (i = 0; i < DILITHIUM_K; ++i)
 		{
-			DLMNPolyMath::PolyPointwiseInvMontgomery(ct0[i], chat, t0[i]);
+			DLMNPolyMath::PolyPointwiseInvMontgomery(ct0[i], chat, PrivateKey.T0Hat[i]);
 			DLMNPolyMath::PolyInvNttMontgomery(ct0[i]);
 		}
 
@@ -227,11 +260,17 @@ void DLTMK4Q8380417N256::Sign(std::vector<byte> &Signature, const std::vector<by
 
 bool DLTMK4Q8380417N256::Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const std::vector<byte> &PublicKey)
 {
-	std::vector<byte> rho(DILITHIUM_SEED_SIZE);
+	DLMNPolyMath::DlmExpandedPublicKey pk;
+
+	ExpandPublicKey(pk, PublicKey);
+
+	return Verify(Message, Signature, pk);
+}
+
+bool DLTMK4Q8380417N256::Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const DLMNPolyMath::DlmExpandedPublicKey &PublicKey)
+{
 	std::vector<byte> mu(DILITHIUM_CRH_SIZE);
-	std::vector<std::vector<std::array<uint, 256>>> mat(DILITHIUM_K, std::vector<std::array<uint, 256>>(DILITHIUM_L));
 	std::vector<std::array<uint, 256>> z(DILITHIUM_L);
-	std::vector<std::array<uint, 256>> t1(DILITHIUM_K);
 	std::vector<std::array<uint, 256>> w1(DILITHIUM_K);
 	std::vector<std::array<uint, 256>> h(DILITHIUM_K);
 	std::vector<std::array<uint, 256>> tmp1(DILITHIUM_K);
@@ -253,7 +292,6 @@ bool DLTMK4Q8380417N256::Verify(std::vector<byte> &Message, const std::vector<by
 	if (bsig == 0)
 	{
 		msglen = Signature.size() - DILITHIUM_SIGNATURE_SIZE;
-		DLMNPolyMath::UnpackPk(rho, t1, PublicKey, DILITHIUM_POLT1_SIZE_PACKED);
 
 		if (DLMNPolyMath::UnpackSig(z, h, c, Signature, DILITHIUM_OMEGA, DILITHIUM_POLZ_SIZE_PACKED) != 0)
 		{
@@ -278,26 +316,23 @@ bool DLTMK4Q8380417N256::Verify(std::vector<byte> &Message, const std::vector<by
 					}
 				}
 
-				XOF(PublicKey, 0, DILITHIUM_PUBLICKEY_SIZE, Message, DILITHIUM_SIGNATURE_SIZE - DILITHIUM_CRH_SIZE, DILITHIUM_CRH_SIZE, Keccak::KECCAK256_RATE_SIZE);
+				MemoryTools::Copy(PublicKey.Tr, 0, Message, DILITHIUM_SIGNATURE_SIZE - DILITHIUM_CRH_SIZE, DILITHIUM_CRH_SIZE);
 				XOF(Message, (DILITHIUM_SIGNATURE_SIZE - DILITHIUM_CRH_SIZE), DILITHIUM_CRH_SIZE + msglen, mu, 0, DILITHIUM_CRH_SIZE, Keccak::KECCAK256_RATE_SIZE);
 
 				// matrix-vector multiplication; compute Az-c2^dt1 
-				DLMNPolyMath::ExpandMat(mat, rho);
 				DLMNPolyMath::PolyVecNtt(z);
 
 				for (i = 0; i < DILITHIUM_K; ++i)
 				{
-					DLMNPolyMath::PolyVecPointwiseAccInvMontgomery(tmp1[i], mat[i], z);
+					DLMNPolyMath::PolyVecPointwiseAccInvMontgomery(tmp1[i], PublicKey.Matrix[i], z);
 				}
 
 				chat = c;
 				DLMNPolyMath::PolyNtt(chat);
-				DLMNPolyMath::PolyVecShiftL(t1);
-				DLMNPolyMath::PolyVecNtt(t1);
 
 				for (i = 0; i < DILITHIUM_K; ++i)
 				{
-					DLMNPolyMath::PolyPointwiseInvMontgomery(tmp2[i], chat, t1[i]);
+					DLMNPolyMath::PolyPointwiseInvMontgomery(tmp2[i], chat, PublicKey.T1Hat[i]);
 				}
 
 				DLMNPolyMath::PolyVecSub(tmp1, tmp1, tmp2);
@@ -345,6 +380,133 @@ bool DLTMK4Q8380417N256::Verify(std::vector<byte> &Message, const std::vector<by
 	return (bsig == 0);
 }
 
+void DLTMK4Q8380417N256::Verify(std::vector<std::vector<byte>> &Messages, const std::vector<std::vector<byte>> &Signatures, const std::vector<const DLMNPolyMath::DlmExpandedPublicKey*> &PublicKeys, std::vector<byte> &Results, size_t Offset, size_t Count)
+{
+	// verifies Count signed messages beginning at Offset, the message digests and challenges 
+	// of each group of BATCH_LANES items are computed in parallel keccak lanes
+	std::vector<std::array<uint, 256>> c(BATCH_LANES);
+	std::vector<std::array<uint, 256>> cp(BATCH_LANES);
+	std::vector<std::vector<std::array<uint, 256>>> w1(BATCH_LANES, std::vector<std::array<uint, 256>>(DILITHIUM_K));
+	std::vector<std::array<uint, 256>> z(DILITHIUM_L);
+	std::vector<std::array<uint, 256>> h(DILITHIUM_K);
+	std::vector<std::array<uint, 256>> tmp1(DILITHIUM_K);
+	std::vector<std::array<uint, 256>> tmp2(DILITHIUM_K);
+	std::array<uint, 256> chat;
+	std::vector<byte> mbuf(0);
+	std::vector<byte> mu(BATCH_LANES * DILITHIUM_CRH_SIZE);
+	std::vector<byte> valid(BATCH_LANES);
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t lanes;
+	size_t msglen;
+	bool eqlen;
+
+	for (i = Offset; i < Offset + Count; i += lanes)
+	{
+		lanes = (Offset + Count - i) < BATCH_LANES ? (Offset + Count - i) : BATCH_LANES;
+		eqlen = true;
+
+		for (j = 0; j < lanes; ++j)
+		{
+			const std::vector<byte> &sig = Signatures[i + j];
+			const DLMNPolyMath::DlmExpandedPublicKey &pk = *PublicKeys[i + j];
+
+			valid[j] = 0;
+			eqlen = eqlen && (sig.size() == Signatures[i].size());
+			MemoryTools::Clear(c[j], 0, c[j].size() * sizeof(uint));
+
+			for (k = 0; k < DILITHIUM_K; ++k)
+			{
+				MemoryTools::Clear(w1[j][k], 0, w1[j][k].size() * sizeof(uint));
+			}
+
+			if (sig.size() >= DILITHIUM_SIGNATURE_SIZE &&
+				DLMNPolyMath::UnpackSig(z, h, c[j], sig, DILITHIUM_OMEGA, DILITHIUM_POLZ_SIZE_PACKED) == 0 &&
+				DLMNPolyMath::PolyVecChkNorm(z, DILITHIUM_GAMMA1 - DILITHIUM_BETA) == 0)
+			{
+				// matrix-vector multiplication; compute Az-c2^dt1 
+				DLMNPolyMath::PolyVecNtt(z);
+
+				for (k = 0; k < DILITHIUM_K; ++k)
+				{
+					DLMNPolyMath::PolyVecPointwiseAccInvMontgomery(tmp1[k], pk.Matrix[k], z);
+				}
+
+				chat = c[j];
+				DLMNPolyMath::PolyNtt(chat);
+
+				for (k = 0; k < DILITHIUM_K; ++k)
+				{
+					DLMNPolyMath::PolyPointwiseInvMontgomery(tmp2[k], chat, pk.T1Hat[k]);
+				}
+
+				DLMNPolyMath::PolyVecSub(tmp1, tmp1, tmp2);
+				DLMNPolyMath::PolyVecReduce(tmp1);
+				DLMNPolyMath::PolyVecInvNttMontgomery(tmp1);
+
+				// reconstruct w1 
+				DLMNPolyMath::PolyVecCSubQ(tmp1);
+				DLMNPolyMath::PolyVecUseHint(w1[j], tmp1, h);
+				valid[j] = 1;
+			}
+		}
+
+		// compute CRH(CRH(rho, t1), msg) for each lane
+		if (eqlen && lanes > 1 && Signatures[i].size() >= DILITHIUM_SIGNATURE_SIZE)
+		{
+			msglen = Signatures[i].size() - DILITHIUM_SIGNATURE_SIZE;
+			mbuf.resize(lanes * (DILITHIUM_CRH_SIZE + msglen));
+
+			for (j = 0; j < lanes; ++j)
+			{
+				MemoryTools::Copy(PublicKeys[i + j]->Tr, 0, mbuf, j * (DILITHIUM_CRH_SIZE + msglen), DILITHIUM_CRH_SIZE);
+				MemoryTools::Copy(Signatures[i + j], DILITHIUM_SIGNATURE_SIZE, mbuf, (j * (DILITHIUM_CRH_SIZE + msglen)) + DILITHIUM_CRH_SIZE, msglen);
+			}
+
+			DLMNPolyMath::XOFW(mbuf, 0, DILITHIUM_CRH_SIZE + msglen, mu, 0, DILITHIUM_CRH_SIZE, lanes, Keccak::KECCAK256_RATE_SIZE);
+		}
+		else
+		{
+			for (j = 0; j < lanes; ++j)
+			{
+				if (valid[j] == 1)
+				{
+					msglen = Signatures[i + j].size() - DILITHIUM_SIGNATURE_SIZE;
+					mbuf.resize(DILITHIUM_CRH_SIZE + msglen);
+					MemoryTools::Copy(PublicKeys[i + j]->Tr, 0, mbuf, 0, DILITHIUM_CRH_SIZE);
+					MemoryTools::Copy(Signatures[i + j], DILITHIUM_SIGNATURE_SIZE, mbuf, DILITHIUM_CRH_SIZE, msglen);
+					XOF(mbuf, 0, mbuf.size(), mu, j * DILITHIUM_CRH_SIZE, DILITHIUM_CRH_SIZE, Keccak::KECCAK256_RATE_SIZE);
+				}
+			}
+		}
+
+		// call random oracle and verify challenge 
+		mu.resize(lanes * DILITHIUM_CRH_SIZE);
+		DLMNPolyMath::ChallengeW(cp, mu, w1, lanes);
+		mu.resize(BATCH_LANES * DILITHIUM_CRH_SIZE);
+
+		for (j = 0; j < lanes; ++j)
+		{
+			const std::vector<byte> &sig = Signatures[i + j];
+
+			msglen = sig.size() >= DILITHIUM_SIGNATURE_SIZE ? sig.size() - DILITHIUM_SIGNATURE_SIZE : 0;
+			Messages[i + j].resize(msglen);
+
+			if (valid[j] == 1 && c[j] == cp[j])
+			{
+				MemoryTools::Copy(sig, DILITHIUM_SIGNATURE_SIZE, Messages[i + j], 0, msglen);
+				Results[i + j] = 1;
+			}
+			else
+			{
+				MemoryTools::Clear(Messages[i + j], 0, msglen);
+				Results[i + j] = 0;
+			}
+		}
+	}
+}
+
 void DLTMK4Q8380417N256::XOF(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate)
 {
 	Keccak::XOFR24P1600(Input, InOffset, InLength, Output, OutOffset, OutLength, Rate);
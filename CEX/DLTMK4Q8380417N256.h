@@ -2,6 +2,7 @@
 #define CEX_DLTMK4Q8380417N256_H
 
 #include "CexConfig.h"
+#include "DLMNPolyMath.h"
 #include "IPrng.h"
 
 NAMESPACE_DILITHIUM
@@ -30,6 +31,13 @@ private:
 	// -q^(-1) mod 2^32 
 	static const int32_t DILITHIUM_QINV = 4236238847U;
 
+#if defined(CEX_KERNEL_SIMD512)
+	// the number of batch verifications that share a hashing pass
+	static const size_t BATCH_LANES = 8;
+#else
+	static const size_t BATCH_LANES = 4;
+#endif
+
 	static const uint DILITHIUM_K = 4;
 	static const uint DILITHIUM_L = 3;
 	static const uint DILITHIUM_ETA = 6;
@@ -52,9 +60,19 @@ public:
 
 	static void Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng);
 
+	static void ExpandPrivateKey(DLMNPolyMath::DlmExpandedPrivateKey &Expanded, const std::vector<byte> &PrivateKey);
+
+	static void ExpandPublicKey(DLMNPolyMath::DlmExpandedPublicKey &Expanded, const std::vector<byte> &PublicKey);
+
 	static void Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng);
 
+	static void Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const DLMNPolyMath::DlmExpandedPrivateKey &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng);
+
 	static bool Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const std::vector<byte> &PublicKey);
+
+	static bool Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const DLMNPolyMath::DlmExpandedPublicKey &PublicKey);
+
+	static void Verify(std::vector<std::vector<byte>> &Messages, const std::vector<std::vector<byte>> &Signatures, const std::vector<const DLMNPolyMath::DlmExpandedPublicKey*> &PublicKeys, std::vector<byte> &Results, size_t Offset, size_t Count);
 };
 
 NAMESPACE_DILITHIUMEND
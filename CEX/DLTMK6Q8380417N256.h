@@ -2,6 +2,7 @@
 #define CEX_DLTMK6Q8380417N256_H
 
 #include "CexConfig.h"
+#include "DLMNPolyMath.h"
 #include "IPrng.h"
 
 NAMESPACE_DILITHIUM
@@ -26,6 +27,13 @@ private:
 	static const int32_t DILITHIUM_GAMMA2 = (DILITHIUM_GAMMA1 / 2);
 	static const int32_t DILITHIUM_ALPHA = (2 * DILITHIUM_GAMMA2);
 
+#if defined(CEX_KERNEL_SIMD512)
+	// the number of batch verifications that share a hashing pass
+	static const size_t BATCH_LANES = 8;
+#else
+	static const size_t BATCH_LANES = 4;
+#endif
+
 	static const int32_t DILITHIUM_K = 6;
 	static const int32_t DILITHIUM_L = 5;
 	static const int32_t DILITHIUM_ETA = 3;
@@ -48,9 +56,19 @@ public:
 
 	static void Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng);
 
+	static void ExpandPrivateKey(DLMNPolyMath::DlmExpandedPrivateKey &Expanded, const std::vector<byte> &PrivateKey);
+
+	static void ExpandPublicKey(DLMNPolyMath::DlmExpandedPublicKey &Expanded, const std::vector<byte> &PublicKey);
+
 	static void Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng);
 
+	static void Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const DLMNPolyMath::DlmExpandedPrivateKey &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng);
+
 	static bool Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const std::vector<byte> &PublicKey);
+
+	static bool Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const DLMNPolyMath::DlmExpandedPublicKey &PublicKey);
+
+	static void Verify(std::vector<std::vector<byte>> &Messages, const std::vector<std::vector<byte>> &Signatures, const std::vector<const DLMNPolyMath::DlmExpandedPublicKey*> &PublicKeys, std::vector<byte> &Results, size_t Offset, size_t Count);
 };
 
 NAMESPACE_DILITHIUMEND
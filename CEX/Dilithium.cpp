@@ -1,18 +1,25 @@
 #include "Dilithium.h"
+#include "DLMNPolyMath.h"
 #include "DLTMK4Q8380417N256.h"
 #include "DLTMK5Q8380417N256.h"
 #include "DLTMK6Q8380417N256.h"
+#include "IntegerTools.h"
+#include "ParallelTools.h"
 #include "PrngFromName.h"
 
 NAMESPACE_DILITHIUM
 
 using Enumeration::AsymmetricPrimitiveConvert;
 using Enumeration::DilithiumParameterConvert;
+using Utility::IntegerTools;
+using Utility::ParallelTools;
 
 class Dilithium::DilithiumState
 {
 public:
 
+	DLMNPolyMath::DlmExpandedPrivateKey PrivateExpanded;
+	DLMNPolyMath::DlmExpandedPublicKey PublicExpanded;
 	bool Destroyed;
 	bool Initialized;
 	bool Signer;
@@ -29,11 +36,64 @@ public:
 
 	~DilithiumState()
 	{
+		DLMNPolyMath::ClearExpanded(PrivateExpanded);
+		DLMNPolyMath::ClearExpanded(PublicExpanded);
 		Destroyed = false;
 		Initialized = false;
 		Signer = false;
 		Parameters = DilithiumParameters::None;
 	}
+
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<const DLMNPolyMath::DlmExpandedPublicKey*> &PublicKeys, std::vector<byte> &Results)
+	{
+		const size_t CNT = Signatures.size();
+		const size_t THDCNT = IntegerTools::Min(IntegerTools::Max(ParallelTools::ProcessorCount(), static_cast<size_t>(1)), IntegerTools::Max(CNT, static_cast<size_t>(1)));
+		const size_t CNKLEN = (CNT + THDCNT - 1) / THDCNT;
+		const DilithiumParameters PRMS = Parameters;
+		size_t i;
+		size_t vcnt;
+
+		Messages.resize(CNT);
+		Results.resize(CNT);
+
+		// each thread verifies a contiguous range of signatures
+		ParallelTools::ParallelFor(0, THDCNT, [&Signatures, &Messages, &PublicKeys, &Results, CNT, CNKLEN, PRMS](size_t i)
+		{
+			const size_t OFT = i * CNKLEN;
+
+			if (OFT < CNT)
+			{
+				const size_t LEN = IntegerTools::Min(CNKLEN, CNT - OFT);
+
+				switch (PRMS)
+				{
+					case DilithiumParameters::DLMS1N256Q8380417:
+					{
+						DLTMK4Q8380417N256::Verify(Messages, Signatures, PublicKeys, Results, OFT, LEN);
+						break;
+					}
+					case DilithiumParameters::DLMS2N256Q8380417:
+					{
+						DLTMK5Q8380417N256::Verify(Messages, Signatures, PublicKeys, Results, OFT, LEN);
+						break;
+					}
+					default:
+					{
+						DLTMK6Q8380417N256::Verify(Messages, Signatures, PublicKeys, Results, OFT, LEN);
+					}
+				}
+			}
+		});
+
+		vcnt = 0;
+
+		for (i = 0; i < CNT; ++i)
+		{
+			vcnt += Results[i];
+		}
+
+		return vcnt;
+	}
 };
 
 Dilithium::Dilithium(DilithiumParameters Parameters, Prngs PrngType)
@@ -257,12 +317,61 @@ const void Dilithium::Initialize(AsymmetricKey* Key)
 		m_publicKey = std::unique_ptr<AsymmetricKey>(Key);
 		m_dilithiumState->Parameters = static_cast<DilithiumParameters>(m_publicKey->Parameters());
 		m_dilithiumState->Signer = false;
+
+		// expand the matrix and transform t1 once for all verifications
+		switch (m_dilithiumState->Parameters)
+		{
+			case DilithiumParameters::DLMS1N256Q8380417:
+			{
+				DLTMK4Q8380417N256::ExpandPublicKey(m_dilithiumState->PublicExpanded, m_publicKey->Polynomial());
+				break;
+			}
+			case DilithiumParameters::DLMS2N256Q8380417:
+			{
+				DLTMK5Q8380417N256::ExpandPublicKey(m_dilithiumState->PublicExpanded, m_publicKey->Polynomial());
+				break;
+			}
+			case DilithiumParameters::DLMS3N256Q8380417:
+			{
+				DLTMK6Q8380417N256::ExpandPublicKey(m_dilithiumState->PublicExpanded, m_publicKey->Polynomial());
+				break;
+			}
+			default:
+			{
+				throw CryptoAsymmetricException(Name(), std::string("Initialize"), std::string("The Dilithium parameter set is invalid!"), ErrorCodes::InvalidParam);
+			}
+		}
 	}
 	else
 	{
 		m_privateKey = std::unique_ptr<AsymmetricKey>(Key);
 		m_dilithiumState->Parameters = static_cast<DilithiumParameters>(m_privateKey->Parameters());
 		m_dilithiumState->Signer = true;
+		DLMNPolyMath::ClearExpanded(m_dilithiumState->PrivateExpanded);
+
+		// expand the matrix and transform the secret vectors once for all signatures
+		switch (m_dilithiumState->Parameters)
+		{
+			case DilithiumParameters::DLMS1N256Q8380417:
+			{
+				DLTMK4Q8380417N256::ExpandPrivateKey(m_dilithiumState->PrivateExpanded, m_privateKey->Polynomial());
+				break;
+			}
+			case DilithiumParameters::DLMS2N256Q8380417:
+			{
+				DLTMK5Q8380417N256::ExpandPrivateKey(m_dilithiumState->PrivateExpanded, m_privateKey->Polynomial());
+				break;
+			}
+			case DilithiumParameters::DLMS3N256Q8380417:
+			{
+				DLTMK6Q8380417N256::ExpandPrivateKey(m_dilithiumState->PrivateExpanded, m_privateKey->Polynomial());
+				break;
+			}
+			default:
+			{
+				throw CryptoAsymmetricException(Name(), std::string("Initialize"), std::string("The Dilithium parameter set is invalid!"), ErrorCodes::InvalidParam);
+			}
+		}
 	}
 
 	m_dilithiumState->Initialized = true;
@@ -290,21 +399,21 @@ size_t Dilithium::Sign(const std::vector<byte> &Message, std::vector<byte> &Sign
 		case DilithiumParameters::DLMS1N256Q8380417:
 		{
 			Signature.resize(DLTMK4Q8380417N256::DILITHIUM_SIGNATURE_SIZE + Message.size());
-			DLTMK4Q8380417N256::Sign(Signature, Message, m_privateKey->Polynomial(), m_rndGenerator);
+			DLTMK4Q8380417N256::Sign(Signature, Message, m_dilithiumState->PrivateExpanded, m_rndGenerator);
 
 			break;
 		}
 		case DilithiumParameters::DLMS2N256Q8380417:
 		{
 			Signature.resize(DLTMK5Q8380417N256::DILITHIUM_SIGNATURE_SIZE + Message.size());
-			DLTMK5Q8380417N256::Sign(Signature, Message, m_privateKey->Polynomial(), m_rndGenerator);
+			DLTMK5Q8380417N256::Sign(Signature, Message, m_dilithiumState->PrivateExpanded, m_rndGenerator);
 
 			break;
 		}
 		case DilithiumParameters::DLMS3N256Q8380417:
 		{
 			Signature.resize(DLTMK6Q8380417N256::DILITHIUM_SIGNATURE_SIZE + Message.size());
-			DLTMK6Q8380417N256::Sign(Signature, Message, m_privateKey->Polynomial(), m_rndGenerator);
+			DLTMK6Q8380417N256::Sign(Signature, Message, m_dilithiumState->PrivateExpanded, m_rndGenerator);
 
 			break;
 		}
@@ -335,7 +444,7 @@ bool Dilithium::Verify(const std::vector<byte> &Signature, std::vector<byte> &Me
 	{
 		case DilithiumParameters::DLMS1N256Q8380417:
 		{
-			res = DLTMK4Q8380417N256::Verify(tmpm, Signature, m_publicKey->Polynomial());
+			res = DLTMK4Q8380417N256::Verify(tmpm, Signature, m_dilithiumState->PublicExpanded);
 			Message.resize(Signature.size() - DLTMK4Q8380417N256::DILITHIUM_SIGNATURE_SIZE);
 			MemoryTools::Copy(tmpm, 0, Message, 0, Message.size());
 
@@ -343,7 +452,7 @@ bool Dilithium::Verify(const std::vector<byte> &Signature, std::vector<byte> &Me
 		}
 		case DilithiumParameters::DLMS2N256Q8380417:
 		{
-			res = DLTMK5Q8380417N256::Verify(tmpm, Signature, m_publicKey->Polynomial());
+			res = DLTMK5Q8380417N256::Verify(tmpm, Signature, m_dilithiumState->PublicExpanded);
 			Message.resize(Signature.size() - DLTMK5Q8380417N256::DILITHIUM_SIGNATURE_SIZE);
 			MemoryTools::Copy(tmpm, 0, Message, 0, Message.size());
 
@@ -351,7 +460,7 @@ bool Dilithium::Verify(const std::vector<byte> &Signature, std::vector<byte> &Me
 		}
 		case DilithiumParameters::DLMS3N256Q8380417:
 		{
-			res = DLTMK6Q8380417N256::Verify(tmpm, Signature, m_publicKey->Polynomial());
+			res = DLTMK6Q8380417N256::Verify(tmpm, Signature, m_dilithiumState->PublicExpanded);
 			Message.resize(Signature.size() - DLTMK6Q8380417N256::DILITHIUM_SIGNATURE_SIZE);
 			MemoryTools::Copy(tmpm, 0, Message, 0, Message.size());
 
@@ -366,4 +475,92 @@ bool Dilithium::Verify(const std::vector<byte> &Signature, std::vector<byte> &Me
 	return res;
 }
 
+size_t Dilithium::Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results)
+{
+	if (!m_dilithiumState->Initialized)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The cipher has not been initialized!"), ErrorCodes::IllegalOperation);
+	}
+	if (m_dilithiumState->Signer)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The signature scheme is not initialized for verification!"), ErrorCodes::NotInitialized);
+	}
+
+	// every signature shares the cached public key expansion
+	std::vector<const DLMNPolyMath::DlmExpandedPublicKey*> pks(Signatures.size(), &m_dilithiumState->PublicExpanded);
+
+	return m_dilithiumState->Verify(Signatures, Messages, pks, Results);
+}
+
+size_t Dilithium::Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results)
+{
+	if (KeyIndex.size() != Signatures.size())
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key index array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	std::vector<DLMNPolyMath::DlmExpandedPublicKey> kexp(PublicKeys.size());
+	std::vector<const DLMNPolyMath::DlmExpandedPublicKey*> pks(Signatures.size());
+	size_t i;
+	size_t vcnt;
+
+	for (i = 0; i < PublicKeys.size(); ++i)
+	{
+		if (PublicKeys[i] == nullptr || PublicKeys[i]->PrimitiveType() != AsymmetricPrimitives::Dilithium || PublicKeys[i]->KeyClass() != AsymmetricKeyTypes::SignaturePublicKey)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key type is invalid!"), ErrorCodes::InvalidKey);
+		}
+		if (static_cast<DilithiumParameters>(PublicKeys[i]->Parameters()) != m_dilithiumState->Parameters)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key parameter set does not match this instance!"), ErrorCodes::InvalidKey);
+		}
+	}
+
+	for (i = 0; i < KeyIndex.size(); ++i)
+	{
+		if (KeyIndex[i] >= PublicKeys.size())
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key index is out of range!"), ErrorCodes::InvalidParam);
+		}
+
+		pks[i] = &kexp[KeyIndex[i]];
+	}
+
+	// expand each public key once for all of its signatures
+	ParallelTools::ParallelFor(0, PublicKeys.size(), [this, &PublicKeys, &kexp](size_t i)
+	{
+		switch (m_dilithiumState->Parameters)
+		{
+			case DilithiumParameters::DLMS1N256Q8380417:
+			{
+				DLTMK4Q8380417N256::ExpandPublicKey(kexp[i], PublicKeys[i]->Polynomial());
+				break;
+			}
+			case DilithiumParameters::DLMS2N256Q8380417:
+			{
+				DLTMK5Q8380417N256::ExpandPublicKey(kexp[i], PublicKeys[i]->Polynomial());
+				break;
+			}
+			case DilithiumParameters::DLMS3N256Q8380417:
+			{
+				DLTMK6Q8380417N256::ExpandPublicKey(kexp[i], PublicKeys[i]->Polynomial());
+				break;
+			}
+			default:
+			{
+				throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The Dilithium parameter set is invalid!"), ErrorCodes::InvalidParam);
+			}
+		}
+	});
+
+	vcnt = m_dilithiumState->Verify(Signatures, Messages, pks, Results);
+
+	for (i = 0; i < kexp.size(); ++i)
+	{
+		DLMNPolyMath::ClearExpanded(kexp[i]);
+	}
+
+	return vcnt;
+}
+
 NAMESPACE_DILITHIUMEND
\ No newline at end of file
@@ -91,6 +91,8 @@ using Enumeration::DilithiumParameters;
 /// <item><description>The signature schemes operational mode (signing/verifying) is determined by the IAsymmetricKey key-type used to Initialize the cipher; the Public key is used for verification, and use the Private for signing a message.</description></item>
 /// <item><description>Use the Generate function to create a public/private key-pair, and the Sign function to sign a message</description></item>
 /// <item><description>The message-signature is tested using the Verify function, which checks the signature, populates the message array, and returns false on authentication failure</description></item>
+/// <item><description>Initialize expands the key once; the public matrix and the NTT-domain key vectors are cached, so that repeated Sign or Verify calls with the same key only perform the per-message computations</description></item>
+/// <item><description>The batch Verify functions return a result for each signature; signatures are verified across the processor cores, and the SHAKE invocations of neighbouring signatures are processed in 4 (AVX2) or 8 (AVX512) parallel Keccak lanes</description></item>
 /// </list>
 /// 
 /// <description>Guiding Publications:</description>
@@ -200,7 +202,8 @@ public:
 	AsymmetricKeyPair* Generate() override;
 
 	/// <summary>
-	/// Initialize the signature scheme for signing (private-key) or verifying (public-key)
+	/// Initialize the signature scheme for signing (private-key) or verifying (public-key).
+	/// <para>The key is expanded and cached for all subsequent Sign or Verify calls.</para>
 	/// </summary>
 	/// 
 	/// <param name="Key">The <see cref="AsymmetricKey"/> containing the Public (verify) or Private (signing) key</param>
@@ -228,6 +231,39 @@ public:
 	/// 
 	/// <returns>Returns true if the signature matches, false for authentication failure</returns>
 	bool Verify(const std::vector<byte> &Signature, std::vector<byte> &Message) override;
+
+	/// <summary>
+	/// Verify a batch of signed messages with the public key used to initialize the signature scheme.
+	/// <para>The messages and results arrays are resized to the number of signatures; each result is 1 if the signature is authentic, or 0 on failure,
+	/// and the message of a failed signature is zeroed. The batch shares the cached public key, is distributed across the processor cores,
+	/// and the message and challenge hashes of neighbouring signatures are computed in parallel SHAKE lanes.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the signature scheme is not initialized for verification</exception>
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results) override;
+
+	/// <summary>
+	/// Verify a batch of signed messages under a set of public keys.
+	/// <para>Each signature is verified with the public key at its entry in the key index array; each key is expanded once for all of its signatures.
+	/// The keys must use the parameter set of this instance, the signature scheme does not need to be initialized.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="PublicKeys">The public keys used to verify the signatures</param>
+	/// <param name="KeyIndex">The index of the public key used to verify each signature</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if a key is invalid, or the key index array is invalid</exception>
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results) override;
 };
 
 NAMESPACE_DILITHIUMEND
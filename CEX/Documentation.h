@@ -484,6 +484,7 @@ NAMESPACE_ROOT
 		class ULong256 {};
 		class ULong512 {};
 		class UShort128 {};
+		class UShort256 {};
 	NAMESPACE_NUMERICEND
 	/*! @} */
 
@@ -1,4 +1,5 @@
 #include "EAX.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "ParallelTools.h"
 
@@ -22,6 +23,7 @@ public:
 	bool Destroyed;
 	bool Encryption;
 	bool Initialized;
+	bool Interleave;
 	bool Preserve;
 
 	EaxState(bool IsDestroyed)
@@ -35,6 +37,7 @@ public:
 		Destroyed(IsDestroyed),
 		Encryption(false),
 		Initialized(false),
+		Interleave(false),
 		Preserve(false)
 	{
 	}
@@ -55,6 +58,7 @@ public:
 		Destroyed = false;
 		Encryption = false;
 		Initialized = false;
+		Interleave = false;
 		Preserve = false;
 	}
 };
@@ -281,6 +285,7 @@ void EAX::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	// load the state
 	m_eaxState->Encryption = Encryption;
+	m_eaxState->Interleave = HasWideLanes(m_cipherMode->Engine()->Enumeral());
 	m_eaxState->Key.resize(Parameters.KeySizes().KeySize());
 	// copy the key and nonce
 	MemoryTools::Copy(Parameters.Key(), 0, m_eaxState->Key, 0, m_eaxState->Key.size());
@@ -348,15 +353,37 @@ void EAX::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the the block-size!");
 
-	if (IsEncryption())
-	{
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
-		m_macGenerator->Update(Output, OutOffset, Length);
-	}
-	else
+	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
+	size_t plen;
+
+	// two passes: each chunk is authenticated while it is still cache resident;
+	// every chunk but the last is block aligned, so the counter and mac state carry over unchanged
+	while (Length != 0)
 	{
-		m_macGenerator->Update(Input, InOffset, Length);
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
+		if (m_eaxState->Interleave && !(m_parallelProfile.IsParallel() && Length >= PRLBLK))
+		{
+			// the sequential remainder is processed in a single interleaved pass
+			ProcessInterleaved(Input, InOffset, Output, OutOffset, Length);
+			break;
+		}
+
+		plen = (m_parallelProfile.IsParallel() && Length >= PRLBLK) ? PRLBLK : IntegerTools::Min(Length, STITCH_SIZE);
+
+		if (IsEncryption())
+		{
+			m_cipherMode->Transform(Input, InOffset, Output, OutOffset, plen);
+			m_macGenerator->Update(Output, OutOffset, plen);
+		}
+		else
+		{
+			// authenticate the cipher-text before it can be overwritten by an in-place decryption
+			m_macGenerator->Update(Input, InOffset, plen);
+			m_cipherMode->Transform(Input, InOffset, Output, OutOffset, plen);
+		}
+
+		InOffset += plen;
+		OutOffset += plen;
+		Length -= plen;
 	}
 }
 
@@ -459,6 +486,93 @@ void EAX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	m_macGenerator->Update(Input, InOffset, BLOCK_SIZE);
 }
 
+bool EAX::HasWideLanes(BlockCiphers CipherType)
+{
+	// the interleaved loop issues a wide transform for every block,
+	// which costs about as much as a single block only when the engine transforms the lanes in parallel;
+	// the AES family is the AHX engine on an AES-NI cpu, as selected by BlockCipherFromName
+	CpuDetect dtc;
+	bool ret;
+
+	switch (CipherType)
+	{
+		case BlockCiphers::AES:
+		case BlockCiphers::RHXH256:
+		case BlockCiphers::RHXH512:
+		case BlockCiphers::RHXS256:
+		case BlockCiphers::RHXS512:
+		case BlockCiphers::RHXS1024:
+		{
+			ret = dtc.AESNI();
+			break;
+		}
+		case BlockCiphers::Serpent:
+		case BlockCiphers::SHXH256:
+		case BlockCiphers::SHXH512:
+		case BlockCiphers::SHXS256:
+		case BlockCiphers::SHXS512:
+		case BlockCiphers::SHXS1024:
+		{
+			ret = (CpuDetect::SimdProfile() != SimdProfiles::None);
+			break;
+		}
+		default:
+		{
+			ret = false;
+		}
+	}
+
+	return ret;
+}
+
+void EAX::ProcessInterleaved(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t ALNLEN = Length - (Length % BLOCK_SIZE);
+	std::vector<byte> tmpc(m_macGenerator->LaneCount() * BLOCK_SIZE);
+	std::vector<byte> tmpk(m_macGenerator->LaneCount() * BLOCK_SIZE);
+	size_t i;
+
+	// every wide transform chains the mac block held back by the last update in the first lane,
+	// and encrypts the counter of the current block in the second lane
+	for (i = 0; i != ALNLEN; i += BLOCK_SIZE)
+	{
+		m_cipherMode->NextCounters(tmpc, BLOCK_SIZE, 1);
+		m_macGenerator->UpdateLanes(tmpc, tmpk);
+
+		if (IsEncryption())
+		{
+			MemoryTools::XOR128(Input, InOffset + i, tmpk, BLOCK_SIZE);
+			MemoryTools::COPY128(tmpk, BLOCK_SIZE, Output, OutOffset + i);
+			// the cipher-text block is held back, and chained by the next transform
+			m_macGenerator->Update(Output, OutOffset + i, BLOCK_SIZE);
+		}
+		else
+		{
+			// authenticate the cipher-text before it can be overwritten by an in-place decryption
+			m_macGenerator->Update(Input, InOffset + i, BLOCK_SIZE);
+			MemoryTools::XOR128(Input, InOffset + i, tmpk, BLOCK_SIZE);
+			MemoryTools::COPY128(tmpk, BLOCK_SIZE, Output, OutOffset + i);
+		}
+	}
+
+	// the partial tail block, the counter mode continues from the same counter
+	if (ALNLEN != Length)
+	{
+		if (IsEncryption())
+		{
+			m_cipherMode->Transform(Input, InOffset + ALNLEN, Output, OutOffset + ALNLEN, Length - ALNLEN);
+			m_macGenerator->Update(Output, OutOffset + ALNLEN, Length - ALNLEN);
+		}
+		else
+		{
+			m_macGenerator->Update(Input, InOffset + ALNLEN, Length - ALNLEN);
+			m_cipherMode->Transform(Input, InOffset + ALNLEN, Output, OutOffset + ALNLEN, Length - ALNLEN);
+		}
+	}
+
+	MemoryTools::Clear(tmpk, 0, tmpk.size());
+}
+
 void EAX::UpdateTag(byte Tag)
 {
 	std::vector<byte> tmpv(BLOCK_SIZE);
@@ -76,6 +76,9 @@ NAMESPACE_MODE
 /// EAX is an online mode, meaning it can stream data of any length, without needing to know the data size in advance. \n
 /// It also has provable security, the security-level dependant on the block cipher used by the mode. \n
 /// EAX first encrypts the plaintext using a block-cipher counter mode (CTR), then processes that cipher-text using a CBC-based MAC function (CMAC) used for data authentication. \n
+/// With the AES-NI or SIMD Serpent engines, the sequential transform interleaves the two; every block is a single wide block-cipher transform, that chains the previous MAC block and encrypts the CTR counter of the current block. \n
+/// The serial CMAC chain sets the pace, and the counter block is carried in a lane of the same transform. \n
+/// The parallel transform, or the sequential transform with the other engines, walks the input in chunks, generating the CTR keystream for a chunk and then chaining it through the MAC while it is still cache resident. \n
 /// When encryption is completed, the MAC code is generated and appended to the output stream using the Finalize(Output, Offset) call. \n
 /// Decryption performs these steps in reverse, processing the cipher-text bytes through the MAC function, then decrypting the data to plain-text. \n
 /// The Verify(Input, Offset) function can be used to compare the MAC code embedded in the cipher-text with the code generated during the decryption process.</para>
@@ -93,7 +96,8 @@ NAMESPACE_MODE
 /// The EAX parallel mode also leverages SIMD instructions to 'double parallelize' those segments. \n
 /// An input block assigned to a thread uses SIMD instructions to decrypt/encrypt 4, 8, or 16 blocks in parallel per cycle, depending on which framework is runtime available, AVX, AVX2, or AVX512 instructions. \n
 /// Input blocks equal to, or divisble by the ParallelBlockSize() are processed in parallel on supported systems, this can be disabled through the ParallelProfile accessor function. \n
-/// The cipher transform is parallelizable, however the authentication pass, (CMAC), is processed sequentially.</para>
+/// The cipher transform is parallelizable, however the authentication pass, (CMAC), is processed sequentially. \n
+/// When processing in parallel, each ParallelBlockSize() chunk is encrypted across threads and then authenticated, before the next chunk is read.</para>
 ///
 /// <description>Implementation Notes:</description>
 /// <list type="bullet">
@@ -121,6 +125,8 @@ private:
 	static const size_t BLOCK_SIZE = 16;
 	static const size_t MAX_PRLALLOC = 100000000;
 	static const size_t MIN_TAGSIZE = 12;
+	// the two-pass CTR/CMAC chunk; input and output stay L1 resident between the passes
+	static const size_t STITCH_SIZE = 256 * BLOCK_SIZE;
 
 	class EaxState;
 	std::unique_ptr<EaxState> m_eaxState;
@@ -432,6 +438,8 @@ private:
 	void Compute();
 	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
+	static bool HasWideLanes(BlockCiphers CipherType);
+	void ProcessInterleaved(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
 	void UpdateTag(byte Tag);
 };
 
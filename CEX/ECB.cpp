@@ -2,6 +2,7 @@
 #include "BlockCipherFromName.h"
 #include "IntegerTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_MODE
 
@@ -48,6 +49,7 @@ ECB::ECB(BlockCiphers CipherType)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::ECB), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::ECB, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 ECB::ECB(IBlockCipher* Cipher)
@@ -57,6 +59,7 @@ ECB::ECB(IBlockCipher* Cipher)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::ECB), std::string("Constructor"), std::string("The cipher type can not be null!"), ErrorCodes::IllegalOperation)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::ECB, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 ECB::~ECB()
@@ -251,10 +254,10 @@ void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<
 
 	bctr = BlockCount;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512) || defined(CEX_KERNEL_VAES256)
 	if (bctr > 15)
 	{
-		// 512bit avx
+		// 16 blocks, avx512 or a vaes engine
 		const size_t AVX512BLK = 256;
 		rctr = (bctr / 16);
 
@@ -268,7 +271,7 @@ void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<
 			--rctr;
 		}
 	}
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 	if (bctr > 7)
 	{
 		// 256bit avx
@@ -285,7 +288,8 @@ void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<
 			--rctr;
 		}
 	}
-#elif defined(__AVX__)
+#endif
+#if defined(CEX_KERNEL_SIMD128)
 	if (bctr > 3)
 	{
 		// 128bit sse3
@@ -59,17 +59,26 @@ void FORS::ComputeRoot(std::vector<byte> &Root, size_t RootOffset, const std::ve
 	SphincsUtils::THash(Root, RootOffset, buf1, 0, 2, PkSeed, Address, buf2, mask, N);
 }
 
-void FORS::ForsGenLeaf(std::vector<byte> &Leaf, size_t LeafOffset, const std::vector<byte> &SecretSeed, const std::vector<byte> &PublicSeed, uint AddressIdx,
-	const std::array<uint, 8> &TreeAddress, size_t N)
+void FORS::ForsGenLeaves(std::vector<byte> &Leaves, size_t LeafOffset, const std::vector<byte> &SecretSeed, const std::vector<byte> &PublicSeed, uint AddressIdx,
+	uint LeafCount, const std::array<uint, 8> &TreeAddress, size_t N)
 {
+	std::vector<std::array<uint, 8>> leafaddr(LeafCount);
 	std::array<uint, 8> leafaddress = { 0 };
+	uint idx;
 
 	// only copy the parts that must be kept in fors_leaf_addr
 	SphincsUtils::CopyKeypairAddress(TreeAddress, leafaddress);
 	SphincsUtils::SetType(leafaddress, SPX_ADDR_TYPE_FORSTREE);
-	SphincsUtils::SetTreeIndex(leafaddress, AddressIdx);
-	ForsGenSk(Leaf, LeafOffset, SecretSeed, leafaddress, N);
-	ForsSkToLeaf(Leaf, Leaf, LeafOffset, PublicSeed, leafaddress, N);
+
+	for (idx = 0; idx < LeafCount; ++idx)
+	{
+		leafaddr[idx] = leafaddress;
+		SphincsUtils::SetTreeIndex(leafaddr[idx], AddressIdx + idx);
+	}
+
+	// generate the secret keys, then hash them to leaves in place
+	SphincsUtils::PrfAddressW(Leaves, LeafOffset, SecretSeed, leafaddr, LeafCount, N);
+	SphincsUtils::THashW(Leaves, LeafOffset, Leaves, LeafOffset, 1, PublicSeed, leafaddr, LeafCount, N);
 }
 
 void FORS::ForsGenSk(std::vector<byte> &Secret, size_t SecretOffset, const std::vector<byte> &Seed, std::array<uint, 8> &Address, size_t N)
@@ -80,16 +89,19 @@ void FORS::ForsGenSk(std::vector<byte> &Secret, size_t SecretOffset, const std::
 void FORS::ForsPkFromSig(std::vector<byte> &PublicKey, size_t PubKeyOffset, const std::vector<byte> &Signature, size_t SigOffset, const std::vector<byte> &Message,
 	const std::vector<byte> &PublicSeed, const std::array<uint, 8> &ForsAddress, uint ForsHeight, size_t ForsTrees, size_t N)
 {
+	// the leaves and root paths of all the trees are computed together, one tree layer at a time
+	std::vector<std::array<uint, 8>> nodeaddr(ForsTrees);
 	std::array<uint, 8> forstreeaddr = { 0 };
 	std::array<uint, 8> forspkaddr = { 0 };
 	std::vector<uint> indices(ForsTrees * N);
-	std::vector<byte> leaf(N);
+	std::vector<byte> nodes(ForsTrees * 2 * N);
 	std::vector<byte> roots(ForsTrees * N);
+	size_t authoff;
+	uint hgt;
 	uint idx;
-	uint idxsig;
 	uint idxoff;
+	uint nodeidx;
 
-	idxsig = static_cast<uint>(SigOffset);
 	SphincsUtils::CopyKeypairAddress(ForsAddress, forstreeaddr);
 	SphincsUtils::CopyKeypairAddress(ForsAddress, forspkaddr);
 	SphincsUtils::SetType(forstreeaddr, SPX_ADDR_TYPE_FORSTREE);
@@ -97,17 +109,46 @@ void FORS::ForsPkFromSig(std::vector<byte> &PublicKey, size_t PubKeyOffset, cons
 
 	MessageToIndices(indices, Message, ForsHeight, ForsTrees);
 
+	// derive the leaves from the included secret key parts
 	for (idx = 0; idx < ForsTrees; ++idx)
 	{
 		idxoff = idx * (1 << ForsHeight);
-		SphincsUtils::SetTreeHeight(forstreeaddr, 0);
-		SphincsUtils::SetTreeIndex(forstreeaddr, indices[idx] + idxoff);
-		// derive the leaf from the included secret key part
-		ForsSkToLeaf(leaf, Signature, idxsig, PublicSeed, forstreeaddr, N);
-		idxsig += static_cast<uint>(N);
-		// derive the corresponding root node of this tree
-		ComputeRoot(roots, idx * static_cast<uint>(N), leaf, indices[idx], idxoff, Signature, idxsig, ForsHeight, PublicSeed, forstreeaddr, N);
-		idxsig += static_cast<uint>(N) * ForsHeight;
+		nodeaddr[idx] = forstreeaddr;
+		SphincsUtils::SetTreeHeight(nodeaddr[idx], 0);
+		SphincsUtils::SetTreeIndex(nodeaddr[idx], indices[idx] + idxoff);
+		MemoryTools::Copy(Signature, SigOffset + (idx * (ForsHeight + 1) * N), roots, idx * N, N);
+	}
+
+	SphincsUtils::THashW(roots, 0, roots, 0, 1, PublicSeed, nodeaddr, ForsTrees, N);
+
+	// derive the corresponding root node of each tree
+	for (hgt = 0; hgt < ForsHeight; ++hgt)
+	{
+		for (idx = 0; idx < ForsTrees; ++idx)
+		{
+			idxoff = idx * (1 << ForsHeight);
+			nodeidx = (indices[idx] >> hgt);
+			authoff = SigOffset + (idx * (ForsHeight + 1) * N) + ((hgt + 1) * N);
+
+			// if the node is odd (last bit = 1), it is a right child
+			// and the auth path has to go left, otherwise it is the other way around
+			if ((nodeidx & 1) == 1)
+			{
+				MemoryTools::Copy(Signature, authoff, nodes, idx * 2 * N, N);
+				MemoryTools::Copy(roots, idx * N, nodes, (idx * 2 * N) + N, N);
+			}
+			else
+			{
+				MemoryTools::Copy(roots, idx * N, nodes, idx * 2 * N, N);
+				MemoryTools::Copy(Signature, authoff, nodes, (idx * 2 * N) + N, N);
+			}
+
+			// set the address of the node we're creating
+			SphincsUtils::SetTreeHeight(nodeaddr[idx], hgt + 1);
+			SphincsUtils::SetTreeIndex(nodeaddr[idx], (nodeidx >> 1) + (idxoff >> (hgt + 1)));
+		}
+
+		SphincsUtils::THashW(roots, 0, nodes, 0, 2, PublicSeed, nodeaddr, ForsTrees, N);
 	}
 
 	// hash horizontally across all tree roots to derive the public key
@@ -142,8 +183,9 @@ void FORS::ForsSign(std::vector<byte> &Signature, size_t SigOffset, std::vector<
 		const std::vector<byte> &,
 		const std::vector<byte> &,
 		uint,
+		uint,
 		std::array<uint, 8> &,
-		size_t)> forsgen = ForsGenLeaf;
+		size_t)> forsgen = ForsGenLeaves;
 
 	for (idx = 0; idx < ForsTrees; ++idx)
 	{
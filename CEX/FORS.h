@@ -51,8 +51,8 @@ public:
 	static void ComputeRoot(std::vector<byte> &Root, size_t RootOffset, const std::vector<byte> &Leaf, uint LeafOffset, uint IdxOffset, const std::vector<byte> &AuthPath,
 		size_t AuthOffset, uint TreeHeight, const std::vector<byte> &PkSeed, std::array<uint, 8> &Address, size_t N);
 
-	static void ForsGenLeaf(std::vector<byte> &Leaf, size_t LeafOffset, const std::vector<byte> &SecretSeed, const std::vector<byte> &PublicSeed, uint AddressIdx,
-		const std::array<uint, 8> &TreeAddress, size_t N);
+	static void ForsGenLeaves(std::vector<byte> &Leaves, size_t LeafOffset, const std::vector<byte> &SecretSeed, const std::vector<byte> &PublicSeed, uint AddressIdx,
+		uint LeafCount, const std::array<uint, 8> &TreeAddress, size_t N);
 
 	static void ForsGenSk(std::vector<byte> &Secret, size_t SecretOffset, const std::vector<byte> &Seed, std::array<uint, 8> &Address, size_t N);
 
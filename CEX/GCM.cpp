@@ -419,15 +419,23 @@ void GCM::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the the block-size!");
 
-	if (IsEncryption())
+	if (!(m_parallelProfile.IsParallel() && Length >= m_parallelProfile.ParallelBlockSize()))
 	{
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
-		m_gcmHash->Update(Output, OutOffset, m_gcmState->Tag, Length);
+		// the sequential transform hashes each key-stream chunk while it is still cache resident
+		ProcessStitched(Input, InOffset, Output, OutOffset, Length);
 	}
 	else
 	{
-		m_gcmHash->Update(Input, InOffset, m_gcmState->Tag, Length);
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
+		if (IsEncryption())
+		{
+			m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
+			m_gcmHash->Update(Output, OutOffset, m_gcmState->Tag, Length);
+		}
+		else
+		{
+			m_gcmHash->Update(Input, InOffset, m_gcmState->Tag, Length);
+			m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
+		}
 	}
 
 	m_gcmState->Counter += Length;
@@ -533,4 +541,52 @@ void GCM::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	m_gcmState->Counter += BLOCK_SIZE;
 }
 
+void GCM::ProcessStitched(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t ALNLEN = Length - (Length % STITCH_SIZE);
+	const size_t WDELEN = 16 * BLOCK_SIZE;
+	std::vector<byte> tmpc(STITCH_SIZE);
+	size_t i;
+	size_t j;
+
+	// the key-stream of a chunk is generated by 16 block wide transforms of staggered counters,
+	// and the chunk is hashed before the next chunk of key-stream is generated
+	for (i = 0; i != ALNLEN; i += STITCH_SIZE)
+	{
+		if (!IsEncryption())
+		{
+			// hash the cipher-text before it is overwritten by an in-place decryption
+			m_gcmHash->Update(Input, InOffset + i, m_gcmState->Tag, STITCH_SIZE);
+		}
+
+		m_cipherMode->NextCounters(tmpc, 0, STITCH_SIZE / BLOCK_SIZE);
+
+		for (j = 0; j != STITCH_SIZE; j += WDELEN)
+		{
+			m_cipherMode->Engine()->Transform2048(tmpc, j, Output, OutOffset + i + j);
+			MemoryTools::XOR(Input, InOffset + i + j, Output, OutOffset + i + j, WDELEN);
+		}
+
+		if (IsEncryption())
+		{
+			m_gcmHash->Update(Output, OutOffset + i, m_gcmState->Tag, STITCH_SIZE);
+		}
+	}
+
+	// the remainder is processed by the counter mode, which continues from the same counter
+	if (ALNLEN != Length)
+	{
+		if (IsEncryption())
+		{
+			m_cipherMode->Transform(Input, InOffset + ALNLEN, Output, OutOffset + ALNLEN, Length - ALNLEN);
+			m_gcmHash->Update(Output, OutOffset + ALNLEN, m_gcmState->Tag, Length - ALNLEN);
+		}
+		else
+		{
+			m_gcmHash->Update(Input, InOffset + ALNLEN, m_gcmState->Tag, Length - ALNLEN);
+			m_cipherMode->Transform(Input, InOffset + ALNLEN, Output, OutOffset + ALNLEN, Length - ALNLEN);
+		}
+	}
+}
+
 NAMESPACE_MODEEND
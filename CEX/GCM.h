@@ -76,6 +76,7 @@ NAMESPACE_MODE
 /// GCM is an online mode, meaning it can stream data of any size, without needing to know the data size in advance. \n
 /// GCM uses a Galois Multiply function then combines the ciphertext to produce a message authentication code (Tag). \n
 /// In encryption operation mode, GCM encrypts the plaintext using a block-cipher counter mode (CTR), then processes that cipher-text using a Galois-counter message authentication code generator (GMAC). \n
+/// The sequential transform stitches the two passes; the key-stream is generated in 4KB chunks by 16 block wide block-cipher transforms, and each chunk is hashed while it is still cache resident. \n
 /// When encryption is completed, the MAC code is generated and appended to the output stream using the Finalize(Output, Offset) call. \n
 /// Decryption performs these steps in reverse, processing the cipher-text bytes through the GMAC function, then decrypting the data to plain-text. \n
 /// The Verify(Input, Offset) function can be used to compare the MAC code embedded in the cipher-text with the code generated during the decryption process. \n
@@ -132,6 +133,8 @@ private:
 	static const size_t MAX_PRLALLOC = 100000000;
 	static const size_t MIN_NONCESIZE = 8;
 	static const size_t MIN_TAGSIZE = 12;
+	// the stitched CTR/GHASH chunk; the key-stream and output stay L1 resident until the chunk is hashed
+	static const size_t STITCH_SIZE = 256 * BLOCK_SIZE;
 
 	class GcmState;
 	std::unique_ptr<GcmState> m_gcmState;
@@ -444,6 +447,7 @@ private:
 	void Compute();
 	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
+	void ProcessStitched(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
 };
 
 NAMESPACE_MODEEND
@@ -1,7 +1,7 @@
 #include "GHASH.h"
 #include "CpuDetect.h"
 #include "IntegerTools.h"
-#if defined(__AVX2__)
+#if defined(CEX_AVX_INTRINSICS)
 #	include "Intrinsics.h"
 #	include <wmmintrin.h>
 #endif
@@ -19,6 +19,7 @@ public:
 
 	std::array<byte, CMUL::CMUL_BLOCK_SIZE> Buffer;
 	std::array<ulong, CMUL::CMUL_STATE_SIZE> State;
+	std::array<ulong, CMUL::CMUL_STATE_SIZE * CMUL::CMUL_TABLE_SIZE> Table;
 	size_t Position;
 
 	GhashState()
@@ -37,6 +38,7 @@ public:
 		Position = 0;
 		MemoryTools::Clear(Buffer, 0, Buffer.size());
 		MemoryTools::Clear(State, 0, State.size() * sizeof(ulong));
+		MemoryTools::Clear(Table, 0, Table.size() * sizeof(ulong));
 	}
 };
 
@@ -87,6 +89,24 @@ void GHASH::Finalize(std::vector<byte> &Output, size_t Counter, size_t Length)
 void GHASH::Initialize(const std::vector<ulong> &Key)
 {
 	MemoryTools::Copy(Key, 0, m_dgtState->State, 0, Key.size() * sizeof(ulong));
+
+	if (HAS_CMUL)
+	{
+		// precompute H^8..H^1 for the multi-block kernels, the table is stored in descending order
+		std::vector<byte> tmpb(CMUL::CMUL_BLOCK_SIZE);
+		size_t i;
+
+		MemoryTools::Copy(Key, 0, m_dgtState->Table, (CMUL::CMUL_TABLE_SIZE - 1) * CMUL::CMUL_STATE_SIZE, CMUL::CMUL_STATE_SIZE * sizeof(ulong));
+		IntegerTools::Be64ToBytes(Key[0], tmpb, 0);
+		IntegerTools::Be64ToBytes(Key[1], tmpb, sizeof(ulong));
+
+		for (i = CMUL::CMUL_TABLE_SIZE - 1; i != 0; --i)
+		{
+			Permute(m_dgtState->State, tmpb);
+			m_dgtState->Table[(i - 1) * CMUL::CMUL_STATE_SIZE] = IntegerTools::BeBytesTo64(tmpb, 0);
+			m_dgtState->Table[((i - 1) * CMUL::CMUL_STATE_SIZE) + 1] = IntegerTools::BeBytesTo64(tmpb, sizeof(ulong));
+		}
+	}
 }
 
 void GHASH::Multiply(const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length)
@@ -95,6 +115,16 @@ void GHASH::Multiply(const std::vector<byte> &Input, std::vector<byte> &Output,
 
 	boff = 0;
 
+	if (HAS_CMUL)
+	{
+		while (Length >= CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE)
+		{
+			PermuteBlocks(m_dgtState->Table, Input, boff, Output, CMUL::CMUL_TABLE_SIZE);
+			boff += CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE;
+			Length -= CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE;
+		}
+	}
+
 	while (Length != 0)
 	{
 		const size_t RMDLEN = IntegerTools::Min(Length, CMUL::CMUL_BLOCK_SIZE);
@@ -132,6 +162,24 @@ void GHASH::Update(const std::vector<byte> &Input, size_t InOffset, std::vector<
 			Length -= RMDLEN;
 			InOffset += RMDLEN;
 
+			if (HAS_CMUL)
+			{
+				// the last block is always buffered, it may be the final partial block
+				while (Length > CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE)
+				{
+					PermuteBlocks(m_dgtState->Table, Input, InOffset, Output, CMUL::CMUL_TABLE_SIZE);
+					Length -= CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE;
+					InOffset += CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE;
+				}
+
+				if (Length > (CMUL::CMUL_TABLE_SIZE / 2) * CMUL::CMUL_BLOCK_SIZE)
+				{
+					PermuteBlocks(m_dgtState->Table, Input, InOffset, Output, CMUL::CMUL_TABLE_SIZE / 2);
+					Length -= (CMUL::CMUL_TABLE_SIZE / 2) * CMUL::CMUL_BLOCK_SIZE;
+					InOffset += (CMUL::CMUL_TABLE_SIZE / 2) * CMUL::CMUL_BLOCK_SIZE;
+				}
+			}
+
 			while (Length > CMUL::CMUL_BLOCK_SIZE)
 			{
 				MemoryTools::XOR128(Input, InOffset, Output, 0);
@@ -171,6 +219,24 @@ void GHASH::Permute(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, std::vector
 	MemoryTools::COPY128(tmp, 0, Output, 0);
 }
 
+void GHASH::PermuteBlocks(const std::array<ulong, CMUL::CMUL_STATE_SIZE * CMUL::CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t BlockCount)
+{
+	std::array<byte, 16> tmp;
+
+	MemoryTools::COPY128(Output, 0, tmp, 0);
+
+	if (BlockCount == CMUL::CMUL_TABLE_SIZE)
+	{
+		CMUL::PermuteR128P1024V(Table, Input, InOffset, tmp);
+	}
+	else
+	{
+		CMUL::PermuteR128P512V(Table, Input, InOffset, tmp);
+	}
+
+	MemoryTools::COPY128(tmp, 0, Output, 0);
+}
+
 bool GHASH::HasGmul()
 {
 	CpuDetect dtc;
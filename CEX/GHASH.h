@@ -99,6 +99,7 @@ public:
 private:
 
 	static void Permute(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, std::vector<byte> &Output);
+	static void PermuteBlocks(const std::array<ulong, CMUL::CMUL_STATE_SIZE * CMUL::CMUL_TABLE_SIZE> &Table, const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t BlockCount);
 	static bool HasGmul();
 };
 
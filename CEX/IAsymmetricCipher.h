@@ -139,6 +139,22 @@ public:
 	/// <returns>Returns true if decryption is sucesssful</returns>
 	virtual bool Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret) = 0;
 
+	/// <summary>
+	/// Decrypt a batch of ciphertexts and return the shared secrets.
+	/// <para>The cipher-text array holds Count consecutive cipher-texts of CipherTextSize() bytes, the secrets are written consecutively in the same order.
+	/// With a DomainKey, the shared secret array is sized by the caller and divided evenly between the Count secrets,
+	/// otherwise it is resized to Count * SharedSecretSize() bytes. The batch is distributed across the processor cores.</para>
+	/// </summary>
+	/// 
+	/// <param name="CipherText">The input cipher-texts</param>
+	/// <param name="SharedSecret">The shared secret keys</param>
+	/// <param name="Count">The number of cipher-texts in the batch</param>
+	/// 
+	/// <returns>Returns true if every cipher-text was decrypted sucesssfully</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the count or the array sizes are invalid</exception>
+	virtual bool Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count) = 0;
+
 	/// <summary>
 	/// Generate a shared secret and ciphertext
 	/// </summary>
@@ -147,6 +163,20 @@ public:
 	/// <param name="SharedSecret">The shared secret key</param>
 	virtual void Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret) = 0;
 
+	/// <summary>
+	/// Generate a batch of shared secrets and ciphertexts.
+	/// <para>The cipher-text array is resized to Count * CipherTextSize() bytes, and holds the cipher-texts consecutively.
+	/// With a DomainKey, the shared secret array is sized by the caller and divided evenly between the Count secrets,
+	/// otherwise it is resized to Count * SharedSecretSize() bytes. The batch is distributed across the processor cores.</para>
+	/// </summary>
+	/// 
+	/// <param name="CipherText">The output cipher-texts</param>
+	/// <param name="SharedSecret">The shared secret keys</param>
+	/// <param name="Count">The number of secrets to generate</param>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the count or the shared secret array size is invalid</exception>
+	virtual void Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count) = 0;
+
 	/// <summary>
 	/// Generate a public/private key-pair
 	/// </summary>
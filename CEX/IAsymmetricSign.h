@@ -149,6 +149,40 @@ public:
 	/// 
 	/// <returns>Returns true if the signature matches</returns>
 	virtual bool Verify(const std::vector<byte> &Signature, std::vector<byte> &Message) = 0;
+
+	/// <summary>
+	/// Verify a batch of signed messages with the public key used to initialize the signature scheme.
+	/// <para>The messages and results arrays are resized to the number of signatures; each result is 1 if the signature is authentic, or 0 on failure,
+	/// and the message of a failed signature is zeroed. The batch is distributed across the processor cores.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the signature scheme is not initialized for verification</exception>
+	virtual size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results) = 0;
+
+	/// <summary>
+	/// Verify a batch of signed messages under a set of public keys.
+	/// <para>Each signature is verified with the public key at its entry in the key index array; the keys are not retained, and each is prepared once for all of its signatures.
+	/// The keys must use the parameter set of this instance, the signature scheme does not need to be initialized.
+	/// The messages and results arrays are resized to the number of signatures; each result is 1 if the signature is authentic, or 0 on failure,
+	/// and the message of a failed signature is zeroed. The batch is distributed across the processor cores.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="PublicKeys">The public keys used to verify the signatures</param>
+	/// <param name="KeyIndex">The index of the public key used to verify each signature</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if a key is invalid, or the key index array is invalid</exception>
+	virtual size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results) = 0;
 };
 
 NAMESPACE_ASYMMETRICSIGNEND
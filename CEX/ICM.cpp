@@ -2,6 +2,7 @@
 #include "BlockCipherFromName.h"
 #include "IntegerTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_MODE
 
@@ -51,6 +52,7 @@ ICM::ICM(BlockCiphers CipherType)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::ICM), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::ICM, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 ICM::ICM(IBlockCipher* Cipher)
@@ -60,6 +62,7 @@ ICM::ICM(IBlockCipher* Cipher)
 		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::ICM), std::string("Constructor"), std::string("The cipher type can not be null!"), ErrorCodes::IllegalOperation)),
 	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
 {
+	ParallelTuner::Apply(CipherModes::ICM, m_blockCipher->Enumeral(), m_parallelProfile);
 }
 
 ICM::~ICM()
@@ -262,14 +265,14 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 
 	bctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512) || defined(CEX_KERNEL_VAES256)
 	const size_t AVX512BLK = 16 * BLOCK_SIZE;
 	if (Length >= AVX512BLK)
 	{
 		const size_t PBKALN = Length - (Length % AVX512BLK);
 		std::vector<byte> cblk(AVX512BLK);
 
-		// stagger counters and process 8 blocks with avx
+		// stagger counters and process 16 blocks; a vaes engine transforms these in wide registers
 		while (bctr != PBKALN)
 		{
 
@@ -309,7 +312,7 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX512BLK;
 		}
 	}
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
 	if (Length >= AVX2BLK)
 	{
@@ -339,7 +342,8 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX2BLK;
 		}
 	}
-#elif defined(__AVX__)
+#endif
+#if defined(CEX_KERNEL_SIMD128)
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
 	if (Length >= AVXBLK)
 	{
@@ -7,7 +7,7 @@ using Utility::MemoryTools;
 
 //~~~Round Constants~~~//
 
-const std::array<ulong, 24> Keccak::KECCAK_RC24 =
+const ulong Keccak::KECCAK_RC24[24] =
 {
 	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
 	0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
@@ -17,7 +17,7 @@ const std::array<ulong, 24> Keccak::KECCAK_RC24 =
 	0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
 };
 
-const std::array<ulong, 48> Keccak::KECCAK_RC48 =
+const ulong Keccak::KECCAK_RC48[48] =
 {
 	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
 	0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
@@ -2431,396 +2431,6 @@ void Keccak::PermuteR24P1600U(std::array<ulong, 25> &State)
 	State[24] = Asu;
 }
 
-#if defined(__AVX2__)
-
-void Keccak::PermuteR24P4x1600H(std::vector<ULong256> &State)
-{
-	std::array<ULong256, 25> A;
-	std::array<ULong256, 5> C;
-	std::array<ULong256, 5> D;
-	std::array<ULong256, 25> E;
-	size_t i;
-
-	MemoryTools::Copy(State, 0, A, 0, A.size() * sizeof(ULong256));
-
-	for (i = 0; i < 24; i += 2)
-	{
-		// round n
-		C[0] = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
-		C[1] = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
-		C[2] = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
-		C[3] = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
-		C[4] = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
-		D[0] = C[4] ^ ULong256::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong256::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong256::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong256::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong256::RotL64(C[0], 1);
-		A[0] ^= D[0];
-		C[0] = A[0];
-		A[6] ^= D[1];
-		C[1] = ULong256::RotL64(A[6], 44);
-		A[12] ^= D[2];
-		C[2] = ULong256::RotL64(A[12], 43);
-		A[18] ^= D[3];
-		C[3] = ULong256::RotL64(A[18], 21);
-		A[24] ^= D[4];
-		C[4] = ULong256::RotL64(A[24], 14);
-		E[0] = C[0] ^ ((~C[1]) & C[2]);
-		E[0] ^= ULong256(KECCAK_RC24[i]);
-		E[1] = C[1] ^ ((~C[2]) & C[3]);
-		E[2] = C[2] ^ ((~C[3]) & C[4]);
-		E[3] = C[3] ^ ((~C[4]) & C[0]);
-		E[4] = C[4] ^ ((~C[0]) & C[1]);
-		A[3] ^= D[3];
-		C[0] = ULong256::RotL64(A[3], 28);
-		A[9] ^= D[4];
-		C[1] = ULong256::RotL64(A[9], 20);
-		A[10] ^= D[0];
-		C[2] = ULong256::RotL64(A[10], 3);
-		A[16] ^= D[1];
-		C[3] = ULong256::RotL64(A[16], 45);
-		A[22] ^= D[2];
-		C[4] = ULong256::RotL64(A[22], 61);
-		E[5] = C[0] ^ ((~C[1]) & C[2]);
-		E[6] = C[1] ^ ((~C[2]) & C[3]);
-		E[7] = C[2] ^ ((~C[3]) & C[4]);
-		E[8] = C[3] ^ ((~C[4]) & C[0]);
-		E[9] = C[4] ^ ((~C[0]) & C[1]);
-		A[1] ^= D[1];
-		C[0] = ULong256::RotL64(A[1], 1);
-		A[7] ^= D[2];
-		C[1] = ULong256::RotL64(A[7], 6);
-		A[13] ^= D[3];
-		C[2] = ULong256::RotL64(A[13], 25);
-		A[19] ^= D[4];
-		C[3] = ULong256::RotL64(A[19], 8);
-		A[20] ^= D[0];
-		C[4] = ULong256::RotL64(A[20], 18);
-		E[10] = C[0] ^ ((~C[1]) & C[2]);
-		E[11] = C[1] ^ ((~C[2]) & C[3]);
-		E[12] = C[2] ^ ((~C[3]) & C[4]);
-		E[13] = C[3] ^ ((~C[4]) & C[0]);
-		E[14] = C[4] ^ ((~C[0]) & C[1]);
-		A[4] ^= D[4];
-		C[0] = ULong256::RotL64(A[4], 27);
-		A[5] ^= D[0];
-		C[1] = ULong256::RotL64(A[5], 36);
-		A[11] ^= D[1];
-		C[2] = ULong256::RotL64(A[11], 10);
-		A[17] ^= D[2];
-		C[3] = ULong256::RotL64(A[17], 15);
-		A[23] ^= D[3];
-		C[4] = ULong256::RotL64(A[23], 56);
-		E[15] = C[0] ^ ((~C[1]) & C[2]);
-		E[16] = C[1] ^ ((~C[2]) & C[3]);
-		E[17] = C[2] ^ ((~C[3]) & C[4]);
-		E[18] = C[3] ^ ((~C[4]) & C[0]);
-		E[19] = C[4] ^ ((~C[0]) & C[1]);
-		A[2] ^= D[2];
-		C[0] = ULong256::RotL64(A[2], 62);
-		A[8] ^= D[3];
-		C[1] = ULong256::RotL64(A[8], 55);
-		A[14] ^= D[4];
-		C[2] = ULong256::RotL64(A[14], 39);
-		A[15] ^= D[0];
-		C[3] = ULong256::RotL64(A[15], 41);
-		A[21] ^= D[1];
-		C[4] = ULong256::RotL64(A[21], 2);
-		E[20] = C[0] ^ ((~C[1]) & C[2]);
-		E[21] = C[1] ^ ((~C[2]) & C[3]);
-		E[22] = C[2] ^ ((~C[3]) & C[4]);
-		E[23] = C[3] ^ ((~C[4]) & C[0]);
-		E[24] = C[4] ^ ((~C[0]) & C[1]);
-		// round n + 1
-		C[0] = E[0] ^ E[5] ^ E[10] ^ E[15] ^ E[20];
-		C[1] = E[1] ^ E[6] ^ E[11] ^ E[16] ^ E[21];
-		C[2] = E[2] ^ E[7] ^ E[12] ^ E[17] ^ E[22];
-		C[3] = E[3] ^ E[8] ^ E[13] ^ E[18] ^ E[23];
-		C[4] = E[4] ^ E[9] ^ E[14] ^ E[19] ^ E[24];
-		D[0] = C[4] ^ ULong256::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong256::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong256::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong256::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong256::RotL64(C[0], 1);
-		E[0] ^= D[0];
-		C[0] = E[0];
-		E[6] ^= D[1];
-		C[1] = ULong256::RotL64(E[6], 44);
-		E[12] ^= D[2];
-		C[2] = ULong256::RotL64(E[12], 43);
-		E[18] ^= D[3];
-		C[3] = ULong256::RotL64(E[18], 21);
-		E[24] ^= D[4];
-		C[4] = ULong256::RotL64(E[24], 14);
-		A[0] = C[0] ^ ((~C[1]) & C[2]);
-		A[0] ^= ULong256(KECCAK_RC24[i + 1]);
-		A[1] = C[1] ^ ((~C[2]) & C[3]);
-		A[2] = C[2] ^ ((~C[3]) & C[4]);
-		A[3] = C[3] ^ ((~C[4]) & C[0]);
-		A[4] = C[4] ^ ((~C[0]) & C[1]);
-		E[3] ^= D[3];
-		C[0] = ULong256::RotL64(E[3], 28);
-		E[9] ^= D[4];
-		C[1] = ULong256::RotL64(E[9], 20);
-		E[10] ^= D[0];
-		C[2] = ULong256::RotL64(E[10], 3);
-		E[16] ^= D[1];
-		C[3] = ULong256::RotL64(E[16], 45);
-		E[22] ^= D[2];
-		C[4] = ULong256::RotL64(E[22], 61);
-		A[5] = C[0] ^ ((~C[1]) & C[2]);
-		A[6] = C[1] ^ ((~C[2]) & C[3]);
-		A[7] = C[2] ^ ((~C[3]) & C[4]);
-		A[8] = C[3] ^ ((~C[4]) & C[0]);
-		A[9] = C[4] ^ ((~C[0]) & C[1]);
-		E[1] ^= D[1];
-		C[0] = ULong256::RotL64(E[1], 1);
-		E[7] ^= D[2];
-		C[1] = ULong256::RotL64(E[7], 6);
-		E[13] ^= D[3];
-		C[2] = ULong256::RotL64(E[13], 25);
-		E[19] ^= D[4];
-		C[3] = ULong256::RotL64(E[19], 8);
-		E[20] ^= D[0];
-		C[4] = ULong256::RotL64(E[20], 18);
-		A[10] = C[0] ^ ((~C[1]) & C[2]);
-		A[11] = C[1] ^ ((~C[2]) & C[3]);
-		A[12] = C[2] ^ ((~C[3]) & C[4]);
-		A[13] = C[3] ^ ((~C[4]) & C[0]);
-		A[14] = C[4] ^ ((~C[0]) & C[1]);
-		E[4] ^= D[4];
-		C[0] = ULong256::RotL64(E[4], 27);
-		E[5] ^= D[0];
-		C[1] = ULong256::RotL64(E[5], 36);
-		E[11] ^= D[1];
-		C[2] = ULong256::RotL64(E[11], 10);
-		E[17] ^= D[2];
-		C[3] = ULong256::RotL64(E[17], 15);
-		E[23] ^= D[3];
-		C[4] = ULong256::RotL64(E[23], 56);
-		A[15] = C[0] ^ ((~C[1]) & C[2]);
-		A[16] = C[1] ^ ((~C[2]) & C[3]);
-		A[17] = C[2] ^ ((~C[3]) & C[4]);
-		A[18] = C[3] ^ ((~C[4]) & C[0]);
-		A[19] = C[4] ^ ((~C[0]) & C[1]);
-		E[2] ^= D[2];
-		C[0] = ULong256::RotL64(E[2], 62);
-		E[8] ^= D[3];
-		C[1] = ULong256::RotL64(E[8], 55);
-		E[14] ^= D[4];
-		C[2] = ULong256::RotL64(E[14], 39);
-		E[15] ^= D[0];
-		C[3] = ULong256::RotL64(E[15], 41);
-		E[21] ^= D[1];
-		C[4] = ULong256::RotL64(E[21], 2);
-		A[20] = C[0] ^ ((~C[1]) & C[2]);
-		A[21] = C[1] ^ ((~C[2]) & C[3]);
-		A[22] = C[2] ^ ((~C[3]) & C[4]);
-		A[23] = C[3] ^ ((~C[4]) & C[0]);
-		A[24] = C[4] ^ ((~C[0]) & C[1]);
-	}
-
-	MemoryTools::Copy(A, 0, State, 0, A.size() * sizeof(ULong256));
-}
-
-#endif
-
-#if defined(__AVX512__)
-
-void Keccak::PermuteR24P8x1600H(std::vector<ULong512> &State)
-{
-	std::array<ULong512, 25> A;
-	std::array<ULong512, 5> C;
-	std::array<ULong512, 5> D;
-	std::array<ULong512, 25> E;
-	size_t i;
-
-	MemoryTools::Copy(State, 0, A, 0, A.size() * sizeof(ULong512));
-
-	for (i = 0; i < 24; i += 2)
-	{
-		// round n
-		C[0] = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
-		C[1] = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
-		C[2] = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
-		C[3] = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
-		C[4] = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
-		D[0] = C[4] ^ ULong512::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong512::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong512::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong512::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong512::RotL64(C[0], 1);
-		A[0] ^= D[0];
-		C[0] = A[0];
-		A[6] ^= D[1];
-		C[1] = ULong512::RotL64(A[6], 44);
-		A[12] ^= D[2];
-		C[2] = ULong512::RotL64(A[12], 43);
-		A[18] ^= D[3];
-		C[3] = ULong512::RotL64(A[18], 21);
-		A[24] ^= D[4];
-		C[4] = ULong512::RotL64(A[24], 14);
-		E[0] = C[0] ^ ((~C[1]) & C[2]);
-		E[0] ^= ULong512(KECCAK_RC24[i]);
-		E[1] = C[1] ^ ((~C[2]) & C[3]);
-		E[2] = C[2] ^ ((~C[3]) & C[4]);
-		E[3] = C[3] ^ ((~C[4]) & C[0]);
-		E[4] = C[4] ^ ((~C[0]) & C[1]);
-		A[3] ^= D[3];
-		C[0] = ULong512::RotL64(A[3], 28);
-		A[9] ^= D[4];
-		C[1] = ULong512::RotL64(A[9], 20);
-		A[10] ^= D[0];
-		C[2] = ULong512::RotL64(A[10], 3);
-		A[16] ^= D[1];
-		C[3] = ULong512::RotL64(A[16], 45);
-		A[22] ^= D[2];
-		C[4] = ULong512::RotL64(A[22], 61);
-		E[5] = C[0] ^ ((~C[1]) & C[2]);
-		E[6] = C[1] ^ ((~C[2]) & C[3]);
-		E[7] = C[2] ^ ((~C[3]) & C[4]);
-		E[8] = C[3] ^ ((~C[4]) & C[0]);
-		E[9] = C[4] ^ ((~C[0]) & C[1]);
-		A[1] ^= D[1];
-		C[0] = ULong512::RotL64(A[1], 1);
-		A[7] ^= D[2];
-		C[1] = ULong512::RotL64(A[7], 6);
-		A[13] ^= D[3];
-		C[2] = ULong512::RotL64(A[13], 25);
-		A[19] ^= D[4];
-		C[3] = ULong512::RotL64(A[19], 8);
-		A[20] ^= D[0];
-		C[4] = ULong512::RotL64(A[20], 18);
-		E[10] = C[0] ^ ((~C[1]) & C[2]);
-		E[11] = C[1] ^ ((~C[2]) & C[3]);
-		E[12] = C[2] ^ ((~C[3]) & C[4]);
-		E[13] = C[3] ^ ((~C[4]) & C[0]);
-		E[14] = C[4] ^ ((~C[0]) & C[1]);
-		A[4] ^= D[4];
-		C[0] = ULong512::RotL64(A[4], 27);
-		A[5] ^= D[0];
-		C[1] = ULong512::RotL64(A[5], 36);
-		A[11] ^= D[1];
-		C[2] = ULong512::RotL64(A[11], 10);
-		A[17] ^= D[2];
-		C[3] = ULong512::RotL64(A[17], 15);
-		A[23] ^= D[3];
-		C[4] = ULong512::RotL64(A[23], 56);
-		E[15] = C[0] ^ ((~C[1]) & C[2]);
-		E[16] = C[1] ^ ((~C[2]) & C[3]);
-		E[17] = C[2] ^ ((~C[3]) & C[4]);
-		E[18] = C[3] ^ ((~C[4]) & C[0]);
-		E[19] = C[4] ^ ((~C[0]) & C[1]);
-		A[2] ^= D[2];
-		C[0] = ULong512::RotL64(A[2], 62);
-		A[8] ^= D[3];
-		C[1] = ULong512::RotL64(A[8], 55);
-		A[14] ^= D[4];
-		C[2] = ULong512::RotL64(A[14], 39);
-		A[15] ^= D[0];
-		C[3] = ULong512::RotL64(A[15], 41);
-		A[21] ^= D[1];
-		C[4] = ULong512::RotL64(A[21], 2);
-		E[20] = C[0] ^ ((~C[1]) & C[2]);
-		E[21] = C[1] ^ ((~C[2]) & C[3]);
-		E[22] = C[2] ^ ((~C[3]) & C[4]);
-		E[23] = C[3] ^ ((~C[4]) & C[0]);
-		E[24] = C[4] ^ ((~C[0]) & C[1]);
-		// round n + 1
-		C[0] = E[0] ^ E[5] ^ E[10] ^ E[15] ^ E[20];
-		C[1] = E[1] ^ E[6] ^ E[11] ^ E[16] ^ E[21];
-		C[2] = E[2] ^ E[7] ^ E[12] ^ E[17] ^ E[22];
-		C[3] = E[3] ^ E[8] ^ E[13] ^ E[18] ^ E[23];
-		C[4] = E[4] ^ E[9] ^ E[14] ^ E[19] ^ E[24];
-		D[0] = C[4] ^ ULong512::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong512::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong512::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong512::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong512::RotL64(C[0], 1);
-		E[0] ^= D[0];
-		C[0] = E[0];
-		E[6] ^= D[1];
-		C[1] = ULong512::RotL64(E[6], 44);
-		E[12] ^= D[2];
-		C[2] = ULong512::RotL64(E[12], 43);
-		E[18] ^= D[3];
-		C[3] = ULong512::RotL64(E[18], 21);
-		E[24] ^= D[4];
-		C[4] = ULong512::RotL64(E[24], 14);
-		A[0] = C[0] ^ ((~C[1]) & C[2]);
-		A[0] ^= ULong512(KECCAK_RC24[i + 1]);
-		A[1] = C[1] ^ ((~C[2]) & C[3]);
-		A[2] = C[2] ^ ((~C[3]) & C[4]);
-		A[3] = C[3] ^ ((~C[4]) & C[0]);
-		A[4] = C[4] ^ ((~C[0]) & C[1]);
-		E[3] ^= D[3];
-		C[0] = ULong512::RotL64(E[3], 28);
-		E[9] ^= D[4];
-		C[1] = ULong512::RotL64(E[9], 20);
-		E[10] ^= D[0];
-		C[2] = ULong512::RotL64(E[10], 3);
-		E[16] ^= D[1];
-		C[3] = ULong512::RotL64(E[16], 45);
-		E[22] ^= D[2];
-		C[4] = ULong512::RotL64(E[22], 61);
-		A[5] = C[0] ^ ((~C[1]) & C[2]);
-		A[6] = C[1] ^ ((~C[2]) & C[3]);
-		A[7] = C[2] ^ ((~C[3]) & C[4]);
-		A[8] = C[3] ^ ((~C[4]) & C[0]);
-		A[9] = C[4] ^ ((~C[0]) & C[1]);
-		E[1] ^= D[1];
-		C[0] = ULong512::RotL64(E[1], 1);
-		E[7] ^= D[2];
-		C[1] = ULong512::RotL64(E[7], 6);
-		E[13] ^= D[3];
-		C[2] = ULong512::RotL64(E[13], 25);
-		E[19] ^= D[4];
-		C[3] = ULong512::RotL64(E[19], 8);
-		E[20] ^= D[0];
-		C[4] = ULong512::RotL64(E[20], 18);
-		A[10] = C[0] ^ ((~C[1]) & C[2]);
-		A[11] = C[1] ^ ((~C[2]) & C[3]);
-		A[12] = C[2] ^ ((~C[3]) & C[4]);
-		A[13] = C[3] ^ ((~C[4]) & C[0]);
-		A[14] = C[4] ^ ((~C[0]) & C[1]);
-		E[4] ^= D[4];
-		C[0] = ULong512::RotL64(E[4], 27);
-		E[5] ^= D[0];
-		C[1] = ULong512::RotL64(E[5], 36);
-		E[11] ^= D[1];
-		C[2] = ULong512::RotL64(E[11], 10);
-		E[17] ^= D[2];
-		C[3] = ULong512::RotL64(E[17], 15);
-		E[23] ^= D[3];
-		C[4] = ULong512::RotL64(E[23], 56);
-		A[15] = C[0] ^ ((~C[1]) & C[2]);
-		A[16] = C[1] ^ ((~C[2]) & C[3]);
-		A[17] = C[2] ^ ((~C[3]) & C[4]);
-		A[18] = C[3] ^ ((~C[4]) & C[0]);
-		A[19] = C[4] ^ ((~C[0]) & C[1]);
-		E[2] ^= D[2];
-		C[0] = ULong512::RotL64(E[2], 62);
-		E[8] ^= D[3];
-		C[1] = ULong512::RotL64(E[8], 55);
-		E[14] ^= D[4];
-		C[2] = ULong512::RotL64(E[14], 39);
-		E[15] ^= D[0];
-		C[3] = ULong512::RotL64(E[15], 41);
-		E[21] ^= D[1];
-		C[4] = ULong512::RotL64(E[21], 2);
-		A[20] = C[0] ^ ((~C[1]) & C[2]);
-		A[21] = C[1] ^ ((~C[2]) & C[3]);
-		A[22] = C[2] ^ ((~C[3]) & C[4]);
-		A[23] = C[3] ^ ((~C[4]) & C[0]);
-		A[24] = C[4] ^ ((~C[0]) & C[1]);
-	}
-
-	MemoryTools::Copy(A, 0, State, 0, A.size() * sizeof(ULong512));
-}
-
-#endif
-
 void Keccak::PermuteR48P1600C(std::array<ulong, 25> &State)
 {
 	std::array<ulong, 25> A;
@@ -7305,394 +6915,104 @@ void Keccak::PermuteR48P1600U(std::array<ulong, 25> &State)
 	State[24] = Asu;
 }
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
-void Keccak::PermuteR48P4x1600H(std::vector<ULong256> &State)
+void Keccak::XOFR24P4x1600(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate)
 {
-	std::array<ULong256, 25> A;
-	std::array<ULong256, 5> C;
-	std::array<ULong256, 5> D;
-	std::array<ULong256, 25> E;
-	size_t i;
+	XOFR24PWx1600<4>(Input, InOffset, InLength, Output, OutOffset, OutLength, Rate, PermuteR24P4x1600H);
+}
 
-	MemoryTools::Copy(State, 0, A, 0, A.size() * sizeof(ULong256));
+#endif
 
-	for (i = 0; i < 48; i += 2)
-	{
-		// round n
-		C[0] = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
-		C[1] = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
-		C[2] = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
-		C[3] = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
-		C[4] = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
-		D[0] = C[4] ^ ULong256::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong256::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong256::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong256::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong256::RotL64(C[0], 1);
-		A[0] ^= D[0];
-		C[0] = A[0];
-		A[6] ^= D[1];
-		C[1] = ULong256::RotL64(A[6], 44);
-		A[12] ^= D[2];
-		C[2] = ULong256::RotL64(A[12], 43);
-		A[18] ^= D[3];
-		C[3] = ULong256::RotL64(A[18], 21);
-		A[24] ^= D[4];
-		C[4] = ULong256::RotL64(A[24], 14);
-		E[0] = C[0] ^ ((~C[1]) & C[2]);
-		E[0] ^= ULong256(KECCAK_RC48[i]);
-		E[1] = C[1] ^ ((~C[2]) & C[3]);
-		E[2] = C[2] ^ ((~C[3]) & C[4]);
-		E[3] = C[3] ^ ((~C[4]) & C[0]);
-		E[4] = C[4] ^ ((~C[0]) & C[1]);
-		A[3] ^= D[3];
-		C[0] = ULong256::RotL64(A[3], 28);
-		A[9] ^= D[4];
-		C[1] = ULong256::RotL64(A[9], 20);
-		A[10] ^= D[0];
-		C[2] = ULong256::RotL64(A[10], 3);
-		A[16] ^= D[1];
-		C[3] = ULong256::RotL64(A[16], 45);
-		A[22] ^= D[2];
-		C[4] = ULong256::RotL64(A[22], 61);
-		E[5] = C[0] ^ ((~C[1]) & C[2]);
-		E[6] = C[1] ^ ((~C[2]) & C[3]);
-		E[7] = C[2] ^ ((~C[3]) & C[4]);
-		E[8] = C[3] ^ ((~C[4]) & C[0]);
-		E[9] = C[4] ^ ((~C[0]) & C[1]);
-		A[1] ^= D[1];
-		C[0] = ULong256::RotL64(A[1], 1);
-		A[7] ^= D[2];
-		C[1] = ULong256::RotL64(A[7], 6);
-		A[13] ^= D[3];
-		C[2] = ULong256::RotL64(A[13], 25);
-		A[19] ^= D[4];
-		C[3] = ULong256::RotL64(A[19], 8);
-		A[20] ^= D[0];
-		C[4] = ULong256::RotL64(A[20], 18);
-		E[10] = C[0] ^ ((~C[1]) & C[2]);
-		E[11] = C[1] ^ ((~C[2]) & C[3]);
-		E[12] = C[2] ^ ((~C[3]) & C[4]);
-		E[13] = C[3] ^ ((~C[4]) & C[0]);
-		E[14] = C[4] ^ ((~C[0]) & C[1]);
-		A[4] ^= D[4];
-		C[0] = ULong256::RotL64(A[4], 27);
-		A[5] ^= D[0];
-		C[1] = ULong256::RotL64(A[5], 36);
-		A[11] ^= D[1];
-		C[2] = ULong256::RotL64(A[11], 10);
-		A[17] ^= D[2];
-		C[3] = ULong256::RotL64(A[17], 15);
-		A[23] ^= D[3];
-		C[4] = ULong256::RotL64(A[23], 56);
-		E[15] = C[0] ^ ((~C[1]) & C[2]);
-		E[16] = C[1] ^ ((~C[2]) & C[3]);
-		E[17] = C[2] ^ ((~C[3]) & C[4]);
-		E[18] = C[3] ^ ((~C[4]) & C[0]);
-		E[19] = C[4] ^ ((~C[0]) & C[1]);
-		A[2] ^= D[2];
-		C[0] = ULong256::RotL64(A[2], 62);
-		A[8] ^= D[3];
-		C[1] = ULong256::RotL64(A[8], 55);
-		A[14] ^= D[4];
-		C[2] = ULong256::RotL64(A[14], 39);
-		A[15] ^= D[0];
-		C[3] = ULong256::RotL64(A[15], 41);
-		A[21] ^= D[1];
-		C[4] = ULong256::RotL64(A[21], 2);
-		E[20] = C[0] ^ ((~C[1]) & C[2]);
-		E[21] = C[1] ^ ((~C[2]) & C[3]);
-		E[22] = C[2] ^ ((~C[3]) & C[4]);
-		E[23] = C[3] ^ ((~C[4]) & C[0]);
-		E[24] = C[4] ^ ((~C[0]) & C[1]);
-		// round n + 1
-		C[0] = E[0] ^ E[5] ^ E[10] ^ E[15] ^ E[20];
-		C[1] = E[1] ^ E[6] ^ E[11] ^ E[16] ^ E[21];
-		C[2] = E[2] ^ E[7] ^ E[12] ^ E[17] ^ E[22];
-		C[3] = E[3] ^ E[8] ^ E[13] ^ E[18] ^ E[23];
-		C[4] = E[4] ^ E[9] ^ E[14] ^ E[19] ^ E[24];
-		D[0] = C[4] ^ ULong256::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong256::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong256::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong256::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong256::RotL64(C[0], 1);
-		E[0] ^= D[0];
-		C[0] = E[0];
-		E[6] ^= D[1];
-		C[1] = ULong256::RotL64(E[6], 44);
-		E[12] ^= D[2];
-		C[2] = ULong256::RotL64(E[12], 43);
-		E[18] ^= D[3];
-		C[3] = ULong256::RotL64(E[18], 21);
-		E[24] ^= D[4];
-		C[4] = ULong256::RotL64(E[24], 14);
-		A[0] = C[0] ^ ((~C[1]) & C[2]);
-		A[0] ^= ULong256(KECCAK_RC48[i + 1]);
-		A[1] = C[1] ^ ((~C[2]) & C[3]);
-		A[2] = C[2] ^ ((~C[3]) & C[4]);
-		A[3] = C[3] ^ ((~C[4]) & C[0]);
-		A[4] = C[4] ^ ((~C[0]) & C[1]);
-		E[3] ^= D[3];
-		C[0] = ULong256::RotL64(E[3], 28);
-		E[9] ^= D[4];
-		C[1] = ULong256::RotL64(E[9], 20);
-		E[10] ^= D[0];
-		C[2] = ULong256::RotL64(E[10], 3);
-		E[16] ^= D[1];
-		C[3] = ULong256::RotL64(E[16], 45);
-		E[22] ^= D[2];
-		C[4] = ULong256::RotL64(E[22], 61);
-		A[5] = C[0] ^ ((~C[1]) & C[2]);
-		A[6] = C[1] ^ ((~C[2]) & C[3]);
-		A[7] = C[2] ^ ((~C[3]) & C[4]);
-		A[8] = C[3] ^ ((~C[4]) & C[0]);
-		A[9] = C[4] ^ ((~C[0]) & C[1]);
-		E[1] ^= D[1];
-		C[0] = ULong256::RotL64(E[1], 1);
-		E[7] ^= D[2];
-		C[1] = ULong256::RotL64(E[7], 6);
-		E[13] ^= D[3];
-		C[2] = ULong256::RotL64(E[13], 25);
-		E[19] ^= D[4];
-		C[3] = ULong256::RotL64(E[19], 8);
-		E[20] ^= D[0];
-		C[4] = ULong256::RotL64(E[20], 18);
-		A[10] = C[0] ^ ((~C[1]) & C[2]);
-		A[11] = C[1] ^ ((~C[2]) & C[3]);
-		A[12] = C[2] ^ ((~C[3]) & C[4]);
-		A[13] = C[3] ^ ((~C[4]) & C[0]);
-		A[14] = C[4] ^ ((~C[0]) & C[1]);
-		E[4] ^= D[4];
-		C[0] = ULong256::RotL64(E[4], 27);
-		E[5] ^= D[0];
-		C[1] = ULong256::RotL64(E[5], 36);
-		E[11] ^= D[1];
-		C[2] = ULong256::RotL64(E[11], 10);
-		E[17] ^= D[2];
-		C[3] = ULong256::RotL64(E[17], 15);
-		E[23] ^= D[3];
-		C[4] = ULong256::RotL64(E[23], 56);
-		A[15] = C[0] ^ ((~C[1]) & C[2]);
-		A[16] = C[1] ^ ((~C[2]) & C[3]);
-		A[17] = C[2] ^ ((~C[3]) & C[4]);
-		A[18] = C[3] ^ ((~C[4]) & C[0]);
-		A[19] = C[4] ^ ((~C[0]) & C[1]);
-		E[2] ^= D[2];
-		C[0] = ULong256::RotL64(E[2], 62);
-		E[8] ^= D[3];
-		C[1] = ULong256::RotL64(E[8], 55);
-		E[14] ^= D[4];
-		C[2] = ULong256::RotL64(E[14], 39);
-		E[15] ^= D[0];
-		C[3] = ULong256::RotL64(E[15], 41);
-		E[21] ^= D[1];
-		C[4] = ULong256::RotL64(E[21], 2);
-		A[20] = C[0] ^ ((~C[1]) & C[2]);
-		A[21] = C[1] ^ ((~C[2]) & C[3]);
-		A[22] = C[2] ^ ((~C[3]) & C[4]);
-		A[23] = C[3] ^ ((~C[4]) & C[0]);
-		A[24] = C[4] ^ ((~C[0]) & C[1]);
-	}
+#if defined(CEX_KERNEL_SIMD512)
 
-	MemoryTools::Copy(A, 0, State, 0, A.size() * sizeof(ULong256));
+void Keccak::XOFR24P8x1600(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate)
+{
+	XOFR24PWx1600<8>(Input, InOffset, InLength, Output, OutOffset, OutLength, Rate, PermuteR24P8x1600H);
 }
 
 #endif
 
-#if defined(__AVX512__)
+//~~~Private Functions~~~//
 
-void Keccak::PermuteR48P8x1600H(std::vector<ULong512> &State)
+template<size_t LANES>
+void Keccak::XOFR24PWx1600(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate,
+	void(*Permute)(ulong*))
 {
-	std::array<ULong512, 25> A;
-	std::array<ULong512, 5> C;
-	std::array<ULong512, 5> D;
-	std::array<ULong512, 25> E;
+	// word i of the k'th seed state is at state[(i * LANES) + k]
+	std::array<byte, LANES * KECCAK_STATE_SIZE * sizeof(ulong)> msg;
+	std::array<ulong, LANES * KECCAK_STATE_SIZE> state;
+	size_t blkoff;
 	size_t i;
+	size_t k;
 
-	MemoryTools::Copy(State, 0, A, 0, A.size() * sizeof(ULong512));
+	state.fill(0);
+	blkoff = 0;
 
-	for (i = 0; i < 48; i += 2)
+	// absorb the full blocks
+	while (InLength - blkoff >= Rate)
 	{
-		// round n
-		C[0] = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
-		C[1] = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
-		C[2] = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
-		C[3] = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
-		C[4] = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
-		D[0] = C[4] ^ ULong512::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong512::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong512::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong512::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong512::RotL64(C[0], 1);
-		A[0] ^= D[0];
-		C[0] = A[0];
-		A[6] ^= D[1];
-		C[1] = ULong512::RotL64(A[6], 44);
-		A[12] ^= D[2];
-		C[2] = ULong512::RotL64(A[12], 43);
-		A[18] ^= D[3];
-		C[3] = ULong512::RotL64(A[18], 21);
-		A[24] ^= D[4];
-		C[4] = ULong512::RotL64(A[24], 14);
-		E[0] = C[0] ^ ((~C[1]) & C[2]);
-		E[0] ^= ULong512(KECCAK_RC48[i]);
-		E[1] = C[1] ^ ((~C[2]) & C[3]);
-		E[2] = C[2] ^ ((~C[3]) & C[4]);
-		E[3] = C[3] ^ ((~C[4]) & C[0]);
-		E[4] = C[4] ^ ((~C[0]) & C[1]);
-		A[3] ^= D[3];
-		C[0] = ULong512::RotL64(A[3], 28);
-		A[9] ^= D[4];
-		C[1] = ULong512::RotL64(A[9], 20);
-		A[10] ^= D[0];
-		C[2] = ULong512::RotL64(A[10], 3);
-		A[16] ^= D[1];
-		C[3] = ULong512::RotL64(A[16], 45);
-		A[22] ^= D[2];
-		C[4] = ULong512::RotL64(A[22], 61);
-		E[5] = C[0] ^ ((~C[1]) & C[2]);
-		E[6] = C[1] ^ ((~C[2]) & C[3]);
-		E[7] = C[2] ^ ((~C[3]) & C[4]);
-		E[8] = C[3] ^ ((~C[4]) & C[0]);
-		E[9] = C[4] ^ ((~C[0]) & C[1]);
-		A[1] ^= D[1];
-		C[0] = ULong512::RotL64(A[1], 1);
-		A[7] ^= D[2];
-		C[1] = ULong512::RotL64(A[7], 6);
-		A[13] ^= D[3];
-		C[2] = ULong512::RotL64(A[13], 25);
-		A[19] ^= D[4];
-		C[3] = ULong512::RotL64(A[19], 8);
-		A[20] ^= D[0];
-		C[4] = ULong512::RotL64(A[20], 18);
-		E[10] = C[0] ^ ((~C[1]) & C[2]);
-		E[11] = C[1] ^ ((~C[2]) & C[3]);
-		E[12] = C[2] ^ ((~C[3]) & C[4]);
-		E[13] = C[3] ^ ((~C[4]) & C[0]);
-		E[14] = C[4] ^ ((~C[0]) & C[1]);
-		A[4] ^= D[4];
-		C[0] = ULong512::RotL64(A[4], 27);
-		A[5] ^= D[0];
-		C[1] = ULong512::RotL64(A[5], 36);
-		A[11] ^= D[1];
-		C[2] = ULong512::RotL64(A[11], 10);
-		A[17] ^= D[2];
-		C[3] = ULong512::RotL64(A[17], 15);
-		A[23] ^= D[3];
-		C[4] = ULong512::RotL64(A[23], 56);
-		E[15] = C[0] ^ ((~C[1]) & C[2]);
-		E[16] = C[1] ^ ((~C[2]) & C[3]);
-		E[17] = C[2] ^ ((~C[3]) & C[4]);
-		E[18] = C[3] ^ ((~C[4]) & C[0]);
-		E[19] = C[4] ^ ((~C[0]) & C[1]);
-		A[2] ^= D[2];
-		C[0] = ULong512::RotL64(A[2], 62);
-		A[8] ^= D[3];
-		C[1] = ULong512::RotL64(A[8], 55);
-		A[14] ^= D[4];
-		C[2] = ULong512::RotL64(A[14], 39);
-		A[15] ^= D[0];
-		C[3] = ULong512::RotL64(A[15], 41);
-		A[21] ^= D[1];
-		C[4] = ULong512::RotL64(A[21], 2);
-		E[20] = C[0] ^ ((~C[1]) & C[2]);
-		E[21] = C[1] ^ ((~C[2]) & C[3]);
-		E[22] = C[2] ^ ((~C[3]) & C[4]);
-		E[23] = C[3] ^ ((~C[4]) & C[0]);
-		E[24] = C[4] ^ ((~C[0]) & C[1]);
-		// round n + 1
-		C[0] = E[0] ^ E[5] ^ E[10] ^ E[15] ^ E[20];
-		C[1] = E[1] ^ E[6] ^ E[11] ^ E[16] ^ E[21];
-		C[2] = E[2] ^ E[7] ^ E[12] ^ E[17] ^ E[22];
-		C[3] = E[3] ^ E[8] ^ E[13] ^ E[18] ^ E[23];
-		C[4] = E[4] ^ E[9] ^ E[14] ^ E[19] ^ E[24];
-		D[0] = C[4] ^ ULong512::RotL64(C[1], 1);
-		D[1] = C[0] ^ ULong512::RotL64(C[2], 1);
-		D[2] = C[1] ^ ULong512::RotL64(C[3], 1);
-		D[3] = C[2] ^ ULong512::RotL64(C[4], 1);
-		D[4] = C[3] ^ ULong512::RotL64(C[0], 1);
-		E[0] ^= D[0];
-		C[0] = E[0];
-		E[6] ^= D[1];
-		C[1] = ULong512::RotL64(E[6], 44);
-		E[12] ^= D[2];
-		C[2] = ULong512::RotL64(E[12], 43);
-		E[18] ^= D[3];
-		C[3] = ULong512::RotL64(E[18], 21);
-		E[24] ^= D[4];
-		C[4] = ULong512::RotL64(E[24], 14);
-		A[0] = C[0] ^ ((~C[1]) & C[2]);
-		A[0] ^= ULong512(KECCAK_RC48[i + 1]);
-		A[1] = C[1] ^ ((~C[2]) & C[3]);
-		A[2] = C[2] ^ ((~C[3]) & C[4]);
-		A[3] = C[3] ^ ((~C[4]) & C[0]);
-		A[4] = C[4] ^ ((~C[0]) & C[1]);
-		E[3] ^= D[3];
-		C[0] = ULong512::RotL64(E[3], 28);
-		E[9] ^= D[4];
-		C[1] = ULong512::RotL64(E[9], 20);
-		E[10] ^= D[0];
-		C[2] = ULong512::RotL64(E[10], 3);
-		E[16] ^= D[1];
-		C[3] = ULong512::RotL64(E[16], 45);
-		E[22] ^= D[2];
-		C[4] = ULong512::RotL64(E[22], 61);
-		A[5] = C[0] ^ ((~C[1]) & C[2]);
-		A[6] = C[1] ^ ((~C[2]) & C[3]);
-		A[7] = C[2] ^ ((~C[3]) & C[4]);
-		A[8] = C[3] ^ ((~C[4]) & C[0]);
-		A[9] = C[4] ^ ((~C[0]) & C[1]);
-		E[1] ^= D[1];
-		C[0] = ULong512::RotL64(E[1], 1);
-		E[7] ^= D[2];
-		C[1] = ULong512::RotL64(E[7], 6);
-		E[13] ^= D[3];
-		C[2] = ULong512::RotL64(E[13], 25);
-		E[19] ^= D[4];
-		C[3] = ULong512::RotL64(E[19], 8);
-		E[20] ^= D[0];
-		C[4] = ULong512::RotL64(E[20], 18);
-		A[10] = C[0] ^ ((~C[1]) & C[2]);
-		A[11] = C[1] ^ ((~C[2]) & C[3]);
-		A[12] = C[2] ^ ((~C[3]) & C[4]);
-		A[13] = C[3] ^ ((~C[4]) & C[0]);
-		A[14] = C[4] ^ ((~C[0]) & C[1]);
-		E[4] ^= D[4];
-		C[0] = ULong512::RotL64(E[4], 27);
-		E[5] ^= D[0];
-		C[1] = ULong512::RotL64(E[5], 36);
-		E[11] ^= D[1];
-		C[2] = ULong512::RotL64(E[11], 10);
-		E[17] ^= D[2];
-		C[3] = ULong512::RotL64(E[17], 15);
-		E[23] ^= D[3];
-		C[4] = ULong512::RotL64(E[23], 56);
-		A[15] = C[0] ^ ((~C[1]) & C[2]);
-		A[16] = C[1] ^ ((~C[2]) & C[3]);
-		A[17] = C[2] ^ ((~C[3]) & C[4]);
-		A[18] = C[3] ^ ((~C[4]) & C[0]);
-		A[19] = C[4] ^ ((~C[0]) & C[1]);
-		E[2] ^= D[2];
-		C[0] = ULong512::RotL64(E[2], 62);
-		E[8] ^= D[3];
-		C[1] = ULong512::RotL64(E[8], 55);
-		E[14] ^= D[4];
-		C[2] = ULong512::RotL64(E[14], 39);
-		E[15] ^= D[0];
-		C[3] = ULong512::RotL64(E[15], 41);
-		E[21] ^= D[1];
-		C[4] = ULong512::RotL64(E[21], 2);
-		A[20] = C[0] ^ ((~C[1]) & C[2]);
-		A[21] = C[1] ^ ((~C[2]) & C[3]);
-		A[22] = C[2] ^ ((~C[3]) & C[4]);
-		A[23] = C[3] ^ ((~C[4]) & C[0]);
-		A[24] = C[4] ^ ((~C[0]) & C[1]);
+		for (i = 0; i < Rate / sizeof(ulong); ++i)
+		{
+			for (k = 0; k < LANES; ++k)
+			{
+				state[(i * LANES) + k] ^= IntegerTools::LeBytesTo64(Input, InOffset + (k * InLength) + blkoff + (i * sizeof(ulong)));
+			}
+		}
+
+		Permute(state.data());
+		blkoff += Rate;
 	}
 
-	MemoryTools::Copy(A, 0, State, 0, A.size() * sizeof(ULong512));
-}
+	// pad and absorb the final block of each lane
+	for (k = 0; k < LANES; ++k)
+	{
+		MemoryTools::Clear(msg, k * Rate, Rate);
 
-#endif
+		if (InLength - blkoff != 0)
+		{
+			MemoryTools::Copy(Input, InOffset + (k * InLength) + blkoff, msg, k * Rate, InLength - blkoff);
+		}
+
+		msg[(k * Rate) + (InLength - blkoff)] = KECCAK_SHAKE_DOMAIN;
+		msg[(k * Rate) + Rate - 1] |= 128;
+	}
+
+	for (i = 0; i < Rate / sizeof(ulong); ++i)
+	{
+		for (k = 0; k < LANES; ++k)
+		{
+			state[(i * LANES) + k] ^= IntegerTools::LeBytesTo64(msg, (k * Rate) + (i * sizeof(ulong)));
+		}
+	}
+
+	// squeeze each lane into its output block
+	blkoff = 0;
+
+	while (blkoff != OutLength)
+	{
+		const size_t BLKLEN = IntegerTools::Min(Rate, OutLength - blkoff);
+
+		Permute(state.data());
+
+		for (i = 0; i < (BLKLEN + sizeof(ulong) - 1) / sizeof(ulong); ++i)
+		{
+			for (k = 0; k < LANES; ++k)
+			{
+				IntegerTools::Le64ToBytes(state[(i * LANES) + k], msg, (k * Rate) + (i * sizeof(ulong)));
+			}
+		}
+
+		for (k = 0; k < LANES; ++k)
+		{
+			MemoryTools::Copy(msg, k * Rate, Output, OutOffset + (k * OutLength) + blkoff, BLKLEN);
+		}
+
+		blkoff += BLKLEN;
+	}
+
+	MemoryTools::Clear(msg, 0, msg.size());
+	MemoryTools::Clear(state, 0, state.size() * sizeof(ulong));
+}
 
 NAMESPACE_DIGESTEND
\ No newline at end of file
@@ -23,25 +23,11 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 
-#if defined(__AVX2__)
-#	include "ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "ULong512.h"
-#endif
-
 NAMESPACE_DIGEST
 
 using Utility::IntegerTools;
 using Utility::MemoryTools;
 
-#if defined(__AVX2__)
-	using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-	using Numeric::ULong512;
-#endif
-
 /// <summary>
 /// Internal static class containing the 24 and 48 round Keccak permutation functions.
 /// <para>The function names are in the format; Permute-rounds-bits-suffix, ex. PermuteR24P1600C, 24 rounds, permutes 1600 bits, using the compact form of the function. \n
@@ -51,10 +37,12 @@ using Utility::MemoryTools;
 /// <para>The compact forms of the permutations have the suffix C, and are optimized for low memory consumption 
 /// (enabled in the hash function by adding the CEX_DIGEST_COMPACT to the CexConfig file). \n
 /// The Unrolled forms are optimized for speed and timing neutrality have the U suffix. \n
-/// The H suffix denotes functions that take an SIMD wrapper class as the state values, and process message blocks in SIMD parallel blocks.</para>
+/// The H suffix denotes functions that process the interleaved states of several lanes in SIMD parallel blocks.</para>
 /// <para>This class contains wide forms of the functions; PermuteR24P4x1600H and PermuteR48P4x1600H use AVX2. \n
 /// Experimental functions using AVX512 instructions are also implemented; PermuteR24P8x1600H and PermuteR48P8x1600H. \n
-/// These extended functions are only visible at run-time on some development platforms (VS..), if the __AVX2__ or __AVX512__ compiler flags are declared explicitly.</para>
+/// The wide forms are compiled in their own translation units (KeccakSimd256 and KeccakSimd512), each built with its instruction set enabled. \n
+/// When CEX_SIMD_DISPATCH is defined the callers select a wide form at run-time with CpuDetect::SimdProfile(), 
+/// otherwise they are only visible when the compiler flag (__AVX2__ or __AVX512__) is explicitly declared.</para>
 /// </summary>
 class Keccak
 {
@@ -84,12 +72,12 @@ public:
 	/// <summary>
 	/// The round constants for the standard 24-round implementation of the Keccak permutation
 	/// </summary>
-	static const std::array<ulong, 24> KECCAK_RC24;
+	static const ulong KECCAK_RC24[24];
 
 	/// <summary>
 	/// The round constants for the extended 48-round implementation of the Keccak permutation
 	/// </summary>
-	static const std::array<ulong, 48> KECCAK_RC48;
+	static const ulong KECCAK_RC48[48];
 
 	/// <summary>
 	/// The Keccak cSHAKE domain identifier
@@ -937,43 +925,73 @@ public:
 	/// <param name="State">The permutations uint64 state array</param>
 	static void PermuteR48P1600U(std::array<ulong, KECCAK_STATE_SIZE> &State);
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized 24 round (standard) form of the SHA3 permutation function.
 	/// <para>This function processes 4*25 blocks of state in parallel using AVX2 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="State">The permutations ULong256 state array</param>
-	static void PermuteR24P4x1600H(std::vector<ULong256> &State);
+	/// <param name="State">The 100 word interleaved state; word n of lane i is at State[(n * 4) + i]</param>
+	static void PermuteR24P4x1600H(ulong* State);
 
 	/// <summary>
 	/// The horizontally vectorized 48 round form (extended) of the SHA3 permutation function.
 	/// <para>This function processes 4*25 blocks of state in parallel using AVX2 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="State">The permutations ULong256 state array</param>
-	static void PermuteR48P4x1600H(std::vector<ULong256> &State);
+	/// <param name="State">The 100 word interleaved state; word n of lane i is at State[(n * 4) + i]</param>
+	static void PermuteR48P4x1600H(ulong* State);
+
+	/// <summary>
+	/// The horizontally vectorized Keccak XOF function using 24 rounds; processes 4 equal length input seeds and returns 4 pseudo-random output arrays.
+	/// <para>The seeds are read as 4 consecutive blocks of InLength bytes starting at InOffset, and the outputs are written as 4 consecutive blocks of OutLength bytes starting at OutOffset.
+	/// The output of each lane is identical to the output of the sequential XOFR24P1600 function, the caller must check that the SIMD profile is AVX2 or AVX512.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The input byte seed array; must contain 4 * InLength bytes</param>
+	/// <param name="InOffset">The starting offset of the first seed within the input array</param>
+	/// <param name="InLength">The number of seed bytes in each lane</param>
+	/// <param name="Output">The output byte array; must be at least 4 * OutLength bytes</param>
+	/// <param name="OutOffset">The starting offset of the first lane within the output array</param>
+	/// <param name="OutLength">The number of output bytes to produce in each lane</param>
+	/// <param name="Rate">The block input rate of permutation calls; SHAKE128=168, SHAKE256=136, SHAKE512=72</param>
+	static void XOFR24P4x1600(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized 24 round (standard) form of the SHA3 permutation function.
 	/// <para>This function processes 8*25 blocks of state in parallel using AVX512 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="State">The permutations ULong512 state array</param>
-	static void PermuteR24P8x1600H(std::vector<ULong512> &State);
+	/// <param name="State">The 200 word interleaved state; word n of lane i is at State[(n * 8) + i]</param>
+	static void PermuteR24P8x1600H(ulong* State);
 
 	/// <summary>
 	/// The horizontally vectorized 48 round (extended) form of the SHA3 permutation function.
 	/// <para>This function processes 8*25 blocks of state in parallel using AVX512 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="State">The permutations ULong512 state array</param>
-	static void PermuteR48P8x1600H(std::vector<ULong512> &State);
+	/// <param name="State">The 200 word interleaved state; word n of lane i is at State[(n * 8) + i]</param>
+	static void PermuteR48P8x1600H(ulong* State);
+
+	/// <summary>
+	/// The horizontally vectorized Keccak XOF function using 24 rounds; processes 8 equal length input seeds and returns 8 pseudo-random output arrays.
+	/// <para>The seeds are read as 8 consecutive blocks of InLength bytes starting at InOffset, and the outputs are written as 8 consecutive blocks of OutLength bytes starting at OutOffset.
+	/// The output of each lane is identical to the output of the sequential XOFR24P1600 function, the caller must check that the SIMD profile is AVX512.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The input byte seed array; must contain 8 * InLength bytes</param>
+	/// <param name="InOffset">The starting offset of the first seed within the input array</param>
+	/// <param name="InLength">The number of seed bytes in each lane</param>
+	/// <param name="Output">The output byte array; must be at least 8 * OutLength bytes</param>
+	/// <param name="OutOffset">The starting offset of the first lane within the output array</param>
+	/// <param name="OutLength">The number of output bytes to produce in each lane</param>
+	/// <param name="Rate">The block input rate of permutation calls; SHAKE128=168, SHAKE256=136, SHAKE512=72</param>
+	static void XOFR24P8x1600(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate);
 
 #endif
 
@@ -1011,6 +1029,12 @@ public:
 
 		return n + 1;
 	}
+
+private:
+
+	template<size_t LANES>
+	static void XOFR24PWx1600(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate,
+		void(*Permute)(ulong*));
 };
 
 NAMESPACE_DIGESTEND
@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_DIGEST
 
@@ -45,6 +46,7 @@ Keccak1024::Keccak1024(bool Parallel)
 		KeccakParams(Keccak::KECCAK1024_DIGEST_SIZE, 0x00, 0x00))
 {
 	Reset();
+	ParallelTuner::Apply(Digests::Keccak1024, m_parallelProfile);
 }
 
 Keccak1024::Keccak1024(KeccakParams &Params)
@@ -57,6 +59,7 @@ Keccak1024::Keccak1024(KeccakParams &Params)
 	m_treeParams(Params)
 {
 	Reset();
+	ParallelTuner::Apply(Digests::Keccak1024, m_parallelProfile);
 }
 
 Keccak1024::~Keccak1024()
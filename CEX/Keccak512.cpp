@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_DIGEST
 
@@ -45,6 +46,7 @@ Keccak512::Keccak512(bool Parallel)
 		KeccakParams(Keccak::KECCAK512_DIGEST_SIZE, 0x00, 0x00))
 {
 	Reset();
+	ParallelTuner::Apply(Digests::Keccak512, m_parallelProfile);
 }
 
 Keccak512::Keccak512(KeccakParams &Params)
@@ -57,6 +59,7 @@ Keccak512::Keccak512(KeccakParams &Params)
 	m_treeParams(Params)
 {
 	Reset();
+	ParallelTuner::Apply(Digests::Keccak512, m_parallelProfile);
 }
 
 Keccak512::~Keccak512()
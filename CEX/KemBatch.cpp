@@ -0,0 +1,132 @@
+#include "KemBatch.h"
+#include "CryptoAsymmetricException.h"
+#include "IntegerTools.h"
+#include "MemoryTools.h"
+#include "ParallelTools.h"
+#include "PrngFromName.h"
+
+NAMESPACE_ASYMMETRICENCRYPT
+
+using Exception::CryptoAsymmetricException;
+using Enumeration::ErrorCodes;
+using Utility::IntegerTools;
+using Utility::MemoryTools;
+using Utility::ParallelTools;
+
+//~~~Public Functions~~~//
+
+bool KemBatch::Decapsulate(const std::string &Name, const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count, size_t CipherTextSize, size_t SecretSize, bool Domain, const Decapsulator &Function)
+{
+	const size_t SECLEN = SecretLength(Name, std::string("Decapsulate"), SharedSecret, Count, SecretSize, Domain);
+
+	if (CipherText.size() != Count * CipherTextSize)
+	{
+		throw CryptoAsymmetricException(Name, std::string("Decapsulate"), std::string("The cipher-text array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	const size_t THDCNT = ThreadCount(Count);
+	const size_t CNKLEN = (Count + THDCNT - 1) / THDCNT;
+	std::vector<byte> status(THDCNT, 0);
+	size_t i;
+	bool result;
+
+	if (!Domain)
+	{
+		SharedSecret.resize(Count * SECLEN);
+	}
+
+	// each thread decapsulates a contiguous range of cipher-texts
+	ParallelTools::ParallelFor(0, THDCNT, [&Function, &CipherText, &SharedSecret, &status, Count, CNKLEN, CipherTextSize, SECLEN](size_t i)
+	{
+		std::vector<byte> cpt(CipherTextSize);
+		std::vector<byte> sec(SECLEN);
+		size_t j;
+
+		status[i] = 1;
+
+		for (j = i * CNKLEN; j < Count && j < (i + 1) * CNKLEN; ++j)
+		{
+			MemoryTools::Copy(CipherText, j * CipherTextSize, cpt, 0, CipherTextSize);
+
+			if (!Function(cpt, sec))
+			{
+				status[i] = 0;
+			}
+
+			MemoryTools::Copy(sec, 0, SharedSecret, j * SECLEN, SECLEN);
+		}
+
+		IntegerTools::Clear(sec);
+	});
+
+	result = true;
+
+	for (i = 0; i < THDCNT; ++i)
+	{
+		result &= (status[i] == 1);
+	}
+
+	return result;
+}
+
+void KemBatch::Encapsulate(const std::string &Name, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count, size_t CipherTextSize, size_t SecretSize, bool Domain, std::unique_ptr<IPrng> &Rng, const Encapsulator &Function)
+{
+	const size_t SECLEN = SecretLength(Name, std::string("Encapsulate"), SharedSecret, Count, SecretSize, Domain);
+	const size_t THDCNT = ThreadCount(Count);
+	const size_t CNKLEN = (Count + THDCNT - 1) / THDCNT;
+
+	CipherText.resize(Count * CipherTextSize);
+
+	if (!Domain)
+	{
+		SharedSecret.resize(Count * SECLEN);
+	}
+
+	// each thread encapsulates a contiguous range of secrets
+	ParallelTools::ParallelFor(0, THDCNT, [&Function, &Rng, &CipherText, &SharedSecret, Count, CNKLEN, CipherTextSize, SECLEN, THDCNT](size_t i)
+	{
+		// the generator is not thread-safe, concurrent threads draw from their own instance
+		std::unique_ptr<IPrng> rng(THDCNT > 1 ? Helper::PrngFromName::GetInstance(Rng->Enumeral()) : nullptr);
+		std::unique_ptr<IPrng> &gen = (THDCNT > 1) ? rng : Rng;
+		std::vector<byte> cpt(CipherTextSize);
+		std::vector<byte> sec(SECLEN);
+		size_t j;
+
+		for (j = i * CNKLEN; j < Count && j < (i + 1) * CNKLEN; ++j)
+		{
+			Function(cpt, sec, gen);
+			MemoryTools::Copy(cpt, 0, CipherText, j * CipherTextSize, CipherTextSize);
+			MemoryTools::Copy(sec, 0, SharedSecret, j * SECLEN, SECLEN);
+		}
+
+		IntegerTools::Clear(sec);
+	});
+}
+
+//~~~Private Functions~~~//
+
+size_t KemBatch::SecretLength(const std::string &Name, const std::string &Origin, const std::vector<byte> &SharedSecret, size_t Count, size_t SecretSize, bool Domain)
+{
+	size_t seclen;
+
+	if (Count == 0)
+	{
+		throw CryptoAsymmetricException(Name, Origin, std::string("The batch count can not be zero!"), ErrorCodes::InvalidParam);
+	}
+
+	seclen = Domain ? SharedSecret.size() / Count : SecretSize;
+
+	if (seclen == 0 || seclen > MAX_SECRET_SIZE || (Domain && (SharedSecret.size() % Count) != 0))
+	{
+		throw CryptoAsymmetricException(Name, Origin, std::string("The shared secret array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	return seclen;
+}
+
+size_t KemBatch::ThreadCount(size_t Count)
+{
+	return IntegerTools::Min(IntegerTools::Max(ParallelTools::ProcessorCount(), static_cast<size_t>(1)), Count);
+}
+
+NAMESPACE_ASYMMETRICENCRYPTEND
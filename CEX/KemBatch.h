@@ -0,0 +1,95 @@
+// The GPL version 3 License (GPLv3)
+// 
+// Copyright (c) 2019 vtdev.com
+// This file is part of the CEX Cryptographic library.
+// 
+// This program is free software : you can redistribute it and / or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef CEX_KEMBATCH_H
+#define CEX_KEMBATCH_H
+
+#include "CexDomain.h"
+#include "IPrng.h"
+#include <functional>
+
+NAMESPACE_ASYMMETRICENCRYPT
+
+using Prng::IPrng;
+
+/// <summary>
+/// The shared batch encapsulation and decapsulation functions used by the McEliece, NTRUPrime and RingLWE ciphers.
+/// <para>The batch is split into contiguous ranges of operations, one range per processor core, and the ranges run on the thread pool.
+/// The cipher-texts and shared secrets are stored consecutively, in one array each.</para>
+/// </summary>
+class KemBatch
+{
+public:
+
+	/// <summary>
+	/// The function that decapsulates a single cipher-text: Decapsulate(CipherText [in], SharedSecret [out])
+	/// </summary>
+	typedef std::function<bool(const std::vector<byte>&, std::vector<byte>&)> Decapsulator;
+
+	/// <summary>
+	/// The function that encapsulates a single secret with a random generator: Encapsulate(CipherText [out], SharedSecret [out], Rng [in])
+	/// </summary>
+	typedef std::function<void(std::vector<byte>&, std::vector<byte>&, std::unique_ptr<IPrng>&)> Encapsulator;
+
+	/// <summary>
+	/// Decapsulate a batch of cipher-texts
+	/// </summary>
+	/// 
+	/// <param name="Name">The calling cipher's formal name, used in exception messages</param>
+	/// <param name="CipherText">The Count consecutive cipher-texts</param>
+	/// <param name="SharedSecret">The Count consecutive shared secrets</param>
+	/// <param name="Count">The number of cipher-texts in the batch</param>
+	/// <param name="CipherTextSize">The byte size of a single cipher-text</param>
+	/// <param name="SecretSize">The byte size of a single shared secret when no domain key is used</param>
+	/// <param name="Domain">A domain key is used; the shared secret array is sized by the caller and divided evenly between the secrets</param>
+	/// <param name="Function">The single cipher-text decapsulation function</param>
+	/// 
+	/// <returns>Returns true if every cipher-text was decapsulated successfully</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the batch count or an array size is invalid</exception>
+	static bool Decapsulate(const std::string &Name, const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count, size_t CipherTextSize, size_t SecretSize, bool Domain, const Decapsulator &Function);
+
+	/// <summary>
+	/// Encapsulate a batch of shared secrets.
+	/// <para>The random generator is not thread-safe; when the batch runs on more than one thread, each thread draws from its own instance of the same generator type.</para>
+	/// </summary>
+	/// 
+	/// <param name="Name">The calling cipher's formal name, used in exception messages</param>
+	/// <param name="CipherText">Receives the Count consecutive cipher-texts</param>
+	/// <param name="SharedSecret">Receives the Count consecutive shared secrets</param>
+	/// <param name="Count">The number of secrets to generate</param>
+	/// <param name="CipherTextSize">The byte size of a single cipher-text</param>
+	/// <param name="SecretSize">The byte size of a single shared secret when no domain key is used</param>
+	/// <param name="Domain">A domain key is used; the shared secret array is sized by the caller and divided evenly between the secrets</param>
+	/// <param name="Rng">The cipher's random generator</param>
+	/// <param name="Function">The single secret encapsulation function</param>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the batch count or the shared secret array size is invalid</exception>
+	static void Encapsulate(const std::string &Name, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count, size_t CipherTextSize, size_t SecretSize, bool Domain, std::unique_ptr<IPrng> &Rng, const Encapsulator &Function);
+
+private:
+
+	static const size_t MAX_SECRET_SIZE = 256;
+
+	static size_t SecretLength(const std::string &Name, const std::string &Origin, const std::vector<byte> &SharedSecret, size_t Count, size_t SecretSize, bool Domain);
+	static size_t ThreadCount(size_t Count);
+};
+
+NAMESPACE_ASYMMETRICENCRYPTEND
+#endif
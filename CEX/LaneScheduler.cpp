@@ -0,0 +1,112 @@
+#include "LaneScheduler.h"
+#include "MemoryTools.h"
+
+NAMESPACE_MODE
+
+using Utility::MemoryTools;
+
+void LaneScheduler::Process(IBlockCipher* Cipher, size_t Start, size_t End,
+	const std::function<size_t(size_t, std::vector<byte>&, size_t)> &Load,
+	const std::function<void(size_t, size_t, std::vector<byte>&, size_t)> &Mix,
+	const std::function<void(size_t, size_t, const std::vector<byte>&, size_t)> &Store)
+{
+	const size_t BLKLEN = Cipher->BlockSize();
+	std::vector<size_t> lblk(MAX_LANES);
+	std::vector<size_t> lcnt(MAX_LANES);
+	std::vector<size_t> lmsg(MAX_LANES);
+	std::vector<byte> tmpc(MAX_LANES * BLKLEN);
+	std::vector<byte> tmpo(MAX_LANES * BLKLEN);
+	size_t actv;
+	size_t i;
+	size_t next;
+	size_t wdth;
+
+	actv = 0;
+	next = Start;
+
+	do
+	{
+		// load the next messages into the idle lanes
+		while (actv != MAX_LANES && next != End)
+		{
+			lcnt[actv] = Load(next, tmpc, actv * BLKLEN);
+
+			if (lcnt[actv] != 0)
+			{
+				lmsg[actv] = next;
+				lblk[actv] = 0;
+				++actv;
+			}
+
+			++next;
+		}
+
+		if (actv != 0)
+		{
+			// the widest transform the active lanes can fill
+			wdth = (actv == MAX_LANES) ? MAX_LANES : (actv >= 4) ? 4 : 1;
+
+			for (i = 0; i < wdth; ++i)
+			{
+				Mix(lmsg[i], lblk[i], tmpc, i * BLKLEN);
+			}
+
+			Transform(Cipher, tmpc, tmpo, wdth);
+			MemoryTools::Copy(tmpo, 0, tmpc, 0, wdth * BLKLEN);
+
+			for (i = 0; i < wdth; ++i)
+			{
+				Store(lmsg[i], lblk[i], tmpc, i * BLKLEN);
+				++lblk[i];
+			}
+
+			// retire the finished lanes, the last active lane is moved into the free slot
+			i = wdth;
+
+			while (i != 0)
+			{
+				--i;
+
+				if (lblk[i] == lcnt[i])
+				{
+					--actv;
+
+					if (i != actv)
+					{
+						lblk[i] = lblk[actv];
+						lcnt[i] = lcnt[actv];
+						lmsg[i] = lmsg[actv];
+						MemoryTools::Copy(tmpc, actv * BLKLEN, tmpc, i * BLKLEN, BLKLEN);
+					}
+				}
+			}
+		}
+	}
+	while (actv != 0 || next != End);
+
+	MemoryTools::Clear(tmpc, 0, tmpc.size());
+	MemoryTools::Clear(tmpo, 0, tmpo.size());
+}
+
+void LaneScheduler::Transform(IBlockCipher* Cipher, const std::vector<byte> &Input, std::vector<byte> &Output, size_t Lanes)
+{
+	switch (Lanes)
+	{
+		case 8:
+		{
+			Cipher->Transform1024(Input, 0, Output, 0);
+			break;
+		}
+		case 4:
+		{
+			Cipher->Transform512(Input, 0, Output, 0);
+			break;
+		}
+		default:
+		{
+			Cipher->EncryptBlock(Input, 0, Output, 0);
+		}
+	}
+}
+
+NAMESPACE_MODEEND
@@ -0,0 +1,81 @@
+// The GPL version 3 License (GPLv3)
+//
+// Copyright (c) 2019 vtdev.com
+// This file is part of the CEX Cryptographic library.
+//
+// This program is free software : you can redistribute it and / or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CEX_LANESCHEDULER_H
+#define CEX_LANESCHEDULER_H
+
+#include "CexDomain.h"
+#include "IBlockCipher.h"
+#include <functional>
+
+NAMESPACE_MODE
+
+using Cipher::Block::IBlockCipher;
+
+/// <summary>
+/// Interleaves the serial block chains of a set of independent messages through the wide transforms of a block cipher.
+/// <para>Used by the CBC batch encryption and the CMAC batch computation; each lane carries the chain value of one message,
+/// a finished lane is refilled with the next message, and every step encrypts the lanes with the widest transform they can fill.</para>
+/// </summary>
+class LaneScheduler
+{
+public:
+
+#if defined(__AVX2__) || defined(CEX_KERNEL_VAES256)
+	/// <summary>
+	/// The maximum number of chains interleaved in one step
+	/// </summary>
+	static const size_t MAX_LANES = 8;
+#else
+	/// <summary>
+	/// The maximum number of chains interleaved in one step
+	/// </summary>
+	static const size_t MAX_LANES = 4;
+#endif
+
+	/// <summary>
+	/// Run the chains of a range of messages through the block cipher.
+	/// <para>Load initializes the chain value of a lane and returns the number of blocks in the message, a message with no blocks is skipped.
+	/// Mix adds the indexed message block to the lane before the transform, and Store receives the lanes new chain value after it.</para>
+	/// </summary>
+	///
+	/// <param name="Cipher">The initialized block cipher instance</param>
+	/// <param name="Start">The index of the first message</param>
+	/// <param name="End">The exclusive index of the last message</param>
+	/// <param name="Load">Initialize the chain of a message: (message, chain state, state offset), returns the block count</param>
+	/// <param name="Mix">Add a message block to a chain: (message, block index, chain state, state offset)</param>
+	/// <param name="Store">Receive an encrypted chain value: (message, block index, chain state, state offset)</param>
+	static void Process(IBlockCipher* Cipher, size_t Start, size_t End,
+		const std::function<size_t(size_t, std::vector<byte>&, size_t)> &Load,
+		const std::function<void(size_t, size_t, std::vector<byte>&, size_t)> &Mix,
+		const std::function<void(size_t, size_t, const std::vector<byte>&, size_t)> &Store);
+
+	/// <summary>
+	/// Encrypt a set of lanes with the block cipher transform of that width.
+	/// <para>Eight lanes use Transform1024, four use Transform512, any other count encrypts the first block only.</para>
+	/// </summary>
+	///
+	/// <param name="Cipher">The initialized block cipher instance</param>
+	/// <param name="Input">The lane input blocks</param>
+	/// <param name="Output">The encrypted lane blocks</param>
+	/// <param name="Lanes">The number of lanes</param>
+	static void Transform(IBlockCipher* Cipher, const std::vector<byte> &Input, std::vector<byte> &Output, size_t Lanes);
+};
+
+NAMESPACE_MODEEND
+#endif
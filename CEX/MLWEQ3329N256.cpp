@@ -1,4 +1,5 @@
 #include "MLWEQ3329N256.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "Keccak.h"
@@ -37,43 +38,188 @@ const std::vector<int16_t> MLWEQ3329N256::ZetasInv =
 
 //~~~Public Functions~~~//
 
+void MLWEQ3329N256::ClearExpanded(MlweExpandedPrivateKey &PrivateKey)
+{
+	Clear(PrivateKey.Matrix);
+	Clear(PrivateKey.PkHat);
+	Clear(PrivateKey.SkHat);
+	Clear(PrivateKey.Key);
+	PrivateKey.K = 0;
+}
+
+void MLWEQ3329N256::ClearExpanded(MlweExpandedPublicKey &PublicKey)
+{
+	Clear(PublicKey.Matrix);
+	Clear(PublicKey.PkHat);
+	PublicKey.Hash.clear();
+	PublicKey.K = 0;
+}
+
 bool MLWEQ3329N256::Decapsulate(std::vector<byte> &Secret, const std::vector<byte> &CipherText, const std::vector<byte> &PrivateKey)
 {
-	const size_t KLEN = (CipherText.size() == CIPHERTEXTK2_SIZE) ? 2 : (CipherText.size() == CIPHERTEXTK3_SIZE) ? 3 : 4;
-	const size_t PRILEN = MLWE_POLY_SIZE * KLEN;
+	MlweExpandedPrivateKey key;
+	bool status;
+
+	ExpandPrivateKey(key, PrivateKey);
+	status = Decapsulate(Secret, CipherText, key);
+	ClearExpanded(key);
+
+	return status;
+}
+
+bool MLWEQ3329N256::Decapsulate(std::vector<byte> &Secret, const std::vector<byte> &CipherText, const MlweExpandedPrivateKey &PrivateKey)
+{
+	const size_t KLEN = PrivateKey.K;
+	const size_t CPTLEN = (KLEN == 2) ? CIPHERTEXTK2_SIZE : (KLEN == 3) ? CIPHERTEXTK3_SIZE : CIPHERTEXTK4_SIZE;
+
+	CEXASSERT(CipherText.size() == CPTLEN, "The cipher-text size is invalid");
+
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> at(KLEN, std::vector<std::array<ushort, MLWE_N>>(KLEN));
+	std::vector<std::array<ushort, MLWE_N>> pkpv(KLEN);
+	std::vector<std::array<ushort, MLWE_N>> skpv(KLEN);
 	std::vector<byte> buf(2 * MLWE_SEED_SIZE);
-	std::vector<byte> cmp(CipherText.size());
+	std::vector<byte> cmp(CPTLEN);
 	std::vector<byte> kr(2 * MLWE_SEED_SIZE);
-	std::vector<byte> pk(PrivateKey.size() - PRILEN);
 	std::vector<byte> seed(MLWE_SEED_SIZE);
+	std::vector<byte> z(MLWE_SEED_SIZE);
+	size_t i;
 	int32_t fail;
 
+	// load the cached vectors from locked memory
+	for (i = 0; i < KLEN; ++i)
+	{
+		LoadPolyVec(at[i], PrivateKey.Matrix, i * KLEN * MLWE_N);
+	}
+
+	LoadPolyVec(pkpv, PrivateKey.PkHat, 0);
+	LoadPolyVec(skpv, PrivateKey.SkHat, 0);
+
 	// decrypt the coin
-	CpaDecrypt(buf, CipherText, PrivateKey, KLEN);
+	CpaDecrypt(buf, CipherText, skpv, KLEN);
 
 	// multitarget countermeasure for coins + contributory KEM
-	MemoryTools::Copy(PrivateKey, PrivateKey.size() - (2 * MLWE_SEED_SIZE), buf, MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+	MemoryTools::Copy(PrivateKey.Key, 0, buf, MLWE_SEED_SIZE, MLWE_SEED_SIZE);
 	// coins are in kr+MLWE_SEED_SIZE
 	Compute(buf, 0, 2 * MLWE_SEED_SIZE, kr, 0, Keccak::KECCAK512_DIGEST_SIZE, Keccak::KECCAK512_RATE_SIZE);
 	// encrypt the cipher-text
 	MemoryTools::Copy(kr, MLWE_SEED_SIZE, seed, 0, seed.size());
-	MemoryTools::Copy(PrivateKey, PRILEN, pk, 0, pk.size());
 	// generate a new ciphertext for comparison
-	CpaEncrypt(cmp, buf, pk, seed, KLEN);
+	CpaEncrypt(cmp, buf, at, pkpv, seed, KLEN);
 
 	// compare the input ciphertext with the newly generated vector
-	fail = IntegerTools::Verify(CipherText, cmp, CipherText.size());
+	fail = IntegerTools::Verify(CipherText, cmp, CPTLEN);
 
 	// overwrite coins in kr with H(c)
 	Compute(CipherText, 0, CipherText.size(), kr, MLWE_SEED_SIZE, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
 	// overwrite pre-k with z on re-encryption failure
-	IntegerTools::CMov(PrivateKey, PrivateKey.size() - MLWE_SEED_SIZE, kr, 0, MLWE_SEED_SIZE, static_cast<byte>(fail));
+	MemoryTools::Copy(PrivateKey.Key, MLWE_SEED_SIZE, z, 0, MLWE_SEED_SIZE);
+	IntegerTools::CMov(z, 0, kr, 0, MLWE_SEED_SIZE, static_cast<byte>(fail));
 	// hash concatenation of pre-k and H(c) to k
 	XOF(kr, 0, 2 * MLWE_SEED_SIZE, Secret, 0, Secret.size(), Keccak::KECCAK256_RATE_SIZE);
 
+	for (i = 0; i < KLEN; ++i)
+	{
+		MemoryTools::Clear(skpv[i], 0, skpv[i].size() * sizeof(ushort));
+	}
+
+	MemoryTools::Clear(buf, 0, buf.size());
+	MemoryTools::Clear(kr, 0, kr.size());
+	MemoryTools::Clear(z, 0, z.size());
+
 	return (fail == 0);
 }
 
+bool MLWEQ3329N256::Decapsulate(std::vector<byte> &Secrets, const std::vector<byte> &CipherTexts, const MlweExpandedPrivateKey &PrivateKey, size_t Offset, size_t Count)
+{
+	const size_t KLEN = PrivateKey.K;
+	const size_t CPTLEN = (KLEN == 2) ? CIPHERTEXTK2_SIZE : (KLEN == 3) ? CIPHERTEXTK3_SIZE : CIPHERTEXTK4_SIZE;
+
+	CEXASSERT(CipherTexts.size() >= (Offset + Count) * CPTLEN, "The cipher-text array is too small");
+	CEXASSERT(Secrets.size() >= (Offset + Count) * MLWE_SEED_SIZE, "The secret array is too small");
+
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> at(KLEN, std::vector<std::array<ushort, MLWE_N>>(KLEN));
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> noise(BATCH_LANES, std::vector<std::array<ushort, MLWE_N>>((2 * KLEN) + 1));
+	std::vector<std::array<ushort, MLWE_N>> pkpv(KLEN);
+	std::vector<std::array<ushort, MLWE_N>> skpv(KLEN);
+	std::vector<byte> buf(2 * MLWE_SEED_SIZE);
+	std::vector<byte> cmp(CPTLEN);
+	std::vector<byte> coins(BATCH_LANES * MLWE_SEED_SIZE);
+	std::vector<byte> cpt(CPTLEN);
+	std::vector<byte> kr(2 * MLWE_SEED_SIZE);
+	std::vector<byte> msgs(BATCH_LANES * 2 * MLWE_SEED_SIZE);
+	std::vector<byte> prek(BATCH_LANES * MLWE_SEED_SIZE);
+	std::vector<byte> z(MLWE_SEED_SIZE);
+	size_t i;
+	size_t j;
+	size_t lanes;
+	int32_t fail;
+	int32_t status;
+
+	// load the cached vectors from locked memory
+	for (i = 0; i < KLEN; ++i)
+	{
+		LoadPolyVec(at[i], PrivateKey.Matrix, i * KLEN * MLWE_N);
+	}
+
+	LoadPolyVec(pkpv, PrivateKey.PkHat, 0);
+	LoadPolyVec(skpv, PrivateKey.SkHat, 0);
+	MemoryTools::Copy(PrivateKey.Key, MLWE_SEED_SIZE, z, 0, MLWE_SEED_SIZE);
+	status = 0;
+
+	for (i = Offset; i < Offset + Count; i += lanes)
+	{
+		lanes = IntegerTools::Min(BATCH_LANES, Offset + Count - i);
+
+		for (j = 0; j < lanes; ++j)
+		{
+			// decrypt the coin
+			MemoryTools::Copy(CipherTexts, (i + j) * CPTLEN, cpt, 0, CPTLEN);
+			CpaDecrypt(buf, cpt, skpv, KLEN);
+			// multitarget countermeasure for coins + contributory KEM
+			MemoryTools::Copy(PrivateKey.Key, 0, buf, MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+			Compute(buf, 0, 2 * MLWE_SEED_SIZE, kr, 0, Keccak::KECCAK512_DIGEST_SIZE, Keccak::KECCAK512_RATE_SIZE);
+			MemoryTools::Copy(buf, 0, msgs, j * 2 * MLWE_SEED_SIZE, 2 * MLWE_SEED_SIZE);
+			MemoryTools::Copy(kr, 0, prek, j * MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+			MemoryTools::Copy(kr, MLWE_SEED_SIZE, coins, j * MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+		}
+
+		// sample the re-encryption noise of every lane together
+		PolyGetNoise(noise, coins, lanes);
+
+		for (j = 0; j < lanes; ++j)
+		{
+			// generate a new ciphertext for comparison
+			MemoryTools::Copy(msgs, j * 2 * MLWE_SEED_SIZE, buf, 0, 2 * MLWE_SEED_SIZE);
+			CpaEncrypt(cmp, buf, at, pkpv, noise[j], KLEN);
+			MemoryTools::Copy(CipherTexts, (i + j) * CPTLEN, cpt, 0, CPTLEN);
+			fail = IntegerTools::Verify(cpt, cmp, CPTLEN);
+			status |= fail;
+
+			// overwrite coins in kr with H(c)
+			MemoryTools::Copy(prek, j * MLWE_SEED_SIZE, kr, 0, MLWE_SEED_SIZE);
+			Compute(cpt, 0, CPTLEN, kr, MLWE_SEED_SIZE, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
+			// overwrite pre-k with z on re-encryption failure
+			IntegerTools::CMov(z, 0, kr, 0, MLWE_SEED_SIZE, static_cast<byte>(fail));
+			// hash concatenation of pre-k and H(c) to k
+			XOF(kr, 0, 2 * MLWE_SEED_SIZE, Secrets, (i + j) * MLWE_SEED_SIZE, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
+		}
+	}
+
+	for (i = 0; i < KLEN; ++i)
+	{
+		MemoryTools::Clear(skpv[i], 0, skpv[i].size() * sizeof(ushort));
+	}
+
+	MemoryTools::Clear(buf, 0, buf.size());
+	MemoryTools::Clear(coins, 0, coins.size());
+	MemoryTools::Clear(kr, 0, kr.size());
+	MemoryTools::Clear(msgs, 0, msgs.size());
+	MemoryTools::Clear(prek, 0, prek.size());
+	MemoryTools::Clear(z, 0, z.size());
+
+	return (status == 0);
+}
+
 void MLWEQ3329N256::Encapsulate(std::vector<byte> &Secret, std::vector<byte> &CipherText, const std::vector<byte> &PublicKey, std::unique_ptr<Prng::IPrng> &Rng)
 {
 	const size_t KLEN = (PublicKey.size() - MLWE_SEED_SIZE) / MLWE_POLY_SIZE;
@@ -100,6 +246,75 @@ void MLWEQ3329N256::Encapsulate(std::vector<byte> &Secret, std::vector<byte> &Ci
 	XOF(kr, 0, 2 * MLWE_SEED_SIZE, Secret, 0, Secret.size(), Keccak::KECCAK256_RATE_SIZE);
 }
 
+void MLWEQ3329N256::Encapsulate(std::vector<byte> &Secrets, std::vector<byte> &CipherTexts, const MlweExpandedPublicKey &PublicKey, const std::vector<byte> &Seeds, size_t Offset, size_t Count)
+{
+	const size_t KLEN = PublicKey.K;
+	const size_t CPTLEN = (KLEN == 2) ? CIPHERTEXTK2_SIZE : (KLEN == 3) ? CIPHERTEXTK3_SIZE : CIPHERTEXTK4_SIZE;
+
+	CEXASSERT(CipherTexts.size() >= (Offset + Count) * CPTLEN, "The cipher-text array is too small");
+	CEXASSERT(Secrets.size() >= (Offset + Count) * MLWE_SEED_SIZE, "The secret array is too small");
+	CEXASSERT(Seeds.size() >= (Offset + Count) * MLWE_SEED_SIZE, "The seed array is too small");
+
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> at(KLEN, std::vector<std::array<ushort, MLWE_N>>(KLEN));
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> noise(BATCH_LANES, std::vector<std::array<ushort, MLWE_N>>((2 * KLEN) + 1));
+	std::vector<std::array<ushort, MLWE_N>> pkpv(KLEN);
+	std::vector<byte> buf(2 * MLWE_SEED_SIZE);
+	std::vector<byte> coins(BATCH_LANES * MLWE_SEED_SIZE);
+	std::vector<byte> cpt(CPTLEN);
+	std::vector<byte> kr(2 * MLWE_SEED_SIZE);
+	std::vector<byte> msgs(BATCH_LANES * 2 * MLWE_SEED_SIZE);
+	std::vector<byte> prek(BATCH_LANES * MLWE_SEED_SIZE);
+	size_t i;
+	size_t j;
+	size_t lanes;
+
+	for (i = 0; i < KLEN; ++i)
+	{
+		LoadPolyVec(at[i], PublicKey.Matrix, i * KLEN * MLWE_N);
+	}
+
+	LoadPolyVec(pkpv, PublicKey.PkHat, 0);
+
+	for (i = Offset; i < Offset + Count; i += lanes)
+	{
+		lanes = IntegerTools::Min(BATCH_LANES, Offset + Count - i);
+
+		for (j = 0; j < lanes; ++j)
+		{
+			// don't release system RNG output
+			Compute(Seeds, (i + j) * MLWE_SEED_SIZE, MLWE_SEED_SIZE, buf, 0, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
+			// multitarget countermeasure for coins + contributory KEM
+			MemoryTools::Copy(PublicKey.Hash, 0, buf, MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+			Compute(buf, 0, 2 * MLWE_SEED_SIZE, kr, 0, 2 * MLWE_SEED_SIZE, Keccak::KECCAK512_RATE_SIZE);
+			MemoryTools::Copy(buf, 0, msgs, j * 2 * MLWE_SEED_SIZE, 2 * MLWE_SEED_SIZE);
+			MemoryTools::Copy(kr, 0, prek, j * MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+			MemoryTools::Copy(kr, MLWE_SEED_SIZE, coins, j * MLWE_SEED_SIZE, MLWE_SEED_SIZE);
+		}
+
+		// sample the noise of every lane together
+		PolyGetNoise(noise, coins, lanes);
+
+		for (j = 0; j < lanes; ++j)
+		{
+			// encrypt the coin
+			MemoryTools::Copy(msgs, j * 2 * MLWE_SEED_SIZE, buf, 0, 2 * MLWE_SEED_SIZE);
+			CpaEncrypt(cpt, buf, at, pkpv, noise[j], KLEN);
+			MemoryTools::Copy(cpt, 0, CipherTexts, (i + j) * CPTLEN, CPTLEN);
+			// overwrite coins in kr with H(c)
+			MemoryTools::Copy(prek, j * MLWE_SEED_SIZE, kr, 0, MLWE_SEED_SIZE);
+			Compute(cpt, 0, CPTLEN, kr, MLWE_SEED_SIZE, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
+			// hash concatenation of pre-k and H(c) to k
+			XOF(kr, 0, 2 * MLWE_SEED_SIZE, Secrets, (i + j) * MLWE_SEED_SIZE, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
+		}
+	}
+
+	MemoryTools::Clear(buf, 0, buf.size());
+	MemoryTools::Clear(coins, 0, coins.size());
+	MemoryTools::Clear(kr, 0, kr.size());
+	MemoryTools::Clear(msgs, 0, msgs.size());
+	MemoryTools::Clear(prek, 0, prek.size());
+}
+
 void MLWEQ3329N256::Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng)
 {
 	const size_t KLEN = (PublicKey.size() - MLWE_SEED_SIZE) / MLWE_POLY_SIZE;
@@ -119,6 +334,70 @@ void MLWEQ3329N256::Generate(std::vector<byte> &PublicKey, std::vector<byte> &Pr
 	Rng->Generate(PrivateKey, PrivateKey.size() - MLWE_SEED_SIZE, MLWE_SEED_SIZE);
 }
 
+void MLWEQ3329N256::ExpandPrivateKey(MlweExpandedPrivateKey &Expanded, const std::vector<byte> &PrivateKey)
+{
+	const uint KLEN = (PrivateKey.size() == PRIVATEKEYK2_SIZE) ? 2 : (PrivateKey.size() == PRIVATEKEYK3_SIZE) ? 3 : 4;
+	const size_t PRILEN = MLWE_POLY_SIZE * KLEN;
+	std::vector<byte> pk(PrivateKey.size() - PRILEN);
+	std::vector<byte> seed(MLWE_SEED_SIZE);
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> at(KLEN, std::vector<std::array<ushort, MLWE_N>>(KLEN));
+	std::vector<std::array<ushort, MLWE_N>> pkpv(KLEN);
+	std::vector<std::array<ushort, MLWE_N>> skpv(KLEN);
+	size_t i;
+
+	Expanded.K = KLEN;
+	Expanded.Matrix.resize(KLEN * KLEN * MLWE_N);
+	Expanded.PkHat.resize(KLEN * MLWE_N);
+	Expanded.SkHat.resize(KLEN * MLWE_N);
+	Expanded.Key.resize(2 * MLWE_SEED_SIZE);
+
+	// the private key is sk || pk || H(pk) || z
+	MemoryTools::Copy(PrivateKey, PRILEN, pk, 0, pk.size());
+	UnpackSk(skpv, PrivateKey);
+	UnpackPk(pkpv, seed, pk, KLEN);
+	GenMatrix(at, seed, 1);
+
+	for (i = 0; i < KLEN; ++i)
+	{
+		StorePolyVec(Expanded.Matrix, i * KLEN * MLWE_N, at[i]);
+	}
+
+	StorePolyVec(Expanded.PkHat, 0, pkpv);
+	StorePolyVec(Expanded.SkHat, 0, skpv);
+	MemoryTools::Copy(PrivateKey, PrivateKey.size() - (2 * MLWE_SEED_SIZE), Expanded.Key, 0, 2 * MLWE_SEED_SIZE);
+
+	for (i = 0; i < KLEN; ++i)
+	{
+		MemoryTools::Clear(skpv[i], 0, skpv[i].size() * sizeof(ushort));
+	}
+}
+
+void MLWEQ3329N256::ExpandPublicKey(MlweExpandedPublicKey &Expanded, const std::vector<byte> &PublicKey)
+{
+	const uint KLEN = static_cast<uint>((PublicKey.size() - MLWE_SEED_SIZE) / MLWE_POLY_SIZE);
+	std::vector<byte> seed(MLWE_SEED_SIZE);
+	std::vector<std::vector<std::array<ushort, MLWE_N>>> at(KLEN, std::vector<std::array<ushort, MLWE_N>>(KLEN));
+	std::vector<std::array<ushort, MLWE_N>> pkpv(KLEN);
+	size_t i;
+
+	Expanded.K = KLEN;
+	Expanded.Matrix.resize(KLEN * KLEN * MLWE_N);
+	Expanded.PkHat.resize(KLEN * MLWE_N);
+	Expanded.Hash.resize(MLWE_SEED_SIZE);
+
+	UnpackPk(pkpv, seed, PublicKey, KLEN);
+	GenMatrix(at, seed, 1);
+
+	for (i = 0; i < KLEN; ++i)
+	{
+		StorePolyVec(Expanded.Matrix, i * KLEN * MLWE_N, at[i]);
+	}
+
+	StorePolyVec(Expanded.PkHat, 0, pkpv);
+	// the public key hash H(pk) is shared by every encapsulation
+	Compute(PublicKey, 0, PublicKey.size(), Expanded.Hash, 0, MLWE_SEED_SIZE, Keccak::KECCAK256_RATE_SIZE);
+}
+
 // indcpa.c //
 
 void MLWEQ3329N256::PackPk(std::vector<byte> &R, std::vector<std::array<ushort, MLWE_N>> &Pk, const std::vector<byte> &Seed)
@@ -159,7 +438,7 @@ void MLWEQ3329N256::UnpackCiphertext(std::vector<std::array<ushort, MLWE_N>> &B,
 	PolyDecompress(V, C, B.size());
 }
 
-uint MLWEQ3329N256::RejUniform(std::array<ushort, MLWE_N> &R, uint ROffset, uint RLength, const std::vector<byte> &Buffer, size_t BufLength)
+uint MLWEQ3329N256::RejUniform(std::array<ushort, MLWE_N> &R, uint ROffset, uint RLength, const std::vector<byte> &Buffer, size_t BufOffset, size_t BufLength)
 {
 	uint ctr;
 	uint pos;
@@ -168,9 +447,19 @@ uint MLWEQ3329N256::RejUniform(std::array<ushort, MLWE_N> &R, uint ROffset, uint
 	ctr = ROffset;
 	pos = 0;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		// sample 16 candidates at a time while a full register of coefficients still fits
+		RejUniformV(R, ctr, RLength, Buffer, BufOffset, BufLength, pos);
+	}
+#endif
+
 	while (ctr < RLength && pos + 2 <= BufLength)
 	{
-		val = Buffer[pos] | (static_cast<ushort>(Buffer[pos + 1]) << 8);
+		val = Buffer[BufOffset + pos] | (static_cast<ushort>(Buffer[BufOffset + pos + 1]) << 8);
 		pos += 2;
 
 		if (val < 19 * MLWE_Q)
@@ -187,50 +476,120 @@ uint MLWEQ3329N256::RejUniform(std::array<ushort, MLWE_N> &R, uint ROffset, uint
 
 void MLWEQ3329N256::GenMatrix(std::vector<std::vector<std::array<ushort, MLWE_N>>> &A, const std::vector<byte> &Seed, bool Transposed)
 {
-	// 530 is expected number of required bytes
 	const size_t KLEN = A.size();
-	const uint maxnblocks = (530 + Keccak::KECCAK128_RATE_SIZE) / Keccak::KECCAK128_RATE_SIZE;
-	std::vector<byte> buf(Keccak::KECCAK128_RATE_SIZE * ((530 + Keccak::KECCAK128_RATE_SIZE) / Keccak::KECCAK128_RATE_SIZE) + 1);
-	std::array<ulong, Keccak::KECCAK_STATE_SIZE> state;
-	std::vector<byte> extseed(MLWE_SEED_SIZE + 2);
+	const size_t SEEDLEN = MLWE_SEED_SIZE + 2;
+	std::vector<byte> seeds(KLEN * KLEN * SEEDLEN);
 	size_t i;
 	size_t j;
 	size_t k;
-	uint ctr;
 
+	// the extended seeds of every matrix entry, in row order
 	for (i = 0; i < KLEN; ++i)
 	{
 		for (j = 0; j < KLEN; ++j)
 		{
-			MemoryTools::Copy(Seed, 0, extseed, 0, MLWE_SEED_SIZE);
-			k = MLWE_SEED_SIZE;
+			k = ((i * KLEN) + j) * SEEDLEN;
+			MemoryTools::Copy(Seed, 0, seeds, k, MLWE_SEED_SIZE);
+			k += MLWE_SEED_SIZE;
 
 			if (Transposed)
 			{
-				extseed[k] = static_cast<byte>(i);
+				seeds[k] = static_cast<byte>(i);
 				++k;
-				extseed[k] = static_cast<byte>(j);
+				seeds[k] = static_cast<byte>(j);
 			}
 			else
 			{
-				extseed[k] = static_cast<byte>(j);
+				seeds[k] = static_cast<byte>(j);
 				++k;
-				extseed[k] = static_cast<byte>(i);
+				seeds[k] = static_cast<byte>(i);
+			}
+		}
+	}
+
+	k = 0;
+
+#if defined(CEX_KERNEL_SIMD256)
+	// 530 is expected number of required bytes
+	const size_t BUFLEN = Keccak::KECCAK128_RATE_SIZE * ((530 + Keccak::KECCAK128_RATE_SIZE) / Keccak::KECCAK128_RATE_SIZE);
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+	std::vector<byte> buf(8 * BUFLEN);
+	size_t lane;
+
+#	if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		// squeeze 8 entries in parallel
+		while (k + 8 <= KLEN * KLEN)
+		{
+			Keccak::XOFR24P8x1600(seeds, k * SEEDLEN, SEEDLEN, buf, 0, BUFLEN, Keccak::KECCAK128_RATE_SIZE);
+
+			for (lane = 0; lane < 8; ++lane)
+			{
+				i = (k + lane) / KLEN;
+				j = (k + lane) % KLEN;
+
+				// the rare short stream is regenerated and squeezed further in sequential mode
+				if (RejUniform(A[i][j], 0, MLWE_N, buf, lane * BUFLEN, BUFLEN) < MLWE_N)
+				{
+					GenUniform(A[i][j], seeds, (k + lane) * SEEDLEN);
+				}
 			}
 
-			MemoryTools::SetValue(state, 0, state.size() * sizeof(ulong), 0x00);
-			Keccak::AbsorbR24(extseed, 0, MLWE_SEED_SIZE + 2, Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK_SHAKE_DOMAIN, state);
-			Keccak::SqueezeR24(state, buf, 0, maxnblocks, Keccak::KECCAK128_RATE_SIZE);
+			k += 8;
+		}
+	}
+#	endif
 
-			ctr = RejUniform(A[i][j], 0, MLWE_N, buf, maxnblocks * Keccak::KECCAK128_RATE_SIZE);
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		// squeeze 4 entries in parallel
+		while (k + 4 <= KLEN * KLEN)
+		{
+			Keccak::XOFR24P4x1600(seeds, k * SEEDLEN, SEEDLEN, buf, 0, BUFLEN, Keccak::KECCAK128_RATE_SIZE);
 
-			while (ctr < MLWE_N)
+			for (lane = 0; lane < 4; ++lane)
 			{
-				Keccak::SqueezeR24(state, buf, 0, 1, Keccak::KECCAK128_RATE_SIZE);
-				ctr += RejUniform(A[i][j], ctr, MLWE_N - ctr, buf, Keccak::KECCAK128_RATE_SIZE);
+				i = (k + lane) / KLEN;
+				j = (k + lane) % KLEN;
+
+				if (RejUniform(A[i][j], 0, MLWE_N, buf, lane * BUFLEN, BUFLEN) < MLWE_N)
+				{
+					GenUniform(A[i][j], seeds, (k + lane) * SEEDLEN);
+				}
 			}
+
+			k += 4;
 		}
 	}
+#endif
+
+	while (k < KLEN * KLEN)
+	{
+		GenUniform(A[k / KLEN][k % KLEN], seeds, k * SEEDLEN);
+		++k;
+	}
+}
+
+void MLWEQ3329N256::GenUniform(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Seeds, size_t SeedOffset)
+{
+	// 530 is expected number of required bytes
+	const uint maxnblocks = (530 + Keccak::KECCAK128_RATE_SIZE) / Keccak::KECCAK128_RATE_SIZE;
+	std::vector<byte> buf(Keccak::KECCAK128_RATE_SIZE * ((530 + Keccak::KECCAK128_RATE_SIZE) / Keccak::KECCAK128_RATE_SIZE) + 1);
+	std::array<ulong, Keccak::KECCAK_STATE_SIZE> state;
+	uint ctr;
+
+	MemoryTools::SetValue(state, 0, state.size() * sizeof(ulong), 0x00);
+	Keccak::AbsorbR24(Seeds, SeedOffset, MLWE_SEED_SIZE + 2, Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK_SHAKE_DOMAIN, state);
+	Keccak::SqueezeR24(state, buf, 0, maxnblocks, Keccak::KECCAK128_RATE_SIZE);
+
+	ctr = RejUniform(R, 0, MLWE_N, buf, 0, maxnblocks * Keccak::KECCAK128_RATE_SIZE);
+
+	while (ctr < MLWE_N)
+	{
+		Keccak::SqueezeR24(state, buf, 0, 1, Keccak::KECCAK128_RATE_SIZE);
+		ctr += RejUniform(R, ctr, MLWE_N - ctr, buf, 0, Keccak::KECCAK128_RATE_SIZE);
+	}
 }
 
 void MLWEQ3329N256::CpaGenerate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::vector<byte> &Seed, uint K)
@@ -283,44 +642,47 @@ void MLWEQ3329N256::CpaEncrypt(std::vector<byte> &CipherText, const std::vector<
 {
 	std::vector<byte> seed(MLWE_SEED_SIZE);
 	std::vector<std::vector<std::array<ushort, MLWE_N>>> at(K, std::vector<std::array<ushort, MLWE_N>>(K));
-	std::vector<std::array<ushort, MLWE_N>> bp(K);
-	std::vector<std::array<ushort, MLWE_N>> sp(K);
 	std::vector<std::array<ushort, MLWE_N>> pkpv(K);
-	std::vector<std::array<ushort, MLWE_N>> ep(K);
-	std::array<ushort, MLWE_N> k;
-	std::array<ushort, MLWE_N> epp;
-	std::array<ushort, MLWE_N> v;
-	size_t i;
-	uint8_t nonce;
 
-	nonce = 0;
 	UnpackPk(pkpv, seed, Pk, K);
-	PolyFromMsg(k, Message);
 	GenMatrix(at, seed, 1);
+	CpaEncrypt(CipherText, Message, at, pkpv, Coins, K);
+}
 
-	for (i = 0; i < K; ++i)
-	{
-		PolyGetNoise(sp[i], Coins, nonce);
-		++nonce;
-	}
+void MLWEQ3329N256::CpaEncrypt(std::vector<byte> &CipherText, const std::vector<byte> &Message, const std::vector<std::vector<std::array<ushort, MLWE_N>>> &At, const std::vector<std::array<ushort, MLWE_N>> &Pkpv, const std::vector<byte> &Coins, uint K)
+{
+	std::vector<std::array<ushort, MLWE_N>> noise((2 * K) + 1);
+	size_t i;
 
-	for (i = 0; i < K; ++i)
+	for (i = 0; i < noise.size(); ++i)
 	{
-		PolyGetNoise(ep[i], Coins, nonce);
-		++nonce;
+		PolyGetNoise(noise[i], Coins, static_cast<byte>(i));
 	}
 
-	PolyGetNoise(epp, Coins, nonce);
-	++nonce;
+	CpaEncrypt(CipherText, Message, At, Pkpv, noise, K);
+}
+
+void MLWEQ3329N256::CpaEncrypt(std::vector<byte> &CipherText, const std::vector<byte> &Message, const std::vector<std::vector<std::array<ushort, MLWE_N>>> &At, const std::vector<std::array<ushort, MLWE_N>> &Pkpv, const std::vector<std::array<ushort, MLWE_N>> &Noise, uint K)
+{
+	// the noise vectors are sp, ep, and epp, in nonce order
+	std::vector<std::array<ushort, MLWE_N>> bp(K);
+	std::vector<std::array<ushort, MLWE_N>> sp(Noise.begin(), Noise.begin() + K);
+	std::vector<std::array<ushort, MLWE_N>> ep(Noise.begin() + K, Noise.begin() + (2 * K));
+	const std::array<ushort, MLWE_N> &epp = Noise[2 * K];
+	std::array<ushort, MLWE_N> k;
+	std::array<ushort, MLWE_N> v;
+	size_t i;
+
+	PolyFromMsg(k, Message);
 	PolyVecNtt(sp);
 
 	// matrix-vector multiplication
 	for (i = 0; i < K; ++i)
 	{
-		PolyVecPointwiseAcc(bp[i], at[i], sp);
+		PolyVecPointwiseAcc(bp[i], At[i], sp);
 	}
 
-	PolyVecPointwiseAcc(v, pkpv, sp);
+	PolyVecPointwiseAcc(v, Pkpv, sp);
 	PolyVecInvNtt(bp);
 	PolyInvNtt(v);
 
@@ -335,16 +697,22 @@ void MLWEQ3329N256::CpaEncrypt(std::vector<byte> &CipherText, const std::vector<
 
 void MLWEQ3329N256::CpaDecrypt(std::vector<byte> &Message, const std::vector<byte> &CipherText, const std::vector<byte> &Sk, uint K)
 {
-	std::vector<std::array<ushort, MLWE_N>> bp(K);
 	std::vector<std::array<ushort, MLWE_N>> skpv(K);
+
+	UnpackSk(skpv, Sk);
+	CpaDecrypt(Message, CipherText, skpv, K);
+}
+
+void MLWEQ3329N256::CpaDecrypt(std::vector<byte> &Message, const std::vector<byte> &CipherText, const std::vector<std::array<ushort, MLWE_N>> &Skpv, uint K)
+{
+	std::vector<std::array<ushort, MLWE_N>> bp(K);
 	std::array<ushort, MLWE_N> v;
 	std::array<ushort, MLWE_N> mp;
 
 	UnpackCiphertext(bp, v, CipherText);
-	UnpackSk(skpv, Sk);
 
 	PolyVecNtt(bp);
-	PolyVecPointwiseAcc(mp, skpv, bp);
+	PolyVecPointwiseAcc(mp, Skpv, bp);
 	PolyInvNtt(mp);
 
 	PolySub(mp, v, mp);
@@ -353,6 +721,26 @@ void MLWEQ3329N256::CpaDecrypt(std::vector<byte> &Message, const std::vector<byt
 	PolyToMsg(Message, mp);
 }
 
+void MLWEQ3329N256::LoadPolyVec(std::vector<std::array<ushort, MLWE_N>> &R, const SecureVector<ushort> &A, size_t AOffset)
+{
+	size_t i;
+
+	for (i = 0; i < R.size(); ++i)
+	{
+		MemoryTools::Copy(A, AOffset + (i * MLWE_N), R[i], 0, MLWE_N * sizeof(ushort));
+	}
+}
+
+void MLWEQ3329N256::StorePolyVec(SecureVector<ushort> &R, size_t ROffset, const std::vector<std::array<ushort, MLWE_N>> &A)
+{
+	size_t i;
+
+	for (i = 0; i < A.size(); ++i)
+	{
+		MemoryTools::Copy(A[i], 0, R, ROffset + (i * MLWE_N), MLWE_N * sizeof(ushort));
+	}
+}
+
 // ntt.c //
 
 ushort MLWEQ3329N256::FqMul(int16_t A, int16_t B)
@@ -600,6 +988,21 @@ void MLWEQ3329N256::PolyFromBytes(std::array<ushort, MLWE_N> &R, const std::vect
 	}
 }
 
+void MLWEQ3329N256::PolyCbd(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Buffer)
+{
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		CbdV(R, Buffer);
+		return;
+	}
+#endif
+
+	Cbd(R, Buffer);
+}
+
 void MLWEQ3329N256::PolyGetNoise(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Seed, byte Nonce)
 {
 	std::vector<byte> buf(MLWE_ETA * MLWE_N / 4);
@@ -610,17 +1013,135 @@ void MLWEQ3329N256::PolyGetNoise(std::array<ushort, MLWE_N> &R, const std::vecto
 
 	XOF(extkey, 0, MLWE_SEED_SIZE + 1, buf, 0, (MLWE_ETA * MLWE_N) / 4, Keccak::KECCAK256_RATE_SIZE);
 
-	Cbd(R, buf);
+	PolyCbd(R, buf);
+}
+
+void MLWEQ3329N256::PolyGetNoise(std::vector<std::vector<std::array<ushort, MLWE_N>>> &R, const std::vector<byte> &Seeds, size_t Lanes)
+{
+	const size_t BUFLEN = (MLWE_ETA * MLWE_N) / 4;
+	const size_t EXTLEN = MLWE_SEED_SIZE + 1;
+	std::vector<byte> seed(MLWE_SEED_SIZE);
+	size_t i;
+	size_t j;
+
+	j = 0;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+	std::vector<byte> buf(BUFLEN);
+	std::vector<byte> bufs(8 * BUFLEN);
+	std::vector<byte> extkeys(8 * EXTLEN);
+	size_t lane;
+
+#	if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		// sample the noise of 8 operations in parallel
+		while (j + 8 <= Lanes)
+		{
+			for (lane = 0; lane < 8; ++lane)
+			{
+				MemoryTools::Copy(Seeds, (j + lane) * MLWE_SEED_SIZE, extkeys, lane * EXTLEN, MLWE_SEED_SIZE);
+			}
+
+			for (i = 0; i < R[j].size(); ++i)
+			{
+				for (lane = 0; lane < 8; ++lane)
+				{
+					extkeys[(lane * EXTLEN) + MLWE_SEED_SIZE] = static_cast<byte>(i);
+				}
+
+				Keccak::XOFR24P8x1600(extkeys, 0, EXTLEN, bufs, 0, BUFLEN, Keccak::KECCAK256_RATE_SIZE);
+
+				for (lane = 0; lane < 8; ++lane)
+				{
+					MemoryTools::Copy(bufs, lane * BUFLEN, buf, 0, BUFLEN);
+					PolyCbd(R[j + lane][i], buf);
+				}
+			}
+
+			j += 8;
+		}
+	}
+#	endif
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		// sample the noise of 4 operations in parallel
+		while (j + 4 <= Lanes)
+		{
+			for (lane = 0; lane < 4; ++lane)
+			{
+				MemoryTools::Copy(Seeds, (j + lane) * MLWE_SEED_SIZE, extkeys, lane * EXTLEN, MLWE_SEED_SIZE);
+			}
+
+			for (i = 0; i < R[j].size(); ++i)
+			{
+				for (lane = 0; lane < 4; ++lane)
+				{
+					extkeys[(lane * EXTLEN) + MLWE_SEED_SIZE] = static_cast<byte>(i);
+				}
+
+				Keccak::XOFR24P4x1600(extkeys, 0, EXTLEN, bufs, 0, BUFLEN, Keccak::KECCAK256_RATE_SIZE);
+
+				for (lane = 0; lane < 4; ++lane)
+				{
+					MemoryTools::Copy(bufs, lane * BUFLEN, buf, 0, BUFLEN);
+					PolyCbd(R[j + lane][i], buf);
+				}
+			}
+
+			j += 4;
+		}
+	}
+
+	MemoryTools::Clear(bufs, 0, bufs.size());
+	MemoryTools::Clear(extkeys, 0, extkeys.size());
+#endif
+
+	// the remaining operations
+	for (; j < Lanes; ++j)
+	{
+		MemoryTools::Copy(Seeds, j * MLWE_SEED_SIZE, seed, 0, MLWE_SEED_SIZE);
+
+		for (i = 0; i < R[j].size(); ++i)
+		{
+			PolyGetNoise(R[j][i], seed, static_cast<byte>(i));
+		}
+	}
+
+	MemoryTools::Clear(seed, 0, seed.size());
 }
 
 void MLWEQ3329N256::PolyNtt(std::array<ushort, MLWE_N> &R)
 {
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		NttV(R);
+		PolyReduceV(R);
+		return;
+	}
+#endif
+
 	Ntt(R);
 	PolyReduce(R);
 }
 
 void MLWEQ3329N256::PolyInvNtt(std::array<ushort, MLWE_N> &R)
 {
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		InvNttV(R);
+		return;
+	}
+#endif
+
 	InvNtt(R);
 }
 
@@ -628,6 +1149,16 @@ void MLWEQ3329N256::PolyBaseMul(std::array<ushort, MLWE_N> &R, const std::array<
 {
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyBaseMulV(R, A, B);
+		return;
+	}
+#endif
+
 	for (i = 0; i < MLWE_N / 4; ++i)
 	{
 		BaseMul(R, A, B, 4 * i, Zetas[64 + i]);
@@ -650,6 +1181,16 @@ void MLWEQ3329N256::PolyReduce(std::array<ushort, MLWE_N> &R)
 {
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyReduceV(R);
+		return;
+	}
+#endif
+
 	for (i = 0; i < MLWE_N; ++i)
 	{
 		R[i] = BarrettReduce(static_cast<int16_t>(R[i]));
@@ -660,6 +1201,16 @@ void MLWEQ3329N256::PolyCSubQ(std::array<ushort, MLWE_N> &R)
 {
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyCSubQV(R);
+		return;
+	}
+#endif
+
 	for (i = 0; i < MLWE_N; ++i)
 	{
 		R[i] = CSubQ(static_cast<int16_t>(R[i]));
@@ -878,6 +1429,16 @@ void MLWEQ3329N256::PolyVecPointwiseAcc(std::array<ushort, MLWE_N> &R, const std
 	std::array<ushort, MLWE_N> t;
 	size_t i;
 
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyVecPointwiseAccV(R, A, B);
+		return;
+	}
+#endif
+
 	PolyBaseMul(R, A[0], B[0]);
 
 	for (i = 1; i < A.size(); ++i)
@@ -21,6 +21,7 @@
 
 #include "CexDomain.h"
 #include "IPrng.h"
+#include "SecureVector.h"
 
 NAMESPACE_MODULELWE
 
@@ -37,6 +38,12 @@ private:
 
 	// 2^16 % Q
 	static const int MONT = 2285;
+#if defined(CEX_KERNEL_SIMD512)
+	// the number of batch operations that share a noise sampling pass
+	static const size_t BATCH_LANES = 8;
+#else
+	static const size_t BATCH_LANES = 4;
+#endif
 	static const int MLWE_ETA = 2;
 	static const size_t MLWE_POLY_SIZE = 384;
 	// q^(-1) mod 2^16
@@ -108,8 +115,47 @@ public:
 	/// </summary>
 	static const size_t PUBLICKEYK4_SIZE = 1568;
 
+	/// <summary>
+	/// A private key in its decapsulation form: the transposed matrix A^T, and the NTT domain public and secret vectors.
+	/// <para>The polynomials are stored contiguously in locked memory; K is the module dimension.</para>
+	/// </summary>
+	typedef struct
+	{
+		SecureVector<ushort> Matrix;
+		SecureVector<ushort> PkHat;
+		SecureVector<ushort> SkHat;
+		SecureVector<byte> Key;
+		uint K;
+	} MlweExpandedPrivateKey;
+
+	/// <summary>
+	/// A public key in its encapsulation form: the transposed matrix A^T, the NTT domain public vector, and the public key hash H(pk).
+	/// <para>K is the module dimension; a K of zero indicates that the key has not been expanded.</para>
+	/// </summary>
+	typedef struct
+	{
+		SecureVector<ushort> Matrix;
+		SecureVector<ushort> PkHat;
+		std::vector<byte> Hash;
+		uint K;
+	} MlweExpandedPublicKey;
+
 	//~~~Public Functions~~~//
 
+	/// <summary>
+	/// Erase and release an expanded private key
+	/// </summary>
+	/// 
+	/// <param name="PrivateKey">The expanded private key</param>
+	static void ClearExpanded(MlweExpandedPrivateKey &PrivateKey);
+
+	/// <summary>
+	/// Erase and release an expanded public key
+	/// </summary>
+	/// 
+	/// <param name="PublicKey">The expanded public key</param>
+	static void ClearExpanded(MlweExpandedPublicKey &PublicKey);
+
 	/// <summary>
 	/// Decapsulate a cipher-text and return the shared-secret
 	/// </summary>
@@ -119,6 +165,30 @@ public:
 	/// <param name="PrivateKey">The private asymmetric key</param>
 	static bool Decapsulate(std::vector<byte> &Secret, const std::vector<byte> &CipherText, const std::vector<byte> &PrivateKey);
 
+	/// <summary>
+	/// Decapsulate a cipher-text with an expanded private key and return the shared-secret
+	/// </summary>
+	/// 
+	/// <param name="Secret">The shared-secret key</param>
+	/// <param name="CipherText">The encapsulated keys ciphertext</param>
+	/// <param name="PrivateKey">The expanded private key</param>
+	static bool Decapsulate(std::vector<byte> &Secret, const std::vector<byte> &CipherText, const MlweExpandedPrivateKey &PrivateKey);
+
+	/// <summary>
+	/// Decapsulate a range of cipher-texts within a batch with an expanded private key.
+	/// <para>The cipher-texts and the MLWE_SEED_SIZE byte secrets are stored consecutively; items Offset to Offset + Count are processed.
+	/// With AVX2 the re-encryption noise of four cipher-texts is sampled in parallel lanes (eight with AVX512).</para>
+	/// </summary>
+	/// 
+	/// <param name="Secrets">The shared-secret keys</param>
+	/// <param name="CipherTexts">The encapsulated keys ciphertexts</param>
+	/// <param name="PrivateKey">The expanded private key</param>
+	/// <param name="Offset">The index of the first item to process</param>
+	/// <param name="Count">The number of items to process</param>
+	/// 
+	/// <returns>Returns true if every cipher-text in the range was valid</returns>
+	static bool Decapsulate(std::vector<byte> &Secrets, const std::vector<byte> &CipherTexts, const MlweExpandedPrivateKey &PrivateKey, size_t Offset, size_t Count);
+
 	/// <summary>
 	/// Encapsulate a secret key and output the cipher-text and the shared-secret
 	/// </summary>
@@ -129,6 +199,39 @@ public:
 	/// <param name="Rng">The random generator instance</param>
 	static void Encapsulate(std::vector<byte> &Secret, std::vector<byte> &CipherText, const std::vector<byte> &PublicKey, std::unique_ptr<Prng::IPrng> &Rng);
 
+	/// <summary>
+	/// Encapsulate a range of secrets within a batch with an expanded public key.
+	/// <para>The random seeds, the MLWE_SEED_SIZE byte secrets, and the cipher-texts are stored consecutively; items Offset to Offset + Count are processed.
+	/// With AVX2 the noise of four encapsulations is sampled in parallel lanes (eight with AVX512).</para>
+	/// </summary>
+	/// 
+	/// <param name="Secrets">The shared-secret messages</param>
+	/// <param name="CipherTexts">The encapsulated keys ciphertexts</param>
+	/// <param name="PublicKey">The expanded public key</param>
+	/// <param name="Seeds">The random seeds; MLWE_SEED_SIZE bytes per item</param>
+	/// <param name="Offset">The index of the first item to process</param>
+	/// <param name="Count">The number of items to process</param>
+	static void Encapsulate(std::vector<byte> &Secrets, std::vector<byte> &CipherTexts, const MlweExpandedPublicKey &PublicKey, const std::vector<byte> &Seeds, size_t Offset, size_t Count);
+
+	/// <summary>
+	/// Expand a private key to its decapsulation form.
+	/// <para>Generates the transposed public matrix and unpacks the NTT domain public and secret vectors once, 
+	/// so that repeated decapsulations with the same key skip the matrix expansion.</para>
+	/// </summary>
+	/// 
+	/// <param name="Expanded">The expanded private key</param>
+	/// <param name="PrivateKey">The private asymmetric key</param>
+	static void ExpandPrivateKey(MlweExpandedPrivateKey &Expanded, const std::vector<byte> &PrivateKey);
+
+	/// <summary>
+	/// Expand a public key to its encapsulation form.
+	/// <para>Generates the transposed public matrix, unpacks the NTT domain public vector, and hashes the public key once for a batch of encapsulations.</para>
+	/// </summary>
+	/// 
+	/// <param name="Expanded">The expanded public key</param>
+	/// <param name="PublicKey">The public asymmetric key</param>
+	static void ExpandPublicKey(MlweExpandedPublicKey &Expanded, const std::vector<byte> &PublicKey);
+
 	/// <summary>
 	/// Generate a public/private key-pair
 	/// </summary>
@@ -148,11 +251,17 @@ private:
 	static void UnpackSk(std::vector<std::array<ushort, MLWE_N>> &Sk, const std::vector<byte> &PackedSk);
 	static void PackCiphertext(std::vector<byte> &R, std::vector<std::array<ushort, MLWE_N>> &B, std::array<ushort, MLWE_N> &V);
 	static void UnpackCiphertext(std::vector<std::array<ushort, MLWE_N>> &B, std::array<ushort, MLWE_N> &V, const std::vector<byte> &C);
-	static uint RejUniform(std::array<ushort, MLWE_N> &R, uint ROffset, uint RLength, const std::vector<byte> &Buffer, size_t BufLength);
+	static uint RejUniform(std::array<ushort, MLWE_N> &R, uint ROffset, uint RLength, const std::vector<byte> &Buffer, size_t BufOffset, size_t BufLength);
 	static void GenMatrix(std::vector<std::vector<std::array<ushort, MLWE_N>>> &A, const std::vector<byte> &Seed, bool Transposed);
+	static void GenUniform(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Seeds, size_t SeedOffset);
 	static void CpaGenerate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::vector<byte> &Seed, uint K);
 	static void CpaEncrypt(std::vector<byte> &CipherText, const std::vector<byte> &Message, const std::vector<byte> &Pk, const std::vector<byte> &Coins, uint K);
+	static void CpaEncrypt(std::vector<byte> &CipherText, const std::vector<byte> &Message, const std::vector<std::vector<std::array<ushort, MLWE_N>>> &At, const std::vector<std::array<ushort, MLWE_N>> &Pkpv, const std::vector<byte> &Coins, uint K);
+	static void CpaEncrypt(std::vector<byte> &CipherText, const std::vector<byte> &Message, const std::vector<std::vector<std::array<ushort, MLWE_N>>> &At, const std::vector<std::array<ushort, MLWE_N>> &Pkpv, const std::vector<std::array<ushort, MLWE_N>> &Noise, uint K);
 	static void CpaDecrypt(std::vector<byte> &Message, const std::vector<byte> &CipherText, const std::vector<byte> &Sk, uint K);
+	static void CpaDecrypt(std::vector<byte> &Message, const std::vector<byte> &CipherText, const std::vector<std::array<ushort, MLWE_N>> &Skpv, uint K);
+	static void LoadPolyVec(std::vector<std::array<ushort, MLWE_N>> &R, const SecureVector<ushort> &A, size_t AOffset);
+	static void StorePolyVec(SecureVector<ushort> &R, size_t ROffset, const std::vector<std::array<ushort, MLWE_N>> &A);
 
 	// ntt.c //
 
@@ -168,7 +277,9 @@ private:
 	static void PolyDecompress(std::array<ushort, MLWE_N> &R, const std::vector<byte> &A, uint K);
 	static void PolyToBytes(std::vector<byte> &R, size_t ROffset, std::array<ushort, MLWE_N> &A);
 	static void PolyFromBytes(std::array<ushort, MLWE_N> &R, const std::vector<byte> &A, size_t AOffset);
+	static void PolyCbd(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Buffer);
 	static void PolyGetNoise(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Seed, byte Nonce);
+	static void PolyGetNoise(std::vector<std::vector<std::array<ushort, MLWE_N>>> &R, const std::vector<byte> &Seeds, size_t Lanes);
 	static void PolyNtt(std::array<ushort, MLWE_N> &R);
 	static void PolyInvNtt(std::array<ushort, MLWE_N> &R);
 	static void PolyBaseMul(std::array<ushort, MLWE_N> &R, const std::array<ushort, MLWE_N> &A, const std::array<ushort, MLWE_N> &B);
@@ -200,6 +311,20 @@ private:
 	static ushort CSubQ(int16_t A);
 	static void Compute(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate);
 	static void XOF(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate);
+
+#if defined(CEX_KERNEL_SIMD256)
+
+	// avx2 //
+
+	static void CbdV(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Buffer);
+	static void InvNttV(std::array<ushort, MLWE_N> &R);
+	static void NttV(std::array<ushort, MLWE_N> &R);
+	static void PolyBaseMulV(std::array<ushort, MLWE_N> &R, const std::array<ushort, MLWE_N> &A, const std::array<ushort, MLWE_N> &B);
+	static void PolyCSubQV(std::array<ushort, MLWE_N> &R);
+	static void PolyReduceV(std::array<ushort, MLWE_N> &R);
+	static void PolyVecPointwiseAccV(std::array<ushort, MLWE_N> &R, const std::vector<std::array<ushort, MLWE_N>> &A, const std::vector<std::array<ushort, MLWE_N>> &B);
+	static void RejUniformV(std::array<ushort, MLWE_N> &R, uint &Counter, uint RLength, const std::vector<byte> &Buffer, size_t BufOffset, size_t BufLength, uint &Position);
+#endif
 };
 
 NAMESPACE_MODULELWEEND
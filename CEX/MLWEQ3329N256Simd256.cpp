@@ -0,0 +1,390 @@
+#include "MLWEQ3329N256.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "MLWEQ3329N256Simd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "UShort256.h"
+#endif
+
+NAMESPACE_MODULELWE
+
+#if defined(CEX_KERNEL_SIMD256)
+
+using Numeric::UShort256;
+
+namespace
+{
+	// signed Barrett reduction of 16 coefficients
+	UShort256 BarrettReduceV(const UShort256 &A)
+	{
+		const UShort256 Q(static_cast<ushort>(MLWEQ3329N256::MLWE_Q));
+		const UShort256 V(static_cast<ushort>(((1U << 26) / MLWEQ3329N256::MLWE_Q) + 1));
+		UShort256 t;
+
+		t = UShort256::ShiftRA(UShort256::MulHi(A, V), 10);
+		t *= Q;
+
+		return A - t;
+	}
+
+	// montgomery multiplication of 16 coefficient pairs, QInv holds q^(-1) mod 2^16
+	UShort256 FqMulV(const UShort256 &A, const UShort256 &B, const UShort256 &QInv)
+	{
+		const UShort256 Q(static_cast<ushort>(MLWEQ3329N256::MLWE_Q));
+		UShort256 hi;
+		UShort256 lo;
+
+		// montgomery reduction of the 32bit products
+		hi = UShort256::MulHi(A, B);
+		lo = (A * B) * QInv;
+		lo = UShort256::MulHi(lo, Q);
+
+		return hi - lo;
+	}
+
+	// the products of 4 degree one polynomial pairs, Zetas is the zeta table of the base multiplication layer
+	UShort256 BaseMulV(const ushort* A, const ushort* B, const int16_t* Zetas, const UShort256 &QInv)
+	{
+		const __m256i ZMASK4 = _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 4, 5, 4, 5, 4, 5, 4, 5, 6, 7, 6, 7, 6, 7, 6, 7);
+		// the second pair in each group of four is multiplied by -zeta
+		const __m256i ZSIGN = _mm256_set1_epi64x(static_cast<int64_t>(0xFFFF000100010001ULL));
+		UShort256 a;
+		UShort256 b;
+		UShort256 p;
+		UShort256 q;
+		UShort256 zeta;
+
+		a.ymm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A));
+		b.ymm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(B));
+		zeta.ymm = _mm256_sign_epi16(_mm256_shuffle_epi8(_mm256_broadcastq_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Zetas))), ZMASK4), ZSIGN);
+
+		// a0b0, a1b1 and a0b1, a1b0
+		p = FqMulV(a, b, QInv);
+		b.ymm = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(b.ymm, 0xB1), 0xB1);
+		q = FqMulV(a, b, QInv);
+
+		// r0 = a1b1 * zeta + a0b0, r1 = a0b1 + a1b0
+		zeta = FqMulV(p, zeta, QInv);
+		zeta.ymm = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(zeta.ymm, 0xB1), 0xB1);
+		p += zeta;
+		b.ymm = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(q.ymm, 0xB1), 0xB1);
+		q += b;
+
+		return UShort256(_mm256_blend_epi16(p.ymm, q.ymm, 0xAA));
+	}
+}
+
+void MLWEQ3329N256::CbdV(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Buffer)
+{
+	const __m256i M03 = _mm256_set1_epi8(0x03);
+	const __m256i M0F = _mm256_set1_epi8(0x0F);
+	const __m256i M33 = _mm256_set1_epi8(0x33);
+	const __m256i M55 = _mm256_set1_epi8(0x55);
+	__m256i f0;
+	__m256i f1;
+	__m256i f2;
+	__m256i f3;
+	size_t i;
+
+	for (i = 0; i < MLWE_N / 64; ++i)
+	{
+		f0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&Buffer[32 * i]));
+
+		// sum the bit pairs, then a - b + 3 in each nibble
+		f1 = _mm256_and_si256(_mm256_srli_epi16(f0, 1), M55);
+		f0 = _mm256_add_epi8(_mm256_and_si256(f0, M55), f1);
+		f1 = _mm256_and_si256(_mm256_srli_epi16(f0, 2), M33);
+		f0 = _mm256_sub_epi8(_mm256_add_epi8(_mm256_and_si256(f0, M33), M33), f1);
+
+		// the low and high nibbles are the even and odd coefficients
+		f1 = _mm256_sub_epi8(_mm256_and_si256(_mm256_srli_epi16(f0, 4), M0F), M03);
+		f0 = _mm256_sub_epi8(_mm256_and_si256(f0, M0F), M03);
+		f2 = _mm256_unpacklo_epi8(f0, f1);
+		f3 = _mm256_unpackhi_epi8(f0, f1);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&R[64 * i]), _mm256_cvtepi8_epi16(_mm256_castsi256_si128(f2)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&R[(64 * i) + 16]), _mm256_cvtepi8_epi16(_mm256_castsi256_si128(f3)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&R[(64 * i) + 32]), _mm256_cvtepi8_epi16(_mm256_extracti128_si256(f2, 1)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&R[(64 * i) + 48]), _mm256_cvtepi8_epi16(_mm256_extracti128_si256(f3, 1)));
+	}
+}
+
+void MLWEQ3329N256::InvNttV(std::array<ushort, MLWE_N> &R)
+{
+	// word replication masks for the len 4 and len 2 layer zetas
+	const __m256i ZMASK4 = _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 4, 5, 4, 5, 4, 5, 4, 5, 6, 7, 6, 7, 6, 7, 6, 7);
+	const __m256i ZMASK2 = _mm256_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 2, 3, 2, 3, 6, 7, 6, 7, 8, 9, 8, 9, 12, 13, 12, 13, 10, 11, 10, 11, 14, 15, 14, 15);
+	const UShort256 QINV(static_cast<ushort>(MLWE_QINV));
+	UShort256 a;
+	UShort256 b;
+	UShort256 t;
+	UShort256 x;
+	UShort256 y;
+	UShort256 zeta;
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t len;
+	size_t start;
+
+	// the first three layers are computed on shuffled 32 coefficient blocks
+	for (i = 0; i < MLWE_N / 32; ++i)
+	{
+		a.Load(R, 32 * i);
+		b.Load(R, (32 * i) + 16);
+		x.ymm = _mm256_permute2x128_si256(a.ymm, b.ymm, 0x20);
+		y.ymm = _mm256_permute2x128_si256(a.ymm, b.ymm, 0x31);
+		a.ymm = _mm256_unpacklo_epi64(x.ymm, y.ymm);
+		b.ymm = _mm256_unpackhi_epi64(x.ymm, y.ymm);
+		x.ymm = _mm256_shuffle_epi32(a.ymm, 0xD8);
+		y.ymm = _mm256_shuffle_epi32(b.ymm, 0xD8);
+		a.ymm = _mm256_unpacklo_epi64(x.ymm, y.ymm);
+		b.ymm = _mm256_unpackhi_epi64(x.ymm, y.ymm);
+
+		// len 2
+		zeta.ymm = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&ZetasInv[8 * i]))), ZMASK2);
+		t = a;
+		a = BarrettReduceV(t + b);
+		b = FqMulV(zeta, t - b, QINV);
+
+		x.ymm = _mm256_unpacklo_epi64(a.ymm, b.ymm);
+		y.ymm = _mm256_unpackhi_epi64(a.ymm, b.ymm);
+		a.ymm = _mm256_shuffle_epi32(x.ymm, 0xD8);
+		b.ymm = _mm256_shuffle_epi32(y.ymm, 0xD8);
+
+		// len 4
+		zeta.ymm = _mm256_shuffle_epi8(_mm256_broadcastq_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&ZetasInv[64 + (4 * i)]))), ZMASK4);
+		t = a;
+		a = BarrettReduceV(t + b);
+		b = FqMulV(zeta, t - b, QINV);
+
+		x.ymm = _mm256_unpacklo_epi64(a.ymm, b.ymm);
+		y.ymm = _mm256_unpackhi_epi64(a.ymm, b.ymm);
+
+		// len 8
+		zeta.ymm = _mm256_set_m128i(_mm_set1_epi16(ZetasInv[96 + (2 * i) + 1]), _mm_set1_epi16(ZetasInv[96 + (2 * i)]));
+		t = x;
+		x = BarrettReduceV(t + y);
+		y = FqMulV(zeta, t - y, QINV);
+
+		a.ymm = _mm256_permute2x128_si256(x.ymm, y.ymm, 0x20);
+		b.ymm = _mm256_permute2x128_si256(x.ymm, y.ymm, 0x31);
+		a.Store(R, 32 * i);
+		b.Store(R, (32 * i) + 16);
+	}
+
+	k = 112;
+
+	for (len = 16; len <= 128; len <<= 1)
+	{
+		for (start = 0; start < MLWE_N; start += 2 * len)
+		{
+			zeta.Load(static_cast<ushort>(ZetasInv[k]));
+			++k;
+
+			for (j = start; j < start + len; j += 16)
+			{
+				t.Load(R, j);
+				b.Load(R, j + len);
+				BarrettReduceV(t + b).Store(R, j);
+				FqMulV(zeta, t - b, QINV).Store(R, j + len);
+			}
+		}
+	}
+
+	zeta.Load(static_cast<ushort>(ZetasInv[127]));
+
+	for (j = 0; j < MLWE_N; j += 16)
+	{
+		a.Load(R, j);
+		FqMulV(a, zeta, QINV).Store(R, j);
+	}
+}
+
+void MLWEQ3329N256::NttV(std::array<ushort, MLWE_N> &R)
+{
+	// word replication masks for the len 4 and len 2 layer zetas
+	const __m256i ZMASK4 = _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 4, 5, 4, 5, 4, 5, 4, 5, 6, 7, 6, 7, 6, 7, 6, 7);
+	const __m256i ZMASK2 = _mm256_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 2, 3, 2, 3, 6, 7, 6, 7, 8, 9, 8, 9, 12, 13, 12, 13, 10, 11, 10, 11, 14, 15, 14, 15);
+	const UShort256 QINV(static_cast<ushort>(MLWE_QINV));
+	UShort256 a;
+	UShort256 b;
+	UShort256 t;
+	UShort256 x;
+	UShort256 y;
+	UShort256 zeta;
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t len;
+	size_t start;
+
+	k = 1;
+
+	// the butterflies span whole registers down to len 16
+	for (len = 128; len >= 16; len >>= 1)
+	{
+		for (start = 0; start < MLWE_N; start += 2 * len)
+		{
+			zeta.Load(static_cast<ushort>(Zetas[k]));
+			++k;
+
+			for (j = start; j < start + len; j += 16)
+			{
+				a.Load(R, j);
+				b.Load(R, j + len);
+				t = FqMulV(zeta, b, QINV);
+				(a - t).Store(R, j + len);
+				(a + t).Store(R, j);
+			}
+		}
+	}
+
+	// the last three layers are computed on shuffled 32 coefficient blocks
+	for (i = 0; i < MLWE_N / 32; ++i)
+	{
+		a.Load(R, 32 * i);
+		b.Load(R, (32 * i) + 16);
+
+		// len 8
+		x.ymm = _mm256_permute2x128_si256(a.ymm, b.ymm, 0x20);
+		y.ymm = _mm256_permute2x128_si256(a.ymm, b.ymm, 0x31);
+		zeta.ymm = _mm256_set_m128i(_mm_set1_epi16(Zetas[16 + (2 * i) + 1]), _mm_set1_epi16(Zetas[16 + (2 * i)]));
+		t = FqMulV(zeta, y, QINV);
+		y = x - t;
+		x = x + t;
+
+		// len 4
+		a.ymm = _mm256_unpacklo_epi64(x.ymm, y.ymm);
+		b.ymm = _mm256_unpackhi_epi64(x.ymm, y.ymm);
+		zeta.ymm = _mm256_shuffle_epi8(_mm256_broadcastq_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&Zetas[32 + (4 * i)]))), ZMASK4);
+		t = FqMulV(zeta, b, QINV);
+		b = a - t;
+		a = a + t;
+
+		// len 2
+		x.ymm = _mm256_shuffle_epi32(a.ymm, 0xD8);
+		y.ymm = _mm256_shuffle_epi32(b.ymm, 0xD8);
+		a.ymm = _mm256_unpacklo_epi64(x.ymm, y.ymm);
+		b.ymm = _mm256_unpackhi_epi64(x.ymm, y.ymm);
+		zeta.ymm = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Zetas[64 + (8 * i)]))), ZMASK2);
+		t = FqMulV(zeta, b, QINV);
+		b = a - t;
+		a = a + t;
+
+		// restore the coefficient order
+		x.ymm = _mm256_unpacklo_epi64(a.ymm, b.ymm);
+		y.ymm = _mm256_unpackhi_epi64(a.ymm, b.ymm);
+		a.ymm = _mm256_shuffle_epi32(x.ymm, 0xD8);
+		b.ymm = _mm256_shuffle_epi32(y.ymm, 0xD8);
+		x.ymm = _mm256_unpacklo_epi64(a.ymm, b.ymm);
+		y.ymm = _mm256_unpackhi_epi64(a.ymm, b.ymm);
+		a.ymm = _mm256_permute2x128_si256(x.ymm, y.ymm, 0x20);
+		b.ymm = _mm256_permute2x128_si256(x.ymm, y.ymm, 0x31);
+		a.Store(R, 32 * i);
+		b.Store(R, (32 * i) + 16);
+	}
+}
+
+void MLWEQ3329N256::PolyBaseMulV(std::array<ushort, MLWE_N> &R, const std::array<ushort, MLWE_N> &A, const std::array<ushort, MLWE_N> &B)
+{
+	const UShort256 QINV(static_cast<ushort>(MLWE_QINV));
+	size_t i;
+
+	for (i = 0; i < MLWE_N; i += 16)
+	{
+		BaseMulV(&A[i], &B[i], &Zetas[64 + (i / 4)], QINV).Store(R, i);
+	}
+}
+
+void MLWEQ3329N256::PolyCSubQV(std::array<ushort, MLWE_N> &R)
+{
+	const UShort256 Q(static_cast<ushort>(MLWE_Q));
+	UShort256 a;
+	size_t i;
+
+	for (i = 0; i < MLWE_N; i += 16)
+	{
+		a.Load(R, i);
+		a -= Q;
+		a += (UShort256::ShiftRA(a, 15) & Q);
+		a.Store(R, i);
+	}
+}
+
+void MLWEQ3329N256::PolyReduceV(std::array<ushort, MLWE_N> &R)
+{
+	UShort256 a;
+	size_t i;
+
+	for (i = 0; i < MLWE_N; i += 16)
+	{
+		a.Load(R, i);
+		BarrettReduceV(a).Store(R, i);
+	}
+}
+
+void MLWEQ3329N256::PolyVecPointwiseAccV(std::array<ushort, MLWE_N> &R, const std::vector<std::array<ushort, MLWE_N>> &A, const std::vector<std::array<ushort, MLWE_N>> &B)
+{
+	const UShort256 QINV(static_cast<ushort>(MLWE_QINV));
+	UShort256 acc;
+	size_t i;
+	size_t j;
+
+	// the products are accumulated and reduced in-register
+	for (i = 0; i < MLWE_N; i += 16)
+	{
+		acc = BaseMulV(&A[0][i], &B[0][i], &Zetas[64 + (i / 4)], QINV);
+
+		for (j = 1; j < A.size(); ++j)
+		{
+			acc += BaseMulV(&A[j][i], &B[j][i], &Zetas[64 + (i / 4)], QINV);
+		}
+
+		BarrettReduceV(acc).Store(R, i);
+	}
+}
+
+void MLWEQ3329N256::RejUniformV(std::array<ushort, MLWE_N> &R, uint &Counter, uint RLength, const std::vector<byte> &Buffer, size_t BufOffset, size_t BufLength, uint &Position)
+{
+	const __m256i BND = _mm256_set1_epi16(static_cast<short>((19 * MLWE_Q) - 1));
+	const __m256i Q = _mm256_set1_epi16(static_cast<short>(MLWE_Q));
+	std::array<ushort, 16> tmp;
+	__m256i v;
+	uint msk;
+	size_t i;
+
+	while (Counter + 16 <= RLength && Position + 32 <= BufLength)
+	{
+		v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&Buffer[BufOffset + Position]));
+		msk = static_cast<uint>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_min_epu16(v, BND), v)));
+		// Barrett reduction
+		v = _mm256_sub_epi16(v, _mm256_mullo_epi16(_mm256_srli_epi16(v, 12), Q));
+		Position += 32;
+
+		if (msk == 0xFFFFFFFFUL)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&R[Counter]), v);
+			Counter += 16;
+		}
+		else
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp.data()), v);
+
+			for (i = 0; i < tmp.size(); ++i)
+			{
+				if (((msk >> (2 * i)) & 1) != 0)
+				{
+					R[Counter] = tmp[i];
+					++Counter;
+				}
+			}
+		}
+	}
+}
+
+#endif
+
+NAMESPACE_MODULELWEEND
@@ -1,4 +1,5 @@
 #include "MLWEQ7681N256.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "Keccak.h"
@@ -224,56 +225,85 @@ void MLWEQ7681N256::Generate(std::vector<byte> &PublicKey, std::vector<byte> &Pr
 
 void MLWEQ7681N256::GenerateMatrix(std::vector<std::vector<std::array<ushort, MLWE_N>>> &A, const std::vector<byte> &Seed, bool Transposed)
 {
-	std::vector<byte> buf(Keccak::KECCAK128_RATE_SIZE * 4);
-	std::vector<byte> tmpk(Seed.size() + 2);
-	byte i;
-	byte j;
-	ushort val;
-	size_t ctr;
-	size_t pos;
-
-	Utility::MemoryTools::Copy(Seed, 0, tmpk, 0, Seed.size());
+	const size_t BUFLEN = Keccak::KECCAK128_RATE_SIZE * 4;
+	const size_t KLEN = A.size();
+	const size_t SEEDLEN = Seed.size() + 2;
+	std::vector<byte> seeds(KLEN * KLEN * SEEDLEN);
+	size_t i;
+	size_t j;
+	size_t k;
 
-	for (i = 0; i < A.size(); ++i)
+	// the extended seeds of every matrix entry, in row order
+	for (i = 0; i < KLEN; ++i)
 	{
-		for (j = 0; j < A.size(); ++j)
+		for (j = 0; j < KLEN; ++j)
 		{
-			ctr = 0;
-			pos = 0;
+			k = ((i * KLEN) + j) * SEEDLEN;
+			Utility::MemoryTools::Copy(Seed, 0, seeds, k, Seed.size());
 
 			if (Transposed)
 			{
-				tmpk[Seed.size()] = i;
-				tmpk[Seed.size() + 1] = j;
+				seeds[k + Seed.size()] = static_cast<byte>(i);
+				seeds[k + Seed.size() + 1] = static_cast<byte>(j);
 			}
 			else
 			{
-				tmpk[Seed.size() + 1] = i;
-				tmpk[Seed.size()] = j;
+				seeds[k + Seed.size() + 1] = static_cast<byte>(i);
+				seeds[k + Seed.size()] = static_cast<byte>(j);
 			}
+		}
+	}
+
+	k = 0;
 
-			XOF(tmpk, 0, tmpk.size(), buf, 0, buf.size(), Keccak::KECCAK128_RATE_SIZE);
+#if defined(CEX_KERNEL_SIMD256) && !defined(CEX_SHAKE_STRONG)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+	std::vector<byte> buf(8 * BUFLEN);
+	size_t lane;
 
-			while (ctr < MLWE_N)
+#	if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		// generate 8 entries in parallel
+		while (k + 8 <= KLEN * KLEN)
+		{
+			Keccak::XOFR24P8x1600(seeds, k * SEEDLEN, SEEDLEN, buf, 0, BUFLEN, Keccak::KECCAK128_RATE_SIZE);
+
+			for (lane = 0; lane < 8; ++lane)
 			{
-				val = (buf[pos] | ((static_cast<ushort>(buf[pos + 1]) << 8) & 0x1FFF));
+				RejUniform(A[(k + lane) / KLEN][(k + lane) % KLEN], buf, lane * BUFLEN, BUFLEN);
+			}
 
-				if (val < MLWE_Q)
-				{
-					A[i][j][ctr] = val;
-					++ctr;
-				}
+			k += 8;
+		}
+	}
+#	endif
 
-				pos += 2;
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		// generate 4 entries in parallel
+		while (k + 4 <= KLEN * KLEN)
+		{
+			Keccak::XOFR24P4x1600(seeds, k * SEEDLEN, SEEDLEN, buf, 0, BUFLEN, Keccak::KECCAK128_RATE_SIZE);
 
-				if (pos > buf.size() - 2)
-				{
-					XOF(tmpk, 0, tmpk.size(), buf, 0, buf.size(), Keccak::KECCAK128_RATE_SIZE);
-					pos = 0;
-				}
+			for (lane = 0; lane < 4; ++lane)
+			{
+				RejUniform(A[(k + lane) / KLEN][(k + lane) % KLEN], buf, lane * BUFLEN, BUFLEN);
 			}
+
+			k += 4;
 		}
 	}
+#else
+	std::vector<byte> buf(BUFLEN);
+#endif
+
+	while (k < KLEN * KLEN)
+	{
+		XOF(seeds, k * SEEDLEN, SEEDLEN, buf, 0, BUFLEN, Keccak::KECCAK128_RATE_SIZE);
+		RejUniform(A[k / KLEN][k % KLEN], buf, 0, BUFLEN);
+		++k;
+	}
 }
 
 void MLWEQ7681N256::GetNoise(std::array<ushort, MLWE_N> &R, size_t Eta, std::unique_ptr<Prng::IPrng> &Rng)
@@ -868,6 +898,35 @@ void MLWEQ7681N256::PolyVecToBytes(std::vector<byte> &R, const std::vector<std::
 	}
 }
 
+void MLWEQ7681N256::RejUniform(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Buffer, size_t BufOffset, size_t BufLength)
+{
+	size_t ctr;
+	size_t pos;
+	ushort val;
+
+	ctr = 0;
+	pos = 0;
+
+	while (ctr < MLWE_N)
+	{
+		val = (Buffer[BufOffset + pos] | ((static_cast<ushort>(Buffer[BufOffset + pos + 1]) << 8) & 0x1FFF));
+
+		if (val < MLWE_Q)
+		{
+			R[ctr] = val;
+			++ctr;
+		}
+
+		pos += 2;
+
+		// the xof is re-seeded with the same key, so an exhausted buffer repeats from the start
+		if (pos > BufLength - 2)
+		{
+			pos = 0;
+		}
+	}
+}
+
 void MLWEQ7681N256::UnpackCiphertext(std::vector<std::array<ushort, MLWE_N>> &B, std::array<ushort, MLWE_N> &V, const std::vector<byte> &C)
 {
 	PolyVecDecompress(B, C);
@@ -189,6 +189,8 @@ private:
 
 	static void PolyVecToBytes(std::vector<byte> &R, const std::vector<std::array<ushort, MLWE_N>> &A);
 
+	static void RejUniform(std::array<ushort, MLWE_N> &R, const std::vector<byte> &Buffer, size_t BufOffset, size_t BufLength);
+
 	static void UnpackCiphertext(std::vector<std::array<ushort, MLWE_N>> &B, std::array<ushort, MLWE_N> &V, const std::vector<byte> &C);
 
 	static void UnpackPublicKey(std::vector<std::array<ushort, MLWE_N>> &Pk, std::vector<byte> &Seed, const std::vector<byte> &PackedPk);
@@ -766,7 +766,7 @@ bool MPKCN4096T62::Decapsulate(const std::vector<byte> &PrivateKey, const std::v
 	return (ret == 0);
 }
 
-void MPKCN4096T62::Encapsulate(const std::vector<byte> &PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
+void MPKCN4096T62::Encapsulate(const byte* PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
 {
 	std::vector<byte> tmpk(32);
 	std::vector<byte> tmpn(8);
@@ -1135,7 +1135,7 @@ void MPKCN4096T62::SyndromeAdjust(std::array<std::array<ulong, MPKC_M>, 2> &Outp
 
 //~~~Encrypt~~~//
 
-void MPKCN4096T62::EncryptE(std::vector<byte> &S, std::vector<byte> &E, const std::vector<byte> &PublicKey, std::unique_ptr<IPrng> &Rng)
+void MPKCN4096T62::EncryptE(std::vector<byte> &S, std::vector<byte> &E, const byte* PublicKey, std::unique_ptr<IPrng> &Rng)
 {
 	GenE(E, Rng);
 	Syndrome(S, PublicKey, E);
@@ -1203,7 +1203,7 @@ void MPKCN4096T62::GenE(std::vector<byte> &E, std::unique_ptr<IPrng> &Rng)
 	IntegerTools::LeToBlock(eint, 0, E, 0, eint.size() * sizeof(ulong));
 }
 
-void MPKCN4096T62::Syndrome(std::vector<byte> &S, const std::vector<byte> &PublicKey, const std::vector<byte> &E)
+void MPKCN4096T62::Syndrome(std::vector<byte> &S, const byte* PublicKey, const std::vector<byte> &E)
 {
 	const size_t ARRLEN = ((MPKC_PKN_COLS + 63) / MPKC_COLUMN_SIZE);
 	const size_t COLLEN = MPKC_PKN_COLS / sizeof(ulong);
@@ -1223,7 +1223,7 @@ void MPKCN4096T62::Syndrome(std::vector<byte> &S, const std::vector<byte> &Publi
 		for (ctr = 0; ctr < 8; ++ctr)
 		{
 			rowint[ARRLEN - 1] = 0;
-			MemoryTools::Copy(PublicKey, ((i + ctr) * COLLEN), rowint, 0, COLLEN);
+			std::memcpy(rowint.data(), PublicKey + ((i + ctr) * COLLEN), COLLEN);
 			tmp[ctr] = 0;
 
 			for (j = 0; j < ARRLEN; ++j)
@@ -116,11 +116,11 @@ public:
 	/// Encrypt a message and return the shared secret and cipher-text
 	/// </summary>
 	/// 
-	/// <param name="PublicKey">The public key array</param>
+	/// <param name="PublicKey">A pointer to the public key, read in place (PUBLICKEY_SIZE bytes)</param>
 	/// <param name="CipherText">The ciphertext input vector</param>
 	/// <param name="SharedSecret">The shared secret output</param>
 	/// <param name="Rng">The random generator instance</param>
-	static void Encapsulate(const std::vector<byte> &PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng);
+	static void Encapsulate(const byte* PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng);
 
 	/// <summary>
 	/// Generate a public/private key pair
@@ -153,11 +153,11 @@ private:
 
 	//~~~Encrypt~~~//
 
-	static void EncryptE(std::vector<byte> &S, std::vector<byte> &E, const std::vector<byte> &PublicKey, std::unique_ptr<IPrng> &Rng);
+	static void EncryptE(std::vector<byte> &S, std::vector<byte> &E, const byte* PublicKey, std::unique_ptr<IPrng> &Rng);
 
 	static void GenE(std::vector<byte> &E, std::unique_ptr<IPrng> &Rng);
 
-	static void Syndrome(std::vector<byte> &S, const std::vector<byte> &PublicKey, const std::vector<byte> &E);
+	static void Syndrome(std::vector<byte> &S, const byte* PublicKey, const std::vector<byte> &E);
 
 	//~~~KeyGen~~~//
 
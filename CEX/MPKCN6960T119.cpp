@@ -56,16 +56,16 @@ bool MPKCN6960T119::Decapsulate(const std::vector<byte> &PrivateKey, const std::
 /// Generates the cipher-text and shared-secret for a given public key
 /// </summary>
 /// 
-/// <param name="PublicKey">The public-key vector</param>
+/// <param name="PublicKey">A pointer to the public-key, read in place (PUBLICKEY_SIZE bytes)</param>
 /// <param name="CipherText">The output cipher-text vector</param>
 /// <param name="SharedSecret">The output shared-secret (an array of MCELIECE_SECRET_SIZE bytes)</param>
 /// <param name="Rng">The random generator instance</param>
-void MPKCN6960T119::Encapsulate(const std::vector<byte> &PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
+void MPKCN6960T119::Encapsulate(const byte* PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
 {
 	std::vector<byte> e2(1 + (MPKC_N / 8), 0x02);
 	std::vector<byte> ec1(1 + (MPKC_N / 8) + (SYND_BYTES + MAC_SIZE), 0x01);
 
-	EncryptE(CipherText.data(), PublicKey.data(), e2.data() + 1, Rng);
+	EncryptE(CipherText.data(), PublicKey, e2.data() + 1, Rng);
 	XOF(e2, 0, e2.size(), CipherText, SYND_BYTES, MAC_SIZE, Keccak::KECCAK256_RATE_SIZE);
 
 	std::memcpy(ec1.data() + 1, e2.data() + 1, MPKC_N / 8);
@@ -268,11 +268,9 @@ void MPKCN6960T119::ControlBits(byte* Output, const uint* Pi)
 byte MPKCN6960T119::DecryptE(byte* E, const byte* Sk, const byte* C)
 {
 	ushort g[MPKC_T + 1];
-	ushort L[MPKC_N];
 	ushort s[MPKC_T * 2];
 	ushort scmp[MPKC_T * 2];
 	ushort locator[MPKC_T + 1];
-	ushort images[MPKC_N];
 	byte r[MPKC_N / 8];
 	size_t i;
 	int32_t w;
@@ -299,26 +297,18 @@ byte MPKCN6960T119::DecryptE(byte* E, const byte* Sk, const byte* C)
 	}
 
 	g[MPKC_T] = 1U;
-	SupportGen(L, Sk);
-	Syndrome(s, g, L, r);
+	Syndrome(s, g, Sk, r);
 	BerlekampMassey(locator, s);
-	Root(images, locator, L);
+	Root(E, locator, Sk);
 	w = 0;
 
-	for (i = 0; i < MPKC_N / 8; ++i)
-	{
-		E[i] = 0x00;
-	}
-
 	for (i = 0; i < MPKC_N; ++i)
 	{
-		t = GF::IsZero(images[i]) & 1U;
-		E[i / 8] |= static_cast<byte>(t << (i % 8));
+		t = (E[i / 8] >> (i % 8)) & 1U;
 		w += t;
-
 	}
 
-	Syndrome(scmp, g, L, E);
+	Syndrome(scmp, g, Sk, E);
 	check = static_cast<ushort>(w);
 	check ^= MPKC_T;
 
@@ -455,52 +445,34 @@ void MPKCN6960T119::Syndrome(byte* S, const byte* Pk, const byte* E)
 	// input: public key pk, error vector e
 	// output: Syndrome s
 
-	const byte* pkptr = Pk;
-	byte row[MPKC_N / 8];
+	// the key rows hold columns PK_NROWS to MPKC_N - 1; shift e once to the row alignment
+	// so that each row is read in place from the public key
+	const size_t EOFT = PK_NROWS / 8;
+	const uint TAIL = PK_NROWS % 8;
+	byte es[PK_ROW_BYTES];
 	size_t i;
-	size_t j;
-	uint tail;
 	byte b;
 
+	for (i = 0; i < PK_ROW_BYTES; ++i)
+	{
+		es[i] = E[EOFT + i] >> TAIL;
+
+		if (EOFT + i + 1 < MPKC_N / 8)
+		{
+			es[i] |= static_cast<byte>(E[EOFT + i + 1] << (8 - TAIL));
+		}
+	}
+
 	for (i = 0; i < SYND_BYTES; ++i)
 	{
 		S[i] = 0;
 	}
 
-	tail = PK_NROWS % 8;
-
 	for (i = 0; i < PK_NROWS; ++i)
 	{
-		for (j = 0; j < MPKC_N / 8; ++j)
-		{
-			row[j] = 0;
-		}
-
-		for (j = 0; j < PK_ROW_BYTES; ++j)
-		{
-			row[((MPKC_N / 8) - PK_ROW_BYTES) + j] = pkptr[j];
-		}
-
-		for (j = (MPKC_N / 8) - 1; j >= (MPKC_N / 8) - PK_ROW_BYTES; --j)
-		{
-			row[j] = (row[j] << tail) | (row[j - 1] >> (8UL - tail));
-		}
-
-		row[i / 8] |= 1 << (i % 8);
-		b = 0;
-
-		for (j = 0; j < MPKC_N / 8; ++j)
-		{
-			b ^= row[j] & E[j];
-		}
-
-		b ^= b >> 4;
-		b ^= b >> 2;
-		b ^= b >> 1;
-		b &= 1;
-
+		b = McElieceUtils::RowParity(Pk + (i * PK_ROW_BYTES), es, PK_ROW_BYTES);
+		b ^= (E[i / 8] >> (i % 8)) & 1;
 		S[i / 8] |= (b << (i % 8));
-		pkptr += PK_ROW_BYTES;
 	}
 }
 
@@ -508,173 +480,89 @@ void MPKCN6960T119::Syndrome(byte* S, const byte* Pk, const byte* E)
 
 int32_t MPKCN6960T119::PkGen(byte* Pk, const byte* Sk)
 {
-	byte** mat = new byte*[GFBITS * SYS_T];
+	// input: secret key sk
+	// output: public key pk
+	// return: 0 for success, -1 if the parity-check matrix is not systematic
+
+	std::vector<ulong> mat(PK_NROWS * PK_ROW_WORDS, 0);
 	ushort g[SYS_T + 1];
 	ushort L[SYS_N];
 	ushort inv[SYS_N];
-	size_t c;
+	ulong bits[64];
+	ulong tmp[64];
+	byte row[PK_ROW_WORDS * 8];
 	size_t i;
 	size_t j;
 	size_t k;
-	size_t row;
 	uint tail;
 	int32_t ret;
-	byte b;
-	byte mask;
 
-	ret = (mat == nullptr) ? -1 : 0;
+	g[SYS_T] = 1;
 
-	if (ret == 0)
+	for (i = 0; i < SYS_T; ++i)
 	{
-		g[SYS_T] = 1;
+		g[i] = McElieceUtils::Load16(Sk);
+		g[i] &= GFMASK;
+		Sk += 2;
+	}
 
-		for (i = 0; i < SYS_T; i++)
-		{
-			g[i] = McElieceUtils::Load16(Sk);
-			g[i] &= GFMASK;
-			Sk += 2;
-		}
+	SupportGen(L, Sk);
+	Root(inv, g, L);
 
-		SupportGen(L, Sk);
-		Root(inv, g, L);
+	for (i = 0; i < SYS_N; ++i)
+	{
+		inv[i] = GF::Inverse(inv[i]);
+	}
 
-		for (i = 0; i < SYS_N; i++)
+	// fill the rows in 64-bit words, each word is a transposed group of 64 columns
+	for (i = 0; i < SYS_T; ++i)
+	{
+		for (j = 0; j < SYS_N; j += 64)
 		{
-			inv[i] = GF::Inverse(inv[i]);
-		}
+			for (k = 0; k < 64; ++k)
+			{
+				tmp[k] = (j + k < SYS_N) ? inv[j + k] : 0;
+			}
 
-		for (i = 0; i < GFBITS * SYS_T; ++i)
-		{
-			mat[i] = new byte[SYS_N / 8];
+			McElieceUtils::Transpose64x64(bits, tmp);
 
-			if (mat[i] == nullptr)
+			for (k = 0; k < GFBITS; ++k)
 			{
-				ret = -1;
-				break;
+				mat[(((i * GFBITS) + k) * PK_ROW_WORDS) + (j / 64)] = bits[k];
 			}
-
-			std::memset(mat[i], 0, SYS_N / 8);
 		}
 
-		if (ret == 0)
+		for (j = 0; j < SYS_N; ++j)
 		{
-			for (i = 0; i < SYS_T; i++)
-			{
-				for (j = 0; j < SYS_N; j += 8)
-				{
-					for (k = 0; k < GFBITS; k++)
-					{
-						/* jgu: checked */
-						/*lint -save -e661, -e662 */
-						b = (inv[j + 7] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j + 6] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j + 5] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j + 4] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j + 3] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j + 2] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j + 1] >> k) & 1;
-						b <<= 1;
-						b |= (inv[j] >> k) & 1;
-						/*lint -restore */
-						mat[i * GFBITS + k][j / 8] = b;
-					}
-				}
+			inv[j] = GF::Multiply(inv[j], L[j]);
+		}
+	}
 
-				for (j = 0; j < SYS_N; j++)
-				{
-					inv[j] = GF::Multiply(inv[j], L[j]);
-				}
-			}
+	ret = McElieceUtils::GaussEliminate(mat.data(), PK_NROWS, PK_ROW_WORDS);
 
-			for (i = 0; i < (GFBITS * SYS_T + 7) / 8; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					row = (i * 8) + j;
-
-					if (row >= GFBITS * SYS_T)
-					{
-						break;
-					}
-
-					for (k = row + 1; k < GFBITS * SYS_T; k++)
-					{
-						mask = mat[row][i] ^ mat[k][i];
-						mask >>= j;
-						mask &= 1;
-						mask = ~mask + 1;
-
-						for (c = 0; c < SYS_N / 8; c++)
-						{
-							mat[row][c] ^= mat[k][c] & mask;
-						}
-					}
-
-					// return if not systematic
-					if (((mat[row][i] >> j) & 1) == 0)
-					{
-						ret = -1;
-						break;
-					}
-
-					for (k = 0; k < GFBITS * SYS_T; k++)
-					{
-						if (k != row)
-						{
-							mask = mat[k][i] >> j;
-							mask &= 1;
-							mask = ~mask + 1;
-
-							for (c = 0; c < SYS_N / 8; c++)
-							{
-								mat[k][c] ^= mat[row][c] & mask;
-							}
-						}
-					}
-				}
+	if (ret == 0)
+	{
+		tail = PK_NROWS % 8;
+		k = 0;
 
-				if (ret != 0)
-				{
-					break;
-				}
+		for (i = 0; i < PK_NROWS; ++i)
+		{
+			for (j = 0; j < PK_ROW_WORDS; ++j)
+			{
+				McElieceUtils::Store64(row + (j * 8), mat[(i * PK_ROW_WORDS) + j]);
 			}
 
-			tail = (GFBITS * SYS_T) % 8;
-			k = 0;
-
-			for (i = 0; i < GFBITS * SYS_T; i++)
+			for (j = (PK_NROWS - 1) / 8; j < (SYS_N / 8) - 1; ++j)
 			{
-				for (j = ((GFBITS * SYS_T) - 1) / 8; j < (SYS_N / 8) - 1; j++)
-				{
-					Pk[k] = (mat[i][j] >> tail) | (mat[i][j + 1UL] << (8UL - tail));
-					++k;
-				}
-
-				Pk[k] = (mat[i][j] >> tail);
+				Pk[k] = (row[j] >> tail) | (row[j + 1] << (8UL - tail));
 				++k;
 			}
-		}
 
-		for (i = 0; i < GFBITS * SYS_T; ++i)
-		{
-			if (mat[i] != nullptr)
-			{
-				delete[] mat[i];
-			}
+			Pk[k] = (row[j] >> tail);
+			++k;
 		}
 	}
 
-	if (mat[i] != nullptr)
-	{
-		delete[] mat;
-	}
-
 	return ret;
 }
 
@@ -698,6 +586,32 @@ ushort MPKCN6960T119::Evaluate(const ushort* F, ushort A)
 	return r;
 }
 
+void MPKCN6960T119::Evaluate(ulong Output[][GFBITS], const ushort* F)
+{
+	// input: polynomial f
+	// output: out = [ f(a) for all field elements a ], bitsliced in support base order
+
+	ulong coef[2][GFBITS];
+	size_t b;
+	size_t i;
+
+	for (b = 0; b < GFBITS; ++b)
+	{
+		coef[0][b] = 0;
+		coef[1][b] = 0;
+	}
+
+	for (i = 0; i <= MPKC_T; ++i)
+	{
+		for (b = 0; b < GFBITS; ++b)
+		{
+			coef[i / 64][b] |= static_cast<ulong>((F[i] >> b) & 1) << (i % 64);
+		}
+	}
+
+	McElieceUtils::FftTransform(Output, coef);
+}
+
 void MPKCN6960T119::Root(ushort* Output, const ushort* F, const ushort* L)
 {
 	// input: polynomial f and list of field elements L
@@ -711,6 +625,40 @@ void MPKCN6960T119::Root(ushort* Output, const ushort* F, const ushort* L)
 	}
 }
 
+void MPKCN6960T119::Root(byte* Output, const ushort* F, const byte* C)
+{
+	// input: polynomial f and condition bits c of the support
+	// output: out, bit i is set when f(S[i]) is zero
+
+	ulong eval[FFT_COLUMNS][GFBITS];
+	byte buf[(1 << GFBITS) / 8];
+	size_t b;
+	size_t i;
+	ulong z;
+
+	Evaluate(eval, F);
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
+	{
+		z = eval[i][0];
+
+		for (b = 1; b < GFBITS; ++b)
+		{
+			z |= eval[i][b];
+		}
+
+		McElieceUtils::Store64(buf + (i * 8), ~z);
+	}
+
+	// permute the zero mask from the base order into support order
+	McElieceUtils::ApplyBenes(buf, C, false);
+
+	for (i = 0; i < MPKC_N / 8; ++i)
+	{
+		Output[i] = buf[i];
+	}
+}
+
 // sk_gen.c //
 
 int32_t MPKCN6960T119::IrrGen(ushort* Output, const ushort* F)
@@ -886,32 +834,100 @@ int32_t MPKCN6960T119::SkPartGen(byte* Sk, std::unique_ptr<IPrng> &Rng)
 
 // syndrome.c //
 
-void MPKCN6960T119::Syndrome(ushort* Output, const ushort* F, const ushort* L, const byte* R)
+void MPKCN6960T119::Syndrome(ushort* Output, const ushort* F, const byte* C, const byte* R)
 {
-	// input: Goppa polynomial f, support L, received word r
-	// output: out, the Syndrome of length 2t
-
+	// input: Goppa polynomial f, condition bits c of the support, received word r
+	// output: out, the syndrome of length 2t
+
+	ulong eval[FFT_COLUMNS][GFBITS];
+	ulong prod[FFT_COLUMNS][GFBITS];
+	ulong sum[2][2][GFBITS];
+	ulong inv[GFBITS];
+	ulong tmp[GFBITS];
+	byte buf[(1 << GFBITS) / 8];
+	size_t b;
 	size_t i;
 	size_t j;
-	ushort c;
-	ushort e;
-	ushort einv;
+	ulong rw;
 
-	for (j = 0; j < 2 * MPKC_T; ++j)
+	// eval = f(a)^2 for every field element, then batch inverted
+	Evaluate(eval, F);
+	McElieceUtils::GfSquare(eval[0], eval[0]);
+
+	for (b = 0; b < GFBITS; ++b)
 	{
-		Output[j] = 0;
+		prod[0][b] = eval[0][b];
 	}
 
-	for (i = 0; i < MPKC_N; ++i)
+	for (i = 1; i < FFT_COLUMNS; ++i)
+	{
+		McElieceUtils::GfSquare(eval[i], eval[i]);
+		McElieceUtils::GfMultiply(prod[i], prod[i - 1], eval[i]);
+	}
+
+	McElieceUtils::GfInvert(inv, prod[FFT_COLUMNS - 1]);
+	i = FFT_COLUMNS - 1;
+
+	do
+	{
+		McElieceUtils::GfMultiply(tmp, inv, prod[i - 1]);
+		McElieceUtils::GfMultiply(inv, inv, eval[i]);
+
+		for (b = 0; b < GFBITS; ++b)
+		{
+			eval[i][b] = tmp[b];
+		}
+
+		--i;
+	}
+	while (i != 0);
+
+	for (b = 0; b < GFBITS; ++b)
+	{
+		eval[0][b] = inv[b];
+	}
+
+	// permute the received word from support order into the base order
+	for (i = 0; i < MPKC_N / 8; ++i)
+	{
+		buf[i] = R[i];
+	}
+
+	for (i = MPKC_N / 8; i < (1 << GFBITS) / 8; ++i)
+	{
+		buf[i] = 0;
+	}
+
+	McElieceUtils::ApplyBenes(buf, C, true);
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
 	{
-		c = (R[i / 8] >> (i % 8)) & 1;
-		e = Evaluate(F, L[i]);
-		einv = GF::Inverse(GF::Multiply(e, e));
+		rw = McElieceUtils::Load64(buf + (i * 8));
+
+		for (b = 0; b < GFBITS; ++b)
+		{
+			eval[i][b] &= rw;
+		}
+	}
+
+	// the power sums for exponents 128 and above are taken over r(a) * a^128 / f(a)^2
+	McElieceUtils::FftPowers(prod);
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
+	{
+		McElieceUtils::GfMultiply(prod[i], prod[i], eval[i]);
+	}
+
+	McElieceUtils::FftTransposed(sum[0], eval);
+	McElieceUtils::FftTransposed(sum[1], prod);
+
+	for (j = 0; j < 2 * MPKC_T; ++j)
+	{
+		Output[j] = 0;
 
-		for (j = 0; j < 2 * MPKC_T; ++j)
+		for (b = 0; b < GFBITS; ++b)
 		{
-			Output[j] = GF::Add(Output[j], GF::Multiply(einv, c));
-			einv = GF::Multiply(einv, L[i]);
+			Output[j] |= static_cast<ushort>(((sum[j / 128][(j / 64) % 2][b] >> (j % 64)) & 1) << b);
 		}
 	}
 }
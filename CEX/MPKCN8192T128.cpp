@@ -53,12 +53,12 @@ bool MPKCN8192T128::Decapsulate(const std::vector<byte> &PrivateKey, const std::
 	return static_cast<bool>(confirm == 0 && derr == 0);
 }
 
-void MPKCN8192T128::Encapsulate(const std::vector<byte> &PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
+void MPKCN8192T128::Encapsulate(const byte* PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
 {
 	std::vector<byte> e2(1 + (MPKC_N / 8), 0x02);
 	std::vector<byte> ec1(1 + (MPKC_N / 8) + SYND_BYTES + SECRET_SIZE, 0x01);
 
-	EncryptE(CipherText.data(), PublicKey.data(), e2.data() + 1, Rng);
+	EncryptE(CipherText.data(), PublicKey, e2.data() + 1, Rng);
 	XOF(e2, 0, e2.size(), CipherText, SYND_BYTES, MAC_SIZE, Keccak::KECCAK256_RATE_SIZE);
 
 	std::memcpy(ec1.data() + 1, e2.data() + 1, MPKC_N / 8);
@@ -240,11 +240,9 @@ void MPKCN8192T128::ControlBits(byte* Output, const uint* Pi)
 byte MPKCN8192T128::DecryptE(byte* E, const byte* Sk, const byte* C)
 {
 	ushort g[SYS_T + 1];
-	ushort L[SYS_N];
 	ushort s[SYS_T * 2];
 	ushort s_cmp[SYS_T * 2];
 	ushort locator[SYS_T + 1];
-	ushort images[SYS_N];
 	byte r[SYS_N / 8];
 	size_t i;
 	ushort check;
@@ -269,26 +267,18 @@ byte MPKCN8192T128::DecryptE(byte* E, const byte* Sk, const byte* C)
 	}
 
 	g[SYS_T] = 1;
-	SupportGen(L, Sk);
-	Syndrome(s, g, L, r);
+	Syndrome(s, g, Sk, r);
 	BerlekampMassey(locator, s);
-	Root(images, locator, L);
-
-	for (i = 0; i < SYS_N / 8; ++i)
-	{
-		E[i] = 0;
-	}
-
+	Root(E, locator, Sk);
 	w = 0;
 
 	for (i = 0; i < SYS_N; ++i)
 	{
-		t = GF::IsZero(images[i]) & 1;
-		E[i / 8] |= t << (i % 8);
+		t = (E[i / 8] >> (i % 8)) & 1;
 		w += t;
 	}
 
-	Syndrome(s_cmp, g, L, E);
+	Syndrome(s_cmp, g, Sk, E);
 	check = w;
 	check ^= SYS_T;
 
@@ -374,10 +364,9 @@ void MPKCN8192T128::GenE(byte* E, std::unique_ptr<IPrng> &Rng)
 
 void MPKCN8192T128::Syndrome(byte* S, const byte* Pk, byte* E)
 {
-	byte row[SYS_N / 8];
+	// the key rows hold columns PK_NROWS to SYS_N - 1 and are byte aligned,
+	// each row is read in place from the public key
 	size_t i;
-	size_t j;
-	size_t poft;
 	byte b;
 
 	for (i = 0; i < SYND_BYTES; ++i)
@@ -385,35 +374,11 @@ void MPKCN8192T128::Syndrome(byte* S, const byte* Pk, byte* E)
 		S[i] = 0;
 	}
 
-	poft = 0;
-
 	for (i = 0; i < PK_NROWS; ++i)
 	{
-		for (j = 0; j < SYS_N / 8; ++j)
-		{
-			row[j] = 0;
-		}
-
-		for (j = 0; j < PK_ROW_BYTES; ++j)
-		{
-			row[SYS_N / 8 - PK_ROW_BYTES + j] = Pk[poft + j];
-		}
-
-		row[i / 8] |= 1 << (i % 8);
-		b = 0;
-
-		for (j = 0; j < SYS_N / 8; ++j)
-		{
-			b ^= row[j] & E[j];
-		}
-
-		b ^= b >> 4;
-		b ^= b >> 2;
-		b ^= b >> 1;
-		b &= 1;
+		b = McElieceUtils::RowParity(Pk + (i * PK_ROW_BYTES), E + (PK_NROWS / 8), PK_ROW_BYTES);
+		b ^= (E[i / 8] >> (i % 8)) & 1;
 		S[i / 8] |= (b << (i % 8));
-
-		poft += PK_ROW_BYTES;
 	}
 }
 
@@ -427,145 +392,73 @@ void MPKCN8192T128::EncryptE(byte* S, const byte* Pk, byte* E, std::unique_ptr<I
 
 int32_t MPKCN8192T128::PkGen(byte* Pk, const byte* Sk)
 {
-	byte** mat = new byte*[GFBITS * SYS_T];
+	// input: secret key sk
+	// output: public key pk
+	// return: 0 for success, -1 if the parity-check matrix is not systematic
+
+	std::vector<ulong> mat(PK_NROWS * PK_ROW_WORDS, 0);
 	ushort g[SYS_T + 1];
 	ushort L[SYS_N];
 	ushort inv[SYS_N];
-	int32_t ret;
-	size_t c;
+	ulong bits[64];
+	ulong tmp[64];
 	size_t i;
 	size_t j;
 	size_t k;
-	size_t row;
-	uint8_t b;
-	uint8_t mask;
+	int32_t ret;
 
-	ret = (mat == nullptr) ? -1 : 0;
+	g[SYS_T] = 1;
 
-	if (ret == 0)
+	for (i = 0; i < SYS_T; ++i)
 	{
-		g[SYS_T] = 1;
-
-		for (i = 0; i < SYS_T; i++)
-		{
-			g[i] = McElieceUtils::Load16(Sk);
-			g[i] &= GFMASK;
-			Sk += 2;
-		}
+		g[i] = McElieceUtils::Load16(Sk);
+		g[i] &= GFMASK;
+		Sk += 2;
+	}
 
-		SupportGen(L, Sk);
-		Root(inv, g, L);
+	SupportGen(L, Sk);
+	Root(inv, g, L);
 
-		for (i = 0; i < SYS_N; i++)
-		{
-			inv[i] = GF::Inverse(inv[i]);
-		}
+	for (i = 0; i < SYS_N; ++i)
+	{
+		inv[i] = GF::Inverse(inv[i]);
+	}
 
-		for (i = 0; i < GFBITS * SYS_T; ++i)
+	// fill the rows in 64-bit words, each word is a transposed group of 64 columns
+	for (i = 0; i < SYS_T; ++i)
+	{
+		for (j = 0; j < SYS_N; j += 64)
 		{
-			mat[i] = new byte[SYS_N / 8];
-
-			if (mat[i] == nullptr)
+			for (k = 0; k < 64; ++k)
 			{
-				ret = -1;
-				break;
+				tmp[k] = (j + k < SYS_N) ? inv[j + k] : 0;
 			}
 
-			std::memset(mat[i], 0, SYS_N / 8);
-		}
+			McElieceUtils::Transpose64x64(bits, tmp);
 
-		if (ret == 0)
-		{
-			for (i = 0; i < SYS_T; i++)
+			for (k = 0; k < GFBITS; ++k)
 			{
-				for (j = 0; j < SYS_N; j += 8)
-				{
-					for (k = 0; k < GFBITS; k++)
-					{
-						b = (inv[j + 7] >> k) & 1; b <<= 1;
-						b |= (inv[j + 6] >> k) & 1; b <<= 1;
-						b |= (inv[j + 5] >> k) & 1; b <<= 1;
-						b |= (inv[j + 4] >> k) & 1; b <<= 1;
-						b |= (inv[j + 3] >> k) & 1; b <<= 1;
-						b |= (inv[j + 2] >> k) & 1; b <<= 1;
-						b |= (inv[j + 1] >> k) & 1; b <<= 1;
-						b |= (inv[j + 0] >> k) & 1;
-
-						mat[i * GFBITS + k][j / 8] = b;
-					}
-				}
-
-				for (j = 0; j < SYS_N; j++)
-				{
-					inv[j] = GF::Multiply(inv[j], L[j]);
-				}
+				mat[(((i * GFBITS) + k) * PK_ROW_WORDS) + (j / 64)] = bits[k];
 			}
+		}
 
-			for (i = 0; i < (GFBITS * SYS_T + 7) / 8; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					row = i * 8 + j;
-
-					if (row >= GFBITS * SYS_T)
-					{
-						break;
-					}
-
-					for (k = row + 1; k < GFBITS * SYS_T; k++)
-					{
-						mask = mat[row][i] ^ mat[k][i];
-						mask >>= j;
-						mask &= 1;
-						mask = ~mask + 1;
-
-						for (c = 0; c < SYS_N / 8; c++)
-						{
-							mat[row][c] ^= mat[k][c] & mask;
-						}
-					}
-
-					// return if not systematic
-					if (((mat[row][i] >> j) & 1) == 0)
-					{
-						return -1;
-					}
-
-					for (k = 0; k < GFBITS * SYS_T; k++)
-					{
-						if (k != row)
-						{
-							mask = mat[k][i] >> j;
-							mask &= 1;
-							mask = ~mask + 1;
-
-							for (c = 0; c < SYS_N / 8; c++)
-							{
-								mat[k][c] ^= mat[row][c] & mask;
-							}
-						}
-					}
-				}
-			}
+		for (j = 0; j < SYS_N; ++j)
+		{
+			inv[j] = GF::Multiply(inv[j], L[j]);
+		}
+	}
 
-			for (i = 0; i < PK_NROWS; i++)
-			{
-				std::memcpy(Pk + i * PK_ROW_BYTES, mat[i] + PK_NROWS / 8, PK_ROW_BYTES);
-			}
+	ret = McElieceUtils::GaussEliminate(mat.data(), PK_NROWS, PK_ROW_WORDS);
 
-			for (i = 0; i < GFBITS * SYS_T; ++i)
+	if (ret == 0)
+	{
+		for (i = 0; i < PK_NROWS; ++i)
+		{
+			for (j = PK_NROWS / 64; j < SYS_N / 64; ++j)
 			{
-				if (mat[i] != nullptr)
-				{
-					delete[] mat[i];
-				}
+				McElieceUtils::Store64(Pk + (i * PK_ROW_BYTES) + ((j - (PK_NROWS / 64)) * 8), mat[(i * PK_ROW_WORDS) + j]);
 			}
 		}
-
-		if (mat != nullptr)
-		{
-			delete[] mat;
-		}
 	}
 
 	return ret;
@@ -756,6 +649,53 @@ ushort MPKCN8192T128::Evaluate(const ushort* F, ushort A)
 	return r;
 }
 
+void MPKCN8192T128::Evaluate(ulong Output[][GFBITS], const ushort* F)
+{
+	// input: polynomial f
+	// output: out = [ f(a) for all field elements a ], bitsliced in support base order
+
+	ulong coef[2][GFBITS];
+	ulong pw[FFT_COLUMNS][GFBITS];
+	ulong top[GFBITS];
+	size_t b;
+	size_t i;
+
+	for (b = 0; b < GFBITS; ++b)
+	{
+		coef[0][b] = 0;
+		coef[1][b] = 0;
+	}
+
+	for (i = 0; i < SYS_T; ++i)
+	{
+		for (b = 0; b < GFBITS; ++b)
+		{
+			coef[i / 64][b] |= static_cast<ulong>((F[i] >> b) & 1) << (i % 64);
+		}
+	}
+
+	McElieceUtils::FftTransform(Output, coef);
+
+	// the x^128 term is outside the reach of the transform, add f[128] * a^128
+	McElieceUtils::FftPowers(pw);
+
+	for (b = 0; b < GFBITS; ++b)
+	{
+		top[b] = (F[SYS_T] >> b) & 1;
+		top[b] = ~top[b] + 1;
+	}
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
+	{
+		McElieceUtils::GfMultiply(pw[i], pw[i], top);
+
+		for (b = 0; b < GFBITS; ++b)
+		{
+			Output[i][b] ^= pw[i][b];
+		}
+	}
+}
+
 void MPKCN8192T128::Root(ushort* Output, const ushort* F, const ushort* L)
 {
 	size_t i;
@@ -766,31 +706,136 @@ void MPKCN8192T128::Root(ushort* Output, const ushort* F, const ushort* L)
 	}
 }
 
+void MPKCN8192T128::Root(byte* Output, const ushort* F, const byte* C)
+{
+	// input: polynomial f and condition bits c of the support
+	// output: out, bit i is set when f(S[i]) is zero
+
+	ulong eval[FFT_COLUMNS][GFBITS];
+	byte buf[(1 << GFBITS) / 8];
+	size_t b;
+	size_t i;
+	ulong z;
+
+	Evaluate(eval, F);
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
+	{
+		z = eval[i][0];
+
+		for (b = 1; b < GFBITS; ++b)
+		{
+			z |= eval[i][b];
+		}
+
+		McElieceUtils::Store64(buf + (i * 8), ~z);
+	}
+
+	// permute the zero mask from the base order into support order
+	McElieceUtils::ApplyBenes(buf, C, false);
+
+	for (i = 0; i < SYS_N / 8; ++i)
+	{
+		Output[i] = buf[i];
+	}
+}
+
 // syndrome.c //
 
-void MPKCN8192T128::Syndrome(ushort* Output, const ushort* F, const ushort* L, const byte* R)
+void MPKCN8192T128::Syndrome(ushort* Output, const ushort* F, const byte* C, const byte* R)
 {
+	// input: Goppa polynomial f, condition bits c of the support, received word r
+	// output: out, the syndrome of length 2t
+
+	ulong eval[FFT_COLUMNS][GFBITS];
+	ulong prod[FFT_COLUMNS][GFBITS];
+	ulong sum[2][2][GFBITS];
+	ulong inv[GFBITS];
+	ulong tmp[GFBITS];
+	byte buf[(1 << GFBITS) / 8];
+	size_t b;
 	size_t i;
 	size_t j;
-	ushort c;
-	ushort e;
-	ushort einv;
+	ulong rw;
 
-	for (j = 0; j < 2 * SYS_T; ++j)
+	// eval = f(a)^2 for every field element, then batch inverted
+	Evaluate(eval, F);
+	McElieceUtils::GfSquare(eval[0], eval[0]);
+
+	for (b = 0; b < GFBITS; ++b)
 	{
-		Output[j] = 0;
+		prod[0][b] = eval[0][b];
 	}
 
-	for (i = 0; i < SYS_N; ++i)
+	for (i = 1; i < FFT_COLUMNS; ++i)
+	{
+		McElieceUtils::GfSquare(eval[i], eval[i]);
+		McElieceUtils::GfMultiply(prod[i], prod[i - 1], eval[i]);
+	}
+
+	McElieceUtils::GfInvert(inv, prod[FFT_COLUMNS - 1]);
+	i = FFT_COLUMNS - 1;
+
+	do
+	{
+		McElieceUtils::GfMultiply(tmp, inv, prod[i - 1]);
+		McElieceUtils::GfMultiply(inv, inv, eval[i]);
+
+		for (b = 0; b < GFBITS; ++b)
+		{
+			eval[i][b] = tmp[b];
+		}
+
+		--i;
+	}
+	while (i != 0);
+
+	for (b = 0; b < GFBITS; ++b)
+	{
+		eval[0][b] = inv[b];
+	}
+
+	// permute the received word from support order into the base order
+	for (i = 0; i < SYS_N / 8; ++i)
+	{
+		buf[i] = R[i];
+	}
+
+	for (i = SYS_N / 8; i < (1 << GFBITS) / 8; ++i)
+	{
+		buf[i] = 0;
+	}
+
+	McElieceUtils::ApplyBenes(buf, C, true);
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
 	{
-		c = (R[i / 8] >> (i % 8)) & 1;
-		e = Evaluate(F, L[i]);
-		einv = GF::Inverse(GF::Multiply(e, e));
+		rw = McElieceUtils::Load64(buf + (i * 8));
+
+		for (b = 0; b < GFBITS; ++b)
+		{
+			eval[i][b] &= rw;
+		}
+	}
+
+	// the power sums for exponents 128 and above are taken over r(a) * a^128 / f(a)^2
+	McElieceUtils::FftPowers(prod);
+
+	for (i = 0; i < FFT_COLUMNS; ++i)
+	{
+		McElieceUtils::GfMultiply(prod[i], prod[i], eval[i]);
+	}
+
+	McElieceUtils::FftTransposed(sum[0], eval);
+	McElieceUtils::FftTransposed(sum[1], prod);
+
+	for (j = 0; j < 2 * SYS_T; ++j)
+	{
+		Output[j] = 0;
 
-		for (j = 0; j < 2 * SYS_T; ++j)
+		for (b = 0; b < GFBITS; ++b)
 		{
-			Output[j] = GF::Add(Output[j], GF::Multiply(einv, c));
-			einv = GF::Multiply(einv, L[i]);
+			Output[j] |= static_cast<ushort>(((sum[j / 128][(j / 64) % 2][b] >> (j % 64)) & 1) << b);
 		}
 	}
 }
@@ -45,9 +45,11 @@ private:
 	static const uint PK_NROWS = (SYS_T * GFBITS);
 	static const uint PK_NCOLS = (SYS_N - PK_NROWS);
 	static const uint PK_ROW_BYTES = ((PK_NCOLS + 7) / 8);
+	static const uint PK_ROW_WORDS = (((SYS_N + 511) / 512) * 8);
 	static const uint SK_BYTES = (SYS_N / 8 + IRR_BYTES + COND_BYTES);
 	static const uint SYND_BYTES = ((PK_NROWS + 7) / 8);
 	static const uint GFMASK = ((1 << GFBITS) - 1);
+	static const uint FFT_COLUMNS = ((1UL << GFBITS) / 64);
 	static const uint KEYGEN_RETRIES = 100;
 	static const ushort GF_MUL_FACTOR1 = 7682;
 	static const ushort GF_MUL_FACTOR2 = 2159;
@@ -114,11 +116,11 @@ public:
 	/// Generates the cipher-text and shared-secret for a given public key
 	/// </summary>
 	/// 
-	/// <param name="PublicKey">The public-key vector</param>
+	/// <param name="PublicKey">A pointer to the public-key, read in place (PUBLICKEY_SIZE bytes)</param>
 	/// <param name="CipherText">The output cipher-text vector</param>
 	/// <param name="SharedSecret">The output shared-secret (an array of SECRET_SIZE bytes)</param>
 	/// <param name="Rng">The random generator instance</param>
-	static void Encapsulate(const std::vector<byte> &PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng);
+	static void Encapsulate(const byte* PublicKey, std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng);
 
 	/// <summary>
 	/// Generate a public/private key-pair
@@ -175,11 +177,15 @@ private:
 
 	static ushort Evaluate(const ushort* F, ushort A);
 
+	static void Evaluate(ulong Output[][GFBITS], const ushort* F);
+
 	static void Root(ushort* Output, const ushort* F, const ushort* L);
 
+	static void Root(byte* Output, const ushort* F, const byte* C);
+
 	// syndrome.c //
 
-	static void Syndrome(ushort* Output, const ushort* F, const ushort* L, const byte* R);
+	static void Syndrome(ushort* Output, const ushort* F, const byte* C, const byte* R);
 
 	// gf.c //
 
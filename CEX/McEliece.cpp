@@ -5,6 +5,7 @@
 #include "GCM.h"
 #include "IntegerTools.h"
 #include "Keccak.h"
+#include "KemBatch.h"
 #include "PrngFromName.h"
 #include "SymmetricKey.h"
 
@@ -277,48 +278,24 @@ bool McEliece::Decapsulate(const std::vector<byte> &CipherText, std::vector<byte
 	return status;
 }
 
-void McEliece::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
+bool McEliece::Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
 {
 	CEXASSERT(m_mpkcState->Initialized, "The cipher has not been initialized");
-	CEXASSERT(SharedSecret.size() <= 256, "The shared secret size is too large");
 
-	std::vector<byte> sec(SECRET_SIZE);
+	return KemBatch::Decapsulate(Name(), CipherText, SharedSecret, Count, CipherTextSize(), SECRET_SIZE, m_mpkcState->DomainKey.size() != 0,
+		[this](const std::vector<byte> &Input, std::vector<byte> &Secret) { return Decapsulate(Input, Secret); });
+}
+void McEliece::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
+{
+	Encapsulate(CipherText, SharedSecret, m_rndGenerator);
+}
 
-	switch (m_mpkcState->Parameters)
-	{
-		case MPKCParameters::MPKCS1N4096T62:
-		{
-			CipherText.resize(MPKCN4096T62::CIPHERTEXT_SIZE);
-			MPKCN4096T62::Encapsulate(m_publicKey->Polynomial(), CipherText, sec, m_rndGenerator);
-			break;
-		}
-		case MPKCParameters::MPKCS1N6960T119:
-		{
-			CipherText.resize(MPKCN6960T119::CIPHERTEXT_SIZE);
-			MPKCN6960T119::Encapsulate(m_publicKey->Polynomial(), CipherText, sec, m_rndGenerator);
-			break;
-		}
-		case MPKCParameters::MPKCS1N8192T128:
-		{
-			CipherText.resize(MPKCN8192T128::CIPHERTEXT_SIZE);
-			MPKCN8192T128::Encapsulate(m_publicKey->Polynomial(), CipherText, sec, m_rndGenerator);
-			break;
-		}
-		default:
-		{
-			throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The McEliece parameter set is invalid!"), ErrorCodes::InvalidParam);
-		}
-	}
+void McEliece::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
+{
+	CEXASSERT(m_mpkcState->Initialized, "The cipher has not been initialized");
 
-	if (m_mpkcState->DomainKey.size() != 0)
-	{
-		CXOF(m_mpkcState->DomainKey, sec, SharedSecret, Keccak::KECCAK512_RATE_SIZE);
-	}
-	else
-	{
-		SharedSecret.resize(sec.size());
-		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
-	}
+	KemBatch::Encapsulate(Name(), CipherText, SharedSecret, Count, CipherTextSize(), SECRET_SIZE, m_mpkcState->DomainKey.size() != 0, m_rndGenerator,
+		[this](std::vector<byte> &Output, std::vector<byte> &Secret, std::unique_ptr<IPrng> &Rng) { Encapsulate(Output, Secret, Rng); });
 }
 
 AsymmetricKeyPair* McEliece::Generate()
@@ -390,8 +367,15 @@ void McEliece::Initialize(AsymmetricKey* Key)
 
 	if (Key->KeyClass() == AsymmetricKeyTypes::CipherPublicKey)
 	{
+		m_mpkcState->Parameters = static_cast<MPKCParameters>(Key->Parameters());
+
+		// the public key is read in place by encapsulation
+		if (Key->PolynomialSize() != PublicKeySize())
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Initialize"), std::string("The public key size is invalid!"), ErrorCodes::InvalidKey);
+		}
+
 		m_publicKey = std::unique_ptr<AsymmetricKey>(Key);
-		m_mpkcState->Parameters = static_cast<MPKCParameters>(m_publicKey->Parameters());
 		m_mpkcState->Encryption = true;
 	}
 	else
@@ -406,8 +390,53 @@ void McEliece::Initialize(AsymmetricKey* Key)
 
 void McEliece::CXOF(const std::vector<byte> &Domain, const std::vector<byte> &Key, std::vector<byte> &Secret, size_t Rate)
 {
-	std::vector<byte> tmpn(Name().begin(), Name().end());
+	const std::string NAME = Name();
+	std::vector<byte> tmpn(NAME.begin(), NAME.end());
 	Keccak::CXOFR24P1600(Key, Domain, tmpn, Secret, 0, Secret.size(), Rate);
 }
 
+void McEliece::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
+{
+	CEXASSERT(m_mpkcState->Initialized, "The cipher has not been initialized");
+	CEXASSERT(SharedSecret.size() <= 256, "The shared secret size is too large");
+
+	std::vector<byte> sec(SECRET_SIZE);
+
+	switch (m_mpkcState->Parameters)
+	{
+		case MPKCParameters::MPKCS1N4096T62:
+		{
+			CipherText.resize(MPKCN4096T62::CIPHERTEXT_SIZE);
+			MPKCN4096T62::Encapsulate(m_publicKey->PolynomialView(), CipherText, sec, Rng);
+			break;
+		}
+		case MPKCParameters::MPKCS1N6960T119:
+		{
+			CipherText.resize(MPKCN6960T119::CIPHERTEXT_SIZE);
+			MPKCN6960T119::Encapsulate(m_publicKey->PolynomialView(), CipherText, sec, Rng);
+			break;
+		}
+		case MPKCParameters::MPKCS1N8192T128:
+		{
+			CipherText.resize(MPKCN8192T128::CIPHERTEXT_SIZE);
+			MPKCN8192T128::Encapsulate(m_publicKey->PolynomialView(), CipherText, sec, Rng);
+			break;
+		}
+		default:
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The McEliece parameter set is invalid!"), ErrorCodes::InvalidParam);
+		}
+	}
+
+	if (m_mpkcState->DomainKey.size() != 0)
+	{
+		CXOF(m_mpkcState->DomainKey, sec, SharedSecret, Keccak::KECCAK512_RATE_SIZE);
+	}
+	else
+	{
+		SharedSecret.resize(sec.size());
+		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
+	}
+}
+
 NAMESPACE_MCELIECEEND
@@ -1,7 +1,895 @@
 #include "McElieceUtils.h"
+#include "CpuDetect.h"
+#include "ParallelTools.h"
 
 NAMESPACE_MCELIECE
 
+using Utility::ParallelTools;
+
+const std::array<std::array<ulong, McElieceUtils::FFT_GFBITS>, 127> McElieceUtils::FftButterflyConsts =
+{
+	{
+		{
+			0x6969969669699696ULL, 0x9966669966999966ULL, 0x9966669966999966ULL, 0xFF0000FF00FFFF00ULL,
+			0xCC3333CCCC3333CCULL, 0x9966669966999966ULL, 0x6666666666666666ULL, 0xA55AA55AA55AA55AULL,
+			0xCCCC33333333CCCCULL, 0x5A5A5A5A5A5A5A5AULL, 0x55AAAA55AA5555AAULL, 0x0FF0F00FF00F0FF0ULL,
+			0x5AA55AA5A55AA55AULL
+		},
+		{
+			0xA55A5AA55AA5A55AULL, 0x6969696996969696ULL, 0x5AA55AA5A55AA55AULL, 0x9999999966666666ULL,
+			0x3C3CC3C3C3C33C3CULL, 0xFFFF0000FFFF0000ULL, 0x0000000000000000ULL, 0xCC33CC3333CC33CCULL,
+			0x0000000000000000ULL, 0x3C3C3C3C3C3C3C3CULL, 0xAA5555AAAA5555AAULL, 0xC33C3CC33CC3C33CULL,
+			0x00FFFF0000FFFF00ULL
+		},
+		{
+			0xA55A5AA55AA5A55AULL, 0x6969696996969696ULL, 0x5AA55AA5A55AA55AULL, 0x6666666699999999ULL,
+			0xC3C33C3C3C3CC3C3ULL, 0x0000FFFF0000FFFFULL, 0x0000000000000000ULL, 0x33CC33CCCC33CC33ULL,
+			0x0000000000000000ULL, 0x3C3C3C3C3C3C3C3CULL, 0xAA5555AAAA5555AAULL, 0xC33C3CC33CC3C33CULL,
+			0xFF0000FFFF0000FFULL
+		},
+		{
+			0xFFFFFFFF00000000ULL, 0xA5A5A5A55A5A5A5AULL, 0x0FF0F00FF00F0FF0ULL, 0x9669966969966996ULL,
+			0x0000FFFFFFFF0000ULL, 0x33333333CCCCCCCCULL, 0xA55A5AA55AA5A55AULL, 0x00FFFF0000FFFF00ULL,
+			0x0000000000000000ULL, 0xC33CC33CC33CC33CULL, 0x0F0FF0F00F0FF0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAA55555555AAAAULL
+		},
+		{
+			0xFFFFFFFF00000000ULL, 0xA5A5A5A55A5A5A5AULL, 0x0FF0F00FF00F0FF0ULL, 0x6996699696699669ULL,
+			0xFFFF00000000FFFFULL, 0x33333333CCCCCCCCULL, 0x5AA5A55AA55A5AA5ULL, 0xFF0000FFFF0000FFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xC33CC33CC33CC33CULL, 0x0F0FF0F00F0FF0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0x5555AAAAAAAA5555ULL
+		},
+		{
+			0xFFFFFFFF00000000ULL, 0x5A5A5A5AA5A5A5A5ULL, 0xF00F0FF00FF0F00FULL, 0x6996699696699669ULL,
+			0x0000FFFFFFFF0000ULL, 0x33333333CCCCCCCCULL, 0x5AA5A55AA55A5AA5ULL, 0xFF0000FFFF0000FFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xC33CC33CC33CC33CULL, 0x0F0FF0F00F0FF0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAA55555555AAAAULL
+		},
+		{
+			0xFFFFFFFF00000000ULL, 0x5A5A5A5AA5A5A5A5ULL, 0xF00F0FF00FF0F00FULL, 0x9669966969966996ULL,
+			0xFFFF00000000FFFFULL, 0x33333333CCCCCCCCULL, 0xA55A5AA55AA5A55AULL, 0x00FFFF0000FFFF00ULL,
+			0x0000000000000000ULL, 0xC33CC33CC33CC33CULL, 0x0F0FF0F00F0FF0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0x5555AAAAAAAA5555ULL
+		},
+		{
+			0xC33C3CC33CC3C33CULL, 0x9966669966999966ULL, 0x9966996699669966ULL, 0x6969969669699696ULL,
+			0xAA55AA5555AA55AAULL, 0x9966996699669966ULL, 0x5AA5A55A5AA5A55AULL, 0xC3C3C3C33C3C3C3CULL,
+			0x3CC33CC3C33CC33CULL, 0x3333CCCC3333CCCCULL, 0x9999999966666666ULL, 0xC33CC33CC33CC33CULL,
+			0x6666999999996666ULL
+		},
+		{
+			0x3CC3C33CC33C3CC3ULL, 0x6699996699666699ULL, 0x6699669966996699ULL, 0x6969969669699696ULL,
+			0xAA55AA5555AA55AAULL, 0x9966996699669966ULL, 0xA55A5AA5A55A5AA5ULL, 0xC3C3C3C33C3C3C3CULL,
+			0x3CC33CC3C33CC33CULL, 0x3333CCCC3333CCCCULL, 0x6666666699999999ULL, 0x3CC33CC33CC33CC3ULL,
+			0x9999666666669999ULL
+		},
+		{
+			0xC33C3CC33CC3C33CULL, 0x9966669966999966ULL, 0x6699669966996699ULL, 0x6969969669699696ULL,
+			0xAA55AA5555AA55AAULL, 0x6699669966996699ULL, 0x5AA5A55A5AA5A55AULL, 0x3C3C3C3CC3C3C3C3ULL,
+			0xC33CC33C3CC33CC3ULL, 0xCCCC3333CCCC3333ULL, 0x6666666699999999ULL, 0xC33CC33CC33CC33CULL,
+			0x9999666666669999ULL
+		},
+		{
+			0x3CC3C33CC33C3CC3ULL, 0x6699996699666699ULL, 0x9966996699669966ULL, 0x6969969669699696ULL,
+			0xAA55AA5555AA55AAULL, 0x6699669966996699ULL, 0xA55A5AA5A55A5AA5ULL, 0x3C3C3C3CC3C3C3C3ULL,
+			0xC33CC33C3CC33CC3ULL, 0xCCCC3333CCCC3333ULL, 0x9999999966666666ULL, 0x3CC33CC33CC33CC3ULL,
+			0x6666999999996666ULL
+		},
+		{
+			0xC33C3CC33CC3C33CULL, 0x6699996699666699ULL, 0x6699669966996699ULL, 0x6969969669699696ULL,
+			0x55AA55AAAA55AA55ULL, 0x9966996699669966ULL, 0x5AA5A55A5AA5A55AULL, 0xC3C3C3C33C3C3C3CULL,
+			0xC33CC33C3CC33CC3ULL, 0x3333CCCC3333CCCCULL, 0x9999999966666666ULL, 0xC33CC33CC33CC33CULL,
+			0x6666999999996666ULL
+		},
+		{
+			0x3CC3C33CC33C3CC3ULL, 0x9966669966999966ULL, 0x9966996699669966ULL, 0x6969969669699696ULL,
+			0x55AA55AAAA55AA55ULL, 0x9966996699669966ULL, 0xA55A5AA5A55A5AA5ULL, 0xC3C3C3C33C3C3C3CULL,
+			0xC33CC33C3CC33CC3ULL, 0x3333CCCC3333CCCCULL, 0x6666666699999999ULL, 0x3CC33CC33CC33CC3ULL,
+			0x9999666666669999ULL
+		},
+		{
+			0xC33C3CC33CC3C33CULL, 0x6699996699666699ULL, 0x9966996699669966ULL, 0x6969969669699696ULL,
+			0x55AA55AAAA55AA55ULL, 0x6699669966996699ULL, 0x5AA5A55A5AA5A55AULL, 0x3C3C3C3CC3C3C3C3ULL,
+			0x3CC33CC3C33CC33CULL, 0xCCCC3333CCCC3333ULL, 0x6666666699999999ULL, 0xC33CC33CC33CC33CULL,
+			0x9999666666669999ULL
+		},
+		{
+			0x3CC3C33CC33C3CC3ULL, 0x9966669966999966ULL, 0x6699669966996699ULL, 0x6969969669699696ULL,
+			0x55AA55AAAA55AA55ULL, 0x6699669966996699ULL, 0xA55A5AA5A55A5AA5ULL, 0x3C3C3C3CC3C3C3C3ULL,
+			0x3CC33CC3C33CC33CULL, 0xCCCC3333CCCC3333ULL, 0x9999999966666666ULL, 0x3CC33CC33CC33CC3ULL,
+			0x6666999999996666ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0x55555555AAAAAAAAULL, 0xF00FF00F0FF00FF0ULL, 0x5AA55AA5A55AA55AULL,
+			0x55AAAA55AA5555AAULL, 0xF00F0FF0F00F0FF0ULL, 0x9669699696696996ULL, 0xA55AA55AA55AA55AULL,
+			0x55555555AAAAAAAAULL, 0xCCCC33333333CCCCULL, 0x0000FFFFFFFF0000ULL, 0xFF0000FF00FFFF00ULL,
+			0x6996699669966996ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0x55555555AAAAAAAAULL, 0x0FF00FF0F00FF00FULL, 0x5AA55AA5A55AA55AULL,
+			0x55AAAA55AA5555AAULL, 0xF00F0FF0F00F0FF0ULL, 0x9669699696696996ULL, 0x5AA55AA55AA55AA5ULL,
+			0x55555555AAAAAAAAULL, 0x3333CCCCCCCC3333ULL, 0x0000FFFFFFFF0000ULL, 0x00FFFF00FF0000FFULL,
+			0x9669966996699669ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0x55555555AAAAAAAAULL, 0xF00FF00F0FF00FF0ULL, 0xA55AA55A5AA55AA5ULL,
+			0xAA5555AA55AAAA55ULL, 0x0FF0F00F0FF0F00FULL, 0x9669699696696996ULL, 0x5AA55AA55AA55AA5ULL,
+			0xAAAAAAAA55555555ULL, 0x3333CCCCCCCC3333ULL, 0xFFFF00000000FFFFULL, 0xFF0000FF00FFFF00ULL,
+			0x9669966996699669ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0x55555555AAAAAAAAULL, 0x0FF00FF0F00FF00FULL, 0xA55AA55A5AA55AA5ULL,
+			0xAA5555AA55AAAA55ULL, 0x0FF0F00F0FF0F00FULL, 0x9669699696696996ULL, 0xA55AA55AA55AA55AULL,
+			0xAAAAAAAA55555555ULL, 0xCCCC33333333CCCCULL, 0xFFFF00000000FFFFULL, 0x00FFFF00FF0000FFULL,
+			0x6996699669966996ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0x55555555AAAAAAAAULL, 0x0FF00FF0F00FF00FULL, 0xA55AA55A5AA55AA5ULL,
+			0xAA5555AA55AAAA55ULL, 0x0FF0F00F0FF0F00FULL, 0x6996966969969669ULL, 0xA55AA55AA55AA55AULL,
+			0xAAAAAAAA55555555ULL, 0xCCCC33333333CCCCULL, 0x0000FFFFFFFF0000ULL, 0xFF0000FF00FFFF00ULL,
+			0x6996699669966996ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0x55555555AAAAAAAAULL, 0xF00FF00F0FF00FF0ULL, 0xA55AA55A5AA55AA5ULL,
+			0xAA5555AA55AAAA55ULL, 0x0FF0F00F0FF0F00FULL, 0x6996966969969669ULL, 0x5AA55AA55AA55AA5ULL,
+			0xAAAAAAAA55555555ULL, 0x3333CCCCCCCC3333ULL, 0x0000FFFFFFFF0000ULL, 0x00FFFF00FF0000FFULL,
+			0x9669966996699669ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0x55555555AAAAAAAAULL, 0x0FF00FF0F00FF00FULL, 0x5AA55AA5A55AA55AULL,
+			0x55AAAA55AA5555AAULL, 0xF00F0FF0F00F0FF0ULL, 0x6996966969969669ULL, 0x5AA55AA55AA55AA5ULL,
+			0x55555555AAAAAAAAULL, 0x3333CCCCCCCC3333ULL, 0xFFFF00000000FFFFULL, 0xFF0000FF00FFFF00ULL,
+			0x9669966996699669ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0x55555555AAAAAAAAULL, 0xF00FF00F0FF00FF0ULL, 0x5AA55AA5A55AA55AULL,
+			0x55AAAA55AA5555AAULL, 0xF00F0FF0F00F0FF0ULL, 0x6996966969969669ULL, 0xA55AA55AA55AA55AULL,
+			0x55555555AAAAAAAAULL, 0xCCCC33333333CCCCULL, 0xFFFF00000000FFFFULL, 0x00FFFF00FF0000FFULL,
+			0x6996699669966996ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0xAAAAAAAA55555555ULL, 0x0FF00FF0F00FF00FULL, 0x5AA55AA5A55AA55AULL,
+			0xAA5555AA55AAAA55ULL, 0xF00F0FF0F00F0FF0ULL, 0x9669699696696996ULL, 0xA55AA55AA55AA55AULL,
+			0x55555555AAAAAAAAULL, 0xCCCC33333333CCCCULL, 0x0000FFFFFFFF0000ULL, 0xFF0000FF00FFFF00ULL,
+			0x6996699669966996ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0xAAAAAAAA55555555ULL, 0xF00FF00F0FF00FF0ULL, 0x5AA55AA5A55AA55AULL,
+			0xAA5555AA55AAAA55ULL, 0xF00F0FF0F00F0FF0ULL, 0x9669699696696996ULL, 0x5AA55AA55AA55AA5ULL,
+			0x55555555AAAAAAAAULL, 0x3333CCCCCCCC3333ULL, 0x0000FFFFFFFF0000ULL, 0x00FFFF00FF0000FFULL,
+			0x9669966996699669ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0xAAAAAAAA55555555ULL, 0x0FF00FF0F00FF00FULL, 0xA55AA55A5AA55AA5ULL,
+			0x55AAAA55AA5555AAULL, 0x0FF0F00F0FF0F00FULL, 0x9669699696696996ULL, 0x5AA55AA55AA55AA5ULL,
+			0xAAAAAAAA55555555ULL, 0x3333CCCCCCCC3333ULL, 0xFFFF00000000FFFFULL, 0xFF0000FF00FFFF00ULL,
+			0x9669966996699669ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0xAAAAAAAA55555555ULL, 0xF00FF00F0FF00FF0ULL, 0xA55AA55A5AA55AA5ULL,
+			0x55AAAA55AA5555AAULL, 0x0FF0F00F0FF0F00FULL, 0x9669699696696996ULL, 0xA55AA55AA55AA55AULL,
+			0xAAAAAAAA55555555ULL, 0xCCCC33333333CCCCULL, 0xFFFF00000000FFFFULL, 0x00FFFF00FF0000FFULL,
+			0x6996699669966996ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0xAAAAAAAA55555555ULL, 0xF00FF00F0FF00FF0ULL, 0xA55AA55A5AA55AA5ULL,
+			0x55AAAA55AA5555AAULL, 0x0FF0F00F0FF0F00FULL, 0x6996966969969669ULL, 0xA55AA55AA55AA55AULL,
+			0xAAAAAAAA55555555ULL, 0xCCCC33333333CCCCULL, 0x0000FFFFFFFF0000ULL, 0xFF0000FF00FFFF00ULL,
+			0x6996699669966996ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0xAAAAAAAA55555555ULL, 0x0FF00FF0F00FF00FULL, 0xA55AA55A5AA55AA5ULL,
+			0x55AAAA55AA5555AAULL, 0x0FF0F00F0FF0F00FULL, 0x6996966969969669ULL, 0x5AA55AA55AA55AA5ULL,
+			0xAAAAAAAA55555555ULL, 0x3333CCCCCCCC3333ULL, 0x0000FFFFFFFF0000ULL, 0x00FFFF00FF0000FFULL,
+			0x9669966996699669ULL
+		},
+		{
+			0x3C3CC3C3C3C33C3CULL, 0xAAAAAAAA55555555ULL, 0xF00FF00F0FF00FF0ULL, 0x5AA55AA5A55AA55AULL,
+			0xAA5555AA55AAAA55ULL, 0xF00F0FF0F00F0FF0ULL, 0x6996966969969669ULL, 0x5AA55AA55AA55AA5ULL,
+			0x55555555AAAAAAAAULL, 0x3333CCCCCCCC3333ULL, 0xFFFF00000000FFFFULL, 0xFF0000FF00FFFF00ULL,
+			0x9669966996699669ULL
+		},
+		{
+			0xC3C33C3C3C3CC3C3ULL, 0xAAAAAAAA55555555ULL, 0x0FF00FF0F00FF00FULL, 0x5AA55AA5A55AA55AULL,
+			0xAA5555AA55AAAA55ULL, 0xF00F0FF0F00F0FF0ULL, 0x6996966969969669ULL, 0xA55AA55AA55AA55AULL,
+			0x55555555AAAAAAAAULL, 0xCCCC33333333CCCCULL, 0xFFFF00000000FFFFULL, 0x00FFFF00FF0000FFULL,
+			0x6996699669966996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0xAAAAAAAAAAAAAAAAULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0x0000FFFF0000FFFFULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0xC33C3CC3C33C3CC3ULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0x55AA55AA55AA55AAULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0xFFFF0000FFFF0000ULL, 0x0F0F0F0FF0F0F0F0ULL, 0x00FFFF00FF0000FFULL,
+			0xCC3333CC33CCCC33ULL, 0xFF0000FF00FFFF00ULL, 0x6996966996696996ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x3CC3C33C3CC3C33CULL, 0x5555555555555555ULL, 0xFFFF0000FFFF0000ULL, 0x3CC3C33C3CC3C33CULL,
+			0xAA55AA55AA55AA55ULL, 0x0000FFFF0000FFFFULL, 0xF0F0F0F00F0F0F0FULL, 0xFF0000FF00FFFF00ULL,
+			0x33CCCC33CC3333CCULL, 0x00FFFF00FF0000FFULL, 0x9669699669969669ULL, 0xA55A5AA55AA5A55AULL,
+			0x6996966996696996ULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		},
+		{
+			0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+			0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFF00000000ULL,
+			0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL, 0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL,
+			0xAAAAAAAAAAAAAAAAULL
+		}
+	}
+};
+
+const std::array<std::array<std::array<ulong, McElieceUtils::FFT_GFBITS>, 2>, 6> McElieceUtils::FftRadixScalar =
+{
+	{
+		{
+			{
+				{
+					0x3C3CF30C0000C003ULL, 0x0CCCC3F333C0000CULL, 0x03C33F33FCC0C03CULL, 0x0003000F3C03C0C0ULL,
+					0xF33FF33030CF03F0ULL, 0x0CF0303300F0CCC0ULL, 0xFF3F0C0CC0FF3CC0ULL, 0xCF3CF0FF003FC000ULL,
+					0xC00FF3CF0303F300ULL, 0x3CCC0CC00CF0CC00ULL, 0xF30FFC3C3FCCFC00ULL, 0x3F0FC3F0CCF0C000ULL,
+					0x3000FF33CCF0F000ULL
+				},
+				{
+					0x0C0F0FCF0F0CF330ULL, 0xF0000FC33C3CCF3CULL, 0x3C0F3F00C3C300FCULL, 0x3C33CCC0F0F3CC30ULL,
+					0xC0CFFFFFCCCC30CCULL, 0x3FC3F3CCFFFC033FULL, 0xFC3030CCCCC0CFCFULL, 0x0FCF0C00CCF333C3ULL,
+					0xCFFCF33000CFF030ULL, 0x00CFFCC330F30FCCULL, 0x3CCC3FCCC0F3FFF3ULL, 0xF00F0C3FC003C0FFULL,
+					0x330CCFCC03C0FC33ULL
+				}
+			}
+		},
+		{
+			{
+				{
+					0x0F0F0FF0F000000FULL, 0x00FFFFFFFF0000F0ULL, 0xFFFF00FF00000F00ULL, 0xFFF000F00F0FF000ULL,
+					0xFFF0000F0FF000F0ULL, 0x00FF000FFF000000ULL, 0xFF0F0FFF0F0FF000ULL, 0x0FFF0000000F0000ULL,
+					0x00F000F0FFF00F00ULL, 0x00F00FF00F00F000ULL, 0xFFF000F000F00000ULL, 0x00F00F000FF00000ULL,
+					0x0000FF0F0000F000ULL
+				},
+				{
+					0xF0FFFFFFF0F00F00ULL, 0x00FFF0FFFF0000FFULL, 0x00FF00000F0F0FFFULL, 0xF000F0000F00FF0FULL,
+					0xFF000000FFF00000ULL, 0xF0FF000FF00F0FF0ULL, 0x0F0F0F00FF000F0FULL, 0x0F0F00F0F0F0F000ULL,
+					0x00F00F00F00F000FULL, 0x00F0F0F00000FFF0ULL, 0xFFFFFF0FF00F0FFFULL, 0x0F0FFFF00FFFFFFFULL,
+					0xFFFF0F0FFF0FFF00ULL
+				}
+			}
+		},
+		{
+			{
+				{
+					0x00FF0000000000FFULL, 0xFFFFFFFFFF00FF00ULL, 0xFF0000FF00FF0000ULL, 0xFFFF000000FF0000ULL,
+					0xFF00000000FF0000ULL, 0x00FFFFFFFF000000ULL, 0xFF0000FFFFFF0000ULL, 0xFF00FF00FFFF0000ULL,
+					0x00FFFFFFFF00FF00ULL, 0xFFFF000000000000ULL, 0x00FF0000FF000000ULL, 0xFF00FF00FF000000ULL,
+					0x00FF00FFFF000000ULL
+				},
+				{
+					0x00FF00FF00FF0000ULL, 0xFF00FFFF000000FFULL, 0x0000FFFF000000FFULL, 0x00FFFF00FF000000ULL,
+					0xFFFFFF0000FF00FFULL, 0x0000FFFF00FFFF00ULL, 0xFF00FF0000FFFF00ULL, 0x00000000FFFFFFFFULL,
+					0x0000FF0000000000ULL, 0xFF00FFFF00FFFF00ULL, 0x00FFFF00000000FFULL, 0x0000FF00FF00FFFFULL,
+					0xFF0000FFFFFF0000ULL
+				}
+			}
+		},
+		{
+			{
+				{
+					0x000000000000FFFFULL, 0xFFFFFFFFFFFF0000ULL, 0x0000000000000000ULL, 0xFFFF0000FFFF0000ULL,
+					0xFFFFFFFFFFFF0000ULL, 0x0000FFFF00000000ULL, 0x0000FFFFFFFF0000ULL, 0xFFFF0000FFFF0000ULL,
+					0x0000FFFF00000000ULL, 0xFFFF000000000000ULL, 0xFFFF000000000000ULL, 0xFFFF000000000000ULL,
+					0xFFFFFFFF00000000ULL
+				},
+				{
+					0x0000FFFF00000000ULL, 0xFFFFFFFF0000FFFFULL, 0x00000000FFFFFFFFULL, 0x0000000000000000ULL,
+					0x0000FFFF00000000ULL, 0xFFFF0000FFFF0000ULL, 0x0000FFFFFFFF0000ULL, 0x0000FFFF0000FFFFULL,
+					0xFFFFFFFF0000FFFFULL, 0x00000000FFFF0000ULL, 0xFFFF0000FFFFFFFFULL, 0xFFFF0000FFFFFFFFULL,
+					0x0000000000000000ULL
+				}
+			}
+		},
+		{
+			{
+				{
+					0x00000000FFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000000ULL, 0x0000000000000000ULL,
+					0xFFFFFFFF00000000ULL, 0xFFFFFFFF00000000ULL, 0xFFFFFFFF00000000ULL, 0x0000000000000000ULL,
+					0xFFFFFFFF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0xFFFFFFFF00000000ULL
+				},
+				{
+					0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x00000000FFFFFFFFULL, 0xFFFFFFFF00000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+					0x00000000FFFFFFFFULL, 0xFFFFFFFF00000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+					0xFFFFFFFF00000000ULL
+				}
+			}
+		},
+		{
+			{
+				{
+					0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL
+				},
+				{
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL,
+					0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+					0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+					0x0000000000000000ULL
+				}
+			}
+		}
+	}
+};
+
+const std::array<byte, McElieceUtils::FFT_COLUMNS> McElieceUtils::FftReverse =
+{
+	{
+		0x00, 0x40, 0x20, 0x60, 0x10, 0x50, 0x30, 0x70, 0x08, 0x48, 0x28, 0x68, 0x18, 0x58, 0x38, 0x78,
+		0x04, 0x44, 0x24, 0x64, 0x14, 0x54, 0x34, 0x74, 0x0C, 0x4C, 0x2C, 0x6C, 0x1C, 0x5C, 0x3C, 0x7C,
+		0x02, 0x42, 0x22, 0x62, 0x12, 0x52, 0x32, 0x72, 0x0A, 0x4A, 0x2A, 0x6A, 0x1A, 0x5A, 0x3A, 0x7A,
+		0x06, 0x46, 0x26, 0x66, 0x16, 0x56, 0x36, 0x76, 0x0E, 0x4E, 0x2E, 0x6E, 0x1E, 0x5E, 0x3E, 0x7E,
+		0x01, 0x41, 0x21, 0x61, 0x11, 0x51, 0x31, 0x71, 0x09, 0x49, 0x29, 0x69, 0x19, 0x59, 0x39, 0x79,
+		0x05, 0x45, 0x25, 0x65, 0x15, 0x55, 0x35, 0x75, 0x0D, 0x4D, 0x2D, 0x6D, 0x1D, 0x5D, 0x3D, 0x7D,
+		0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0B, 0x4B, 0x2B, 0x6B, 0x1B, 0x5B, 0x3B, 0x7B,
+		0x07, 0x47, 0x27, 0x67, 0x17, 0x57, 0x37, 0x77, 0x0F, 0x4F, 0x2F, 0x6F, 0x1F, 0x5F, 0x3F, 0x7F
+	}
+};
+
 //~~~N6090T13 and N8192T13~~~//
 
 // benes.c //
@@ -175,6 +1063,421 @@ void McElieceUtils::ApplyBenes(byte* R, const byte* Bits, bool Reverse)
 	}
 }
 
+// encrypt.c //
+
+byte McElieceUtils::RowParity(const byte* Row, const byte* E, size_t Length)
+{
+	// returns the parity of the inner product of a public-key row and the error vector
+	ulong acc;
+	ulong e;
+	ulong r;
+	size_t i;
+
+	acc = 0;
+	i = 0;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512 && Length >= 64)
+	{
+		i = Length - (Length % 64);
+		acc = RowParityV8(Row, E, i);
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (i == 0 && (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512) && Length >= 32)
+	{
+		i = Length - (Length % 32);
+		acc = RowParityV4(Row, E, i);
+	}
+#endif
+
+	// byte order does not change the parity, use native word loads
+	for (; i + 8 <= Length; i += 8)
+	{
+		std::memcpy(&r, Row + i, sizeof(ulong));
+		std::memcpy(&e, E + i, sizeof(ulong));
+		acc ^= r & e;
+	}
+
+	for (; i < Length; ++i)
+	{
+		acc ^= static_cast<ulong>(Row[i] & E[i]);
+	}
+
+	acc ^= acc >> 32;
+	acc ^= acc >> 16;
+	acc ^= acc >> 8;
+	acc ^= acc >> 4;
+	acc ^= acc >> 2;
+	acc ^= acc >> 1;
+
+	return static_cast<byte>(acc & 1);
+}
+
+// fft.c //
+
+void McElieceUtils::FftTransform(ulong Output[][FFT_GFBITS], const ulong Input[][FFT_GFBITS])
+{
+	// input: in, polynomial of degree < 128 in bitsliced form
+	// output: out, the evaluations of in at all 8192 field elements, in support base order
+
+	ulong buf[2][FFT_GFBITS];
+	size_t i;
+
+	for (i = 0; i < FFT_GFBITS; ++i)
+	{
+		buf[0][i] = Input[0][i];
+		buf[1][i] = Input[1][i];
+	}
+
+	FftRadixConversions(buf);
+	FftButterflies(Output, buf);
+}
+
+void McElieceUtils::FftButterflies(ulong Output[][FFT_GFBITS], const ulong Input[][FFT_GFBITS])
+{
+	ulong tmp[FFT_GFBITS];
+	size_t b;
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t pos;
+	size_t s;
+
+	// broadcast
+	for (j = 0; j < FFT_COLUMNS; ++j)
+	{
+		for (b = 0; b < FFT_GFBITS; ++b)
+		{
+			Output[j][b] = (Input[FftReverse[j] >> 6][b] >> (FftReverse[j] & 63)) & 1;
+			Output[j][b] = ~Output[j][b] + 1;
+		}
+	}
+
+	pos = 0;
+
+	// butterflies
+	for (i = 0; i <= 6; ++i)
+	{
+		s = static_cast<size_t>(1) << i;
+
+		for (j = 0; j < FFT_COLUMNS; j += 2 * s)
+		{
+			for (k = j; k < j + s; ++k)
+			{
+				GfMultiply(tmp, Output[k + s], FftButterflyConsts[pos + (k - j)].data());
+
+				for (b = 0; b < FFT_GFBITS; ++b)
+				{
+					Output[k][b] ^= tmp[b];
+				}
+
+				for (b = 0; b < FFT_GFBITS; ++b)
+				{
+					Output[k + s][b] ^= Output[k][b];
+				}
+			}
+		}
+
+		pos += s;
+	}
+}
+
+void McElieceUtils::FftPowers(ulong Output[][FFT_GFBITS])
+{
+	// output: out, the 128th power of all 8192 field elements, in support base order
+
+	const ulong masks[6] =
+	{
+		0xFFFFFFFF00000000ULL, 0xFFFF0000FFFF0000ULL, 0xFF00FF00FF00FF00ULL,
+		0xF0F0F0F0F0F0F0F0ULL, 0xCCCCCCCCCCCCCCCCULL, 0xAAAAAAAAAAAAAAAAULL
+	};
+
+	size_t b;
+	size_t i;
+	size_t j;
+
+	for (j = 0; j < FFT_COLUMNS; ++j)
+	{
+		// the element at position 64j + l is bitrev(64j + l)
+		for (b = 0; b < 7; ++b)
+		{
+			Output[j][b] = (j >> (6 - b)) & 1;
+			Output[j][b] = ~Output[j][b] + 1;
+		}
+
+		for (b = 7; b < FFT_GFBITS; ++b)
+		{
+			Output[j][b] = masks[b - 7];
+		}
+
+		for (i = 0; i < 7; ++i)
+		{
+			GfSquare(Output[j], Output[j]);
+		}
+	}
+}
+
+void McElieceUtils::FftRadixConversions(ulong Input[][FFT_GFBITS])
+{
+	size_t ctr;
+	size_t i;
+	size_t j;
+
+	static const std::array<std::array<ulong, 2>, 5> RadixMask =
+	{
+		{
+			{ 0x8888888888888888ULL, 0x4444444444444444ULL },
+			{ 0xC0C0C0C0C0C0C0C0ULL, 0x3030303030303030ULL },
+			{ 0xF000F000F000F000ULL, 0x0F000F000F000F00ULL },
+			{ 0xFF000000FF000000ULL, 0x00FF000000FF0000ULL },
+			{ 0xFFFF000000000000ULL, 0x0000FFFF00000000ULL }
+		}
+	};
+
+	for (i = 0; i <= 5; ++i)
+	{
+		for (j = 0; j < FFT_GFBITS; ++j)
+		{
+			Input[1][j] ^= Input[1][j] >> 32;
+			Input[0][j] ^= Input[1][j] << 32;
+
+			for (ctr = RadixMask.size(); ctr > i; --ctr)
+			{
+				Input[0][j] ^= (Input[0][j] & RadixMask[ctr - 1][0]) >> (1UL << (ctr - 1));
+				Input[0][j] ^= (Input[0][j] & RadixMask[ctr - 1][1]) >> (1UL << (ctr - 1));
+				Input[1][j] ^= (Input[1][j] & RadixMask[ctr - 1][0]) >> (1UL << (ctr - 1));
+				Input[1][j] ^= (Input[1][j] & RadixMask[ctr - 1][1]) >> (1UL << (ctr - 1));
+			}
+		}
+
+		GfMultiply(Input[0], Input[0], FftRadixScalar[i][0].data());
+		GfMultiply(Input[1], Input[1], FftRadixScalar[i][1].data());
+	}
+}
+
+// fft_tr.c //
+
+void McElieceUtils::FftTransposed(ulong Output[][FFT_GFBITS], ulong Input[][FFT_GFBITS])
+{
+	// input: in, field elements in support base order (overwritten)
+	// output: out, the power sums of in over all 8192 field elements for exponents < 128
+
+	FftTrButterflies(Output, Input);
+	FftTrRadixConversions(Output);
+}
+
+void McElieceUtils::FftTrButterflies(ulong Output[][FFT_GFBITS], ulong Input[][FFT_GFBITS])
+{
+	ulong tmp[FFT_GFBITS];
+	ulong x;
+	size_t b;
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t pos;
+	size_t s;
+
+	// butterflies
+	i = 7;
+	pos = FftButterflyConsts.size();
+
+	do
+	{
+		--i;
+		s = static_cast<size_t>(1) << i;
+		pos -= s;
+
+		for (j = 0; j < FFT_COLUMNS; j += 2 * s)
+		{
+			for (k = j; k < j + s; ++k)
+			{
+				for (b = 0; b < FFT_GFBITS; ++b)
+				{
+					Input[k][b] ^= Input[k + s][b];
+				}
+
+				GfMultiply(tmp, Input[k], FftButterflyConsts[pos + (k - j)].data());
+
+				for (b = 0; b < FFT_GFBITS; ++b)
+				{
+					Input[k + s][b] ^= tmp[b];
+				}
+			}
+		}
+	}
+	while (i != 0);
+
+	// broadcast
+	for (b = 0; b < FFT_GFBITS; ++b)
+	{
+		Output[0][b] = 0;
+		Output[1][b] = 0;
+	}
+
+	for (j = 0; j < FFT_COLUMNS; ++j)
+	{
+		for (b = 0; b < FFT_GFBITS; ++b)
+		{
+			x = Input[j][b];
+			x ^= x >> 32;
+			x ^= x >> 16;
+			x ^= x >> 8;
+			x ^= x >> 4;
+			x ^= x >> 2;
+			x ^= x >> 1;
+			Output[FftReverse[j] >> 6][b] |= (x & 1) << (FftReverse[j] & 63);
+		}
+	}
+}
+
+void McElieceUtils::FftTrRadixConversions(ulong Output[][FFT_GFBITS])
+{
+	size_t ctr;
+	size_t i;
+	size_t j;
+
+	static const std::array<std::array<ulong, 2>, 5> RadixTrMask =
+	{
+		{
+			{ 0x2222222222222222ULL, 0x4444444444444444ULL },
+			{ 0x0C0C0C0C0C0C0C0CULL, 0x3030303030303030ULL },
+			{ 0x00F000F000F000F0ULL, 0x0F000F000F000F00ULL },
+			{ 0x0000FF000000FF00ULL, 0x00FF000000FF0000ULL },
+			{ 0x00000000FFFF0000ULL, 0x0000FFFF00000000ULL }
+		}
+	};
+
+	i = 6;
+
+	do
+	{
+		--i;
+		GfMultiply(Output[0], Output[0], FftRadixScalar[i][0].data());
+		GfMultiply(Output[1], Output[1], FftRadixScalar[i][1].data());
+
+		for (j = 0; j < FFT_GFBITS; ++j)
+		{
+			for (ctr = i; ctr < RadixTrMask.size(); ++ctr)
+			{
+				Output[0][j] ^= (Output[0][j] & RadixTrMask[ctr][0]) << (1UL << ctr);
+				Output[0][j] ^= (Output[0][j] & RadixTrMask[ctr][1]) << (1UL << ctr);
+				Output[1][j] ^= (Output[1][j] & RadixTrMask[ctr][0]) << (1UL << ctr);
+				Output[1][j] ^= (Output[1][j] & RadixTrMask[ctr][1]) << (1UL << ctr);
+			}
+
+			Output[1][j] ^= Output[0][j] >> 32;
+			Output[1][j] ^= Output[1][j] << 32;
+		}
+	}
+	while (i != 0);
+}
+
+// gf.c //
+
+void McElieceUtils::GfInvert(ulong* Output, const ulong* Input)
+{
+	// bitsliced inverse in GF(2^13), computed as in^(2^13 - 2)
+
+	ulong tmp11[FFT_GFBITS];
+	ulong tmp1111[FFT_GFBITS];
+	size_t i;
+
+	// ^11
+	GfSquare(tmp11, Input);
+	GfMultiply(tmp11, tmp11, Input);
+	// ^1111
+	GfSquare(tmp1111, tmp11);
+	GfSquare(tmp1111, tmp1111);
+	GfMultiply(tmp1111, tmp1111, tmp11);
+	// ^11111111
+	GfSquare(Output, tmp1111);
+
+	for (i = 0; i < 3; ++i)
+	{
+		GfSquare(Output, Output);
+	}
+
+	GfMultiply(Output, Output, tmp1111);
+
+	// ^111111111111
+	for (i = 0; i < 4; ++i)
+	{
+		GfSquare(Output, Output);
+	}
+
+	GfMultiply(Output, Output, tmp1111);
+	// ^1111111111110 = ^-1
+	GfSquare(Output, Output);
+}
+
+void McElieceUtils::GfMultiply(ulong* Output, const ulong* A, const ulong* B)
+{
+	// bitsliced multiplication in GF(2^13), reduced by x^13 + x^4 + x^3 + x + 1
+
+	ulong buf[(2 * FFT_GFBITS) - 1];
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < (2 * FFT_GFBITS) - 1; ++i)
+	{
+		buf[i] = 0;
+	}
+
+	for (i = 0; i < FFT_GFBITS; ++i)
+	{
+		for (j = 0; j < FFT_GFBITS; ++j)
+		{
+			buf[i + j] ^= A[i] & B[j];
+		}
+	}
+
+	for (i = (2 * FFT_GFBITS) - 2; i >= FFT_GFBITS; --i)
+	{
+		buf[i - 9] ^= buf[i];
+		buf[i - 10] ^= buf[i];
+		buf[i - 12] ^= buf[i];
+		buf[i - 13] ^= buf[i];
+	}
+
+	for (i = 0; i < FFT_GFBITS; ++i)
+	{
+		Output[i] = buf[i];
+	}
+}
+
+void McElieceUtils::GfSquare(ulong* Output, const ulong* Input)
+{
+	ulong buf[(2 * FFT_GFBITS) - 1];
+	size_t i;
+
+	for (i = 0; i < FFT_GFBITS - 1; ++i)
+	{
+		buf[2 * i] = Input[i];
+		buf[(2 * i) + 1] = 0;
+	}
+
+	buf[(2 * FFT_GFBITS) - 2] = Input[FFT_GFBITS - 1];
+
+	for (i = (2 * FFT_GFBITS) - 2; i >= FFT_GFBITS; --i)
+	{
+		buf[i - 9] ^= buf[i];
+		buf[i - 10] ^= buf[i];
+		buf[i - 12] ^= buf[i];
+		buf[i - 13] ^= buf[i];
+	}
+
+	for (i = 0; i < FFT_GFBITS; ++i)
+	{
+		Output[i] = buf[i];
+	}
+}
+
 // controlbits.c //
 
 void McElieceUtils::Compose(uint W, uint N, const uint* Pi, uint* P)
@@ -523,6 +1826,170 @@ void McElieceUtils::Sort63b(uint N, ulong* X)
 	}
 }
 
+// pk_gen.c //
+
+int32_t McElieceUtils::GaussEliminate(ulong* Matrix, size_t Rows, size_t RowWords)
+{
+	// input: mat, a matrix over GF(2) with Rows rows of RowWords little-endian words,
+	// RowWords is a multiple of 8 and the padding columns are zero
+	// output: mat, reduced to the systematic form [I | T]
+	// return: 0 for success, -1 if the leading Rows x Rows block is singular
+
+	const size_t MSKLEN = (Rows + 63) / 64;
+	std::vector<ulong> slice(Rows);
+	std::vector<ulong> srch(GAUSS_BLOCK * MSKLEN);
+	std::vector<ulong> elim(GAUSS_BLOCK * MSKLEN);
+	size_t blk;
+	size_t cnt;
+	size_t grp;
+	size_t i;
+	size_t k;
+	size_t p;
+	size_t start;
+	size_t thds;
+	size_t wrd;
+	int32_t ret;
+	ulong m;
+
+	ret = 0;
+
+	for (blk = 0; blk < Rows; blk += GAUSS_BLOCK)
+	{
+		cnt = (Rows - blk < GAUSS_BLOCK) ? Rows - blk : GAUSS_BLOCK;
+		wrd = blk / 64;
+
+		for (k = 0; k < Rows; ++k)
+		{
+			slice[k] = Matrix[(k * RowWords) + wrd];
+		}
+
+		for (k = 0; k < srch.size(); ++k)
+		{
+			srch[k] = 0;
+			elim[k] = 0;
+		}
+
+		// resolve the pivots of the block on its 64 column slice, and record the row operations
+		for (i = 0; i < cnt; ++i)
+		{
+			p = blk + i;
+
+			for (k = p + 1; k < Rows; ++k)
+			{
+				m = ((slice[p] ^ slice[k]) >> i) & 1;
+				srch[(i * MSKLEN) + (k / 64)] |= m << (k % 64);
+				slice[p] ^= slice[k] & (~m + 1);
+			}
+
+			// return if not systematic
+			if (((slice[p] >> i) & 1) == 0)
+			{
+				ret = -1;
+				break;
+			}
+
+			for (k = 0; k < Rows; ++k)
+			{
+				if (k != p)
+				{
+					m = (slice[k] >> i) & 1;
+					elim[(i * MSKLEN) + (k / 64)] |= m << (k % 64);
+					slice[k] ^= slice[p] & (~m + 1);
+				}
+			}
+		}
+
+		if (ret != 0)
+		{
+			break;
+		}
+
+		// replay the block on every column from the slice onward, the columns are independent,
+		// so the row range is split into 8-word groups across the thread pool
+		start = (wrd / 8) * 8;
+		grp = (RowWords - start) / 8;
+		thds = ParallelTools::ParallelWorkers() + 1;
+		thds = (thds < grp) ? thds : grp;
+		grp = (grp + thds - 1) / thds;
+
+		ParallelTools::ParallelFor(0, thds, [Matrix, Rows, RowWords, blk, cnt, &srch, &elim, start, grp](size_t t)
+		{
+			const size_t OFF = start + (t * grp * 8);
+			const size_t END = (OFF + (grp * 8) < RowWords) ? OFF + (grp * 8) : RowWords;
+
+			if (OFF < END)
+			{
+				GaussUpdate(Matrix, Rows, RowWords, blk, cnt, srch.data(), elim.data(), OFF, END);
+			}
+		});
+	}
+
+	return ret;
+}
+
+void McElieceUtils::GaussUpdate(ulong* Matrix, size_t Rows, size_t RowWords, size_t Pivot, size_t Count, const ulong* Search, const ulong* Eliminate, size_t Start, size_t End)
+{
+	// apply the recorded pivot search and elimination masks of a block to the words [Start, End) of every row
+
+	const size_t MSKLEN = (Rows + 63) / 64;
+	ulong* prow;
+	size_t i;
+	size_t k;
+	size_t p;
+	ulong m;
+
+	for (i = 0; i < Count; ++i)
+	{
+		p = Pivot + i;
+		prow = Matrix + (p * RowWords);
+
+		for (k = p + 1; k < Rows; ++k)
+		{
+			m = (Search[(i * MSKLEN) + (k / 64)] >> (k % 64)) & 1;
+			XorMasked(prow, Matrix + (k * RowWords), ~m + 1, Start, End);
+		}
+
+		for (k = 0; k < Rows; ++k)
+		{
+			if (k != p)
+			{
+				m = (Eliminate[(i * MSKLEN) + (k / 64)] >> (k % 64)) & 1;
+				XorMasked(Matrix + (k * RowWords), prow, ~m + 1, Start, End);
+			}
+		}
+	}
+}
+
+void McElieceUtils::XorMasked(ulong* Output, const ulong* Input, ulong Mask, size_t Start, size_t End)
+{
+	size_t i;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		XorMaskedV8(Output, Input, Mask, Start, End);
+		return;
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		XorMaskedV4(Output, Input, Mask, Start, End);
+		return;
+	}
+#endif
+
+	for (i = Start; i < End; ++i)
+	{
+		Output[i] ^= Input[i] & Mask;
+	}
+}
+
 // transpose.c //
 
 void McElieceUtils::Transpose64x64(ulong* Output, const ulong* Input)
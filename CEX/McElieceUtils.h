@@ -32,6 +32,16 @@ NAMESPACE_MCELIECE
 /// </summary>
 class McElieceUtils
 {
+private:
+
+	static const size_t FFT_COLUMNS = 128;
+	static const size_t FFT_GFBITS = 13;
+	static const size_t GAUSS_BLOCK = 64;
+
+	static const std::array<std::array<ulong, FFT_GFBITS>, 127> FftButterflyConsts;
+	static const std::array<std::array<std::array<ulong, FFT_GFBITS>, 2>, 6> FftRadixScalar;
+	static const std::array<byte, FFT_COLUMNS> FftReverse;
+
 public:
 
 	//~~~N6090T13 and N8192T13~~~//
@@ -44,6 +54,44 @@ public:
 
 	static void ApplyBenes(byte* R, const byte* Bits, bool Reverse);
 
+	// encrypt.c //
+
+	static byte RowParity(const byte* Row, const byte* E, size_t Length);
+
+#if defined(CEX_KERNEL_SIMD256)
+	static ulong RowParityV4(const byte* Row, const byte* E, size_t Length);
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	static ulong RowParityV8(const byte* Row, const byte* E, size_t Length);
+#endif
+
+	// fft.c //
+
+	static void FftTransform(ulong Output[][FFT_GFBITS], const ulong Input[][FFT_GFBITS]);
+
+	static void FftButterflies(ulong Output[][FFT_GFBITS], const ulong Input[][FFT_GFBITS]);
+
+	static void FftPowers(ulong Output[][FFT_GFBITS]);
+
+	static void FftRadixConversions(ulong Input[][FFT_GFBITS]);
+
+	// fft_tr.c //
+
+	static void FftTransposed(ulong Output[][FFT_GFBITS], ulong Input[][FFT_GFBITS]);
+
+	static void FftTrButterflies(ulong Output[][FFT_GFBITS], ulong Input[][FFT_GFBITS]);
+
+	static void FftTrRadixConversions(ulong Output[][FFT_GFBITS]);
+
+	// gf.c //
+
+	static void GfInvert(ulong* Output, const ulong* Input);
+
+	static void GfMultiply(ulong* Output, const ulong* A, const ulong* B);
+
+	static void GfSquare(ulong* Output, const ulong* Input);
+
 	// controlbits.c //
 
 	static void Compose(uint W, uint N, const uint* Pi, uint* P);
@@ -78,6 +126,22 @@ public:
 
 	static void Sort63b(uint N, ulong* X);
 
+	// pk_gen.c //
+
+	static int32_t GaussEliminate(ulong* Matrix, size_t Rows, size_t RowWords);
+
+	static void GaussUpdate(ulong* Matrix, size_t Rows, size_t RowWords, size_t Pivot, size_t Count, const ulong* Search, const ulong* Eliminate, size_t Start, size_t End);
+
+	static void XorMasked(ulong* Output, const ulong* Input, ulong Mask, size_t Start, size_t End);
+
+#if defined(CEX_KERNEL_SIMD256)
+	static void XorMaskedV4(ulong* Output, const ulong* Input, ulong Mask, size_t Start, size_t End);
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	static void XorMaskedV8(ulong* Output, const ulong* Input, ulong Mask, size_t Start, size_t End);
+#endif
+
 	// transpose.c //
 
 	static void Transpose64x64(ulong* Output, const ulong* Input);
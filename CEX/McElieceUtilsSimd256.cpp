@@ -0,0 +1,49 @@
+#include "McElieceUtils.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "McElieceUtilsSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_MCELIECE
+
+#if defined(CEX_KERNEL_SIMD256)
+
+ulong McElieceUtils::RowParityV4(const byte* Row, const byte* E, size_t Length)
+{
+	// the xor of the row and error vector products, folded into one word
+	ulong tmp[4];
+	__m256i x;
+	size_t i;
+
+	x = _mm256_setzero_si256();
+
+	for (i = 0; i + 32 <= Length; i += 32)
+	{
+		x = _mm256_xor_si256(x, _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Row + i)),
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(E + i))));
+	}
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), x);
+
+	return tmp[0] ^ tmp[1] ^ tmp[2] ^ tmp[3];
+}
+
+void McElieceUtils::XorMaskedV4(ulong* Output, const ulong* Input, ulong Mask, size_t Start, size_t End)
+{
+	const __m256i MSK = _mm256_set1_epi64x(static_cast<long long>(Mask));
+	size_t i;
+
+	for (i = Start; i < End; i += 4)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output + i), _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Output + i)),
+			_mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + i)), MSK)));
+	}
+}
+
+#endif
+
+NAMESPACE_MCELIECEEND
@@ -0,0 +1,49 @@
+#include "McElieceUtils.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD512) && !defined(__AVX512__)
+#	error "McElieceUtilsSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_MCELIECE
+
+#if defined(CEX_KERNEL_SIMD512)
+
+ulong McElieceUtils::RowParityV8(const byte* Row, const byte* E, size_t Length)
+{
+	// the xor of the row and error vector products, folded into one word
+	ulong tmp[8];
+	__m512i x;
+	size_t i;
+
+	x = _mm512_setzero_si512();
+
+	for (i = 0; i + 64 <= Length; i += 64)
+	{
+		x = _mm512_xor_si512(x, _mm512_and_si512(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(Row + i)),
+			_mm512_loadu_si512(reinterpret_cast<const __m512i*>(E + i))));
+	}
+
+	_mm512_storeu_si512(reinterpret_cast<__m512i*>(tmp), x);
+
+	return tmp[0] ^ tmp[1] ^ tmp[2] ^ tmp[3] ^ tmp[4] ^ tmp[5] ^ tmp[6] ^ tmp[7];
+}
+
+void McElieceUtils::XorMaskedV8(ulong* Output, const ulong* Input, ulong Mask, size_t Start, size_t End)
+{
+	const __m512i MSK = _mm512_set1_epi64(static_cast<long long>(Mask));
+	size_t i;
+
+	for (i = Start; i < End; i += 8)
+	{
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output + i), _mm512_xor_si512(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(Output + i)),
+			_mm512_and_si512(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + i)), MSK)));
+	}
+}
+
+#endif
+
+NAMESPACE_MCELIECEEND
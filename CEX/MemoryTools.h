@@ -592,10 +592,10 @@ public:
 	/// <param name="InOffset">The offset within the source array</param>
 	/// <param name="Output">The destination object pointer</param>
 	template <typename Object, typename Array>
-	inline static void COPY128TOOBJECT(Array &Input, size_t InOffset, const Object* Output)
+	inline static void COPY128TOOBJECT(const Array &Input, size_t InOffset, Object* Output)
 	{
 #if defined(__AVX__)
-		_mm_storeu_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Output), reinterpret_cast<__m128i*>(&Input[OutOffset])));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output), _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset])));
 #else
 		std::memcpy(Output, &Input[InOffset], 16);
 #endif
@@ -638,8 +638,8 @@ public:
 #if defined(__AVX2__)
 		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Output[OutOffset]), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input)));
 #else
-		COPY128(Input, Output, OutOffset);
-		COPY128(Input + 16, Output, OutOffset + (16 / sizeof(ArrayB::value_type)));
+		COPY128FROMOBJECT(Input, Output, OutOffset);
+		COPY128FROMOBJECT(reinterpret_cast<const byte*>(Input) + 16, Output, OutOffset + (16 / sizeof(Array::value_type)));
 #endif
 	}
 
@@ -659,8 +659,8 @@ public:
 #if defined(__AVX2__)
 		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&Input[InOffset])));
 #else
-		COPY128(Input, InOffset, Output);
-		COPY128(Input + InOffset + (16 / sizeof(ArrayB::value_type)), Output + 16);
+		COPY128TOOBJECT(Input, InOffset, Output);
+		COPY128TOOBJECT(Input, InOffset + (16 / sizeof(Array::value_type)), reinterpret_cast<byte*>(Output) + 16);
 #endif
 	}
 
@@ -702,8 +702,8 @@ public:
 #if defined(__AVX512__)
 		_mm512_storeu_si512(reinterpret_cast<__m512i*>(&Output[OutOffset]), _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input)));
 #else
-		COPY256(Input, Output, OutOffset);
-		COPY256(Input + 32, Output, OutOffset + (32 / sizeof(Array::value_type)));
+		COPY256FROMOBJECT(Input, Output, OutOffset);
+		COPY256FROMOBJECT(reinterpret_cast<const byte*>(Input) + 32, Output, OutOffset + (32 / sizeof(Array::value_type)));
 #endif
 	}
 
@@ -721,10 +721,10 @@ public:
 	inline static void COPY512TOOBJECT(const Array &Input, size_t InOffset, Object* Output)
 	{
 #if defined(__AVX512__)
-		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output), _mm512_loadu_si512(reinterpret_cast<const __m512i*>(&Input[OutOffset])));
+		_mm512_storeu_si512(reinterpret_cast<__m512i*>(Output), _mm512_loadu_si512(reinterpret_cast<const __m512i*>(&Input[InOffset])));
 #else
-		COPY256(Input, InOffset, Output);
-		COPY256(Input, InOffset + (32 / sizeof(Array::value_type)), Output + 32);
+		COPY256TOOBJECT(Input, InOffset, Output);
+		COPY256TOOBJECT(Input, InOffset + (32 / sizeof(Array::value_type)), reinterpret_cast<byte*>(Output) + 32);
 #endif
 	}
 
@@ -1090,7 +1090,7 @@ public:
 
 		if (ALNLEN != 0)
 		{
-			__m256i zmm = _mm512_set1_epi8(N);
+			__m512i zmm = _mm512_set1_epi8(N);
 
 			while (i != ALNLEN)
 			{
@@ -2,6 +2,7 @@
 #include "IntegerTools.h"
 #include "Keccak.h"
 #include "MLWEQ3329N256.h"
+#include "ParallelTools.h"
 #include "PrngFromName.h"
 #include "SymmetricKey.h"
 
@@ -12,11 +13,14 @@ using Enumeration::ErrorCodes;
 using Utility::IntegerTools;
 using Digest::Keccak;
 using Enumeration::MLWEParameterConvert;
+using Utility::ParallelTools;
 
 class ModuleLWE::MlweState
 {
 public:
 
+	MLWEQ3329N256::MlweExpandedPrivateKey PrivateExpanded;
+	MLWEQ3329N256::MlweExpandedPublicKey PublicExpanded;
 	std::vector<byte> DomainKey;
 	bool Destroyed;
 	bool Encryption;
@@ -25,6 +29,8 @@ public:
 
 	MlweState(MLWEParameters Params, bool Destroy)
 		:
+		PrivateExpanded(),
+		PublicExpanded(),
 		DomainKey(0),
 		Destroyed(Destroy),
 		Encryption(false),
@@ -35,6 +41,8 @@ public:
 
 	~MlweState()
 	{
+		MLWEQ3329N256::ClearExpanded(PrivateExpanded);
+		MLWEQ3329N256::ClearExpanded(PublicExpanded);
 		IntegerTools::Clear(DomainKey);
 		Destroyed = false;
 		Encryption = false;
@@ -250,7 +258,7 @@ bool ModuleLWE::Decapsulate(const std::vector<byte> &CipherText, std::vector<byt
 		}
 	}
 
-	result = MLWEQ3329N256::Decapsulate(sec, CipherText, m_privateKey->Polynomial());
+	result = MLWEQ3329N256::Decapsulate(sec, CipherText, m_mlweState->PrivateExpanded);
 
 	if (m_mlweState->DomainKey.size() != 0)
 	{
@@ -265,6 +273,80 @@ bool ModuleLWE::Decapsulate(const std::vector<byte> &CipherText, std::vector<byt
 	return result;
 }
 
+bool ModuleLWE::Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
+{
+	CEXASSERT(m_mlweState->Initialized, "The cipher has not been initialized");
+
+	if (Count == 0)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Decapsulate"), std::string("The batch count can not be zero!"), ErrorCodes::InvalidParam);
+	}
+
+	const size_t CPTLEN = CipherTextSize();
+	const size_t SECLEN = (m_mlweState->DomainKey.size() != 0) ? SharedSecret.size() / Count : SECRET_SIZE;
+
+	if (CipherText.size() != Count * CPTLEN)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Decapsulate"), std::string("The cipher-text array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+	if (SECLEN == 0 || SECLEN > 256 || (m_mlweState->DomainKey.size() != 0 && (SharedSecret.size() % Count) != 0))
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Decapsulate"), std::string("The shared secret array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	const size_t THDCNT = IntegerTools::Min(IntegerTools::Max(ParallelTools::ProcessorCount(), static_cast<size_t>(1)), Count);
+	const size_t CNKLEN = (Count + THDCNT - 1) / THDCNT;
+	std::vector<byte> sec(Count * SECRET_SIZE);
+	std::vector<byte> status(THDCNT, 0);
+	std::vector<byte> tmpk(SECRET_SIZE);
+	std::vector<byte> tmps(SECLEN);
+	size_t i;
+	bool result;
+
+	// each thread decapsulates a contiguous range of cipher-texts with the cached private key
+	ParallelTools::ParallelFor(0, THDCNT, [this, &CipherText, &sec, &status, Count, CNKLEN](size_t i)
+	{
+		const size_t OFT = i * CNKLEN;
+
+		if (OFT < Count)
+		{
+			status[i] = MLWEQ3329N256::Decapsulate(sec, CipherText, m_mlweState->PrivateExpanded, OFT, IntegerTools::Min(CNKLEN, Count - OFT)) ? 1 : 0;
+		}
+		else
+		{
+			status[i] = 1;
+		}
+	});
+
+	if (m_mlweState->DomainKey.size() != 0)
+	{
+		for (i = 0; i < Count; ++i)
+		{
+			MemoryTools::Copy(sec, i * SECRET_SIZE, tmpk, 0, SECRET_SIZE);
+			CXOF(m_mlweState->DomainKey, tmpk, tmps, Keccak::KECCAK512_RATE_SIZE);
+			MemoryTools::Copy(tmps, 0, SharedSecret, i * SECLEN, SECLEN);
+		}
+
+		IntegerTools::Clear(tmpk);
+		IntegerTools::Clear(tmps);
+	}
+	else
+	{
+		SharedSecret.resize(sec.size());
+		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
+	}
+
+	IntegerTools::Clear(sec);
+	result = true;
+
+	for (i = 0; i < THDCNT; ++i)
+	{
+		result &= (status[i] == 1);
+	}
+
+	return result;
+}
+
 void ModuleLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
 {
 	CEXASSERT(m_mlweState->Initialized, "The cipher has not been initialized");
@@ -308,6 +390,74 @@ void ModuleLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &Sh
 	}
 }
 
+void ModuleLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
+{
+	CEXASSERT(m_mlweState->Initialized, "The cipher has not been initialized");
+
+	if (Count == 0)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The batch count can not be zero!"), ErrorCodes::InvalidParam);
+	}
+
+	const size_t CPTLEN = CipherTextSize();
+	const size_t SECLEN = (m_mlweState->DomainKey.size() != 0) ? SharedSecret.size() / Count : SECRET_SIZE;
+
+	if (SECLEN == 0 || SECLEN > 256 || (m_mlweState->DomainKey.size() != 0 && (SharedSecret.size() % Count) != 0))
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The shared secret array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	const size_t THDCNT = IntegerTools::Min(IntegerTools::Max(ParallelTools::ProcessorCount(), static_cast<size_t>(1)), Count);
+	const size_t CNKLEN = (Count + THDCNT - 1) / THDCNT;
+	std::vector<byte> sec(Count * SECRET_SIZE);
+	std::vector<byte> seeds(Count * MLWEQ3329N256::MLWE_SEED_SIZE);
+	std::vector<byte> tmpk(SECRET_SIZE);
+	std::vector<byte> tmps(SECLEN);
+	size_t i;
+
+	// the generator is not thread-safe; the seeds of the batch are drawn before the work is divided
+	m_rndGenerator->Generate(seeds, 0, seeds.size());
+
+	// expand the public matrix and key hash once, they are shared by every thread
+	if (m_mlweState->PublicExpanded.K == 0)
+	{
+		MLWEQ3329N256::ExpandPublicKey(m_mlweState->PublicExpanded, m_publicKey->Polynomial());
+	}
+
+	CipherText.resize(Count * CPTLEN);
+
+	ParallelTools::ParallelFor(0, THDCNT, [this, &CipherText, &sec, &seeds, Count, CNKLEN](size_t i)
+	{
+		const size_t OFT = i * CNKLEN;
+
+		if (OFT < Count)
+		{
+			MLWEQ3329N256::Encapsulate(sec, CipherText, m_mlweState->PublicExpanded, seeds, OFT, IntegerTools::Min(CNKLEN, Count - OFT));
+		}
+	});
+
+	if (m_mlweState->DomainKey.size() != 0)
+	{
+		for (i = 0; i < Count; ++i)
+		{
+			MemoryTools::Copy(sec, i * SECRET_SIZE, tmpk, 0, SECRET_SIZE);
+			CXOF(m_mlweState->DomainKey, tmpk, tmps, Keccak::KECCAK512_RATE_SIZE);
+			MemoryTools::Copy(tmps, 0, SharedSecret, i * SECLEN, SECLEN);
+		}
+
+		IntegerTools::Clear(tmpk);
+		IntegerTools::Clear(tmps);
+	}
+	else
+	{
+		SharedSecret.resize(sec.size());
+		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
+	}
+
+	IntegerTools::Clear(sec);
+	IntegerTools::Clear(seeds);
+}
+
 AsymmetricKeyPair* ModuleLWE::Generate()
 {
 	std::vector<byte> pk(0);
@@ -366,12 +516,22 @@ void ModuleLWE::Initialize(AsymmetricKey* Key)
 		m_publicKey = std::unique_ptr<AsymmetricKey>(Key);
 		m_mlweState->Parameters = static_cast<MLWEParameters>(m_publicKey->Parameters());
 		m_mlweState->Encryption = true;
+		// the public matrix is expanded by the first batch encapsulation
+		MLWEQ3329N256::ClearExpanded(m_mlweState->PublicExpanded);
 	}
 	else
 	{
+		if (Key->Polynomial().size() != MLWEQ3329N256::PRIVATEKEYK2_SIZE && Key->Polynomial().size() != MLWEQ3329N256::PRIVATEKEYK3_SIZE && Key->Polynomial().size() != MLWEQ3329N256::PRIVATEKEYK4_SIZE)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Initialize"), std::string("The private key size is invalid!"), ErrorCodes::InvalidKey);
+		}
+
 		m_privateKey = std::unique_ptr<AsymmetricKey>(Key);
 		m_mlweState->Parameters = static_cast<MLWEParameters>(m_privateKey->Parameters());
 		m_mlweState->Encryption = false;
+		// expand the matrix and key vectors once for all subsequent decapsulations
+		MLWEQ3329N256::ClearExpanded(m_mlweState->PrivateExpanded);
+		MLWEQ3329N256::ExpandPrivateKey(m_mlweState->PrivateExpanded, m_privateKey->Polynomial());
 	}
  
 	m_mlweState->Initialized = true;
@@ -379,7 +539,8 @@ void ModuleLWE::Initialize(AsymmetricKey* Key)
 
 void ModuleLWE::CXOF(const std::vector<byte> &Domain, const std::vector<byte> &Key, std::vector<byte> &Secret, size_t Rate)
 {
-	std::vector<byte> tmpn(Name().begin(), Name().end());
+	const std::string NAME = Name();
+	std::vector<byte> tmpn(NAME.begin(), NAME.end());
 	Keccak::CXOFR24P1600(Key, Domain, tmpn, Secret, 0, Secret.size(), Rate);
 }
 
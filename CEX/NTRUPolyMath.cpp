@@ -1,4 +1,5 @@
 #include "NTRUPolyMath.h"
+#include "CpuDetect.h"
 
 NAMESPACE_NTRUPRIME
 
@@ -325,6 +326,40 @@ void NTRUPolyMath::R3FromRq(std::vector<int8_t> &Output, const std::vector<int16
 void NTRUPolyMath::R3Mult(std::vector<int8_t> &H, const std::vector<int8_t> &F, const std::vector<int8_t> &G)
 {
 	// h = f*g in the ring R3
+#if defined(CEX_NTRUP_SCHOOLBOOK)
+	R3MultSchoolbook(H, F, G);
+#else
+	const size_t P = H.size();
+	const size_t N = KaratsubaLength(P);
+	std::vector<int16_t> f(N, 0);
+	std::vector<int16_t> g(N, 0);
+	std::vector<int16_t> fg(2 * N);
+	size_t i;
+
+	for (i = 0; i < P; ++i)
+	{
+		f[i] = F[i];
+		g[i] = G[i];
+	}
+
+	PolyMul(fg, f, g, 3);
+
+	for (i = P + P - 2; i >= P; --i)
+	{
+		fg[i - P] = F3Freeze(fg[i - P] + fg[i]);
+		fg[i - P + 1] = F3Freeze(fg[i - P + 1] + fg[i]);
+	}
+
+	for (i = 0; i < P; ++i)
+	{
+		H[i] = static_cast<int8_t>(fg[i]);
+	}
+#endif
+}
+
+void NTRUPolyMath::R3MultSchoolbook(std::vector<int8_t> &H, const std::vector<int8_t> &F, const std::vector<int8_t> &G)
+{
+	// h = f*g in the ring R3, reference form
 
 	const size_t P = H.size();
 	std::vector<int8_t> fg(P + P - 1);
@@ -382,6 +417,40 @@ void NTRUPolyMath::RqMult3(std::vector<int16_t> &H, const std::vector<int16_t> &
 void NTRUPolyMath::RqMultSmall(std::vector<int16_t> &H, const std::vector<int16_t> &F, const std::vector<int8_t> &G, int32_t Q)
 {
 	// h = f*g in the ring Rq
+#if defined(CEX_NTRUP_SCHOOLBOOK)
+	RqMultSmallSchoolbook(H, F, G, Q);
+#else
+	const size_t P = H.size();
+	const size_t N = KaratsubaLength(P);
+	std::vector<int16_t> f(N, 0);
+	std::vector<int16_t> g(N, 0);
+	std::vector<int16_t> fg(2 * N);
+	size_t i;
+
+	for (i = 0; i < P; ++i)
+	{
+		f[i] = F[i];
+		g[i] = G[i];
+	}
+
+	PolyMul(fg, f, g, Q);
+
+	for (i = P + P - 2; i >= P; --i)
+	{
+		fg[i - P] = FqFreeze(fg[i - P] + fg[i], Q);
+		fg[i - P + 1] = FqFreeze(fg[i - P + 1] + fg[i], Q);
+	}
+
+	for (i = 0; i < P; ++i)
+	{
+		H[i] = fg[i];
+	}
+#endif
+}
+
+void NTRUPolyMath::RqMultSmallSchoolbook(std::vector<int16_t> &H, const std::vector<int16_t> &F, const std::vector<int8_t> &G, int32_t Q)
+{
+	// h = f*g in the ring Rq, reference form
 	const size_t P = H.size();
 	std::vector<int16_t> fg(P + P - 1);
 	size_t i;
@@ -752,4 +821,123 @@ int32_t NTRUPolyMath::WeightWMask(std::vector<int8_t> &R, int32_t W)
 	return I16NonZeroMask(weight - W);
 }
 
+//~~~Private Functions~~~//
+
+int16_t NTRUPolyMath::FqBarrett(int32_t X, int32_t Q, int64_t V)
+{
+	// centered x mod q for any 32-bit x; V is round(2^32 / q)
+	const int32_t Q12 = ((Q - 1) / 2);
+	int32_t r;
+
+	// the quotient is within one of the nearest integer to x/q
+	r = X - (static_cast<int32_t>(((X * V) + 0x80000000LL) >> 32) * Q);
+	// constant-time corrections into [-(q-1)/2, (q-1)/2]
+	r -= Q & ((Q12 - r) >> 31);
+	r += Q & ((r + Q12) >> 31);
+
+	return static_cast<int16_t>(r);
+}
+
+size_t NTRUPolyMath::KaratsubaLength(size_t P)
+{
+	// the padded length splits evenly down to a kernel aligned to the vector width
+	const size_t SPLITS = static_cast<size_t>(1) << KARATSUBA_DEPTH;
+	size_t klen;
+
+	klen = (P + SPLITS - 1) / SPLITS;
+	klen = ((klen + KERNEL_ALIGNMENT - 1) / KERNEL_ALIGNMENT) * KERNEL_ALIGNMENT;
+
+	return klen * SPLITS;
+}
+
+void NTRUPolyMath::PolyMul(std::vector<int16_t> &R, std::vector<int16_t> &A, std::vector<int16_t> &B, int32_t Q)
+{
+	// r = a*b with centered coefficients mod q, a and b are zero padded to KaratsubaLength
+	const int64_t V = ((0x100000000LL + (Q / 2)) / Q);
+	size_t i;
+
+	// bound the inputs so the kernel accumulators can not overflow
+	for (i = 0; i < A.size(); ++i)
+	{
+		A[i] = FqBarrett(A[i], Q, V);
+		B[i] = FqBarrett(B[i], Q, V);
+	}
+
+	PolyMulKaratsuba(R, 0, A, 0, B, 0, A.size(), KARATSUBA_DEPTH, Q, V);
+}
+
+void NTRUPolyMath::PolyMulKaratsuba(std::vector<int16_t> &R, size_t ROffset, const std::vector<int16_t> &A, size_t AOffset, const std::vector<int16_t> &B, size_t BOffset, size_t Length, size_t Depth, int32_t Q, int64_t V)
+{
+	// r = a*b in 2*length coefficients, using a0b0, a1b1, and (a0+a1)(b0+b1)
+	const size_t HLEN = Length / 2;
+	std::vector<int16_t> asum(0);
+	std::vector<int16_t> bsum(0);
+	std::vector<int16_t> mid(0);
+	size_t i;
+
+	if (Depth == 0)
+	{
+		PolyMulKernel(R, ROffset, A, AOffset, B, BOffset, Length, Q, V);
+	}
+	else
+	{
+		asum.resize(HLEN);
+		bsum.resize(HLEN);
+		mid.resize(Length);
+
+		for (i = 0; i < HLEN; ++i)
+		{
+			asum[i] = FqBarrett(A[AOffset + i] + A[AOffset + HLEN + i], Q, V);
+			bsum[i] = FqBarrett(B[BOffset + i] + B[BOffset + HLEN + i], Q, V);
+		}
+
+		PolyMulKaratsuba(R, ROffset, A, AOffset, B, BOffset, HLEN, Depth - 1, Q, V);
+		PolyMulKaratsuba(R, ROffset + Length, A, AOffset + HLEN, B, BOffset + HLEN, HLEN, Depth - 1, Q, V);
+		PolyMulKaratsuba(mid, 0, asum, 0, bsum, 0, HLEN, Depth - 1, Q, V);
+
+		for (i = 0; i < Length; ++i)
+		{
+			mid[i] = FqBarrett(mid[i] - R[ROffset + i] - R[ROffset + Length + i], Q, V);
+		}
+
+		for (i = 0; i < Length; ++i)
+		{
+			R[ROffset + HLEN + i] = FqBarrett(R[ROffset + HLEN + i] + mid[i], Q, V);
+		}
+	}
+}
+
+void NTRUPolyMath::PolyMulKernel(std::vector<int16_t> &R, size_t ROffset, const std::vector<int16_t> &A, size_t AOffset, const std::vector<int16_t> &B, size_t BOffset, size_t Length, int32_t Q, int64_t V)
+{
+	// schoolbook r = a*b with lazy reduction; the inputs are centered mod q,
+	// so each 32-bit accumulator sums at most length products of (q-1)^2/4
+	std::vector<int32_t> acc(2 * Length, 0);
+	size_t i;
+	size_t j;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		PolyMulKernelV(acc.data(), A.data() + AOffset, B.data() + BOffset, Length);
+	}
+	else
+#endif
+	{
+		for (i = 0; i < Length; ++i)
+		{
+			for (j = 0; j < Length; ++j)
+			{
+				acc[i + j] += A[AOffset + i] * static_cast<int32_t>(B[BOffset + j]);
+			}
+		}
+	}
+
+	for (i = 0; i < 2 * Length; ++i)
+	{
+		R[ROffset + i] = FqBarrett(acc[i], Q, V);
+	}
+}
+
 NAMESPACE_NTRUPRIMEEND
@@ -35,6 +35,22 @@ using Utility::MemoryTools;
 /// </summary>
 class NTRUPolyMath
 {
+private:
+
+	// the number of karatsuba levels above the schoolbook kernel
+	static const size_t KARATSUBA_DEPTH = 3;
+	// the kernel length is a multiple of the 16 x 16-bit lanes in an AVX2 register
+	static const size_t KERNEL_ALIGNMENT = 16;
+
+	static int16_t FqBarrett(int32_t X, int32_t Q, int64_t V);
+	static size_t KaratsubaLength(size_t P);
+	static void PolyMul(std::vector<int16_t> &R, std::vector<int16_t> &A, std::vector<int16_t> &B, int32_t Q);
+	static void PolyMulKaratsuba(std::vector<int16_t> &R, size_t ROffset, const std::vector<int16_t> &A, size_t AOffset, const std::vector<int16_t> &B, size_t BOffset, size_t Length, size_t Depth, int32_t Q, int64_t V);
+	static void PolyMulKernel(std::vector<int16_t> &R, size_t ROffset, const std::vector<int16_t> &A, size_t AOffset, const std::vector<int16_t> &B, size_t BOffset, size_t Length, int32_t Q, int64_t V);
+#if defined(CEX_KERNEL_SIMD256)
+	static void PolyMulKernelV(int32_t* Acc, const int16_t* A, const int16_t* B, size_t Length);
+#endif
+
 public:
 
 	//~~~Inline~~~//
@@ -201,8 +217,10 @@ public:
 	static int R3Recip(std::vector<int8_t> &Output, const std::vector<int8_t> &Input);
 	static void R3FromRq(std::vector<int8_t> &Output, const std::vector<int16_t> &R);
 	static void R3Mult(std::vector<int8_t> &H, const std::vector<int8_t> &F, const std::vector<int8_t> &G);
+	static void R3MultSchoolbook(std::vector<int8_t> &H, const std::vector<int8_t> &F, const std::vector<int8_t> &G);
 	static void RqMult3(std::vector<int16_t> &H, const std::vector<int16_t> &F, int32_t Q);
 	static void RqMultSmall(std::vector<int16_t> &H, const std::vector<int16_t> &F, const std::vector<int8_t> &G, int32_t Q);
+	static void RqMultSmallSchoolbook(std::vector<int16_t> &H, const std::vector<int16_t> &F, const std::vector<int8_t> &G, int32_t Q);
 	static void Round(std::vector<int16_t> &Output, const std::vector<int16_t> &A);
 	static void RoundedDecode(std::vector<int16_t> &R, const std::vector<byte> &S, int32_t Q);
 	static void RoundedEncode(std::vector<byte> &S, const std::vector<int16_t> &R, int32_t Q);
@@ -0,0 +1,57 @@
+#include "NTRUPolyMath.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "NTRUPolyMathSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_NTRUPRIME
+
+#if defined(CEX_KERNEL_SIMD256)
+
+void NTRUPolyMath::PolyMulKernelV(int32_t* Acc, const int16_t* A, const int16_t* B, size_t Length)
+{
+	// pairs (b[s], b[s-1]) offset by length, so the sliding window reads zeros outside b
+	std::vector<uint> bp((3 * Length) + 8, 0);
+	std::vector<uint> ap(Length / 2);
+	__m256i sum;
+	size_t i;
+	size_t j;
+	size_t jmin;
+	size_t jmax;
+	size_t k;
+
+	for (i = 0; i <= Length; ++i)
+	{
+		bp[Length + i] = (i < Length) ? static_cast<ushort>(B[i]) : 0;
+		bp[Length + i] |= (i > 0) ? static_cast<uint>(static_cast<ushort>(B[i - 1])) << 16 : 0;
+	}
+
+	for (i = 0; i < Length / 2; ++i)
+	{
+		ap[i] = static_cast<ushort>(A[2 * i]) | (static_cast<uint>(static_cast<ushort>(A[(2 * i) + 1])) << 16);
+	}
+
+	// each lane k accumulates a[j]b[k-j] + a[j+1]b[k-j-1] over the even j that reach it
+	for (k = 0; k < 2 * Length; k += 8)
+	{
+		sum = _mm256_setzero_si256();
+		jmin = (k > Length) ? (k - Length) & ~static_cast<size_t>(1) : 0;
+		jmax = (k + 8 < Length) ? k + 8 : Length;
+
+		for (j = jmin; j < jmax; j += 2)
+		{
+			sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_set1_epi32(static_cast<int32_t>(ap[j / 2])),
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bp.data() + Length + k - j))));
+		}
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Acc + k), sum);
+	}
+}
+
+#endif
+
+NAMESPACE_NTRUPRIMEEND
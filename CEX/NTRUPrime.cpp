@@ -5,6 +5,7 @@
 #include "NTRUSQ5167P857.h"
 #include "PrngFromName.h"
 #include "Keccak.h"
+#include "KemBatch.h"
 #include "SymmetricKey.h"
 
 NAMESPACE_NTRUPRIME
@@ -277,48 +278,24 @@ bool NTRUPrime::Decapsulate(const std::vector<byte> &CipherText, std::vector<byt
 	return result;
 }
 
-void NTRUPrime::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
+bool NTRUPrime::Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
 {
 	CEXASSERT(m_ntruState->Initialized, "The cipher has not been initialized");
-	CEXASSERT(SharedSecret.size() <= 256, "The shared secret size is too large");
 
-	std::vector<byte> sec(SECRET_SIZE);
+	return KemBatch::Decapsulate(Name(), CipherText, SharedSecret, Count, CipherTextSize(), SECRET_SIZE, m_ntruState->DomainKey.size() != 0,
+		[this](const std::vector<byte> &Input, std::vector<byte> &Secret) { return Decapsulate(Input, Secret); });
+}
+void NTRUPrime::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
+{
+	Encapsulate(CipherText, SharedSecret, m_rndGenerator);
+}
 
-	switch (m_ntruState->Parameters)
-	{
-		case NTRUParameters::NTRUS1SQ4621N653:
-		{
-			CipherText.resize(NTRUSQ4621P653::CIPHERTEXT_SIZE);
-			NTRUSQ4621P653::Encapsulate(sec, CipherText, m_publicKey->Polynomial(), m_rndGenerator);
-			break;
-		}
-		case NTRUParameters::NTRUS2SQ4591N761:
-		{
-			CipherText.resize(NTRUSQ4591P761::CIPHERTEXT_SIZE);
-			NTRUSQ4591P761::Encapsulate(sec, CipherText, m_publicKey->Polynomial(), m_rndGenerator);
-			break;
-		}
-		case NTRUParameters::NTRUS3SQ5167N857:
-		{
-			CipherText.resize(NTRUSQ5167P857::CIPHERTEXT_SIZE);
-			NTRUSQ5167P857::Encapsulate(sec, CipherText, m_publicKey->Polynomial(), m_rndGenerator);
-			break;
-		}
-		default:
-		{
-			throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The NTRU-Prime parameter set is invalid!"), ErrorCodes::InvalidParam);
-		}
-	}
+void NTRUPrime::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
+{
+	CEXASSERT(m_ntruState->Initialized, "The cipher has not been initialized");
 
-	if (m_ntruState->DomainKey.size() != 0)
-	{
-		CXOF(m_ntruState->DomainKey, sec, SharedSecret, Keccak::KECCAK512_RATE_SIZE);
-	}
-	else
-	{
-		SharedSecret.resize(sec.size());
-		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
-	}
+	KemBatch::Encapsulate(Name(), CipherText, SharedSecret, Count, CipherTextSize(), SECRET_SIZE, m_ntruState->DomainKey.size() != 0, m_rndGenerator,
+		[this](std::vector<byte> &Output, std::vector<byte> &Secret, std::unique_ptr<IPrng> &Rng) { Encapsulate(Output, Secret, Rng); });
 }
 
 AsymmetricKeyPair* NTRUPrime::Generate()
@@ -393,8 +370,53 @@ void NTRUPrime::Initialize(AsymmetricKey* Key)
 
 void NTRUPrime::CXOF(const std::vector<byte> &Domain, const std::vector<byte> &Key, std::vector<byte> &Secret, size_t Rate)
 {
-	std::vector<byte> tmpn(Name().begin(), Name().end());
+	const std::string NAME = Name();
+	std::vector<byte> tmpn(NAME.begin(), NAME.end());
 	Keccak::CXOFR24P1600(Key, Domain, tmpn, Secret, 0, Secret.size(), Rate);
 }
 
+void NTRUPrime::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
+{
+	CEXASSERT(m_ntruState->Initialized, "The cipher has not been initialized");
+	CEXASSERT(SharedSecret.size() <= 256, "The shared secret size is too large");
+
+	std::vector<byte> sec(SECRET_SIZE);
+
+	switch (m_ntruState->Parameters)
+	{
+		case NTRUParameters::NTRUS1SQ4621N653:
+		{
+			CipherText.resize(NTRUSQ4621P653::CIPHERTEXT_SIZE);
+			NTRUSQ4621P653::Encapsulate(sec, CipherText, m_publicKey->Polynomial(), Rng);
+			break;
+		}
+		case NTRUParameters::NTRUS2SQ4591N761:
+		{
+			CipherText.resize(NTRUSQ4591P761::CIPHERTEXT_SIZE);
+			NTRUSQ4591P761::Encapsulate(sec, CipherText, m_publicKey->Polynomial(), Rng);
+			break;
+		}
+		case NTRUParameters::NTRUS3SQ5167N857:
+		{
+			CipherText.resize(NTRUSQ5167P857::CIPHERTEXT_SIZE);
+			NTRUSQ5167P857::Encapsulate(sec, CipherText, m_publicKey->Polynomial(), Rng);
+			break;
+		}
+		default:
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The NTRU-Prime parameter set is invalid!"), ErrorCodes::InvalidParam);
+		}
+	}
+
+	if (m_ntruState->DomainKey.size() != 0)
+	{
+		CXOF(m_ntruState->DomainKey, sec, SharedSecret, Keccak::KECCAK512_RATE_SIZE);
+	}
+	else
+	{
+		SharedSecret.resize(sec.size());
+		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
+	}
+}
+
 NAMESPACE_NTRUPRIMEEND
@@ -226,6 +226,21 @@ public:
 	/// <returns>Returns true if decryption is sucesssful</returns>
 	bool Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret) override;
 
+	/// <summary>
+	/// Decrypt a batch of ciphertexts and return the shared secrets.
+	/// <para>The cipher-texts are divided between the processor cores.
+	/// With a DomainKey, the shared secret array is sized by the caller and divided evenly between the Count secrets.</para>
+	/// </summary>
+	/// 
+	/// <param name="CipherText">The input cipher-texts; Count * CipherTextSize() bytes</param>
+	/// <param name="SharedSecret">The shared secret keys</param>
+	/// <param name="Count">The number of cipher-texts in the batch</param>
+	/// 
+	/// <returns>Returns true if every cipher-text was decrypted sucesssfully</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the count or the array sizes are invalid</exception>
+	bool Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count) override;
+
 	/// <summary>
 	/// Generate a shared secret and ciphertext.
 	/// </summary>
@@ -234,6 +249,19 @@ public:
 	/// <param name="SharedSecret">The shared secret key</param>
 	void Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret) override;
 
+	/// <summary>
+	/// Generate a batch of shared secrets and ciphertexts.
+	/// <para>The encapsulations are divided between the processor cores, each thread draws from its own instance of the ciphers prng type.
+	/// With a DomainKey, the shared secret array is sized by the caller and divided evenly between the Count secrets.</para>
+	/// </summary>
+	/// 
+	/// <param name="CipherText">The output cipher-texts; resized to Count * CipherTextSize() bytes</param>
+	/// <param name="SharedSecret">The shared secret keys</param>
+	/// <param name="Count">The number of secrets to generate</param>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the count or the shared secret array size is invalid</exception>
+	void Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count) override;
+
 	/// <summary>
 	/// Generate a public/private key-pair
 	/// </summary>
@@ -253,6 +281,7 @@ public:
 private:
 
 	void CXOF(const std::vector<byte> &Domain, const std::vector<byte> &Key, std::vector<byte> &Secret, size_t Rate);
+	void Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng);
 };
 
 NAMESPACE_NTRUPRIMEEND
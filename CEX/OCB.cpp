@@ -0,0 +1,865 @@
+#include "OCB.h"
+#include "BlockCipherFromName.h"
+#include "IntegerTools.h"
+#include "MemoryTools.h"
+#include "ParallelTools.h"
+
+NAMESPACE_MODE
+
+using Enumeration::BlockCipherConvert;
+using Enumeration::CipherModeConvert;
+using Utility::IntegerTools;
+using Utility::MemoryTools;
+
+class OCB::OcbState
+{
+public:
+
+	std::vector<byte> AAD;
+	SecureVector<byte> Buffer;
+	std::vector<byte> Checksum;
+	SecureVector<byte> Info;
+	SecureVector<byte> Key;
+	std::vector<byte> LDollar;
+	std::vector<byte> LStar;
+	std::vector<byte> LTable;
+	std::vector<byte> Offset;
+	std::vector<byte> Tag;
+	ulong Counter;
+	bool AutoIncrement;
+	bool Destroyed;
+	bool Encryption;
+	bool Finalized;
+	bool Initialized;
+	bool Partial;
+	bool Preserve;
+
+	OcbState(bool IsDestroyed)
+		:
+		AAD(0),
+		Buffer(0),
+		Checksum(BLOCK_SIZE, 0x00),
+		Info(0),
+		Key(0),
+		LDollar(BLOCK_SIZE, 0x00),
+		LStar(BLOCK_SIZE, 0x00),
+		LTable(LTABLE_SIZE * BLOCK_SIZE, 0x00),
+		Offset(BLOCK_SIZE, 0x00),
+		Tag(BLOCK_SIZE, 0x00),
+		Counter(0),
+		AutoIncrement(false),
+		Destroyed(IsDestroyed),
+		Encryption(false),
+		Finalized(false),
+		Initialized(false),
+		Partial(false),
+		Preserve(false)
+	{
+	}
+
+	~OcbState()
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		MemoryTools::Clear(AAD, 0, AAD.size());
+		MemoryTools::Clear(Buffer, 0, Buffer.size());
+		MemoryTools::Clear(Checksum, 0, Checksum.size());
+		MemoryTools::Clear(Info, 0, Info.size());
+		MemoryTools::Clear(Key, 0, Key.size());
+		MemoryTools::Clear(LDollar, 0, LDollar.size());
+		MemoryTools::Clear(LStar, 0, LStar.size());
+		MemoryTools::Clear(LTable, 0, LTable.size());
+		MemoryTools::Clear(Offset, 0, Offset.size());
+		MemoryTools::Clear(Tag, 0, Tag.size());
+		Counter = 0;
+		AutoIncrement = false;
+		Destroyed = false;
+		Encryption = false;
+		Finalized = false;
+		Initialized = false;
+		Partial = false;
+		Preserve = false;
+	}
+};
+
+//~~~Constructor~~~//
+
+OCB::OCB(BlockCiphers CipherType)
+	:
+	m_ocbState(new OcbState(true)),
+	m_blockCipher(CipherType != BlockCiphers::None ? Helper::BlockCipherFromName::GetInstance(CipherType) :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::OCB), std::string("Constructor"), std::string("The block cipher type can nor be None!"), ErrorCodes::InvalidParam)),
+	m_cipherInverse(nullptr),
+	m_legalKeySizes(CalculateKeySizes(m_blockCipher->LegalKeySizes())),
+	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
+{
+}
+
+OCB::OCB(IBlockCipher* Cipher)
+	:
+	m_ocbState(new OcbState(false)),
+	m_blockCipher(Cipher != nullptr ? Cipher :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::OCB), std::string("Constructor"), std::string("The block cipher can nor be null!"), ErrorCodes::IllegalOperation)),
+	m_cipherInverse(nullptr),
+	m_legalKeySizes(CalculateKeySizes(m_blockCipher->LegalKeySizes())),
+	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
+{
+}
+
+OCB::~OCB()
+{
+	if (m_cipherInverse != nullptr)
+	{
+		m_cipherInverse.reset(nullptr);
+	}
+
+	if (m_ocbState->Destroyed)
+	{
+		if (m_blockCipher != nullptr)
+		{
+			m_blockCipher.reset(nullptr);
+		}
+	}
+	else
+	{
+		if (m_blockCipher != nullptr)
+		{
+			m_blockCipher.release();
+		}
+	}
+}
+
+//~~~Accessors~~~//
+
+bool &OCB::AutoIncrement()
+{
+	return m_ocbState->AutoIncrement;
+}
+
+const size_t OCB::BlockSize()
+{
+	return BLOCK_SIZE;
+}
+
+const BlockCiphers OCB::CipherType()
+{
+	return m_blockCipher->Enumeral();
+}
+
+IBlockCipher* OCB::Engine()
+{
+	return m_blockCipher.get();
+}
+
+const CipherModes OCB::Enumeral()
+{
+	return CipherModes::OCB;
+}
+
+const bool OCB::IsEncryption()
+{
+	return m_ocbState->Encryption;
+}
+
+const bool OCB::IsInitialized()
+{
+	return m_ocbState->Initialized;
+}
+
+const bool OCB::IsParallel()
+{
+	return m_parallelProfile.IsParallel();
+}
+
+const std::vector<SymmetricKeySize> &OCB::LegalKeySizes()
+{
+	return m_legalKeySizes;
+}
+
+const size_t OCB::MaxTagSize()
+{
+	return BLOCK_SIZE;
+}
+
+const size_t OCB::MinTagSize()
+{
+	return MIN_TAGSIZE;
+}
+
+const std::string OCB::Name()
+{
+	std::string tmpn;
+
+	tmpn = CipherModeConvert::ToName(Enumeral()) + std::string("-") + BlockCipherConvert::ToName(CipherType());
+
+	return tmpn;
+}
+
+const size_t OCB::ParallelBlockSize()
+{
+	return m_parallelProfile.ParallelBlockSize();
+}
+
+ParallelOptions &OCB::ParallelProfile()
+{
+	return m_parallelProfile;
+}
+
+bool &OCB::PreserveAD()
+{
+	return m_ocbState->Preserve;
+}
+
+const std::vector<byte> OCB::Tag()
+{
+	return m_ocbState->Tag;
+}
+
+//~~~Public Functions~~~//
+
+void OCB::DecryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(!IsEncryption(), "The cipher mode has been initialized for encryption!");
+	CEXASSERT(IntegerTools::Min(Input.size(), Output.size()) >= BLOCK_SIZE, "The data arrays are smaller than the the block-size!");
+
+	ProcessSequential(Input, 0, Output, 0, BLOCK_SIZE);
+}
+
+void OCB::DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(!IsEncryption(), "The cipher mode has been initialized for encryption!");
+	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= BLOCK_SIZE, "The data arrays are smaller than the the block-size!");
+
+	ProcessSequential(Input, InOffset, Output, OutOffset, BLOCK_SIZE);
+}
+
+void OCB::EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(IsEncryption(), "The cipher mode has been initialized for decryption!");
+	CEXASSERT(IntegerTools::Min(Input.size(), Output.size()) >= BLOCK_SIZE, "The data arrays are smaller than the the block-size!");
+
+	ProcessSequential(Input, 0, Output, 0, BLOCK_SIZE);
+}
+
+void OCB::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(IsEncryption(), "The cipher mode has been initialized for decryption!");
+	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= BLOCK_SIZE, "The data arrays are smaller than the the block-size!");
+
+	ProcessSequential(Input, InOffset, Output, OutOffset, BLOCK_SIZE);
+}
+
+void OCB::Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (Length < MIN_TAGSIZE || Length > BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Finalize"), std::string("The tag length must be the full MAC code size!"), ErrorCodes::InvalidSize);
+	}
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Finalize"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	Compute();
+	MemoryTools::Copy(m_ocbState->Tag, 0, Output, OutOffset, Length);
+}
+
+void OCB::Finalize(SecureVector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (Length < MIN_TAGSIZE || Length > BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Finalize"), std::string("The tag length must be the full MAC code size!"), ErrorCodes::InvalidSize);
+	}
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Finalize"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	Compute();
+	MemoryTools::Copy(m_ocbState->Tag, 0, Output, OutOffset, Length);
+}
+
+void OCB::Initialize(bool Encryption, ISymmetricKey &Parameters)
+{
+	const size_t NONLEN = Parameters.KeySizes().NonceSize();
+	size_t i;
+
+	if (!PreserveAD())
+	{
+		MemoryTools::Clear(m_ocbState->AAD, 0, m_ocbState->AAD.size());
+		m_ocbState->AAD.resize(0);
+	}
+
+	if (!AutoIncrement())
+	{
+		MemoryTools::Clear(m_ocbState->Tag, 0, m_ocbState->Tag.size());
+	}
+
+	if (NONLEN < MIN_NONCESIZE || NONLEN > MAX_NONCESIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Requires a nonce of between 1 and 15 bytes in length!"), ErrorCodes::InvalidNonce);
+	}
+
+	if (m_parallelProfile.IsParallel())
+	{
+		if (IsParallel() && ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
+		}
+		if (IsParallel() && ParallelBlockSize() % m_parallelProfile.ParallelMinimumSize() != 0)
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size must be evenly aligned to the ParallelMinimumSize!"), ErrorCodes::InvalidParam);
+		}
+	}
+
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		if (Parameters.SecureNonce() == m_ocbState->Buffer)
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The nonce can not be zeroised or repeating!"), ErrorCodes::InvalidNonce);
+		}
+		if (!m_blockCipher->IsInitialized())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
+		}
+	}
+	else
+	{
+		if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes in length!"), ErrorCodes::InvalidKey);
+		}
+
+		// the forward transform is used in both directions, for the offsets, the associated data and the tag
+		m_blockCipher->Initialize(true, Parameters);
+
+		// re-key the inverse cipher if it has been created
+		if (m_cipherInverse != nullptr)
+		{
+			m_cipherInverse->Initialize(false, Parameters);
+		}
+
+		// store the key for the inverse cipher
+		m_ocbState->Key.resize(Parameters.KeySizes().KeySize());
+		MemoryTools::Copy(Parameters.SecureKey(), 0, m_ocbState->Key, 0, m_ocbState->Key.size());
+		m_ocbState->Info.resize(Parameters.KeySizes().InfoSize());
+
+		if (m_ocbState->Info.size() != 0)
+		{
+			MemoryTools::Copy(Parameters.SecureInfo(), 0, m_ocbState->Info, 0, m_ocbState->Info.size());
+		}
+
+		// L* = E(0), L$ = double(L*), L0 = double(L$), Li = double(Li-1)
+		const std::vector<byte> ZEROES(BLOCK_SIZE, 0x00);
+		std::vector<byte> tmpl(BLOCK_SIZE);
+
+		m_blockCipher->Transform(ZEROES, 0, m_ocbState->LStar, 0);
+		Double(m_ocbState->LStar, m_ocbState->LDollar);
+		Double(m_ocbState->LDollar, tmpl);
+
+		for (i = 0; i < LTABLE_SIZE; ++i)
+		{
+			MemoryTools::COPY128(tmpl, 0, m_ocbState->LTable, i * BLOCK_SIZE);
+			Double(tmpl, tmpl);
+		}
+
+		MemoryTools::Clear(tmpl, 0, tmpl.size());
+	}
+
+	// load the state
+	m_ocbState->Encryption = Encryption;
+	m_ocbState->Buffer.resize(NONLEN);
+	MemoryTools::Copy(Parameters.SecureNonce(), 0, m_ocbState->Buffer, 0, NONLEN);
+
+	if (!Encryption && m_cipherInverse == nullptr)
+	{
+		// the message blocks are decrypted with a second instance of the cipher
+		m_cipherInverse.reset(Helper::BlockCipherFromName::GetInstance(m_blockCipher->Enumeral()));
+		SymmetricKey kp(m_ocbState->Key, m_ocbState->Buffer, m_ocbState->Info);
+		m_cipherInverse->Initialize(false, kp);
+	}
+
+	// format the nonce for a 128-bit tag: 0^7 || 0* || 1 || N
+	std::vector<byte> tmpn(BLOCK_SIZE, 0x00);
+	MemoryTools::Copy(m_ocbState->Buffer, 0, tmpn, BLOCK_SIZE - NONLEN, NONLEN);
+	tmpn[BLOCK_SIZE - NONLEN - 1] |= 0x01;
+
+	// the low 6 bits of the nonce select the starting offset from the stretched key
+	const size_t BTMLEN = tmpn[BLOCK_SIZE - 1] & 0x3F;
+	const size_t BTMBYT = BTMLEN / 8;
+	const size_t BTMBIT = BTMLEN % 8;
+	tmpn[BLOCK_SIZE - 1] &= 0xC0;
+
+	// stretch = Ktop || (Ktop[1..64] ^ Ktop[9..72])
+	std::vector<byte> tmps(BLOCK_SIZE + (BLOCK_SIZE / 2));
+	m_blockCipher->Transform(tmpn, 0, tmps, 0);
+
+	for (i = 0; i < BLOCK_SIZE / 2; ++i)
+	{
+		tmps[BLOCK_SIZE + i] = tmps[i] ^ tmps[i + 1];
+	}
+
+	// offset0 = stretch[1 + bottom..128 + bottom]
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		m_ocbState->Offset[i] = (BTMBIT == 0) ? tmps[BTMBYT + i] :
+			static_cast<byte>((tmps[BTMBYT + i] << BTMBIT) | (tmps[BTMBYT + i + 1] >> (8 - BTMBIT)));
+	}
+
+	MemoryTools::Clear(tmpn, 0, tmpn.size());
+	MemoryTools::Clear(tmps, 0, tmps.size());
+	MemoryTools::Clear(m_ocbState->Checksum, 0, m_ocbState->Checksum.size());
+	m_ocbState->Counter = 0;
+	m_ocbState->Partial = false;
+
+	// reset the initialization and finalization state
+	m_ocbState->Finalized = false;
+	m_ocbState->Initialized = true;
+}
+
+void OCB::ParallelMaxDegree(size_t Degree)
+{
+	if (Degree == 0 || Degree % 2 != 0 || Degree > m_parallelProfile.ProcessorCount())
+	{
+		throw CryptoCipherModeException(Name(), std::string("ParallelMaxDegree"), std::string("Degree setting is invalid!"), ErrorCodes::NotSupported);
+	}
+
+	m_parallelProfile.SetMaxDegree(Degree);
+}
+
+void OCB::SetAssociatedData(const std::vector<byte> &Input, size_t Offset, size_t Length)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("SetAssociatedData"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (m_ocbState->AAD.size() != 0)
+	{
+		throw CryptoCipherModeException(Name(), std::string("SetAssociatedData"), std::string("The associated data has already been set!"), ErrorCodes::IllegalOperation);
+	}
+
+	// the associated data hash is independent of the nonce, it is added to the tag when the mode is finalized
+	m_ocbState->AAD.resize(Length);
+	MemoryTools::Copy(Input, Offset, m_ocbState->AAD, 0, Length);
+	m_ocbState->Finalized = false;
+}
+
+void OCB::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the the block-size!");
+
+	if (m_ocbState->Partial && Length != 0)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("Only the last input of a message can be a partial block!"), ErrorCodes::IllegalOperation);
+	}
+
+	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
+
+	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
+	{
+		const size_t BLKCNT = Length / PRLBLK;
+
+		for (size_t i = 0; i < BLKCNT; ++i)
+		{
+			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK), PRLBLK);
+		}
+
+		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+
+		if (RMDLEN != 0)
+		{
+			const size_t BLKOFT = (PRLBLK * BLKCNT);
+			ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+		}
+	}
+	else
+	{
+		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
+	}
+
+	// a tag computed by an auto-incrementing finalize belongs to the previous message
+	m_ocbState->Finalized = false;
+}
+
+bool OCB::Verify(const std::vector<byte> &Input, size_t Offset, size_t Length)
+{
+	if (IsEncryption())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Verify"), std::string("The cipher mode has not been initialized for decryption!"), ErrorCodes::NotInitialized);
+	}
+	if (!IsInitialized() && !m_ocbState->Finalized)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Verify"), std::string("The cipher mode has not been initialized for decryption!"), ErrorCodes::NotInitialized);
+	}
+	if (Length < MIN_TAGSIZE || Length > BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Verify"), std::string("The tag length must be the full MAC code size!"), ErrorCodes::InvalidSize);
+	}
+
+	if (!m_ocbState->Finalized)
+	{
+		Compute();
+	}
+
+	return IntegerTools::Compare(m_ocbState->Tag, 0, Input, Offset, Length);
+}
+
+bool OCB::Verify(const SecureVector<byte> &Input, size_t Offset, size_t Length)
+{
+	if (IsEncryption())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Verify"), std::string("The cipher mode has not been initialized for decryption!"), ErrorCodes::NotInitialized);
+	}
+	if (!IsInitialized() && !m_ocbState->Finalized)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Verify"), std::string("The cipher mode has not been initialized for decryption!"), ErrorCodes::NotInitialized);
+	}
+	if (Length < MIN_TAGSIZE || Length > BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Verify"), std::string("The tag length must be the full MAC code size!"), ErrorCodes::InvalidSize);
+	}
+
+	if (!m_ocbState->Finalized)
+	{
+		Compute();
+	}
+
+	return IntegerTools::Compare(m_ocbState->Tag, 0, Input, Offset, Length);
+}
+
+//~~~Private Functions~~~//
+
+void OCB::Authenticate(const std::vector<byte> &Input, size_t Length, std::vector<byte> &Output)
+{
+	// hash the associated data with offsets starting from zero, and add the sum to the output
+	const size_t BLKCNT = Length / BLOCK_SIZE;
+	const size_t RMDLEN = Length - (BLKCNT * BLOCK_SIZE);
+	std::vector<byte> tmpb(BATCH_SIZE * BLOCK_SIZE);
+	std::vector<byte> tmpe(BATCH_SIZE * BLOCK_SIZE);
+	std::vector<byte> tmpo(BLOCK_SIZE, 0x00);
+	size_t bctr;
+	size_t i;
+	ulong actr;
+
+	actr = 0;
+	bctr = 0;
+
+	while (bctr != BLKCNT)
+	{
+		const size_t STGCNT = IntegerTools::Min(BLKCNT - bctr, BATCH_SIZE);
+
+		for (i = 0; i < STGCNT; ++i)
+		{
+			++actr;
+			MemoryTools::XOR128(m_ocbState->LTable, Ntz(actr) * BLOCK_SIZE, tmpo, 0);
+			MemoryTools::COPY128(Input, (bctr + i) * BLOCK_SIZE, tmpb, i * BLOCK_SIZE);
+			MemoryTools::XOR128(tmpo, 0, tmpb, i * BLOCK_SIZE);
+		}
+
+		TransformBlocks(m_blockCipher.get(), tmpb, 0, tmpe, 0, STGCNT);
+
+		for (i = 0; i < STGCNT; ++i)
+		{
+			MemoryTools::XOR128(tmpe, i * BLOCK_SIZE, Output, 0);
+		}
+
+		bctr += STGCNT;
+	}
+
+	if (RMDLEN != 0)
+	{
+		// the final partial block is padded with 10*
+		MemoryTools::XOR128(m_ocbState->LStar, 0, tmpo, 0);
+		MemoryTools::Clear(tmpb, 0, BLOCK_SIZE);
+		MemoryTools::Copy(Input, BLKCNT * BLOCK_SIZE, tmpb, 0, RMDLEN);
+		tmpb[RMDLEN] = 0x80;
+		MemoryTools::XOR128(tmpo, 0, tmpb, 0);
+		m_blockCipher->Transform(tmpb, 0, tmpe, 0);
+		MemoryTools::XOR128(tmpe, 0, Output, 0);
+	}
+
+	MemoryTools::Clear(tmpb, 0, tmpb.size());
+	MemoryTools::Clear(tmpe, 0, tmpe.size());
+	MemoryTools::Clear(tmpo, 0, tmpo.size());
+}
+
+std::vector<SymmetricKeySize> OCB::CalculateKeySizes(std::vector<SymmetricKeySize> CipherSizes)
+{
+	std::vector<SymmetricKeySize> keys(0);
+
+	// the ciphers key and info sizes, with the recommended nonce size
+	for (size_t i = 0; i < CipherSizes.size(); ++i)
+	{
+		keys.push_back(SymmetricKeySize(CipherSizes[i].KeySize(), NONCE_SIZE, CipherSizes[i].InfoSize()));
+	}
+
+	return keys;
+}
+
+void OCB::Compute()
+{
+	std::vector<byte> tmpt(BLOCK_SIZE);
+
+	// tag = E(checksum ^ offset ^ L$) ^ hash(A)
+	MemoryTools::COPY128(m_ocbState->Checksum, 0, tmpt, 0);
+	MemoryTools::XOR128(m_ocbState->Offset, 0, tmpt, 0);
+	MemoryTools::XOR128(m_ocbState->LDollar, 0, tmpt, 0);
+	m_blockCipher->Transform(tmpt, 0, m_ocbState->Tag, 0);
+	MemoryTools::Clear(tmpt, 0, tmpt.size());
+
+	if (m_ocbState->AAD.size() != 0)
+	{
+		Authenticate(m_ocbState->AAD, m_ocbState->AAD.size(), m_ocbState->Tag);
+	}
+
+	// clear if not retaining AAD
+	if (!m_ocbState->Preserve)
+	{
+		MemoryTools::Clear(m_ocbState->AAD, 0, m_ocbState->AAD.size());
+		m_ocbState->AAD.resize(0);
+	}
+
+	// reset the internal state
+	m_ocbState->Initialized = false;
+	MemoryTools::Clear(m_ocbState->Checksum, 0, m_ocbState->Checksum.size());
+	MemoryTools::Clear(m_ocbState->Offset, 0, m_ocbState->Offset.size());
+	m_ocbState->Counter = 0;
+	m_ocbState->Partial = false;
+
+	// if using auto, increment the nonce and re-initialize the mode
+	if (AutoIncrement())
+	{
+		SecureVector<byte> tmpn = m_ocbState->Buffer;
+		IntegerTools::BeIncrement8(tmpn);
+		const SecureVector<byte> ZERO(0);
+		SymmetricKey kp(ZERO, tmpn);
+		Initialize(IsEncryption(), kp);
+	}
+
+	m_ocbState->Finalized = true;
+}
+
+void OCB::Double(const std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	// multiply by x in GF(2^128), constant time
+	uint carry = IntegerTools::ShiftLeft(Input, Output);
+	Output[BLOCK_SIZE - 1] ^= static_cast<byte>(0x87 >> ((1 - carry) << 3));
+}
+
+size_t OCB::Ntz(ulong Index)
+{
+	size_t ctr;
+
+	ctr = 0;
+
+	while ((Index & 1) == 0)
+	{
+		Index >>= 1;
+		++ctr;
+	}
+
+	return ctr;
+}
+
+void OCB::ProcessBlocks(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Blocks, std::vector<byte> &Offset, std::vector<byte> &Checksum, ulong Counter)
+{
+	// Counter is the number of blocks preceding Input; Offset and Checksum are advanced past the last block
+	std::vector<byte> tmpb(BATCH_SIZE * BLOCK_SIZE);
+	std::vector<byte> tmpo(BATCH_SIZE * BLOCK_SIZE);
+	IBlockCipher* cpr = IsEncryption() ? m_blockCipher.get() : m_cipherInverse.get();
+	size_t bctr;
+	size_t i;
+
+	bctr = 0;
+
+	while (bctr != Blocks)
+	{
+		const size_t STGCNT = IntegerTools::Min(Blocks - bctr, BATCH_SIZE);
+
+		// stage the offsets and whiten the input
+		for (i = 0; i < STGCNT; ++i)
+		{
+			++Counter;
+			MemoryTools::XOR128(m_ocbState->LTable, Ntz(Counter) * BLOCK_SIZE, Offset, 0);
+			MemoryTools::COPY128(Offset, 0, tmpo, i * BLOCK_SIZE);
+			MemoryTools::COPY128(Input, InOffset + (i * BLOCK_SIZE), tmpb, i * BLOCK_SIZE);
+			MemoryTools::XOR128(Offset, 0, tmpb, i * BLOCK_SIZE);
+
+			if (IsEncryption())
+			{
+				MemoryTools::XOR128(Input, InOffset + (i * BLOCK_SIZE), Checksum, 0);
+			}
+		}
+
+		// transform the staged blocks with the widest available cipher transforms
+		TransformBlocks(cpr, tmpb, 0, Output, OutOffset, STGCNT);
+
+		for (i = 0; i < STGCNT; ++i)
+		{
+			MemoryTools::XOR128(tmpo, i * BLOCK_SIZE, Output, OutOffset + (i * BLOCK_SIZE));
+
+			if (!IsEncryption())
+			{
+				MemoryTools::XOR128(Output, OutOffset + (i * BLOCK_SIZE), Checksum, 0);
+			}
+		}
+
+		InOffset += STGCNT * BLOCK_SIZE;
+		OutOffset += STGCNT * BLOCK_SIZE;
+		bctr += STGCNT;
+	}
+
+	MemoryTools::Clear(tmpb, 0, tmpb.size());
+	MemoryTools::Clear(tmpo, 0, tmpo.size());
+}
+
+void OCB::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t THDCNT = m_parallelProfile.ParallelMaxDegree();
+	const size_t CNKLEN = Length / THDCNT;
+	const size_t CNKBLK = CNKLEN / BLOCK_SIZE;
+	const ulong CTRPOS = m_ocbState->Counter;
+	std::vector<std::vector<byte>> tmpc(THDCNT, std::vector<byte>(BLOCK_SIZE, 0x00));
+	std::vector<byte> tmpo(BLOCK_SIZE);
+
+	Utility::ParallelTools::ParallelFor(0, THDCNT, [this, &Input, InOffset, &Output, OutOffset, &tmpc, &tmpo, THDCNT, CNKLEN, CNKBLK, CTRPOS](size_t i)
+	{
+		// thread level offset, seeked to the block preceding this chunk
+		std::vector<byte> thdo(m_ocbState->Offset);
+		const ulong BLKPOS = CTRPOS + (i * CNKBLK);
+		this->Seek(thdo, CTRPOS, BLKPOS);
+		const size_t STMPOS = i * CNKLEN;
+		// process the chunk into a thread level checksum
+		this->ProcessBlocks(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKBLK, thdo, tmpc[i], BLKPOS);
+
+		// the last chunk carries the offset forward
+		if (i == THDCNT - 1)
+		{
+			MemoryTools::COPY128(thdo, 0, tmpo, 0);
+		}
+	});
+
+	// combine the partial checksums
+	for (size_t i = 0; i < THDCNT; ++i)
+	{
+		MemoryTools::XOR128(tmpc[i], 0, m_ocbState->Checksum, 0);
+	}
+
+	MemoryTools::COPY128(tmpo, 0, m_ocbState->Offset, 0);
+	m_ocbState->Counter += CNKBLK * THDCNT;
+}
+
+void OCB::ProcessPartial(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	std::vector<byte> tmpc(BLOCK_SIZE, 0x00);
+	std::vector<byte> tmpp(BLOCK_SIZE);
+
+	// offset* = offset ^ L*, pad = E(offset*)
+	MemoryTools::XOR128(m_ocbState->LStar, 0, m_ocbState->Offset, 0);
+	m_blockCipher->Transform(m_ocbState->Offset, 0, tmpp, 0);
+
+	if (IsEncryption())
+	{
+		MemoryTools::Copy(Input, InOffset, tmpc, 0, Length);
+		MemoryTools::Copy(Input, InOffset, Output, OutOffset, Length);
+		MemoryTools::XOR(tmpp, 0, Output, OutOffset, Length);
+	}
+	else
+	{
+		MemoryTools::Copy(Input, InOffset, Output, OutOffset, Length);
+		MemoryTools::XOR(tmpp, 0, Output, OutOffset, Length);
+		MemoryTools::Copy(Output, OutOffset, tmpc, 0, Length);
+	}
+
+	// checksum ^= P* || 10*
+	tmpc[Length] = 0x80;
+	MemoryTools::XOR128(tmpc, 0, m_ocbState->Checksum, 0);
+	MemoryTools::Clear(tmpc, 0, tmpc.size());
+	MemoryTools::Clear(tmpp, 0, tmpp.size());
+	m_ocbState->Partial = true;
+}
+
+void OCB::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t BLKCNT = Length / BLOCK_SIZE;
+	const size_t RMDLEN = Length - (BLKCNT * BLOCK_SIZE);
+
+	if (BLKCNT != 0)
+	{
+		ProcessBlocks(Input, InOffset, Output, OutOffset, BLKCNT, m_ocbState->Offset, m_ocbState->Checksum, m_ocbState->Counter);
+		m_ocbState->Counter += BLKCNT;
+	}
+
+	if (RMDLEN != 0)
+	{
+		const size_t BLKOFT = BLKCNT * BLOCK_SIZE;
+		ProcessPartial(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+	}
+}
+
+void OCB::Seek(std::vector<byte> &Offset, ulong Position, ulong Target)
+{
+	// the offset of block i is offset0 xored with L[j] for every bit j set in the gray code of i,
+	// so the offset is moved between two positions by the bits that differ in their gray codes
+	ulong gray;
+	size_t i;
+
+	gray = (Position ^ (Position >> 1)) ^ (Target ^ (Target >> 1));
+	i = 0;
+
+	while (gray != 0)
+	{
+		if ((gray & 1) != 0)
+		{
+			MemoryTools::XOR128(m_ocbState->LTable, i * BLOCK_SIZE, Offset, 0);
+		}
+
+		gray >>= 1;
+		++i;
+	}
+}
+
+void OCB::TransformBlocks(IBlockCipher* Cipher, const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Blocks)
+{
+	while (Blocks >= 16)
+	{
+		Cipher->Transform2048(Input, InOffset, Output, OutOffset);
+		InOffset += 16 * BLOCK_SIZE;
+		OutOffset += 16 * BLOCK_SIZE;
+		Blocks -= 16;
+	}
+
+	if (Blocks >= 8)
+	{
+		Cipher->Transform1024(Input, InOffset, Output, OutOffset);
+		InOffset += 8 * BLOCK_SIZE;
+		OutOffset += 8 * BLOCK_SIZE;
+		Blocks -= 8;
+	}
+
+	if (Blocks >= 4)
+	{
+		Cipher->Transform512(Input, InOffset, Output, OutOffset);
+		InOffset += 4 * BLOCK_SIZE;
+		OutOffset += 4 * BLOCK_SIZE;
+		Blocks -= 4;
+	}
+
+	while (Blocks != 0)
+	{
+		Cipher->Transform(Input, InOffset, Output, OutOffset);
+		InOffset += BLOCK_SIZE;
+		OutOffset += BLOCK_SIZE;
+		--Blocks;
+	}
+}
+
+NAMESPACE_MODEEND
\ No newline at end of file
@@ -214,7 +214,31 @@ void ParallelOptions::Calculate()
 
 	if (m_simdMultiply)
 	{
-#if defined(__AVX512__)
+#if defined(CEX_SIMD_DISPATCH)
+		// scale by the width of the kernels selected at run-time
+		switch (CpuDetect::SimdProfile())
+		{
+			case SimdProfiles::Simd512:
+			{
+				m_parallelMinimumSize *= 16;
+				break;
+			}
+			case SimdProfiles::Simd256:
+			{
+				m_parallelMinimumSize *= 8;
+				break;
+			}
+			case SimdProfiles::Simd128:
+			{
+				m_parallelMinimumSize *= 4;
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+#elif defined(__AVX512__)
 		m_parallelMinimumSize *= 16;
 #elif defined(__AVX2__)
 		m_parallelMinimumSize *= 8;
@@ -1,4 +1,5 @@
 #include "ParallelTools.h"
+#include "ThreadPool.h"
 
 #if defined(CEX_HAS_OPENMP)
 #	include <omp.h>
@@ -19,31 +20,12 @@ size_t ParallelTools::ProcessorCount()
 
 void ParallelTools::ParallelFor(size_t From, size_t To, const std::function<void(size_t)> &F)
 {
-#if defined(CEX_HAS_OPENMP)
-#	pragma omp parallel num_threads(static_cast<int>(To))
-	{
-		size_t i = From + static_cast<size_t>(omp_get_thread_num());
-		F(i);
-	}
-#else
-	std::vector<std::future<void>> futures;
-
-	for (size_t i = From; i < To; ++i)
-	{
-		auto fut = std::async([i, F]()
-		{
-			F(i);
-		});
-		futures.push_back(std::move(fut));
-	}
-
-	for (size_t i = 0; i < futures.size(); ++i)
-	{
-		futures[i].wait();
-	}
+	ThreadPool::Instance().ParallelFor(From, To, F);
+}
 
-	futures.clear();
-#endif
+size_t ParallelTools::ParallelWorkers()
+{
+	return ThreadPool::Instance().WorkerCount();
 }
 
 void ParallelTools::ParallelTask(const std::function<void()> &F)
@@ -32,7 +32,8 @@ class ParallelTools
 public:
 
 	/// <summary>
-	/// A multi-threaded parallel For loop
+	/// A multi-threaded parallel For loop.
+	/// <para>Indices are dispatched to the process-wide persistent work-stealing ThreadPool; no threads are created per call.</para>
 	/// </summary>
 	/// 
 	/// <param name="From">The inclusive starting position</param> 
@@ -40,6 +41,12 @@ public:
 	/// <param name="F">The function delegate</param>
 	static void ParallelFor(size_t From, size_t To, const std::function<void(size_t)> &F);
 
+	/// <summary>
+	/// Read Only: The number of persistent worker threads owned by the process-wide thread pool.
+	/// <para>The calling thread of ParallelFor also executes a share of the loop, so a loop runs on up to ParallelWorkers() + 1 threads.</para>
+	/// </summary>
+	static size_t ParallelWorkers();
+
 	/// <summary>
 	/// Execute a function on a new thread
 	/// </summary>
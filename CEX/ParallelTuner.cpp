@@ -0,0 +1,478 @@
+#include "ParallelTuner.h"
+#include "CipherModeFromName.h"
+#include "DigestFromName.h"
+#include "StreamCipherFromName.h"
+#include "SymmetricKey.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+NAMESPACE_ROOT
+
+using Enumeration::BlockCipherConvert;
+using Enumeration::CipherModeConvert;
+using Exception::CryptoException;
+using Enumeration::DigestConvert;
+using Enumeration::ErrorCodes;
+using Cipher::Block::Mode::ICipherMode;
+using Digest::IDigest;
+using Cipher::Stream::IStreamCipher;
+using Enumeration::StreamCipherConvert;
+using Cipher::SymmetricKey;
+using Cipher::SymmetricKeySize;
+
+const std::string ParallelTuner::CLASS_NAME("ParallelTuner");
+const std::string ParallelTuner::PROFILE_VARIABLE("CEX_PARALLEL_PROFILE");
+
+class ParallelTuner::TunerState
+{
+public:
+
+	struct TunerRecord
+	{
+		TunerRecord()
+			:
+			IsParallel(false),
+			MaxDegree(0),
+			ParallelBlockSize(0)
+		{
+		}
+
+		bool IsParallel;
+		size_t MaxDegree;
+		size_t ParallelBlockSize;
+	};
+
+	// the record key families
+	static const uint MODE_FAMILY = 1;
+	static const uint DIGEST_FAMILY = 2;
+	static const uint STREAM_FAMILY = 3;
+
+	std::map<uint, TunerRecord> Profiles;
+	std::mutex Lock;
+	bool Loaded;
+
+	TunerState()
+		:
+		Profiles(),
+		Lock(),
+		Loaded(false)
+	{
+	}
+
+	static uint ToKey(uint Family, byte Algorithm, byte Cipher)
+	{
+		return (Family << 16) | (static_cast<uint>(Algorithm) << 8) | static_cast<uint>(Cipher);
+	}
+
+	void Read(const std::string &FilePath, bool &Opened)
+	{
+		std::ifstream ifs(FilePath.c_str());
+		std::string line;
+
+		Opened = ifs.is_open();
+
+		while (Opened && std::getline(ifs, line))
+		{
+			std::istringstream iss(line);
+			std::string fam;
+			std::string alg;
+			std::string cpr;
+			TunerRecord rec;
+			uint key;
+			int prl;
+
+			if (!(iss >> fam) || fam[0] == '#')
+			{
+				continue;
+			}
+
+			key = 0;
+			prl = -1;
+
+			if (fam == std::string("mode"))
+			{
+				iss >> alg >> cpr;
+				const CipherModes MODE = CipherModeConvert::FromName(alg);
+				const BlockCiphers CIPHER = BlockCipherConvert::FromName(cpr);
+
+				if (MODE != CipherModes::None && CIPHER != BlockCiphers::None)
+				{
+					key = ToKey(MODE_FAMILY, static_cast<byte>(MODE), static_cast<byte>(CIPHER));
+				}
+			}
+			else if (fam == std::string("digest"))
+			{
+				iss >> alg;
+				const Digests DIGEST = DigestConvert::FromName(alg);
+
+				if (DIGEST != Digests::None)
+				{
+					key = ToKey(DIGEST_FAMILY, static_cast<byte>(DIGEST), 0);
+				}
+			}
+			else if (fam == std::string("stream"))
+			{
+				iss >> alg;
+				const StreamCiphers STREAM = StreamCipherConvert::FromName(alg);
+
+				if (STREAM != StreamCiphers::None)
+				{
+					key = ToKey(STREAM_FAMILY, static_cast<byte>(STREAM), 0);
+				}
+			}
+
+			if (!(iss >> prl >> rec.ParallelBlockSize >> rec.MaxDegree) || key == 0 || (prl != 0 && prl != 1))
+			{
+				throw CryptoProcessingException(CLASS_NAME, std::string("Load"), std::string("The profile file contains a malformed entry!"), ErrorCodes::InvalidParam);
+			}
+
+			rec.IsParallel = (prl == 1);
+			Profiles[key] = rec;
+		}
+	}
+};
+
+//~~~Public Functions~~~//
+
+bool ParallelTuner::Apply(CipherModes ModeType, BlockCiphers CipherType, ParallelOptions &Options)
+{
+	return Apply(TunerState::ToKey(TunerState::MODE_FAMILY, static_cast<byte>(ModeType), static_cast<byte>(CipherType)), false, Options);
+}
+
+bool ParallelTuner::Apply(Digests DigestType, ParallelOptions &Options)
+{
+	return Apply(TunerState::ToKey(TunerState::DIGEST_FAMILY, static_cast<byte>(DigestType), 0), true, Options);
+}
+
+bool ParallelTuner::Apply(StreamCiphers CipherType, ParallelOptions &Options)
+{
+	return Apply(TunerState::ToKey(TunerState::STREAM_FAMILY, static_cast<byte>(CipherType), 0), false, Options);
+}
+
+void ParallelTuner::Calibrate(CipherModes ModeType, BlockCiphers CipherType, size_t SampleSize)
+{
+	if (ModeType != CipherModes::CBC && ModeType != CipherModes::CFB && ModeType != CipherModes::CTR && ModeType != CipherModes::ECB && ModeType != CipherModes::ICM)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), std::string("The cipher mode does not support parallel processing!"), ErrorCodes::NotSupported);
+	}
+
+	std::unique_ptr<ICipherMode> cpr;
+
+	try
+	{
+		cpr.reset(Helper::CipherModeFromName::GetInstance(CipherType, ModeType));
+	}
+	catch (CryptoException &ex)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), ex.Message(), ex.ErrorCode());
+	}
+
+	// cbc and cfb are parallel in the decryption direction only
+	const bool ENC = (ModeType != CipherModes::CBC && ModeType != CipherModes::CFB);
+	SymmetricKeySize ks = cpr->LegalKeySizes()[0];
+	std::vector<byte> key(ks.KeySize(), 0x3C);
+	std::vector<byte> nonce(ks.NonceSize(), 0xA5);
+	std::vector<byte> smp(SampleSize, 0x5A);
+	std::vector<byte> otp(SampleSize);
+	SymmetricKey kp(key, nonce);
+
+	Select(TunerState::ToKey(TunerState::MODE_FAMILY, static_cast<byte>(ModeType), static_cast<byte>(CipherType)), cpr->ParallelProfile(), false, SampleSize,
+		[&cpr, &kp, ENC]() { cpr->Initialize(ENC, kp); },
+		[&cpr, &smp, &otp]() { cpr->Transform(smp, 0, otp, 0, smp.size()); });
+}
+
+void ParallelTuner::Calibrate(Digests DigestType, size_t SampleSize)
+{
+	std::unique_ptr<IDigest> dgt;
+
+	try
+	{
+		dgt.reset(Helper::DigestFromName::GetInstance(DigestType, true));
+	}
+	catch (CryptoException &ex)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), ex.Message(), ex.ErrorCode());
+	}
+
+	// a digest that can not run in parallel on this host has nothing to calibrate
+	if (dgt->ParallelProfile().IsParallel())
+	{
+		std::vector<byte> smp(SampleSize, 0x5A);
+		std::vector<byte> otp(dgt->DigestSize());
+
+		Select(TunerState::ToKey(TunerState::DIGEST_FAMILY, static_cast<byte>(DigestType), 0), dgt->ParallelProfile(), true, SampleSize,
+			[&dgt]() { dgt->Reset(); },
+			[&dgt, &smp, &otp]() { dgt->Update(smp, 0, smp.size()); dgt->Finalize(otp, 0); });
+	}
+}
+
+void ParallelTuner::Calibrate(StreamCiphers CipherType, size_t SampleSize)
+{
+	std::unique_ptr<IStreamCipher> cpr;
+
+	try
+	{
+		cpr.reset(Helper::StreamCipherFromName::GetInstance(CipherType));
+	}
+	catch (CryptoException &ex)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), ex.Message(), ex.ErrorCode());
+	}
+
+	SymmetricKeySize ks = cpr->LegalKeySizes()[0];
+	std::vector<byte> key(ks.KeySize(), 0x3C);
+	std::vector<byte> nonce(ks.NonceSize(), 0xA5);
+	std::vector<byte> info(ks.InfoSize(), 0x96);
+	std::vector<byte> smp(SampleSize, 0x5A);
+	std::vector<byte> otp(SampleSize);
+	SymmetricKey kp(key, nonce, info);
+
+	Select(TunerState::ToKey(TunerState::STREAM_FAMILY, static_cast<byte>(CipherType), 0), cpr->ParallelProfile(), false, SampleSize,
+		[&cpr, &kp]() { cpr->Initialize(true, kp); },
+		[&cpr, &smp, &otp]() { cpr->Transform(smp, 0, otp, 0, smp.size()); });
+}
+
+void ParallelTuner::Clear()
+{
+	TunerState &state = State();
+	std::lock_guard<std::mutex> lock(state.Lock);
+
+	state.Profiles.clear();
+}
+
+bool ParallelTuner::Load(const std::string &FilePath)
+{
+	TunerState &state = State();
+	std::lock_guard<std::mutex> lock(state.Lock);
+	bool opened;
+
+	state.Read(FilePath, opened);
+
+	return opened;
+}
+
+void ParallelTuner::Save(const std::string &FilePath)
+{
+	TunerState &state = State();
+	std::lock_guard<std::mutex> lock(state.Lock);
+	std::ofstream ofs(FilePath.c_str(), std::ofstream::out | std::ofstream::trunc);
+
+	if (!ofs.is_open())
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Save"), std::string("The profile file could not be opened for writing!"), ErrorCodes::IllegalOperation);
+	}
+
+	ofs << "# CEX parallel profile: family algorithm [cipher] parallel block-size degree" << std::endl;
+
+	for (const std::pair<const uint, TunerState::TunerRecord> &ent : state.Profiles)
+	{
+		const uint FAM = ent.first >> 16;
+		const byte ALG = static_cast<byte>(ent.first >> 8);
+		const byte CPR = static_cast<byte>(ent.first);
+
+		if (FAM == TunerState::MODE_FAMILY)
+		{
+			ofs << "mode " << CipherModeConvert::ToName(static_cast<CipherModes>(ALG)) << " " << BlockCipherConvert::ToName(static_cast<BlockCiphers>(CPR));
+		}
+		else if (FAM == TunerState::DIGEST_FAMILY)
+		{
+			ofs << "digest " << DigestConvert::ToName(static_cast<Digests>(ALG));
+		}
+		else
+		{
+			ofs << "stream " << StreamCipherConvert::ToName(static_cast<StreamCiphers>(ALG));
+		}
+
+		ofs << " " << (ent.second.IsParallel ? 1 : 0) << " " << ent.second.ParallelBlockSize << " " << ent.second.MaxDegree << std::endl;
+	}
+
+	if (!ofs.good())
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Save"), std::string("The profile file could not be written!"), ErrorCodes::IllegalOperation);
+	}
+}
+
+//~~~Private Functions~~~//
+
+bool ParallelTuner::Apply(uint Key, bool DigestMode, ParallelOptions &Options)
+{
+	TunerState &state = State();
+	TunerState::TunerRecord rec;
+	bool res;
+
+	res = false;
+
+	{
+		std::lock_guard<std::mutex> lock(state.Lock);
+
+		// the first request loads the profile file named by the environment, if any
+		if (!state.Loaded)
+		{
+			std::string pth;
+			bool opened;
+
+			state.Loaded = true;
+
+#if defined(CEX_OS_WINDOWS)
+			char* env = nullptr;
+			size_t len = 0;
+
+			if (_dupenv_s(&env, &len, PROFILE_VARIABLE.c_str()) == 0 && env != nullptr)
+			{
+				pth = env;
+				std::free(env);
+			}
+#else
+			const char* env = std::getenv(PROFILE_VARIABLE.c_str());
+
+			if (env != nullptr)
+			{
+				pth = env;
+			}
+#endif
+
+			if (!pth.empty())
+			{
+				try
+				{
+					state.Read(pth, opened);
+				}
+				catch (CryptoProcessingException&)
+				{
+					// a damaged profile falls back to the calculated defaults
+				}
+			}
+		}
+
+		std::map<uint, TunerState::TunerRecord>::const_iterator itr = state.Profiles.find(Key);
+
+		if (itr != state.Profiles.end())
+		{
+			rec = itr->second;
+			res = true;
+		}
+	}
+
+	if (res)
+	{
+		if (DigestMode)
+		{
+			// the digest degree is part of the tree configuration; only the block size is changed
+			res = Options.IsParallel() && rec.IsParallel;
+
+			if (res)
+			{
+				Options.Calculate(true, rec.ParallelBlockSize, 0);
+			}
+		}
+		else if (!rec.IsParallel)
+		{
+			Options.Calculate(false, 0, 0);
+		}
+		else
+		{
+			// a profile recorded on a larger host is ignored
+			res = (rec.MaxDegree <= Options.ProcessorCount());
+
+			if (res)
+			{
+				Options.Calculate(true, rec.ParallelBlockSize, rec.MaxDegree);
+			}
+		}
+	}
+
+	return res;
+}
+
+ulong ParallelTuner::Measure(ParallelOptions &Options, bool Parallel, size_t BlockSize, size_t Degree, const std::function<void()> &Initialize, const std::function<void()> &Process)
+{
+	ulong bst;
+	size_t i;
+
+	Options.Calculate(Parallel, BlockSize, Degree);
+	Initialize();
+	// warm the caches and thread pool
+	Process();
+	bst = ~0ULL;
+
+	for (i = 0; i < TIMED_PASSES; ++i)
+	{
+		const std::chrono::steady_clock::time_point STRT = std::chrono::steady_clock::now();
+		Process();
+		const ulong ELPS = static_cast<ulong>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - STRT).count());
+
+		if (ELPS < bst)
+		{
+			bst = ELPS;
+		}
+	}
+
+	return bst;
+}
+
+void ParallelTuner::Select(uint Key, ParallelOptions &Options, bool DigestMode, size_t SampleSize, const std::function<void()> &Initialize, const std::function<void()> &Process)
+{
+	const size_t MAXDEG = DigestMode ? Options.ParallelMaxDegree() : Options.ProcessorCount();
+	const size_t MINDEG = DigestMode ? MAXDEG : 2;
+	const size_t MAXBLK = (SampleSize < Options.ParallelMaximumSize()) ? SampleSize : Options.ParallelMaximumSize();
+	TunerState::TunerRecord bstr;
+	ulong bstt;
+	ulong tme;
+	size_t blk;
+	size_t deg;
+
+	if (SampleSize == 0 || SampleSize < Options.ParallelMinimumSize())
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), std::string("The sample size must be at least the parallel minimum size!"), ErrorCodes::InvalidSize);
+	}
+
+	bstt = ~0ULL;
+
+	// the sequential baseline; a parallel digest can not be switched off without changing its output
+	if (!DigestMode)
+	{
+		bstt = Measure(Options, false, 0, 0, Initialize, Process);
+	}
+
+	for (deg = MINDEG; deg <= MAXDEG && deg != 0; deg += 2)
+	{
+		// set the degree to obtain its minimum block size
+		Options.Calculate(true, 0, deg);
+
+		for (blk = Options.ParallelMinimumSize(); blk <= MAXBLK; blk *= 2)
+		{
+			tme = Measure(Options, true, blk, deg, Initialize, Process);
+
+			if (tme < bstt)
+			{
+				bstt = tme;
+				bstr.IsParallel = true;
+				bstr.MaxDegree = DigestMode ? 0 : deg;
+				bstr.ParallelBlockSize = blk;
+			}
+		}
+	}
+
+	// a digest with no usable candidate keeps its calculated defaults
+	if (!DigestMode || bstr.IsParallel)
+	{
+		TunerState &state = State();
+		std::lock_guard<std::mutex> lock(state.Lock);
+
+		state.Profiles[Key] = bstr;
+	}
+}
+
+ParallelTuner::TunerState &ParallelTuner::State()
+{
+	// thread-safe static initialization; shared by all instances
+	static TunerState STATE;
+
+	return STATE;
+}
+
+NAMESPACE_ROOTEND
@@ -0,0 +1,189 @@
+// The GPL version 3 License (GPLv3)
+// 
+// Copyright (c) 2019 vtdev.com
+// This file is part of the CEX Cryptographic library.
+// 
+// This program is free software : you can redistribute it and / or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CEX_PARALLELTUNER_H
+#define CEX_PARALLELTUNER_H
+
+#include "CexDomain.h"
+#include "BlockCiphers.h"
+#include "CipherModes.h"
+#include "Digests.h"
+#include "ParallelOptions.h"
+#include "StreamCiphers.h"
+#include <functional>
+
+NAMESPACE_ROOT
+
+using Enumeration::BlockCiphers;
+using Enumeration::CipherModes;
+using Enumeration::Digests;
+using Enumeration::StreamCiphers;
+
+/// <summary>
+/// The ParallelTuner class.
+/// <para>Calibrates the ParallelOptions of a cipher mode, digest, or stream cipher by measuring candidate parallel block sizes and thread counts on the host,
+/// and stores the fastest profile for each algorithm enumeral in a process-wide table.
+/// The table can be written to and read from a profile file; stored profiles are applied by the algorithms constructor.</para>
+/// </summary>
+///
+/// <example>
+/// <description>Calibrating and persisting profiles:</description>
+/// <code>
+/// ParallelTuner::Calibrate(CipherModes::CTR, BlockCiphers::AES);
+/// ParallelTuner::Calibrate(Digests::SHA512);
+/// ParallelTuner::Save("cex.profile");
+///
+/// // in a later process; or set the CEX_PARALLEL_PROFILE environment variable to the file path
+/// ParallelTuner::Load("cex.profile");
+/// CTR cpr(BlockCiphers::AES); // constructed with the calibrated block size and degree
+/// </code>
+/// </example>
+///
+/// <remarks>
+/// <para>Block cipher modes are calibrated over the parallel block size and the even thread counts up to the processor count, and against sequential processing.
+/// The thread count of a parallel digest is part of its tree configuration and changes its output, so digests are calibrated over the parallel block size only.
+/// A stored profile is applied when the algorithm is constructed; a profile whose thread count exceeds the processor count of the host is ignored.</para>
+/// <para>The profile file is a text file with one profile per line; lines beginning with # are comments.
+/// If the CEX_PARALLEL_PROFILE environment variable is set, the named file is loaded the first time a profile is requested.</para>
+/// </remarks>
+class ParallelTuner
+{
+private:
+
+	static const std::string CLASS_NAME;
+	// 4mb sample
+	static const size_t DEF_SAMPLESIZE = 4194304;
+	// the environment variable naming an automatically loaded profile file
+	static const std::string PROFILE_VARIABLE;
+	// timed passes per candidate, the best is kept
+	static const size_t TIMED_PASSES = 3;
+
+	class TunerState;
+
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	ParallelTuner() = delete;
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Apply a stored profile to a cipher modes parallel options.
+	/// <para>Called by the cipher mode constructor; returns false if no profile is stored for this mode and cipher.</para>
+	/// </summary>
+	///
+	/// <param name="ModeType">The cipher mode type enumeral</param>
+	/// <param name="CipherType">The block cipher type enumeral</param>
+	/// <param name="Options">The parallel options of the cipher mode instance</param>
+	///
+	/// <returns>Returns true if a stored profile was applied</returns>
+	static bool Apply(CipherModes ModeType, BlockCiphers CipherType, ParallelOptions &Options);
+
+	/// <summary>
+	/// Apply a stored profile to a digests parallel options.
+	/// <para>Called by the digest constructor; only the parallel block size of a digest running in parallel mode is changed.</para>
+	/// </summary>
+	///
+	/// <param name="DigestType">The digest type enumeral</param>
+	/// <param name="Options">The parallel options of the digest instance</param>
+	///
+	/// <returns>Returns true if a stored profile was applied</returns>
+	static bool Apply(Digests DigestType, ParallelOptions &Options);
+
+	/// <summary>
+	/// Apply a stored profile to a stream ciphers parallel options.
+	/// <para>Called by the stream cipher constructor; returns false if no profile is stored for this cipher.</para>
+	/// </summary>
+	///
+	/// <param name="CipherType">The stream cipher type enumeral</param>
+	/// <param name="Options">The parallel options of the stream cipher instance</param>
+	///
+	/// <returns>Returns true if a stored profile was applied</returns>
+	static bool Apply(StreamCiphers CipherType, ParallelOptions &Options);
+
+	/// <summary>
+	/// Calibrate a block cipher mode and store the fastest profile.
+	/// <para>Modes that are parallel only when decrypting (CBC and CFB) are calibrated in the decryption direction.</para>
+	/// </summary>
+	///
+	/// <param name="ModeType">The cipher mode type enumeral</param>
+	/// <param name="CipherType">The block cipher type enumeral</param>
+	/// <param name="SampleSize">The number of bytes processed by each timed pass; the largest candidate block size</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the mode or cipher type is not supported, or the sample size is too small</exception>
+	static void Calibrate(CipherModes ModeType, BlockCiphers CipherType, size_t SampleSize = DEF_SAMPLESIZE);
+
+	/// <summary>
+	/// Calibrate the parallel block size of a digest in parallel mode and store the fastest profile
+	/// </summary>
+	///
+	/// <param name="DigestType">The digest type enumeral</param>
+	/// <param name="SampleSize">The number of bytes processed by each timed pass; the largest candidate block size</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the digest type is not supported, or the sample size is too small</exception>
+	static void Calibrate(Digests DigestType, size_t SampleSize = DEF_SAMPLESIZE);
+
+	/// <summary>
+	/// Calibrate a stream cipher and store the fastest profile
+	/// </summary>
+	///
+	/// <param name="CipherType">The stream cipher type enumeral</param>
+	/// <param name="SampleSize">The number of bytes processed by each timed pass; the largest candidate block size</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the stream cipher type is not supported, or the sample size is too small</exception>
+	static void Calibrate(StreamCiphers CipherType, size_t SampleSize = DEF_SAMPLESIZE);
+
+	/// <summary>
+	/// Erase all stored profiles
+	/// </summary>
+	static void Clear();
+
+	/// <summary>
+	/// Load the profiles in a profile file, replacing stored profiles for the same algorithms
+	/// </summary>
+	///
+	/// <param name="FilePath">The full path to the profile file</param>
+	///
+	/// <returns>Returns false if the file could not be opened</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the file contains a malformed profile</exception>
+	static bool Load(const std::string &FilePath);
+
+	/// <summary>
+	/// Write all stored profiles to a profile file, replacing the file
+	/// </summary>
+	///
+	/// <param name="FilePath">The full path to the profile file</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the file can not be written</exception>
+	static void Save(const std::string &FilePath);
+
+private:
+
+	static bool Apply(uint Key, bool DigestMode, ParallelOptions &Options);
+	static ulong Measure(ParallelOptions &Options, bool Parallel, size_t BlockSize, size_t Degree, const std::function<void()> &Initialize, const std::function<void()> &Process);
+	static void Select(uint Key, ParallelOptions &Options, bool DigestMode, size_t SampleSize, const std::function<void()> &Initialize, const std::function<void()> &Process);
+	static TunerState &State();
+};
+
+NAMESPACE_ROOTEND
+#endif
@@ -1,4 +1,5 @@
 #include "Poly1305.h"
+#include "CpuDetect.h"
 #include "Donna128.h"
 #include "IntegerTools.h"
 
@@ -7,6 +8,7 @@ NAMESPACE_MAC
 using Numeric::Donna128;
 using Utility::IntegerTools;
 using Enumeration::MacConvert;
+using Enumeration::SimdProfiles;
 using Utility::MemoryTools;
 
 class Poly1305::Poly1305State
@@ -14,6 +16,7 @@ class Poly1305::Poly1305State
 public:
 
 	std::array<ulong, 8> State = { 0x00 };
+	std::array<ulong, POWER_COUNT * 5> Powers = { 0x00 };
 	std::vector<byte> Buffer;
 	size_t Position;
 
@@ -34,6 +37,7 @@ public:
 		Position = 0;
 		MemoryTools::Clear(Buffer, 0, Buffer.size());
 		MemoryTools::Clear(State, 0, State.size() * sizeof(ulong));
+		MemoryTools::Clear(Powers, 0, Powers.size() * sizeof(ulong));
 	}
 };
 
@@ -220,6 +224,11 @@ void Poly1305::Initialize(ISymmetricKey &Parameters)
 	m_poly1305State->State[6] = IntegerTools::LeBytesTo64(Parameters.Key(), 2 * sizeof(ulong));
 	m_poly1305State->State[7] = IntegerTools::LeBytesTo64(Parameters.Key(), 3 * sizeof(ulong));
 
+#if defined(CEX_KERNEL_SIMD256)
+	// r^1..r^8 in 26-bit limbs for the vectorized absorb
+	ComputePowers(m_poly1305State);
+#endif
+
 	m_isInitialized = true;
 }
 
@@ -283,6 +292,11 @@ void Poly1305::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	const ulong R2 = State->State[2];
 	const ulong S1 = R1 * (5 << 2);
 	const ulong S2 = R2 * (5 << 2);
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+	std::array<ulong, 3> acc;
+	std::array<ulong, 5> limbs;
+#endif
 	uint128_t d0;
 	uint128_t d1;
 	uint128_t d2;
@@ -292,6 +306,37 @@ void Poly1305::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	ulong h2;
 	size_t bctr;
 
+#if defined(CEX_KERNEL_SIMD256)
+	if (!IsFinal && Length >= POWER_COUNT * BLOCK_SIZE && (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512))
+	{
+		// the accumulator is carried through the vector lanes in 26-bit limbs
+		acc = { State->State[3], State->State[4], State->State[5] };
+		ToRadix26(acc, limbs);
+
+#	if defined(CEX_KERNEL_SIMD512)
+		if (SMDPRF == SimdProfiles::Simd512 && Length >= 2 * POWER_COUNT * BLOCK_SIZE)
+		{
+			const size_t VECLEN = Length - (Length % (POWER_COUNT * BLOCK_SIZE));
+			AbsorbV8(Input.data() + InOffset, VECLEN, State->Powers.data(), limbs.data());
+			InOffset += VECLEN;
+			Length -= VECLEN;
+		}
+		else
+#	endif
+		{
+			const size_t VECLEN = Length - (Length % ((POWER_COUNT / 2) * BLOCK_SIZE));
+			AbsorbV4(Input.data() + InOffset, VECLEN, State->Powers.data(), limbs.data());
+			InOffset += VECLEN;
+			Length -= VECLEN;
+		}
+
+		FromRadix26(limbs, acc);
+		State->State[3] = acc[0];
+		State->State[4] = acc[1];
+		State->State[5] = acc[2];
+	}
+#endif
+
 	bctr = Length / BLOCK_SIZE;
 	h0 = State->State[3];
 	h1 = State->State[4];
@@ -332,4 +377,106 @@ void Poly1305::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	State->State[5] = h2;
 }
 
+void Poly1305::ComputePowers(std::unique_ptr<Poly1305State> &State)
+{
+	const std::array<ulong, 3> R = { State->State[0], State->State[1], State->State[2] };
+	std::array<ulong, 5> limbs;
+	std::array<ulong, 3> rpow;
+	size_t i;
+
+	rpow = R;
+
+	for (i = 0; i < POWER_COUNT; ++i)
+	{
+		if (i != 0)
+		{
+			Multiply(rpow, R);
+		}
+
+		ToRadix26(rpow, limbs);
+		MemoryTools::Copy(limbs, 0, State->Powers, i * limbs.size(), limbs.size() * sizeof(ulong));
+	}
+}
+
+void Poly1305::FromRadix26(std::array<ulong, 5> &Limbs, std::array<ulong, 3> &Output)
+{
+	ulong c;
+	ulong t;
+
+	// carry the 26-bit limbs
+	c = Limbs[0] >> 26;
+	Limbs[0] &= 0x3FFFFFFULL;
+	Limbs[1] += c;
+	c = Limbs[1] >> 26;
+	Limbs[1] &= 0x3FFFFFFULL;
+	Limbs[2] += c;
+	c = Limbs[2] >> 26;
+	Limbs[2] &= 0x3FFFFFFULL;
+	Limbs[3] += c;
+	c = Limbs[3] >> 26;
+	Limbs[3] &= 0x3FFFFFFULL;
+	Limbs[4] += c;
+	c = Limbs[4] >> 26;
+	Limbs[4] &= 0x3FFFFFFULL;
+	Limbs[0] += c * 5;
+	c = Limbs[0] >> 26;
+	Limbs[0] &= 0x3FFFFFFULL;
+	Limbs[1] += c;
+
+	// repack as 44/44/42-bit limbs
+	t = Limbs[0] + (Limbs[1] << 26);
+	Output[0] = t & 0xFFFFFFFFFFFULL;
+	t >>= 44;
+	t += (Limbs[2] << 8) + (Limbs[3] << 34);
+	Output[1] = t & 0xFFFFFFFFFFFULL;
+	t >>= 44;
+	Output[2] = t + (Limbs[4] << 16);
+}
+
+void Poly1305::Multiply(std::array<ulong, 3> &Output, const std::array<ulong, 3> &R)
+{
+#if !defined(CEX_NATIVE_UINT128)
+	typedef Numeric::Donna128 uint128_t;
+#endif
+
+	const ulong S1 = R[1] * (5 << 2);
+	const ulong S2 = R[2] * (5 << 2);
+	uint128_t d0;
+	uint128_t d1;
+	uint128_t d2;
+	ulong c;
+	ulong h0;
+
+	d0 = (uint128_t(Output[0]) * R[0]) + (uint128_t(Output[1]) * S2) + (uint128_t(Output[2]) * S1);
+	d1 = (uint128_t(Output[0]) * R[1]) + (uint128_t(Output[1]) * R[0]) + (uint128_t(Output[2]) * S2);
+	d2 = (uint128_t(Output[0]) * R[2]) + (uint128_t(Output[1]) * R[1]) + (uint128_t(Output[2]) * R[0]);
+	c = Donna128::CarryShift(d0, 44);
+	h0 = d0 & 0xFFFFFFFFFFFULL;
+	d1 += c;
+	c = Donna128::CarryShift(d1, 44);
+	Output[1] = d1 & 0xFFFFFFFFFFFULL;
+	d2 += c;
+	c = Donna128::CarryShift(d2, 42);
+	Output[2] = d2 & 0x3FFFFFFFFFFULL;
+	h0 += c * 5;
+	c = Donna128::CarryShift(h0, 44);
+	Output[0] = h0 & 0xFFFFFFFFFFFULL;
+	Output[1] += c;
+}
+
+void Poly1305::ToRadix26(const std::array<ulong, 3> &Input, std::array<ulong, 5> &Limbs)
+{
+	ulong t;
+
+	Limbs[0] = Input[0] & 0x3FFFFFFULL;
+	t = (Input[0] >> 26) + (Input[1] << 18);
+	Limbs[1] = t & 0x3FFFFFFULL;
+	t >>= 26;
+	Limbs[2] = t & 0x3FFFFFFULL;
+	t >>= 26;
+	t += (Input[2] << 10);
+	Limbs[3] = t & 0x3FFFFFFULL;
+	Limbs[4] = t >> 26;
+}
+
 NAMESPACE_MACEND
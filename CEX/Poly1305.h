@@ -61,6 +61,8 @@ NAMESPACE_MAC
 /// <item><description>The Compute(Input, Output) method wraps the Update(Input, Offset, Length) and Finalize(Output, Offset) methods and should only be used on small to medium sized data.</description>/></item>
 /// <item><description>The Update(Input, Offset, Length) processes any length of message data, and is used in conjunction with the Finalize(Output, Offset) method, which completes processing and returns the finalized MAC code.</description>/></item>
 /// <item><description>After a finalizer call the MAC must be re-initialized with a new key.</description></item>
+/// <item><description>Large inputs are processed 4 (AVX2) or 8 (AVX512) blocks at a time in 26-bit limbs, using the powers of r computed when the key is loaded. \n
+/// The vector forms are compiled in their own translation units (Poly1305Simd256 and Poly1305Simd512), and are selected at run-time with CpuDetect::SimdProfile().</description></item>
 /// </list>
 /// 
 /// <description>Guiding Publications:</description>
@@ -75,6 +77,7 @@ private:
 	static const size_t BLOCK_SIZE = 16;
 	static const size_t POLYKEY_SIZE = 32;
 	static const size_t MINSALT_LENGTH = 0;
+	static const size_t POWER_COUNT = 8;
 
 	class Poly1305State;
 	bool m_isInitialized;
@@ -178,6 +181,18 @@ public:
 private:
 
 	static void Absorb(const std::vector<byte> &Output, size_t OutOffset, size_t Length, bool IsFinal, std::unique_ptr<Poly1305State> &State);
+	static void ComputePowers(std::unique_ptr<Poly1305State> &State);
+	static void FromRadix26(std::array<ulong, 5> &Limbs, std::array<ulong, 3> &Output);
+	static void Multiply(std::array<ulong, 3> &Output, const std::array<ulong, 3> &R);
+	static void ToRadix26(const std::array<ulong, 3> &Input, std::array<ulong, 5> &Limbs);
+
+#if defined(CEX_KERNEL_SIMD256)
+	static void AbsorbV4(const byte* Input, size_t Length, const ulong* Powers, ulong* Limbs);
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	static void AbsorbV8(const byte* Input, size_t Length, const ulong* Powers, ulong* Limbs);
+#endif
 };
 
 NAMESPACE_MACEND
@@ -0,0 +1,150 @@
+#include "Poly1305.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "Poly1305Simd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_MAC
+
+#if defined(CEX_KERNEL_SIMD256)
+
+namespace
+{
+	// h *= r in 4 lanes of 26-bit limbs, with a partial reduction; S holds 5 * R
+	void MultiplyV4(__m256i* H, const __m256i* R, const __m256i* S)
+	{
+		const __m256i MASK = _mm256_set1_epi64x(0x3FFFFFFULL);
+		__m256i c;
+		__m256i d0;
+		__m256i d1;
+		__m256i d2;
+		__m256i d3;
+		__m256i d4;
+
+		d0 = _mm256_mul_epu32(H[0], R[0]);
+		d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(H[1], S[4]));
+		d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(H[2], S[3]));
+		d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(H[3], S[2]));
+		d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(H[4], S[1]));
+		d1 = _mm256_mul_epu32(H[0], R[1]);
+		d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(H[1], R[0]));
+		d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(H[2], S[4]));
+		d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(H[3], S[3]));
+		d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(H[4], S[2]));
+		d2 = _mm256_mul_epu32(H[0], R[2]);
+		d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(H[1], R[1]));
+		d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(H[2], R[0]));
+		d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(H[3], S[4]));
+		d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(H[4], S[3]));
+		d3 = _mm256_mul_epu32(H[0], R[3]);
+		d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(H[1], R[2]));
+		d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(H[2], R[1]));
+		d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(H[3], R[0]));
+		d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(H[4], S[4]));
+		d4 = _mm256_mul_epu32(H[0], R[4]);
+		d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(H[1], R[3]));
+		d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(H[2], R[2]));
+		d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(H[3], R[1]));
+		d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(H[4], R[0]));
+
+		// partial h %= p
+		c = _mm256_srli_epi64(d0, 26);
+		d0 = _mm256_and_si256(d0, MASK);
+		d1 = _mm256_add_epi64(d1, c);
+		c = _mm256_srli_epi64(d1, 26);
+		d1 = _mm256_and_si256(d1, MASK);
+		d2 = _mm256_add_epi64(d2, c);
+		c = _mm256_srli_epi64(d2, 26);
+		d2 = _mm256_and_si256(d2, MASK);
+		d3 = _mm256_add_epi64(d3, c);
+		c = _mm256_srli_epi64(d3, 26);
+		d3 = _mm256_and_si256(d3, MASK);
+		d4 = _mm256_add_epi64(d4, c);
+		c = _mm256_srli_epi64(d4, 26);
+		d4 = _mm256_and_si256(d4, MASK);
+		d0 = _mm256_add_epi64(d0, _mm256_add_epi64(c, _mm256_slli_epi64(c, 2)));
+		c = _mm256_srli_epi64(d0, 26);
+		d0 = _mm256_and_si256(d0, MASK);
+		d1 = _mm256_add_epi64(d1, c);
+
+		H[0] = d0;
+		H[1] = d1;
+		H[2] = d2;
+		H[3] = d3;
+		H[4] = d4;
+	}
+}
+
+void Poly1305::AbsorbV4(const byte* Input, size_t Length, const ulong* Powers, ulong* Limbs)
+{
+	const __m256i HIBIT = _mm256_set1_epi64x(static_cast<ulong>(1) << 24);
+	const __m256i MASK = _mm256_set1_epi64x(0x3FFFFFFULL);
+	__m256i h[5];
+	__m256i r[5];
+	__m256i s[5];
+	ulong tmp[4];
+	__m256i A;
+	__m256i B;
+	__m256i HI;
+	__m256i LO;
+	size_t bctr;
+	size_t i;
+
+	// the accumulator is added to the first block, in the first lane; the powers are stored as r^1..r^8, 5 limbs each
+	for (i = 0; i < 5; ++i)
+	{
+		h[i] = _mm256_set_epi64x(0, 0, 0, Limbs[i]);
+		r[i] = _mm256_set1_epi64x(Powers[15 + i]);
+		s[i] = _mm256_add_epi64(r[i], _mm256_slli_epi64(r[i], 2));
+	}
+
+	bctr = Length / BLOCK_SIZE;
+
+	while (bctr != 0)
+	{
+		// transpose 4 blocks into the low and high 64-bit words of each lane
+		A = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input));
+		B = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input + (2 * BLOCK_SIZE)));
+		LO = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(A, B), 0xD8);
+		HI = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(A, B), 0xD8);
+
+		// h += m[i..i+3]
+		h[0] = _mm256_add_epi64(h[0], _mm256_and_si256(LO, MASK));
+		h[1] = _mm256_add_epi64(h[1], _mm256_and_si256(_mm256_srli_epi64(LO, 26), MASK));
+		h[2] = _mm256_add_epi64(h[2], _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(LO, 52), _mm256_slli_epi64(HI, 12)), MASK));
+		h[3] = _mm256_add_epi64(h[3], _mm256_and_si256(_mm256_srli_epi64(HI, 14), MASK));
+		h[4] = _mm256_add_epi64(h[4], _mm256_or_si256(_mm256_srli_epi64(HI, 40), HIBIT));
+
+		Input += 4 * BLOCK_SIZE;
+		bctr -= 4;
+
+		if (bctr != 0)
+		{
+			// h *= r^4
+			MultiplyV4(h, r, s);
+		}
+	}
+
+	// the lanes are multiplied by r^4, r^3, r^2, r^1 and summed
+	for (i = 0; i < 5; ++i)
+	{
+		r[i] = _mm256_set_epi64x(Powers[i], Powers[5 + i], Powers[10 + i], Powers[15 + i]);
+		s[i] = _mm256_add_epi64(r[i], _mm256_slli_epi64(r[i], 2));
+	}
+
+	MultiplyV4(h, r, s);
+
+	for (i = 0; i < 5; ++i)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), h[i]);
+		Limbs[i] = tmp[0] + tmp[1] + tmp[2] + tmp[3];
+	}
+}
+
+#endif
+
+NAMESPACE_MACEND
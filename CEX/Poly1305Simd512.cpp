@@ -0,0 +1,150 @@
+#include "Poly1305.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD512) && !defined(__AVX512__)
+#	error "Poly1305Simd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_MAC
+
+#if defined(CEX_KERNEL_SIMD512)
+
+namespace
+{
+	// h *= r in 8 lanes of 26-bit limbs, with a partial reduction; S holds 5 * R
+	void MultiplyV8(__m512i* H, const __m512i* R, const __m512i* S)
+	{
+		const __m512i MASK = _mm512_set1_epi64(0x3FFFFFFULL);
+		__m512i c;
+		__m512i d0;
+		__m512i d1;
+		__m512i d2;
+		__m512i d3;
+		__m512i d4;
+
+		d0 = _mm512_mul_epu32(H[0], R[0]);
+		d0 = _mm512_add_epi64(d0, _mm512_mul_epu32(H[1], S[4]));
+		d0 = _mm512_add_epi64(d0, _mm512_mul_epu32(H[2], S[3]));
+		d0 = _mm512_add_epi64(d0, _mm512_mul_epu32(H[3], S[2]));
+		d0 = _mm512_add_epi64(d0, _mm512_mul_epu32(H[4], S[1]));
+		d1 = _mm512_mul_epu32(H[0], R[1]);
+		d1 = _mm512_add_epi64(d1, _mm512_mul_epu32(H[1], R[0]));
+		d1 = _mm512_add_epi64(d1, _mm512_mul_epu32(H[2], S[4]));
+		d1 = _mm512_add_epi64(d1, _mm512_mul_epu32(H[3], S[3]));
+		d1 = _mm512_add_epi64(d1, _mm512_mul_epu32(H[4], S[2]));
+		d2 = _mm512_mul_epu32(H[0], R[2]);
+		d2 = _mm512_add_epi64(d2, _mm512_mul_epu32(H[1], R[1]));
+		d2 = _mm512_add_epi64(d2, _mm512_mul_epu32(H[2], R[0]));
+		d2 = _mm512_add_epi64(d2, _mm512_mul_epu32(H[3], S[4]));
+		d2 = _mm512_add_epi64(d2, _mm512_mul_epu32(H[4], S[3]));
+		d3 = _mm512_mul_epu32(H[0], R[3]);
+		d3 = _mm512_add_epi64(d3, _mm512_mul_epu32(H[1], R[2]));
+		d3 = _mm512_add_epi64(d3, _mm512_mul_epu32(H[2], R[1]));
+		d3 = _mm512_add_epi64(d3, _mm512_mul_epu32(H[3], R[0]));
+		d3 = _mm512_add_epi64(d3, _mm512_mul_epu32(H[4], S[4]));
+		d4 = _mm512_mul_epu32(H[0], R[4]);
+		d4 = _mm512_add_epi64(d4, _mm512_mul_epu32(H[1], R[3]));
+		d4 = _mm512_add_epi64(d4, _mm512_mul_epu32(H[2], R[2]));
+		d4 = _mm512_add_epi64(d4, _mm512_mul_epu32(H[3], R[1]));
+		d4 = _mm512_add_epi64(d4, _mm512_mul_epu32(H[4], R[0]));
+
+		// partial h %= p
+		c = _mm512_srli_epi64(d0, 26);
+		d0 = _mm512_and_si512(d0, MASK);
+		d1 = _mm512_add_epi64(d1, c);
+		c = _mm512_srli_epi64(d1, 26);
+		d1 = _mm512_and_si512(d1, MASK);
+		d2 = _mm512_add_epi64(d2, c);
+		c = _mm512_srli_epi64(d2, 26);
+		d2 = _mm512_and_si512(d2, MASK);
+		d3 = _mm512_add_epi64(d3, c);
+		c = _mm512_srli_epi64(d3, 26);
+		d3 = _mm512_and_si512(d3, MASK);
+		d4 = _mm512_add_epi64(d4, c);
+		c = _mm512_srli_epi64(d4, 26);
+		d4 = _mm512_and_si512(d4, MASK);
+		d0 = _mm512_add_epi64(d0, _mm512_add_epi64(c, _mm512_slli_epi64(c, 2)));
+		c = _mm512_srli_epi64(d0, 26);
+		d0 = _mm512_and_si512(d0, MASK);
+		d1 = _mm512_add_epi64(d1, c);
+
+		H[0] = d0;
+		H[1] = d1;
+		H[2] = d2;
+		H[3] = d3;
+		H[4] = d4;
+	}
+}
+
+void Poly1305::AbsorbV8(const byte* Input, size_t Length, const ulong* Powers, ulong* Limbs)
+{
+	const __m512i HIBIT = _mm512_set1_epi64(static_cast<ulong>(1) << 24);
+	const __m512i MASK = _mm512_set1_epi64(0x3FFFFFFULL);
+	const __m512i PIDX = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
+	__m512i h[5];
+	__m512i r[5];
+	__m512i s[5];
+	__m512i A;
+	__m512i B;
+	__m512i HI;
+	__m512i LO;
+	size_t bctr;
+	size_t i;
+
+	// the accumulator is added to the first block, in the first lane; the powers are stored as r^1..r^8, 5 limbs each
+	for (i = 0; i < 5; ++i)
+	{
+		h[i] = _mm512_set_epi64(0, 0, 0, 0, 0, 0, 0, Limbs[i]);
+		r[i] = _mm512_set1_epi64(Powers[35 + i]);
+		s[i] = _mm512_add_epi64(r[i], _mm512_slli_epi64(r[i], 2));
+	}
+
+	bctr = Length / BLOCK_SIZE;
+
+	while (bctr != 0)
+	{
+		// transpose 8 blocks into the low and high 64-bit words of each lane
+		A = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input));
+		B = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(Input + (4 * BLOCK_SIZE)));
+		LO = _mm512_permutexvar_epi64(PIDX, _mm512_unpacklo_epi64(A, B));
+		HI = _mm512_permutexvar_epi64(PIDX, _mm512_unpackhi_epi64(A, B));
+
+		// h += m[i..i+7]
+		h[0] = _mm512_add_epi64(h[0], _mm512_and_si512(LO, MASK));
+		h[1] = _mm512_add_epi64(h[1], _mm512_and_si512(_mm512_srli_epi64(LO, 26), MASK));
+		h[2] = _mm512_add_epi64(h[2], _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(LO, 52), _mm512_slli_epi64(HI, 12)), MASK));
+		h[3] = _mm512_add_epi64(h[3], _mm512_and_si512(_mm512_srli_epi64(HI, 14), MASK));
+		h[4] = _mm512_add_epi64(h[4], _mm512_or_si512(_mm512_srli_epi64(HI, 40), HIBIT));
+
+		Input += 8 * BLOCK_SIZE;
+		bctr -= 8;
+
+		if (bctr != 0)
+		{
+			// h *= r^8
+			MultiplyV8(h, r, s);
+		}
+	}
+
+	// the lanes are multiplied by r^8..r^1 and summed
+	for (i = 0; i < 5; ++i)
+	{
+		r[i] = _mm512_set_epi64(Powers[i], Powers[5 + i], Powers[10 + i], Powers[15 + i],
+			Powers[20 + i], Powers[25 + i], Powers[30 + i], Powers[35 + i]);
+		s[i] = _mm512_add_epi64(r[i], _mm512_slli_epi64(r[i], 2));
+	}
+
+	MultiplyV8(h, r, s);
+
+	for (i = 0; i < 5; ++i)
+	{
+		Limbs[i] = static_cast<ulong>(_mm512_reduce_add_epi64(h[i]));
+	}
+}
+
+#endif
+
+NAMESPACE_MACEND
@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MacFromName.h"
 #include "MemoryTools.h"
+#include "ParallelTuner.h"
 #include "Rijndael.h"
 #include "SHAKE.h"
 
@@ -86,6 +87,7 @@ RCS::RCS(StreamAuthenticators AuthenticatorType)
 		Helper::MacFromName::GetInstance(AuthenticatorType)),
 	m_parallelProfile(BLOCK_SIZE, true, STATE_PRECACHED, true)
 {
+	ParallelTuner::Apply(Enumeral(), m_parallelProfile);
 }
 
 RCS::~RCS()
@@ -395,7 +397,7 @@ void RCS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 
 	bctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 	const size_t AVX512BLK = 16 * BLOCK_SIZE;
 	if (Length >= AVX512BLK)
 	{
@@ -441,7 +443,7 @@ void RCS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX512BLK;
 		}
 	}
-#elif defined(__AVX2__)
+#elif defined(CEX_KERNEL_SIMD256)
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
 	if (Length >= AVX2BLK)
 	{
@@ -471,7 +473,7 @@ void RCS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			bctr += AVX2BLK;
 }
 	}
-#elif defined(__AVX__)
+#elif defined(CEX_KERNEL_SIMD128)
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
 	if (Length >= AVXBLK)
 	{
@@ -1,4 +1,5 @@
 #include "RHX.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "KdfFromName.h"
@@ -15,6 +16,9 @@ class RHX::RhxState
 {
 public:
 
+#if defined(CEX_KERNEL_SIMD128)
+	SecureVector<byte> Bitsliced;
+#endif
 	SecureVector<byte> Custom;
 	SecureVector<uint> RoundKeys;
 	size_t Rounds;
@@ -25,6 +29,9 @@ public:
 
 	RhxState(BlockCipherExtensions CipherExtension, bool IsDestroyed)
 		:
+#if defined(CEX_KERNEL_SIMD128)
+		Bitsliced(0),
+#endif
 		Custom(0),
 		RoundKeys(0),
 		Rounds(0),
@@ -37,6 +44,9 @@ public:
 
 	~RhxState()
 	{
+#if defined(CEX_KERNEL_SIMD128)
+		MemoryTools::Clear(Bitsliced, 0, Bitsliced.size());
+#endif
 		MemoryTools::Clear(Custom, 0, Custom.size());
 		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(uint));
 		Rounds = 0;
@@ -48,6 +58,9 @@ public:
 
 	void Reset()
 	{
+#if defined(CEX_KERNEL_SIMD128)
+		MemoryTools::Clear(Bitsliced, 0, Bitsliced.size());
+#endif
 		MemoryTools::Clear(Custom, 0, Custom.size());
 		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(uint));
 		Encryption = false;
@@ -268,6 +281,14 @@ void RHX::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		}
 	}
 
+#if defined(CEX_KERNEL_SIMD128)
+	if (CpuDetect::SimdProfile() != SimdProfiles::None)
+	{
+		// the bitsliced round-keys used by the parallel transforms
+		BitslicedExpand(m_rhxState->RoundKeys, m_rhxState->Bitsliced);
+	}
+#endif
+
 #if defined(CEX_PREFETCH_RHX_TABLES)
 	Prefetch(m_rhxState->Encryption);
 #endif
@@ -497,6 +518,36 @@ void RHX::ExpandSubBlock(SecureVector<uint> &RoundKeys, size_t KeyIndex, size_t
 
 //~~~Rounds Processing~~~//
 
+#if defined(CEX_KERNEL_SIMD128)
+
+void RHX::BitslicedExpand(const SecureVector<uint> &RoundKeys, SecureVector<byte> &Keys)
+{
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t r;
+	byte kb;
+
+	Keys.resize((RoundKeys.size() / 4) * BITSLICED_KEYSIZE);
+
+	// each round-key bit is spread across the eight block positions of its byte lane in bit-plane order
+	for (r = 0; r < RoundKeys.size() / 4; ++r)
+	{
+		for (j = 0; j < BLOCK_SIZE; ++j)
+		{
+			kb = static_cast<byte>(RoundKeys[(r * 4) + (j / 4)] >> (24 - (8 * (j % 4))));
+
+			for (i = 0; i < 8; ++i)
+			{
+				k = (r * BITSLICED_KEYSIZE) + (i * BLOCK_SIZE) + j;
+				Keys[k] = static_cast<byte>(0x00 - ((kb >> i) & 0x01));
+			}
+		}
+	}
+}
+
+#endif
+
 void RHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = m_rhxState->RoundKeys.size() - 4;
@@ -570,8 +621,17 @@ void RHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vecto
 
 void RHX::Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-	Decrypt512(Input, InOffset, Output, OutOffset);
-	Decrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+#if defined(CEX_KERNEL_SIMD128)
+	if (!m_rhxState->Bitsliced.empty())
+	{
+		BitslicedDecrypt(m_rhxState->Bitsliced.data(), m_rhxState->Bitsliced.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
+#endif
+	{
+		Decrypt512(Input, InOffset, Output, OutOffset);
+		Decrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+	}
 }
 
 void RHX::Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
@@ -659,8 +719,17 @@ void RHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vecto
 
 void RHX::Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-	Encrypt512(Input, InOffset, Output, OutOffset);
-	Encrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+#if defined(CEX_KERNEL_SIMD128)
+	if (!m_rhxState->Bitsliced.empty())
+	{
+		BitslicedEncrypt(m_rhxState->Bitsliced.data(), m_rhxState->Bitsliced.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
+#endif
+	{
+		Encrypt512(Input, InOffset, Output, OutOffset);
+		Encrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+	}
 }
 
 void RHX::Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
@@ -83,6 +83,8 @@ NAMESPACE_BLOCK
 /// <item><description>The Info parameter in a symmetric key container is a user-definable cipher tweak, this can be used to create a unique cipher-text output with a secondary secret.</description></item>
 /// <item><description>Extended mode is set through the constructors BlockCipherExtensions parameter to either None for standard mode, or HKDF(SHA2-256), HKDF(SHA2-512), cSHAKE256, cSHAKE512, or cSHAKE1024 for extended mode operation.</description></item>
 /// <item><description>It is recommended that in extended mode, the key expansion functions security match the key size used; ex. with a 256-bit key use SHAKE-256, or HKDF(SHA2-512) for a 512-bit key, or SHAKE-1024 for a 1024-bit input cipher-key.</description></item>
+/// <item><description>On processors with SSE4.1, the 1024 and 2048-bit parallel transforms use a constant-time bitsliced implementation that processes 8 blocks without table lookups; single block transforms use the lookup tables. \n
+/// The bitsliced kernel is compiled in its own translation unit (RHXSimd128.cpp) and is selected at run-time through CpuDetect::SimdProfile().</description></item>
 /// </list>
 ///
 /// <description>Guiding Publications:</description>
@@ -106,6 +108,8 @@ private:
 	static const size_t BLOCK_SIZE = 16;
 	static const size_t MAX_ROUNDS = 38;
 	static const size_t MIN_ROUNDS = 10;
+	// size of one round-key expanded to the bitsliced form
+	static const size_t BITSLICED_KEYSIZE = 128;
 	// size of state buffer and lookup tables subtracted from parallel size calculations
 	static const size_t STATE_PRECACHED = 5120;
 
@@ -312,6 +316,11 @@ public:
 
 private:
 
+#if defined(CEX_KERNEL_SIMD128)
+	static void BitslicedDecrypt(const byte* Keys, size_t KeySize, const byte* Input, byte* Output);
+	static void BitslicedEncrypt(const byte* Keys, size_t KeySize, const byte* Input, byte* Output);
+	static void BitslicedExpand(const SecureVector<uint> &RoundKeys, SecureVector<byte> &Keys);
+#endif
 	static std::vector<SymmetricKeySize> CalculateKeySizes(BlockCipherExtensions Extension);
 	static void ExpandRotBlock(SecureVector<uint> &RoundKeys, size_t KeyIndex, size_t KeyOffset, size_t RconIndex);
 	static void ExpandSubBlock(SecureVector<uint> &RoundKeys, size_t KeyIndex, size_t KeyOffset);
@@ -0,0 +1,384 @@
+#include "RHX.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD128) && !defined(__SSE4_1__) && !defined(CEX_COMPILER_MSC)
+#	error "RHXSimd128.cpp must be compiled with the SSE4.1 instruction set enabled (-msse4.1)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD128)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_BLOCK
+
+#if defined(CEX_KERNEL_SIMD128)
+
+namespace
+{
+	// the bitsliced round functions have internal linkage, so that no helper is shared with the baseline translation units
+
+	void BitslicedMixColumns(std::array<__m128i, 8> &State)
+	{
+		// b(r) = 2(a(r) ^ a(r+1)) ^ a(r+1) ^ a(r+2) ^ a(r+3), computed on each column
+		const __m128i ROT1MASK = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+		const __m128i ROT2MASK = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+		std::array<__m128i, 8> R;
+		std::array<__m128i, 8> T;
+		size_t i;
+
+		for (i = 0; i < 8; ++i)
+		{
+			R[i] = _mm_shuffle_epi8(State[i], ROT1MASK);
+			T[i] = _mm_xor_si128(State[i], R[i]);
+			State[i] = _mm_xor_si128(R[i], _mm_shuffle_epi8(T[i], ROT2MASK));
+		}
+
+		// multiply by x and add
+		State[0] = _mm_xor_si128(State[0], T[7]);
+		State[1] = _mm_xor_si128(State[1], _mm_xor_si128(T[0], T[7]));
+		State[2] = _mm_xor_si128(State[2], T[1]);
+		State[3] = _mm_xor_si128(State[3], _mm_xor_si128(T[2], T[7]));
+		State[4] = _mm_xor_si128(State[4], _mm_xor_si128(T[3], T[7]));
+		State[5] = _mm_xor_si128(State[5], T[4]);
+		State[6] = _mm_xor_si128(State[6], T[5]);
+		State[7] = _mm_xor_si128(State[7], T[6]);
+	}
+
+	void BitslicedInvMixColumns(std::array<__m128i, 8> &State)
+	{
+		// InvMixColumns(a) = MixColumns(a ^ 4(a ^ (a <<< 16))), computed on each column
+		const __m128i ROT2MASK = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+		std::array<__m128i, 8> T;
+		size_t i;
+
+		for (i = 0; i < 8; ++i)
+		{
+			T[i] = _mm_xor_si128(State[i], _mm_shuffle_epi8(State[i], ROT2MASK));
+		}
+
+		// multiply by x^2 and add
+		State[0] = _mm_xor_si128(State[0], T[6]);
+		State[1] = _mm_xor_si128(State[1], _mm_xor_si128(T[6], T[7]));
+		State[2] = _mm_xor_si128(State[2], _mm_xor_si128(T[0], T[7]));
+		State[3] = _mm_xor_si128(State[3], _mm_xor_si128(T[1], T[6]));
+		State[4] = _mm_xor_si128(State[4], _mm_xor_si128(T[2], _mm_xor_si128(T[6], T[7])));
+		State[5] = _mm_xor_si128(State[5], _mm_xor_si128(T[3], T[7]));
+		State[6] = _mm_xor_si128(State[6], T[4]);
+		State[7] = _mm_xor_si128(State[7], T[5]);
+
+		BitslicedMixColumns(State);
+	}
+
+	void BitslicedSubBytes(std::array<__m128i, 8> &State)
+	{
+		// the Boyar-Peralta s-box circuit; x0 is the most significant bit plane
+		const __m128i ONES = _mm_set1_epi32(-1);
+		__m128i x0, x1, x2, x3, x4, x5, x6, x7;
+		__m128i y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+		__m128i z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11, z12, z13, z14, z15, z16, z17;
+		__m128i t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+		__m128i t20, t21, t22, t23, t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+		__m128i t40, t41, t42, t43, t44, t45, t46, t47, t48, t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+		__m128i t60, t61, t62, t63, t64, t65, t66, t67;
+
+		x0 = State[7];
+		x1 = State[6];
+		x2 = State[5];
+		x3 = State[4];
+		x4 = State[3];
+		x5 = State[2];
+		x6 = State[1];
+		x7 = State[0];
+
+		// top linear transformation
+		y14 = _mm_xor_si128(x3, x5);
+		y13 = _mm_xor_si128(x0, x6);
+		y9 = _mm_xor_si128(x0, x3);
+		y8 = _mm_xor_si128(x0, x5);
+		t0 = _mm_xor_si128(x1, x2);
+		y1 = _mm_xor_si128(t0, x7);
+		y4 = _mm_xor_si128(y1, x3);
+		y12 = _mm_xor_si128(y13, y14);
+		y2 = _mm_xor_si128(y1, x0);
+		y5 = _mm_xor_si128(y1, x6);
+		y3 = _mm_xor_si128(y5, y8);
+		t1 = _mm_xor_si128(x4, y12);
+		y15 = _mm_xor_si128(t1, x5);
+		y20 = _mm_xor_si128(t1, x1);
+		y6 = _mm_xor_si128(y15, x7);
+		y10 = _mm_xor_si128(y15, t0);
+		y11 = _mm_xor_si128(y20, y9);
+		y7 = _mm_xor_si128(x7, y11);
+		y17 = _mm_xor_si128(y10, y11);
+		y19 = _mm_xor_si128(y10, y8);
+		y16 = _mm_xor_si128(t0, y11);
+		y21 = _mm_xor_si128(y13, y16);
+		y18 = _mm_xor_si128(x0, y16);
+
+		// non-linear section
+		t2 = _mm_and_si128(y12, y15);
+		t3 = _mm_and_si128(y3, y6);
+		t4 = _mm_xor_si128(t3, t2);
+		t5 = _mm_and_si128(y4, x7);
+		t6 = _mm_xor_si128(t5, t2);
+		t7 = _mm_and_si128(y13, y16);
+		t8 = _mm_and_si128(y5, y1);
+		t9 = _mm_xor_si128(t8, t7);
+		t10 = _mm_and_si128(y2, y7);
+		t11 = _mm_xor_si128(t10, t7);
+		t12 = _mm_and_si128(y9, y11);
+		t13 = _mm_and_si128(y14, y17);
+		t14 = _mm_xor_si128(t13, t12);
+		t15 = _mm_and_si128(y8, y10);
+		t16 = _mm_xor_si128(t15, t12);
+		t17 = _mm_xor_si128(t4, t14);
+		t18 = _mm_xor_si128(t6, t16);
+		t19 = _mm_xor_si128(t9, t14);
+		t20 = _mm_xor_si128(t11, t16);
+		t21 = _mm_xor_si128(t17, y20);
+		t22 = _mm_xor_si128(t18, y19);
+		t23 = _mm_xor_si128(t19, y21);
+		t24 = _mm_xor_si128(t20, y18);
+		t25 = _mm_xor_si128(t21, t22);
+		t26 = _mm_and_si128(t21, t23);
+		t27 = _mm_xor_si128(t24, t26);
+		t28 = _mm_and_si128(t25, t27);
+		t29 = _mm_xor_si128(t28, t22);
+		t30 = _mm_xor_si128(t23, t24);
+		t31 = _mm_xor_si128(t22, t26);
+		t32 = _mm_and_si128(t31, t30);
+		t33 = _mm_xor_si128(t32, t24);
+		t34 = _mm_xor_si128(t23, t33);
+		t35 = _mm_xor_si128(t27, t33);
+		t36 = _mm_and_si128(t24, t35);
+		t37 = _mm_xor_si128(t36, t34);
+		t38 = _mm_xor_si128(t27, t36);
+		t39 = _mm_and_si128(t29, t38);
+		t40 = _mm_xor_si128(t25, t39);
+		t41 = _mm_xor_si128(t40, t37);
+		t42 = _mm_xor_si128(t29, t33);
+		t43 = _mm_xor_si128(t29, t40);
+		t44 = _mm_xor_si128(t33, t37);
+		t45 = _mm_xor_si128(t42, t41);
+		z0 = _mm_and_si128(t44, y15);
+		z1 = _mm_and_si128(t37, y6);
+		z2 = _mm_and_si128(t33, x7);
+		z3 = _mm_and_si128(t43, y16);
+		z4 = _mm_and_si128(t40, y1);
+		z5 = _mm_and_si128(t29, y7);
+		z6 = _mm_and_si128(t42, y11);
+		z7 = _mm_and_si128(t45, y17);
+		z8 = _mm_and_si128(t41, y10);
+		z9 = _mm_and_si128(t44, y12);
+		z10 = _mm_and_si128(t37, y3);
+		z11 = _mm_and_si128(t33, y4);
+		z12 = _mm_and_si128(t43, y13);
+		z13 = _mm_and_si128(t40, y5);
+		z14 = _mm_and_si128(t29, y2);
+		z15 = _mm_and_si128(t42, y9);
+		z16 = _mm_and_si128(t45, y14);
+		z17 = _mm_and_si128(t41, y8);
+
+		// bottom linear transformation
+		t46 = _mm_xor_si128(z15, z16);
+		t47 = _mm_xor_si128(z10, z11);
+		t48 = _mm_xor_si128(z5, z13);
+		t49 = _mm_xor_si128(z9, z10);
+		t50 = _mm_xor_si128(z2, z12);
+		t51 = _mm_xor_si128(z2, z5);
+		t52 = _mm_xor_si128(z7, z8);
+		t53 = _mm_xor_si128(z0, z3);
+		t54 = _mm_xor_si128(z6, z7);
+		t55 = _mm_xor_si128(z16, z17);
+		t56 = _mm_xor_si128(z12, t48);
+		t57 = _mm_xor_si128(t50, t53);
+		t58 = _mm_xor_si128(z4, t46);
+		t59 = _mm_xor_si128(z3, t54);
+		t60 = _mm_xor_si128(t46, t57);
+		t61 = _mm_xor_si128(z14, t57);
+		t62 = _mm_xor_si128(t52, t58);
+		t63 = _mm_xor_si128(t49, t58);
+		t64 = _mm_xor_si128(z4, t59);
+		t65 = _mm_xor_si128(t61, t62);
+		t66 = _mm_xor_si128(z1, t63);
+		State[7] = _mm_xor_si128(t59, t63);
+		State[1] = _mm_xor_si128(t56, _mm_xor_si128(t62, ONES));
+		State[0] = _mm_xor_si128(t48, _mm_xor_si128(t60, ONES));
+		t67 = _mm_xor_si128(t64, t65);
+		State[4] = _mm_xor_si128(t53, t66);
+		State[3] = _mm_xor_si128(t51, t66);
+		State[2] = _mm_xor_si128(t47, t65);
+		State[6] = _mm_xor_si128(t64, _mm_xor_si128(State[4], ONES));
+		State[5] = _mm_xor_si128(t55, _mm_xor_si128(t67, ONES));
+	}
+
+	void BitslicedInvSubBytes(std::array<__m128i, 8> &State)
+	{
+		// the inverse s-box is computed as L(S(L(x))), where L is the inverse affine transform:
+		// b(i) = x(i + 2) ^ x(i + 5) ^ x(i + 7) ^ 0x05(i)
+		const __m128i ONES = _mm_set1_epi32(-1);
+		std::array<__m128i, 8> T;
+
+		T[0] = _mm_xor_si128(_mm_xor_si128(State[2], State[5]), _mm_xor_si128(State[7], ONES));
+		T[1] = _mm_xor_si128(_mm_xor_si128(State[3], State[6]), State[0]);
+		T[2] = _mm_xor_si128(_mm_xor_si128(State[4], State[7]), _mm_xor_si128(State[1], ONES));
+		T[3] = _mm_xor_si128(_mm_xor_si128(State[5], State[0]), State[2]);
+		T[4] = _mm_xor_si128(_mm_xor_si128(State[6], State[1]), State[3]);
+		T[5] = _mm_xor_si128(_mm_xor_si128(State[7], State[2]), State[4]);
+		T[6] = _mm_xor_si128(_mm_xor_si128(State[0], State[3]), State[5]);
+		T[7] = _mm_xor_si128(_mm_xor_si128(State[1], State[4]), State[6]);
+
+		BitslicedSubBytes(T);
+
+		State[0] = _mm_xor_si128(_mm_xor_si128(T[2], T[5]), _mm_xor_si128(T[7], ONES));
+		State[1] = _mm_xor_si128(_mm_xor_si128(T[3], T[6]), T[0]);
+		State[2] = _mm_xor_si128(_mm_xor_si128(T[4], T[7]), _mm_xor_si128(T[1], ONES));
+		State[3] = _mm_xor_si128(_mm_xor_si128(T[5], T[0]), T[2]);
+		State[4] = _mm_xor_si128(_mm_xor_si128(T[6], T[1]), T[3]);
+		State[5] = _mm_xor_si128(_mm_xor_si128(T[7], T[2]), T[4]);
+		State[6] = _mm_xor_si128(_mm_xor_si128(T[0], T[3]), T[5]);
+		State[7] = _mm_xor_si128(_mm_xor_si128(T[1], T[4]), T[6]);
+	}
+
+	void BitslicedTranspose(std::array<__m128i, 8> &State)
+	{
+		// 8x8 bit transpose in each byte lane, swapping bit groups of 1, 2, and 4 between register pairs; the transform is its own inverse
+		const std::array<__m128i, 3> MASKS = { _mm_set1_epi8(0x55), _mm_set1_epi8(0x33), _mm_set1_epi8(0x0F) };
+		__m128i tmp;
+		size_t i;
+		size_t j;
+		size_t k;
+
+		for (j = 0; j < 3; ++j)
+		{
+			k = static_cast<size_t>(1) << j;
+
+			for (i = 0; i < 8; ++i)
+			{
+				if ((i & k) == 0)
+				{
+					tmp = _mm_and_si128(_mm_xor_si128(_mm_srli_epi64(State[i], static_cast<int>(k)), State[i + k]), MASKS[j]);
+					State[i + k] = _mm_xor_si128(State[i + k], tmp);
+					State[i] = _mm_xor_si128(State[i], _mm_slli_epi64(tmp, static_cast<int>(k)));
+				}
+			}
+		}
+	}
+}
+
+void RHX::BitslicedDecrypt(const byte* Keys, size_t KeySize, const byte* Input, byte* Output)
+{
+	const __m128i ISRMASK = _mm_setr_epi8(0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3);
+	const size_t RNDCNT = (KeySize / BITSLICED_KEYSIZE) - 1;
+	std::array<__m128i, 8> X;
+	size_t i;
+	size_t r;
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + (i * BLOCK_SIZE)));
+	}
+
+	BitslicedTranspose(X);
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_xor_si128(X[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + (i * BLOCK_SIZE))));
+	}
+
+	for (r = 1; r < RNDCNT; ++r)
+	{
+		for (i = 0; i < 8; ++i)
+		{
+			X[i] = _mm_shuffle_epi8(X[i], ISRMASK);
+		}
+
+		BitslicedInvSubBytes(X);
+		BitslicedInvMixColumns(X);
+
+		for (i = 0; i < 8; ++i)
+		{
+			X[i] = _mm_xor_si128(X[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + (r * BITSLICED_KEYSIZE) + (i * BLOCK_SIZE))));
+		}
+	}
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_shuffle_epi8(X[i], ISRMASK);
+	}
+
+	BitslicedInvSubBytes(X);
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_xor_si128(X[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + (r * BITSLICED_KEYSIZE) + (i * BLOCK_SIZE))));
+	}
+
+	BitslicedTranspose(X);
+
+	for (i = 0; i < 8; ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + (i * BLOCK_SIZE)), X[i]);
+	}
+}
+
+void RHX::BitslicedEncrypt(const byte* Keys, size_t KeySize, const byte* Input, byte* Output)
+{
+	const __m128i SRMASK = _mm_setr_epi8(0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11);
+	const size_t RNDCNT = (KeySize / BITSLICED_KEYSIZE) - 1;
+	std::array<__m128i, 8> X;
+	size_t i;
+	size_t r;
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + (i * BLOCK_SIZE)));
+	}
+
+	BitslicedTranspose(X);
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_xor_si128(X[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + (i * BLOCK_SIZE))));
+	}
+
+	for (r = 1; r < RNDCNT; ++r)
+	{
+		BitslicedSubBytes(X);
+
+		for (i = 0; i < 8; ++i)
+		{
+			X[i] = _mm_shuffle_epi8(X[i], SRMASK);
+		}
+
+		BitslicedMixColumns(X);
+
+		for (i = 0; i < 8; ++i)
+		{
+			X[i] = _mm_xor_si128(X[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + (r * BITSLICED_KEYSIZE) + (i * BLOCK_SIZE))));
+		}
+	}
+
+	BitslicedSubBytes(X);
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_shuffle_epi8(X[i], SRMASK);
+	}
+
+
+	for (i = 0; i < 8; ++i)
+	{
+		X[i] = _mm_xor_si128(X[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + (r * BITSLICED_KEYSIZE) + (i * BLOCK_SIZE))));
+	}
+
+	BitslicedTranspose(X);
+
+	for (i = 0; i < 8; ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + (i * BLOCK_SIZE)), X[i]);
+	}
+}
+
+#endif
+
+NAMESPACE_BLOCKEND
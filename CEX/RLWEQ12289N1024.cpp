@@ -1,4 +1,5 @@
 #include "RLWEQ12289N1024.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "Keccak.h"
 #include "MemoryTools.h"
@@ -851,36 +852,76 @@ void RLWEQ12289N1024::PolyToMessage(std::vector<byte> &Message, const std::array
 
 void RLWEQ12289N1024::PolyUniform(std::array<ushort, RLWE_N> &A, const std::vector<byte> &Seed)
 {
-	std::vector<byte> buf(Keccak::KECCAK128_RATE_SIZE);
-	std::vector<byte> tmpk(RLWE_SEED_SIZE + 1);
-	size_t ctr;
+	const size_t BLKCNT = RLWE_N / 64;
+	const size_t SEEDLEN = RLWE_SEED_SIZE + 1;
+	std::vector<byte> buf(BLKCNT * Keccak::KECCAK128_RATE_SIZE);
+	std::vector<byte> seeds(BLKCNT * SEEDLEN);
 	size_t i;
+
+	// domain-separate the 16 independent calls
+	for (i = 0; i < BLKCNT; ++i)
+	{
+		MemoryTools::Copy(Seed, 0, seeds, i * SEEDLEN, RLWE_SEED_SIZE);
+		seeds[(i * SEEDLEN) + RLWE_SEED_SIZE] = static_cast<byte>(i);
+	}
+
+	i = 0;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+#	if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		// squeeze 8 blocks in parallel
+		for (; i < BLKCNT; i += 8)
+		{
+			Keccak::XOFR24P8x1600(seeds, i * SEEDLEN, SEEDLEN, buf, i * Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK128_RATE_SIZE);
+		}
+	}
+#	endif
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		// squeeze 4 blocks in parallel
+		for (; i < BLKCNT; i += 4)
+		{
+			Keccak::XOFR24P4x1600(seeds, i * SEEDLEN, SEEDLEN, buf, i * Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK128_RATE_SIZE);
+		}
+	}
+#endif
+
+	for (; i < BLKCNT; ++i)
+	{
+		XOF(seeds, i * SEEDLEN, SEEDLEN, buf, i * Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK128_RATE_SIZE, Keccak::KECCAK128_RATE_SIZE);
+	}
+
+	// generate a in blocks of 64 coefficients
+	for (i = 0; i < BLKCNT; ++i)
+	{
+		RejUniform(A, i * 64, buf, i * Keccak::KECCAK128_RATE_SIZE);
+	}
+}
+
+void RLWEQ12289N1024::RejUniform(std::array<ushort, RLWE_N> &A, size_t AOffset, const std::vector<byte> &Buffer, size_t BufOffset)
+{
+	size_t ctr;
 	size_t j;
 	ushort val;
 
-	MemoryTools::Copy(Seed, 0, tmpk, 0, RLWE_SEED_SIZE);
 	ctr = 0;
 
-	// generate a in blocks of 64 coefficients
-	for (i = 0; i < RLWE_N / 64; ++i)
+	// the xof is re-seeded with the same key, so a short block repeats the same buffer
+	while (ctr < 64)
 	{
-		ctr = 0;
-		// domain-separate the 16 independent calls
-		tmpk[RLWE_SEED_SIZE] = static_cast<byte>(i);
-
-		while (ctr < 64)
+		for (j = 0; j < Keccak::KECCAK128_RATE_SIZE && ctr < 64; j += 2)
 		{
-			//gen.Generate(buf);
-			XOF(tmpk, 0, tmpk.size(), buf, 0, buf.size(), Keccak::KECCAK128_RATE_SIZE);
+			val = (Buffer[BufOffset + j] | (static_cast<ushort>(Buffer[BufOffset + j + 1]) << 8));
 
-			for (j = 0; j < Keccak::KECCAK128_RATE_SIZE && ctr < 64; j += 2)
+			if (val < 5 * RLWE_Q)
 			{
-				val = (buf[j] | ((ushort)buf[j + 1] << 8));
-				if (val < 5 * RLWE_Q)
-				{
-					A[(i * 64) + ctr] = val;
-					ctr++;
-				}
+				A[AOffset + ctr] = val;
+				++ctr;
 			}
 		}
 	}
@@ -194,6 +194,8 @@ private:
 
 	static void PolyUniform(std::array<ushort, RLWE_N> &A, const std::vector<byte> &Seed);
 
+	static void RejUniform(std::array<ushort, RLWE_N> &A, size_t AOffset, const std::vector<byte> &Buffer, size_t BufOffset);
+
 	static void XOF(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Rate);
 };
 
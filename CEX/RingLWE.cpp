@@ -1,6 +1,7 @@
 #include "RingLWE.h"
 #include "IntegerTools.h"
 #include "Keccak.h"
+#include "KemBatch.h"
 #include "MemoryTools.h"
 #include "PrngFromName.h"
 #include "RLWEQ12289N1024.h"
@@ -257,42 +258,24 @@ bool RingLWE::Decapsulate(const std::vector<byte> &CipherText, std::vector<byte>
 	return result;
 }
 
-void RingLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
+bool RingLWE::Decapsulate(const std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
 {
 	CEXASSERT(m_rlweState->Initialized, "The cipher has not been initialized");
-	CEXASSERT(SharedSecret.size() <= 256, "The shared secret size is too large");
 
-	std::vector<byte> sec(SECRET_SIZE);
+	return KemBatch::Decapsulate(Name(), CipherText, SharedSecret, Count, CipherTextSize(), SECRET_SIZE, m_rlweState->DomainKey.size() != 0,
+		[this](const std::vector<byte> &Input, std::vector<byte> &Secret) { return Decapsulate(Input, Secret); });
+}
+void RingLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret)
+{
+	Encapsulate(CipherText, SharedSecret, m_rndGenerator);
+}
 
-	switch (m_rlweState->Parameters)
-	{
-		case (RLWEParameters::RLWES1Q12289N1024):
-		{
-			CipherText.resize(RLWEQ12289N1024::CIPHERTEXT_SIZE);
-			RLWEQ12289N1024::Encapsulate(CipherText, sec, m_publicKey->Polynomial(), m_rndGenerator);
-			break;
-		}
-		case (RLWEParameters::RLWES2Q12289N2048):
-		{
-			CipherText.resize(RLWEQ12289N2048::CIPHERTEXT_SIZE);
-			RLWEQ12289N2048::Encapsulate(CipherText, sec, m_publicKey->Polynomial(), m_rndGenerator);
-			break;
-		}
-		default:
-		{
-			throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The RingLWE parameter set is invalid!"), ErrorCodes::InvalidParam);
-		}
-	}
+void RingLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, size_t Count)
+{
+	CEXASSERT(m_rlweState->Initialized, "The cipher has not been initialized");
 
-	if (m_rlweState->DomainKey.size() != 0)
-	{
-		CXOF(m_rlweState->DomainKey, sec, SharedSecret, Keccak::KECCAK512_RATE_SIZE);
-	}
-	else
-	{
-		SharedSecret.resize(sec.size());
-		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
-	}
+	KemBatch::Encapsulate(Name(), CipherText, SharedSecret, Count, CipherTextSize(), SECRET_SIZE, m_rlweState->DomainKey.size() != 0, m_rndGenerator,
+		[this](std::vector<byte> &Output, std::vector<byte> &Secret, std::unique_ptr<IPrng> &Rng) { Encapsulate(Output, Secret, Rng); });
 }
 
 AsymmetricKeyPair* RingLWE::Generate()
@@ -363,8 +346,47 @@ void RingLWE::Initialize(AsymmetricKey* Key)
 
 void RingLWE::CXOF(const std::vector<byte> &Domain, const std::vector<byte> &Key, std::vector<byte> &Secret, size_t Rate)
 {
-	std::vector<byte> tmpn(Name().begin(), Name().end());
+	const std::string NAME = Name();
+	std::vector<byte> tmpn(NAME.begin(), NAME.end());
 	Keccak::CXOFR24P1600(Key, Domain, tmpn, Secret, 0, Secret.size(), Rate);
 }
 
+void RingLWE::Encapsulate(std::vector<byte> &CipherText, std::vector<byte> &SharedSecret, std::unique_ptr<IPrng> &Rng)
+{
+	CEXASSERT(m_rlweState->Initialized, "The cipher has not been initialized");
+	CEXASSERT(SharedSecret.size() <= 256, "The shared secret size is too large");
+
+	std::vector<byte> sec(SECRET_SIZE);
+
+	switch (m_rlweState->Parameters)
+	{
+		case (RLWEParameters::RLWES1Q12289N1024):
+		{
+			CipherText.resize(RLWEQ12289N1024::CIPHERTEXT_SIZE);
+			RLWEQ12289N1024::Encapsulate(CipherText, sec, m_publicKey->Polynomial(), Rng);
+			break;
+		}
+		case (RLWEParameters::RLWES2Q12289N2048):
+		{
+			CipherText.resize(RLWEQ12289N2048::CIPHERTEXT_SIZE);
+			RLWEQ12289N2048::Encapsulate(CipherText, sec, m_publicKey->Polynomial(), Rng);
+			break;
+		}
+		default:
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Encapsulate"), std::string("The RingLWE parameter set is invalid!"), ErrorCodes::InvalidParam);
+		}
+	}
+
+	if (m_rlweState->DomainKey.size() != 0)
+	{
+		CXOF(m_rlweState->DomainKey, sec, SharedSecret, Keccak::KECCAK512_RATE_SIZE);
+	}
+	else
+	{
+		SharedSecret.resize(sec.size());
+		MemoryTools::Copy(sec, 0, SharedSecret, 0, sec.size());
+	}
+}
+
 NAMESPACE_RINGLWEEND
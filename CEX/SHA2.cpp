@@ -1,4 +1,5 @@
 #include "SHA2.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 
@@ -9,7 +10,7 @@ using Utility::MemoryTools;
 
 //~~~SHA2 K Constants~~~//
 
-const std::vector<uint> SHA2::SHA256_RC64
+const uint SHA2::SHA256_RC64[64] =
 {
 	0x428A2F98UL, 0x71374491UL, 0xB5C0FBCFUL, 0xE9B5DBA5UL, 0x3956C25BUL, 0x59F111F1UL, 0x923F82A4UL, 0xAB1C5ED5UL,
 	0xD807AA98UL, 0x12835B01UL, 0x243185BEUL, 0x550C7DC3UL, 0x72BE5D74UL, 0x80DEB1FEUL, 0x9BDC06A7UL, 0xC19BF174UL,
@@ -21,7 +22,7 @@ const std::vector<uint> SHA2::SHA256_RC64
 	0x748F82EEUL, 0x78A5636FUL, 0x84C87814UL, 0x8CC70208UL, 0x90BEFFFAUL, 0xA4506CEBUL, 0xBEF9A3F7UL, 0xC67178F2UL
 };
 
-const std::vector<ulong> SHA2::SHA512_RC80
+const ulong SHA2::SHA512_RC80[80] =
 {
 	0X428A2F98D728AE22ULL, 0X7137449123EF65CDULL, 0XB5C0FBCFEC4D3B2FULL, 0XE9B5DBA58189DBBCULL, 0X3956C25BF348B538ULL, 0X59F111F1B605D019ULL, 0X923F82A4AF194F9BULL, 0XAB1C5ED5DA6D8118ULL,
 	0XD807AA98A3030242ULL, 0X12835B0145706FBEULL, 0X243185BE4EE4B28CULL, 0X550C7DC3D5FFB4E2ULL, 0X72BE5D74F27B896FULL, 0X80DEB1FE3B1696B1ULL, 0X9BDC06A725C71235ULL, 0XC19BF174CF692694ULL,
@@ -63,6 +64,39 @@ const std::vector<ulong> SHA2::SHA512State =
 
 //~~~SHA2-256~~~//
 
+void SHA2::Compute256xN(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	size_t i;
+
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		ComputeWide<uint, 16>(Input, Output, SHA256State, SHA256_DIGEST_SIZE, &PermuteR64P16x512H);
+		return;
+	}
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		ComputeWide<uint, 8>(Input, Output, SHA256State, SHA256_DIGEST_SIZE, &PermuteR64P8x512H);
+		return;
+	}
+#endif
+
+	Output.resize(Input.size());
+
+	for (i = 0; i < Input.size(); ++i)
+	{
+		Output[i].resize(SHA256_DIGEST_SIZE);
+		Compute256(Input[i], 0, Input[i].size(), Output[i], 0);
+	}
+}
+
 
 void SHA2::PermuteR64P512C(const std::vector<byte> &Input, size_t InOffset, std::array<uint, 8> &State)
 {
@@ -427,337 +461,41 @@ void SHA2::PermuteR64P512U(const std::vector<byte> &Input, size_t InOffset, std:
 	State[7] += H;
 }
 
-void SHA2::PermuteR64P512V(const std::vector<byte> &Input, size_t InOffset, std::array<uint, 8> &State)
-{
-#if defined(__AVX__)
-	__m128i S0, S1, T0, T1;
-	__m128i MSG, TMP, MASK;
-	__m128i M0, M1, M2, M3;
-
-	// load initial values
-	TMP = _mm_loadu_si128(reinterpret_cast<__m128i*>(&State));
-	S1 = _mm_loadu_si128(reinterpret_cast<__m128i*>(&State[4]));
-	MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
-	TMP = _mm_shuffle_epi32(TMP, 0xB1);  // CDAB
-	S1 = _mm_shuffle_epi32(S1, 0x1B);    // EFGH
-	S0 = _mm_alignr_epi8(TMP, S1, 8);    // ABEF
-	S1 = _mm_blend_epi16(S1, TMP, 0xF0); // CDGH
-	T0 = S0;
-	T1 = S1;
-
-	// rounds 0-3
-	MSG = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
-	M0 = _mm_shuffle_epi8(MSG, MASK);
-	MSG = _mm_add_epi32(M0, _mm_set_epi64x(0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	// rounds 4-7
-	M1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
-	M1 = _mm_shuffle_epi8(M1, MASK);
-	MSG = _mm_add_epi32(M1, _mm_set_epi64x(0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M0 = _mm_sha256msg1_epu32(M0, M1);
-	// rounds 8-11
-	M2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
-	M2 = _mm_shuffle_epi8(M2, MASK);
-	MSG = _mm_add_epi32(M2, _mm_set_epi64x(0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M1 = _mm_sha256msg1_epu32(M1, M2);
-	// rounds 12-15
-	M3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
-	M3 = _mm_shuffle_epi8(M3, MASK);
-	MSG = _mm_add_epi32(M3, _mm_set_epi64x(0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M3, M2, 4);
-	M0 = _mm_add_epi32(M0, TMP);
-	M0 = _mm_sha256msg2_epu32(M0, M3);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M2 = _mm_sha256msg1_epu32(M2, M3);
-	// rounds 16-19
-	MSG = _mm_add_epi32(M0, _mm_set_epi64x(0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M0, M3, 4);
-	M1 = _mm_add_epi32(M1, TMP);
-	M1 = _mm_sha256msg2_epu32(M1, M0);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M3 = _mm_sha256msg1_epu32(M3, M0);
-	// rounds 20-23
-	MSG = _mm_add_epi32(M1, _mm_set_epi64x(0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M1, M0, 4);
-	M2 = _mm_add_epi32(M2, TMP);
-	M2 = _mm_sha256msg2_epu32(M2, M1);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M0 = _mm_sha256msg1_epu32(M0, M1);
-	// rounds 24-27
-	MSG = _mm_add_epi32(M2, _mm_set_epi64x(0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M2, M1, 4);
-	M3 = _mm_add_epi32(M3, TMP);
-	M3 = _mm_sha256msg2_epu32(M3, M2);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M1 = _mm_sha256msg1_epu32(M1, M2);
-	// rounds 28-31
-	MSG = _mm_add_epi32(M3, _mm_set_epi64x(0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M3, M2, 4);
-	M0 = _mm_add_epi32(M0, TMP);
-	M0 = _mm_sha256msg2_epu32(M0, M3);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M2 = _mm_sha256msg1_epu32(M2, M3);
-	// rounds 32-35
-	MSG = _mm_add_epi32(M0, _mm_set_epi64x(0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M0, M3, 4);
-	M1 = _mm_add_epi32(M1, TMP);
-	M1 = _mm_sha256msg2_epu32(M1, M0);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M3 = _mm_sha256msg1_epu32(M3, M0);
-	// rounds 36-39
-	MSG = _mm_add_epi32(M1, _mm_set_epi64x(0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M1, M0, 4);
-	M2 = _mm_add_epi32(M2, TMP);
-	M2 = _mm_sha256msg2_epu32(M2, M1);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M0 = _mm_sha256msg1_epu32(M0, M1);
-	// rounds 40-43
-	MSG = _mm_add_epi32(M2, _mm_set_epi64x(0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M2, M1, 4);
-	M3 = _mm_add_epi32(M3, TMP);
-	M3 = _mm_sha256msg2_epu32(M3, M2);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M1 = _mm_sha256msg1_epu32(M1, M2);
-	// rounds 44-47
-	MSG = _mm_add_epi32(M3, _mm_set_epi64x(0x106AA070F40E3585ULL, 0xD6990624D192E819ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M3, M2, 4);
-	M0 = _mm_add_epi32(M0, TMP);
-	M0 = _mm_sha256msg2_epu32(M0, M3);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M2 = _mm_sha256msg1_epu32(M2, M3);
-	// rounds 48-51
-	MSG = _mm_add_epi32(M0, _mm_set_epi64x(0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M0, M3, 4);
-	M1 = _mm_add_epi32(M1, TMP);
-	M1 = _mm_sha256msg2_epu32(M1, M0);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	M3 = _mm_sha256msg1_epu32(M3, M0);
-	// rounds 52-55
-	MSG = _mm_add_epi32(M1, _mm_set_epi64x(0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M1, M0, 4);
-	M2 = _mm_add_epi32(M2, TMP);
-	M2 = _mm_sha256msg2_epu32(M2, M1);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	// rounds 56-59
-	MSG = _mm_add_epi32(M2, _mm_set_epi64x(0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	TMP = _mm_alignr_epi8(M2, M1, 4);
-	M3 = _mm_add_epi32(M3, TMP);
-	M3 = _mm_sha256msg2_epu32(M3, M2);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-	// rounds 60-63
-	MSG = _mm_add_epi32(M3, _mm_set_epi64x(0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL));
-	S1 = _mm_sha256rnds2_epu32(S1, S0, MSG);
-	MSG = _mm_shuffle_epi32(MSG, 0x0E);
-	S0 = _mm_sha256rnds2_epu32(S0, S1, MSG);
-
-	// combine state 
-	S0 = _mm_add_epi32(S0, T0);
-	S1 = _mm_add_epi32(S1, T1);
-	TMP = _mm_shuffle_epi32(S0, 0x1B);   // FEBA
-	S1 = _mm_shuffle_epi32(S1, 0xB1);    // DCHG
-	S0 = _mm_blend_epi16(TMP, S1, 0xF0); // DCBA
-	S1 = _mm_alignr_epi8(S1, TMP, 8);    // ABEF
-
-										 // store
-	_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[0]), S0);
-	_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[4]), S1);
-#else
-	PermuteR64P512U(Input, InOffset, State);
-#endif
-}
-
-#if defined(__AVX2__)
+//~~~SHA2-512~~~//
 
-void SHA2::PermuteR64P8x512H(const std::vector<byte> &Input, size_t InOffset, std::vector<UInt256> &State)
+void SHA2::Compute512xN(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
 {
-	std::array<UInt256, 8> A;
-	std::array<UInt256, 64> W;
-	UInt256 K;
 	size_t i;
-	size_t j;
-
-	Utility::MemoryTools::Copy(State, 0, A, 0, State.size() * sizeof(UInt256));
 
-#if defined(CEX_IS_LITTLE_ENDIAN)
-	for (i = 0; i < 16; ++i)
-	{
-		W[i].Load(
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint))),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 64),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 128),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 196),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 256),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 320),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 384),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 448));
-	}
-#else
-	Utility::MemoryTools::Copy(Input, InOffset, W, 0, A.size() * sizeof(UInt256));
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 #endif
 
-	for (i = 16; i < 64; i++)
+#if defined(CEX_KERNEL_SIMD512)
+	if (SMDPRF == SimdProfiles::Simd512)
 	{
-		W[i] = Theta1(W[i - 2]) + W[i - 7] + Theta0(W[i - 15]) + W[i - 16];
-	}
-
-	j = 0;
-	for (i = 0; i < 8; ++i)
-	{
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], K, W[j]);
-		++j;
+		ComputeWide<ulong, 8>(Input, Output, SHA512State, SHA512_DIGEST_SIZE, &PermuteR80P8x1024H);
+		return;
 	}
-
-	State[0] += A[0];
-	State[1] += A[1];
-	State[2] += A[2];
-	State[3] += A[3];
-	State[4] += A[4];
-	State[5] += A[5];
-	State[6] += A[6];
-	State[7] += A[7];
-}
-
 #endif
 
-#if defined(__AVX512__)
-
-void SHA2::PermuteR64P16x512H(const std::vector<byte> &Input, size_t InOffset, std::vector<UInt512> &State)
-{
-	std::array<UInt512, 8> A;
-	std::array<UInt512, 64> W;
-	UInt512 K;
-	size_t i;
-	size_t j;
-
-	Utility::MemoryTools::Copy(State, 0, A, 0, State.size() * sizeof(UInt512));
-
-#if defined(CEX_IS_LITTLE_ENDIAN)
-	for (i = 0; i < 16; ++i)
+#if defined(CEX_KERNEL_SIMD256)
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
 	{
-		W[i].Load(
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint))),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 64),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 128),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 196),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 256),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 320),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 384),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 448),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 512),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 576),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 640),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 704),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 768),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 832),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 896),
-			Utility::IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 960));
+		ComputeWide<ulong, 4>(Input, Output, SHA512State, SHA512_DIGEST_SIZE, &PermuteR80P4x1024H);
+		return;
 	}
-#else
-	Utility::MemoryTools::Copy(Input, InOffset, W, 0, A.size() * sizeof(UInt512));
 #endif
 
-	for (i = 16; i < 64; i++)
-	{
-		W[i] = Theta1(W[i - 2]) + W[i - 7] + Theta0(W[i - 15]) + W[i - 16];
-	}
+	Output.resize(Input.size());
 
-	j = 0;
-	for (i = 0; i < 8; ++i)
+	for (i = 0; i < Input.size(); ++i)
 	{
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], K, W[j]);
-		++j;
-		K.Load(SHA256_RC64[j]);
-		Round256W(A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], K, W[j]);
-		++j;
+		Output[i].resize(SHA512_DIGEST_SIZE);
+		Compute512(Input[i], 0, Input[i].size(), Output[i], 0);
 	}
-
-	State[0] += A[0];
-	State[1] += A[1];
-	State[2] += A[2];
-	State[3] += A[3];
-	State[4] += A[4];
-	State[5] += A[5];
-	State[6] += A[6];
-	State[7] += A[7];
 }
 
-#endif
-
-//~~~SHA2-512~~~//
-
 void SHA2::PermuteR80P1024C(const std::vector<byte> &Input, size_t InOffset, std::array<ulong, 8> &State)
 {
 	std::array<ulong, 8> A;
@@ -1185,154 +923,129 @@ void SHA2::PermuteR80P1024U(const std::vector<byte> &Input, size_t InOffset, std
 	State[7] += H;
 }
 
-#if defined(__AVX2__)
+//~~~Private Functions~~~//
 
-void SHA2::PermuteR80P4x1024H(const std::vector<byte> &Input, size_t InOffset, std::vector<ULong256> &State)
+template<typename T, size_t LANES>
+void SHA2::ComputeWide(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, const std::vector<T> &IV, size_t DigestSize,
+	void(*Permute)(const byte*, T*))
 {
-	std::array<ULong256, 8> A;
-	std::array<ULong256, 80> W;
-	ULong256 K;
+	// the rate is 16 words, the message length is encoded in the last two words of the final block
+	const size_t RATE = 16 * sizeof(T);
+	const size_t LENPOS = RATE - (2 * sizeof(T));
+	// the block of lane i is at offset i * RATE, and word j of lane i is at state[(j * LANES) + i]
+	std::array<size_t, LANES> blkctr;
+	std::array<size_t, LANES> blkcnt;
+	std::array<size_t, LANES> blkfull;
+	std::array<size_t, LANES> msgidx;
+	std::array<T, 8 * LANES> state;
+	std::vector<std::vector<byte>> tail(LANES, std::vector<byte>(2 * RATE));
+	std::vector<byte> blk(LANES * RATE);
+	size_t actcnt;
 	size_t i;
 	size_t j;
+	size_t nxtmsg;
 
-	Utility::MemoryTools::Copy(State, 0, A, 0, State.size() * sizeof(ULong256));
+	Output.resize(Input.size());
 
-#if defined(CEX_IS_LITTLE_ENDIAN)
-	for (i = 0; i < 16; ++i)
+	if (Input.size() == 0)
 	{
-		W[i].Load(
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong))),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 128),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 256),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 384));
+		return;
 	}
-#else
-	Utility::MemoryTools::Copy(Input, InOffset, W, 0, A.size() * sizeof(ULong256));
-#endif
 
-	for (i = 16; i < 80; i++)
-	{
-		W[i] = Sigma1(W[i - 2]) + W[i - 7] + Sigma0(W[i - 15]) + W[i - 16];
-	}
+	blkcnt.fill(0);
+	blkctr.fill(0);
+	state.fill(0);
+	actcnt = 0;
+	nxtmsg = 0;
 
-	j = 0;
-	for (i = 0; i < 10; ++i)
+	do
 	{
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], K, W[j]);
-		++j;
-	}
-
-	State[0] += A[0];
-	State[1] += A[1];
-	State[2] += A[2];
-	State[3] += A[3];
-	State[4] += A[4];
-	State[5] += A[5];
-	State[6] += A[6];
-	State[7] += A[7];
-}
-
-#endif
-
-#if defined(__AVX512__)
-
-void SHA2::PermuteR80P8x1024H(const std::vector<byte> &Input, size_t InOffset, std::vector<ULong512> &State)
-{
-	std::array<ULong512, 8> A;
-	std::array<ULong512, 80> W;
-	ULong512 K;
-	size_t i;
-	size_t j;
-
-	Utility::MemoryTools::Copy(State, 0, A, 0, State.size() * sizeof(ULong512));
-
-#if defined(CEX_IS_LITTLE_ENDIAN)
-	for (i = 0; i < 16; ++i)
+		// refill the idle lanes with the next messages
+		for (i = 0; i < LANES && nxtmsg < Input.size(); ++i)
+		{
+			if (blkctr[i] == blkcnt[i])
+			{
+				const size_t MSGLEN = Input[nxtmsg].size();
+				const size_t RMDLEN = MSGLEN % RATE;
+
+				msgidx[i] = nxtmsg;
+				blkfull[i] = MSGLEN / RATE;
+				blkcnt[i] = blkfull[i] + ((RMDLEN + 1 > LENPOS) ? 2 : 1);
+				blkctr[i] = 0;
+
+				// pre-build the padded final block(s) of this message
+				MemoryTools::Clear(tail[i], 0, tail[i].size());
+
+				if (RMDLEN != 0)
+				{
+					MemoryTools::Copy(Input[nxtmsg], MSGLEN - RMDLEN, tail[i], 0, RMDLEN);
+				}
+
+				tail[i][RMDLEN] = 0x80;
+				IntegerTools::Be64ToBytes(static_cast<ulong>(MSGLEN) << 3, tail[i], ((blkcnt[i] - blkfull[i]) * RATE) - sizeof(ulong));
+
+				for (j = 0; j < 8; ++j)
+				{
+					state[(j * LANES) + i] = IV[j];
+				}
+
+				++nxtmsg;
+				++actcnt;
+			}
+		}
+
+		// gather the next block of every active lane
+		for (i = 0; i < LANES; ++i)
+		{
+			if (blkctr[i] != blkcnt[i])
+			{
+				const size_t BLKOFT = i * RATE;
+
+				if (blkctr[i] < blkfull[i])
+				{
+					MemoryTools::Copy(Input[msgidx[i]], blkctr[i] * RATE, blk, BLKOFT, RATE);
+				}
+				else
+				{
+					MemoryTools::Copy(tail[i], (blkctr[i] - blkfull[i]) * RATE, blk, BLKOFT, RATE);
+				}
+			}
+		}
+
+		Permute(blk.data(), state.data());
+
+		// finalize the lanes that have absorbed their last block
+		for (i = 0; i < LANES; ++i)
+		{
+			if (blkctr[i] != blkcnt[i])
+			{
+				++blkctr[i];
+
+				if (blkctr[i] == blkcnt[i])
+				{
+					Output[msgidx[i]].resize(DigestSize);
+
+					for (j = 0; j < DigestSize; ++j)
+					{
+						Output[msgidx[i]][j] = static_cast<byte>(state[((j / sizeof(T)) * LANES) + i] >> (8 * (sizeof(T) - 1 - (j % sizeof(T)))));
+					}
+
+					--actcnt;
+				}
+			}
+		}
+	} 
+	while (actcnt != 0);
+
+	MemoryTools::Clear(state, 0, state.size() * sizeof(T));
+	MemoryTools::Clear(blk, 0, blk.size());
+
+	for (i = 0; i < LANES; ++i)
 	{
-		W[i].Load(
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong))),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 128),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 256),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 384),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 512),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 640),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 768),
-			Utility::IntegerTools::BeBytesTo64(Input, InOffset + (i * sizeof(ulong)) + 896));
+		MemoryTools::Clear(tail[i], 0, tail[i].size());
 	}
-#else
-	Utility::MemoryTools::Copy(Input, InOffset, W, 0, A.size() * sizeof(ULong512));
-#endif
-
-	for (i = 16; i < 80; i++)
-	{
-		W[i] = Sigma1(W[i - 2]) + W[i - 7] + Sigma0(W[i - 15]) + W[i - 16];
-	}
-
-	j = 0;
-	for (i = 0; i < 10; ++i)
-	{
-		K.Load(SHA512_RC80[j]);
-		Round512W(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], K, W[j]);
-		++j;
-		K.Load(SHA512_RC80[j];
-		Round512W(A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], K, W[j]);
-		++j;
-	}
-
-	State[0] += A[0];
-	State[1] += A[1];
-	State[2] += A[2];
-	State[3] += A[3];
-	State[4] += A[4];
-	State[5] += A[5];
-	State[6] += A[6];
-	State[7] += A[7];
 }
 
-#endif
-
-//~~~Private Functions~~~//
-
 void SHA2::Round256(uint A, uint B, uint C, uint &D, uint E, uint F, uint G, uint &H, uint M, uint P)
 {
 	uint R(H + (((E >> 6) | (E << 26)) ^ ((E >> 11) | (E << 21)) ^ ((E >> 25) | (E << 7))) + ((E & F) ^ (~E & G)) + M + P);
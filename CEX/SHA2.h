@@ -23,62 +23,30 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 
-#if defined(__AVX2__)
-#	include "UInt256.h"
-#	include "ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "UInt512.h"
-#	include "ULong512.h"
-#endif
-
 NAMESPACE_DIGEST
 
 using Utility::IntegerTools;
 using Utility::MemoryTools;
 
-#if defined(__AVX2__)
-	using Numeric::UInt256;
-	using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-	using Numeric::UInt512;
-	using Numeric::ULong512;
-#endif
-
 /// <summary>
 /// Contains the SHA2-256 and 512bit permutation functions.
 /// <para>The function names are in the format; Permute-rounds-bits-suffix, ex. PermuteR64P512C, 64 rounds, permutes 512 bits, using the compact form of the function. \n
 /// The compact forms of the permutations have the suffix C, and are optimized for performance and low memory consumption 
 /// (enabled in the hash function by adding the CEX_DIGEST_COMPACT to the CexConfig file). \n
 /// The Unrolled forms are optimized for speed and timing neutrality (suffix U), and the vertically vectorized functions have the V suffix. \n
-/// The H suffix denotes functions that take an SIMD wrapper class (ULongXXX) as the state values, and process state in SIMD parallel blocks.</para>
+/// The H suffix denotes functions that process state in SIMD parallel blocks, the state words of every lane are interleaved in a single array.</para>
 /// <para>This class contains wide forms of the functions; PermuteR64P8x512H and PermuteR80P4x1024H use AVX2. \n
 /// Experimental functions using AVX512 instructions are also implemented; PermuteR64P16x512H and PermuteR80P8x1024H. \n
-/// These functions are not visible until run-time on some compiler platforms unless the compiler flag (__AVX2__ or __AVX512__) is explicitly declared.</para>
+/// The wide forms and the SHA-NI form are compiled in their own translation units (SHA2Simd128, SHA2Simd256 and SHA2Simd512), each built with its instruction set enabled. \n
+/// When CEX_SIMD_DISPATCH is defined the callers select a form at run-time with CpuDetect::SimdProfile(), 
+/// otherwise they are only visible when the compiler flag (__AVX__, __AVX2__ or __AVX512__) is explicitly declared.</para>
 /// </summary>
 class SHA2
 {
 private:
 
-	static const std::vector<uint> SHA256_RC64;
-	static const std::vector<ulong> SHA512_RC80;
-
-	template<typename T>
-	static void Round256W(T &A, T &B, T &C, T &D, T &E, T &F, T &G, T &H, T &M, T &P)
-	{
-		T R(H + (((E >> 6) | (E << 26)) ^ ((E >> 11) | (E << 21)) ^ ((E >> 25) | (E << 7))) + ((E & F) ^ (~E & G)) + M + P);
-		D += R;
-		H = R + ((((A >> 2) | (A << 30)) ^ ((A >> 13) | (A << 19)) ^ ((A >> 22) | (A << 10))) + ((A & B) ^ (A & C) ^ (B & C)));
-	}
-
-	template<typename T>
-	static void Round512W(T &A, T &B, T &C, T &D, T &E, T &F, T &G, T &H, T &M, T &P)
-	{
-		T R(H + (((E << 50) | (E >> 14)) ^ ((E << 46) | (E >> 18)) ^ ((E << 23) | (E >> 41))) + ((E & F) ^ (~E & G)) + M + P);
-		D += R;
-		H = R + (((A << 36) | (A >> 28)) ^ ((A << 30) | (A >> 34)) ^ ((A << 25) | (A >> 39))) + ((A & B) ^ (A & C) ^ (B & C));
-	}
+	static const uint SHA256_RC64[64];
+	static const ulong SHA512_RC80[80];
 
 	template<typename T>
 	inline static T Sigma0(T &X)
@@ -107,6 +75,10 @@ private:
 	static void Round256(uint A, uint B, uint C, uint &D, uint E, uint F, uint G, uint &H, uint M, uint P);
 	static void Round512(ulong A, ulong B, ulong C, ulong &D, ulong E, ulong F, ulong G, ulong &H, ulong M, ulong P);
 
+	template<typename T, size_t LANES>
+	static void ComputeWide(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, const std::vector<T> &IV, size_t DigestSize,
+		void(*Permute)(const byte*, T*));
+
 public:
 
 	static const std::vector<uint> SHA256State;
@@ -170,6 +142,17 @@ public:
 		IntegerTools::BeUL256ToBlock(state, 0, Output, OutOffset);
 	}
 
+	/// <summary>
+	/// A multi-buffer form of the SHA2-256 message digest function; hashes a set of independent messages and returns one standard digest per message.
+	/// <para>Messages of arbitrary lengths are scheduled into the lanes of the wide permutation (8 lanes with AVX2, 16 with AVX512), 
+	/// a lane is refilled with the next message as soon as its current message has been finalized. 
+	/// The wide permutation is selected at run-time, on a processor without AVX2 the messages are hashed sequentially with Compute256.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The independent input messages</param>
+	/// <param name="Output">The output hashes; resized to the number of messages, each entry contains a hash of 32 bytes</param>
+	static void Compute256xN(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output);
+
 	/// <summary>
 	/// A compact (stateless) form of the SHA2-256 message authentication code generator (HMAC-256).
 	/// <para>Process a key, and a message, and return the hash in the output array.</para>
@@ -276,41 +259,42 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PermuteR64P512U(const std::vector<byte> &Input, size_t InOffset, std::array<uint, 8> &State);
 
+#if defined(CEX_KERNEL_SIMD128)
+
 	/// <summary>
 	/// The vertically vectorized form of the SHA2-256 permutation function.
-	/// <para>This function uses the Intel SHA-NI instructions.</para>
+	/// <para>This function uses the Intel SHA-NI instructions, the caller must check that the processor supports them.</para>
 	/// </summary>
 	/// 
-	/// <param name="Input">The input message array</param>
-	/// <param name="InOffset">The starting offset within the Input array</param>
-	/// <param name="State">The permutations state array</param>
-	static void PermuteR64P512V(const std::vector<byte> &Input, size_t InOffset, std::array<uint, 8> &State);
+	/// <param name="Input">The 64 byte input block</param>
+	/// <param name="State">The 8 word permutation state</param>
+	static void PermuteR64P512V(const byte* Input, uint* State);
+
+#endif
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized form of the SHA2-256 permutation function.
 	/// <para>This function processes 8*64 blocks of input in parallel using AVX2 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Input">The input message array</param>
-	/// <param name="InOffset">The starting offset within the Input array</param>
-	/// <param name="State">The permutations UInt256 state array</param>
-	static void PermuteR64P8x512H(const std::vector<byte> &Input, size_t InOffset, std::vector<UInt256> &State);
+	/// <param name="Input">The 8 consecutive 64 byte input blocks, one block per lane</param>
+	/// <param name="State">The 64 word interleaved state; word n of lane i is at State[(n * 8) + i]</param>
+	static void PermuteR64P8x512H(const byte* Input, uint* State);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized form of the SHA2-256 permutation function.
 	/// <para>This function process 16*64 blocks of input in parallel using AVX512 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Input">The input message array</param>
-	/// <param name="InOffset">The starting offset within the Input array</param>
-	/// <param name="State">The permutations UInt512 state array</param>
-	static void PermuteR64P16x512H(const std::vector<byte> &Input, size_t InOffset, std::vector<UInt512> &State);
+	/// <param name="Input">The 16 consecutive 64 byte input blocks, one block per lane</param>
+	/// <param name="State">The 128 word interleaved state; word n of lane i is at State[(n * 16) + i]</param>
+	static void PermuteR64P16x512H(const byte* Input, uint* State);
 
 #endif
 
@@ -365,6 +349,17 @@ public:
 		IntegerTools::BeULL512ToBlock(state, 0, Output, OutOffset);
 	}
 
+	/// <summary>
+	/// A multi-buffer form of the SHA2-512 message digest function; hashes a set of independent messages and returns one standard digest per message.
+	/// <para>Messages of arbitrary lengths are scheduled into the lanes of the wide permutation (4 lanes with AVX2, 8 with AVX512), 
+	/// a lane is refilled with the next message as soon as its current message has been finalized. 
+	/// The wide permutation is selected at run-time, on a processor without AVX2 the messages are hashed sequentially with Compute512.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The independent input messages</param>
+	/// <param name="Output">The output hashes; resized to the number of messages, each entry contains a hash of 64 bytes</param>
+	static void Compute512xN(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output);
+
 	/// <summary>
 	/// A compact (stateless) form of the HMAC SHA2-512 message authentication code generator (HMAC-512).
 	/// <para>Process a key, and a message, and return the hash in the output array.</para>
@@ -471,31 +466,29 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PermuteR80P1024U(const std::vector<byte> &Input, size_t InOffset, std::array<ulong, 8> &State);
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized form of the SHA2-512 permutation function.
 	/// <para>This function processes 4*128 blocks of input in parallel using AVX2 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Input">The input message array</param>
-	/// <param name="InOffset">The starting offset within the Input array</param>
-	/// <param name="State">The permutations state array</param>
-	static void PermuteR80P4x1024H(const std::vector<byte> &Input, size_t InOffset, std::vector<ULong256> &State);
+	/// <param name="Input">The 4 consecutive 128 byte input blocks, one block per lane</param>
+	/// <param name="State">The 32 word interleaved state; word n of lane i is at State[(n * 4) + i]</param>
+	static void PermuteR80P4x1024H(const byte* Input, ulong* State);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized form of the SHA2-512 permutation function.
 	/// <para>This function process 8*128 blocks of input in parallel using AVX512 instructions.</para>
 	/// </summary>
 	/// 
-	/// <param name="Input">The input message array</param>
-	/// <param name="InOffset">The starting offset within the Input array</param>
-	/// <param name="State">The permutations UInt512 state array</param>
-	static void PermuteR80P8x1024H(const std::vector<byte> &Input, size_t InOffset, std::vector<ULong512> &State);
+	/// <param name="Input">The 8 consecutive 128 byte input blocks, one block per lane</param>
+	/// <param name="State">The 64 word interleaved state; word n of lane i is at State[(n * 8) + i]</param>
+	static void PermuteR80P8x1024H(const byte* Input, ulong* State);
 
 #endif
 };
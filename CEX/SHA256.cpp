@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 #if defined(__AVX__)
 #	include "Intrinsics.h"
 #endif
@@ -57,6 +58,7 @@ SHA256::SHA256(bool Parallel)
 		SHA2Params(SHA2::SHA256_DIGEST_SIZE, 0UL, 0x00))
 {
 	Reset();
+	ParallelTuner::Apply(Digests::SHA256, m_parallelProfile);
 }
 
 SHA256::SHA256(SHA2Params &Params)
@@ -69,6 +71,7 @@ SHA256::SHA256(SHA2Params &Params)
 	m_treeParams(Params)
 {
 	Reset();
+	ParallelTuner::Apply(Digests::SHA256, m_parallelProfile);
 }
 
 SHA256::~SHA256()
@@ -394,11 +397,13 @@ void SHA256::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length,
 
 void SHA256::Permute(const std::vector<byte> &Input, size_t InOffset, SHA256State &State)
 {
+#if defined(CEX_KERNEL_SIMD128)
 	if (m_parallelProfile.HasSHA2())
 	{
-		SHA2::PermuteR64P512V(Input, InOffset, State.H);
+		SHA2::PermuteR64P512V(Input.data() + InOffset, State.H.data());
 	}
 	else
+#endif
 	{
 #if defined(CEX_DIGEST_COMPACT)
 		SHA2::PermuteR64P512C(Input, InOffset, State.H);
@@ -0,0 +1,220 @@
+#include "SHA2.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "SHA2Simd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "UInt256.h"
+#	include "ULong256.h"
+#endif
+
+NAMESPACE_DIGEST
+
+#if defined(CEX_KERNEL_SIMD256)
+
+using Numeric::UInt256;
+using Numeric::ULong256;
+
+namespace
+{
+	// the round functions and message schedule are repeated here with internal linkage, 
+	// so that no helper is shared with the baseline translation units
+
+	uint BeBytesTo32(const byte* Input)
+	{
+		return (static_cast<uint>(Input[0]) << 24) |
+			(static_cast<uint>(Input[1]) << 16) |
+			(static_cast<uint>(Input[2]) << 8) |
+			static_cast<uint>(Input[3]);
+	}
+
+	ulong BeBytesTo64(const byte* Input)
+	{
+		return (static_cast<ulong>(BeBytesTo32(Input)) << 32) | static_cast<ulong>(BeBytesTo32(Input + 4));
+	}
+
+	template<typename T>
+	void Round256W(T &A, T &B, T &C, T &D, T &E, T &F, T &G, T &H, T &M, T &P)
+	{
+		T R(H + (((E >> 6) | (E << 26)) ^ ((E >> 11) | (E << 21)) ^ ((E >> 25) | (E << 7))) + ((E & F) ^ (~E & G)) + M + P);
+		D += R;
+		H = R + ((((A >> 2) | (A << 30)) ^ ((A >> 13) | (A << 19)) ^ ((A >> 22) | (A << 10))) + ((A & B) ^ (A & C) ^ (B & C)));
+	}
+
+	template<typename T>
+	void Round512W(T &A, T &B, T &C, T &D, T &E, T &F, T &G, T &H, T &M, T &P)
+	{
+		T R(H + (((E << 50) | (E >> 14)) ^ ((E << 46) | (E >> 18)) ^ ((E << 23) | (E >> 41))) + ((E & F) ^ (~E & G)) + M + P);
+		D += R;
+		H = R + (((A << 36) | (A >> 28)) ^ ((A << 30) | (A >> 34)) ^ ((A << 25) | (A >> 39))) + ((A & B) ^ (A & C) ^ (B & C));
+	}
+
+	template<typename T>
+	T Sigma0W(T &X)
+	{
+		return (((X << 63) | (X >> 1)) ^ ((X << 56) | (X >> 8)) ^ (X >> 7));
+	}
+
+	template<typename T>
+	T Sigma1W(T &X)
+	{
+		return (((X << 45) | (X >> 19)) ^ ((X << 3) | (X >> 61)) ^ (X >> 6));
+	}
+
+	template<typename T>
+	T Theta0W(T &X)
+	{
+		return T(((X >> 7) | (X << 25)) ^ ((X >> 18) | (X << 14)) ^ (X >> 3));
+	}
+
+	template<typename T>
+	T Theta1W(T &X)
+	{
+		return T(((X >> 17) | (X << 15)) ^ ((X >> 19) | (X << 13)) ^ (X >> 10));
+	}
+}
+
+//~~~SHA2-256~~~//
+
+void SHA2::PermuteR64P8x512H(const byte* Input, uint* State)
+{
+	UInt256 A[8];
+	UInt256 W[64];
+	UInt256 K;
+	uint tmp[8];
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < 8; ++i)
+	{
+		A[i].Load(State, i * 8);
+	}
+
+	// word i of every lane is gathered into one register, lane n reads the block at Input + (n * 64)
+	for (i = 0; i < 16; ++i)
+	{
+		for (j = 0; j < 8; ++j)
+		{
+			tmp[j] = BeBytesTo32(Input + (j * 64) + (i * sizeof(uint)));
+		}
+
+		W[i].Load(tmp, 0);
+	}
+
+	for (i = 16; i < 64; i++)
+	{
+		W[i] = Theta1W(W[i - 2]) + W[i - 7] + Theta0W(W[i - 15]) + W[i - 16];
+	}
+
+	j = 0;
+
+	for (i = 0; i < 8; ++i)
+	{
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], K, W[j]);
+		++j;
+		K.Load(SHA256_RC64[j]);
+		Round256W(A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], K, W[j]);
+		++j;
+	}
+
+	for (i = 0; i < 8; ++i)
+	{
+		K.Load(State, i * 8);
+		A[i] += K;
+		A[i].Store(State, i * 8);
+	}
+}
+
+//~~~SHA2-512~~~//
+
+void SHA2::PermuteR80P4x1024H(const byte* Input, ulong* State)
+{
+	ULong256 A[8];
+	ULong256 W[80];
+	ULong256 K;
+	ulong tmp[4];
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < 8; ++i)
+	{
+		A[i].Load(State, i * 4);
+	}
+
+	// word i of every lane is gathered into one register, lane n reads the block at Input + (n * 128)
+	for (i = 0; i < 16; ++i)
+	{
+		for (j = 0; j < 4; ++j)
+		{
+			tmp[j] = BeBytesTo64(Input + (j * 128) + (i * sizeof(ulong)));
+		}
+
+		W[i].Load(tmp, 0);
+	}
+
+	for (i = 16; i < 80; i++)
+	{
+		W[i] = Sigma1W(W[i - 2]) + W[i - 7] + Sigma0W(W[i - 15]) + W[i - 16];
+	}
+
+	j = 0;
+
+	for (i = 0; i < 10; ++i)
+	{
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], K, W[j]);
+		++j;
+		K.Load(SHA512_RC80[j]);
+		Round512W(A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], K, W[j]);
+		++j;
+	}
+
+	for (i = 0; i < 8; ++i)
+	{
+		K.Load(State, i * 4);
+		A[i] += K;
+		A[i].Store(State, i * 4);
+	}
+}
+
+#endif
+
+NAMESPACE_DIGESTEND
@@ -3,6 +3,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 
 NAMESPACE_DIGEST
 
@@ -60,6 +61,7 @@ SHA512::SHA512(bool Parallel)
 		SHA2Params(SHA2::SHA512_DIGEST_SIZE, 0UL, 0x00))
 {
 	Reset();
+	ParallelTuner::Apply(Digests::SHA512, m_parallelProfile);
 }
 
 SHA512::SHA512(SHA2Params &Params)
@@ -72,6 +74,7 @@ SHA512::SHA512(SHA2Params &Params)
 	m_treeParams(Params)
 {
 	Reset();
+	ParallelTuner::Apply(Digests::SHA512, m_parallelProfile);
 }
 
 SHA512::~SHA512()
@@ -1,20 +1,14 @@
 #include "SHX.h"
+#include "CpuDetect.h"
 #include "Serpent.h"
 #include "IntegerTools.h"
 #include "KdfFromName.h"
 
-#if defined(__AVX512__)
-#	include "UInt512.h"
-#elif defined(__AVX2__)
-#	include "UInt256.h"
-#elif defined(__AVX__)
-#	include "UInt128.h"
-#endif
-
 NAMESPACE_BLOCK
 
 using namespace Cipher::Block::SerpentBase;
 using Utility::IntegerTools;
+using Enumeration::SimdProfiles;
 using Enumeration::Kdfs;
 using Utility::MemoryTools;
 
@@ -535,65 +529,51 @@ void SHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 
 void SHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-#if (!defined(__AVX512__)) && (!defined(__AVX2__)) && defined(__AVX__)
-	DecryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-#else
-	Decrypt128(Input, InOffset, Output, OutOffset);
-	Decrypt128(Input, InOffset + 16, Output, OutOffset + 16);
-	Decrypt128(Input, InOffset + 32, Output, OutOffset + 32);
-	Decrypt128(Input, InOffset + 48, Output, OutOffset + 48);
+#if defined(CEX_KERNEL_SIMD128)
+	if (CpuDetect::SimdProfile() != SimdProfiles::None)
+	{
+		DecryptW128(m_shxState->RoundKeys.data(), m_shxState->RoundKeys.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
 #endif
+	{
+		Decrypt128(Input, InOffset, Output, OutOffset);
+		Decrypt128(Input, InOffset + 16, Output, OutOffset + 16);
+		Decrypt128(Input, InOffset + 32, Output, OutOffset + 32);
+		Decrypt128(Input, InOffset + 48, Output, OutOffset + 48);
+	}
 }
 
 void SHX::Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-#if (!defined(__AVX512__)) && defined(__AVX2__)
-	DecryptW<Numeric::UInt256>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-#elif (!defined(__AVX512__)) && (!defined(__AVX2__)) && defined(__AVX__)
-	DecryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-	DecryptW<Numeric::UInt128>(Input, InOffset + 64, Output, OutOffset + 64, m_shxState->RoundKeys);
-#else
-	Decrypt128(Input, InOffset, Output, OutOffset);
-	Decrypt128(Input, InOffset + 16, Output, OutOffset + 16);
-	Decrypt128(Input, InOffset + 32, Output, OutOffset + 32);
-	Decrypt128(Input, InOffset + 48, Output, OutOffset + 48);
-	Decrypt128(Input, InOffset + 64, Output, OutOffset + 64);
-	Decrypt128(Input, InOffset + 80, Output, OutOffset + 80);
-	Decrypt128(Input, InOffset + 96, Output, OutOffset + 96);
-	Decrypt128(Input, InOffset + 112, Output, OutOffset + 112);
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		DecryptW256(m_shxState->RoundKeys.data(), m_shxState->RoundKeys.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
 #endif
+	{
+		Decrypt512(Input, InOffset, Output, OutOffset);
+		Decrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+	}
 }
 
 void SHX::Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-#if defined(__AVX512__)
-	DecryptW<Numeric::UInt512>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-#elif (!defined(__AVX512__)) && defined(__AVX2__)
-	DecryptW<Numeric::UInt256>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-	DecryptW<Numeric::UInt256>(Input, InOffset + 128, Output, OutOffset + 128, m_shxState->RoundKeys);
-#elif (!defined(__AVX512__)) && (!defined(__AVX2__)) && defined(__AVX__)
-	DecryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-	DecryptW<Numeric::UInt128>(Input, InOffset + 64, Output, OutOffset + 64, m_shxState->RoundKeys);
-	DecryptW<Numeric::UInt128>(Input, InOffset + 128, Output, OutOffset + 128, m_shxState->RoundKeys);
-	DecryptW<Numeric::UInt128>(Input, InOffset + 192, Output, OutOffset + 192, m_shxState->RoundKeys);
-#else
-	Decrypt128(Input, InOffset, Output, OutOffset);
-	Decrypt128(Input, InOffset + 16, Output, OutOffset + 16);
-	Decrypt128(Input, InOffset + 32, Output, OutOffset + 32);
-	Decrypt128(Input, InOffset + 48, Output, OutOffset + 48);
-	Decrypt128(Input, InOffset + 64, Output, OutOffset + 64);
-	Decrypt128(Input, InOffset + 80, Output, OutOffset + 80);
-	Decrypt128(Input, InOffset + 96, Output, OutOffset + 96);
-	Decrypt128(Input, InOffset + 112, Output, OutOffset + 112);
-	Decrypt128(Input, InOffset + 128, Output, OutOffset + 128);
-	Decrypt128(Input, InOffset + 144, Output, OutOffset + 144);
-	Decrypt128(Input, InOffset + 160, Output, OutOffset + 160);
-	Decrypt128(Input, InOffset + 176, Output, OutOffset + 176);
-	Decrypt128(Input, InOffset + 192, Output, OutOffset + 192);
-	Decrypt128(Input, InOffset + 208, Output, OutOffset + 208);
-	Decrypt128(Input, InOffset + 224, Output, OutOffset + 224);
-	Decrypt128(Input, InOffset + 240, Output, OutOffset + 240);
+#if defined(CEX_KERNEL_SIMD512)
+	if (CpuDetect::SimdProfile() == SimdProfiles::Simd512)
+	{
+		DecryptW512(m_shxState->RoundKeys.data(), m_shxState->RoundKeys.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
 #endif
+	{
+		Decrypt1024(Input, InOffset, Output, OutOffset);
+		Decrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
+	}
 }
 
 void SHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
@@ -688,65 +668,51 @@ void SHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 
 void SHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-#if (!defined(__AVX512__)) && (!defined(__AVX2__)) && defined(__AVX__)
-	EncryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-#else
-	Encrypt128(Input, InOffset, Output, OutOffset);
-	Encrypt128(Input, InOffset + 16, Output, OutOffset + 16);
-	Encrypt128(Input, InOffset + 32, Output, OutOffset + 32);
-	Encrypt128(Input, InOffset + 48, Output, OutOffset + 48);
+#if defined(CEX_KERNEL_SIMD128)
+	if (CpuDetect::SimdProfile() != SimdProfiles::None)
+	{
+		EncryptW128(m_shxState->RoundKeys.data(), m_shxState->RoundKeys.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
 #endif
+	{
+		Encrypt128(Input, InOffset, Output, OutOffset);
+		Encrypt128(Input, InOffset + 16, Output, OutOffset + 16);
+		Encrypt128(Input, InOffset + 32, Output, OutOffset + 32);
+		Encrypt128(Input, InOffset + 48, Output, OutOffset + 48);
+	}
 }
 
 void SHX::Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-#if (!defined(__AVX512__)) && defined(__AVX2__)
-	EncryptW<Numeric::UInt256>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-#elif (!defined(__AVX512__)) && (!defined(__AVX2__)) && defined(__AVX__)
-	EncryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-	EncryptW<Numeric::UInt128>(Input, InOffset + 64, Output, OutOffset + 64, m_shxState->RoundKeys);
-#else
-	Encrypt128(Input, InOffset, Output, OutOffset);
-	Encrypt128(Input, InOffset + 16, Output, OutOffset + 16);
-	Encrypt128(Input, InOffset + 32, Output, OutOffset + 32);
-	Encrypt128(Input, InOffset + 48, Output, OutOffset + 48);
-	Encrypt128(Input, InOffset + 64, Output, OutOffset + 64);
-	Encrypt128(Input, InOffset + 80, Output, OutOffset + 80);
-	Encrypt128(Input, InOffset + 96, Output, OutOffset + 96);
-	Encrypt128(Input, InOffset + 112, Output, OutOffset + 112);
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		EncryptW256(m_shxState->RoundKeys.data(), m_shxState->RoundKeys.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
 #endif
+	{
+		Encrypt512(Input, InOffset, Output, OutOffset);
+		Encrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+	}
 }
 
 void SHX::Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
-#if defined(__AVX512__)
-	EncryptW<Numeric::UInt512>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-#elif (!defined(__AVX512__)) && defined(__AVX2__)
-	EncryptW<Numeric::UInt256>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-	EncryptW<Numeric::UInt256>(Input, InOffset + 128, Output, OutOffset + 128, m_shxState->RoundKeys);
-#elif (!defined(__AVX512__)) && (!defined(__AVX2__)) && defined(__AVX__)
-	EncryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
-	EncryptW<Numeric::UInt128>(Input, InOffset + 64, Output, OutOffset + 64, m_shxState->RoundKeys);
-	EncryptW<Numeric::UInt128>(Input, InOffset + 128, Output, OutOffset + 128, m_shxState->RoundKeys);
-	EncryptW<Numeric::UInt128>(Input, InOffset + 192, Output, OutOffset + 192, m_shxState->RoundKeys);
-#else
-	Encrypt128(Input, InOffset, Output, OutOffset);
-	Encrypt128(Input, InOffset + 16, Output, OutOffset + 16);
-	Encrypt128(Input, InOffset + 32, Output, OutOffset + 32);
-	Encrypt128(Input, InOffset + 48, Output, OutOffset + 48);
-	Encrypt128(Input, InOffset + 64, Output, OutOffset + 64);
-	Encrypt128(Input, InOffset + 80, Output, OutOffset + 80);
-	Encrypt128(Input, InOffset + 96, Output, OutOffset + 96);
-	Encrypt128(Input, InOffset + 112, Output, OutOffset + 112);
-	Encrypt128(Input, InOffset + 128, Output, OutOffset + 128);
-	Encrypt128(Input, InOffset + 144, Output, OutOffset + 144);
-	Encrypt128(Input, InOffset + 160, Output, OutOffset + 160);
-	Encrypt128(Input, InOffset + 176, Output, OutOffset + 176);
-	Encrypt128(Input, InOffset + 192, Output, OutOffset + 192);
-	Encrypt128(Input, InOffset + 208, Output, OutOffset + 208);
-	Encrypt128(Input, InOffset + 224, Output, OutOffset + 224);
-	Encrypt128(Input, InOffset + 240, Output, OutOffset + 240);
+#if defined(CEX_KERNEL_SIMD512)
+	if (CpuDetect::SimdProfile() == SimdProfiles::Simd512)
+	{
+		EncryptW512(m_shxState->RoundKeys.data(), m_shxState->RoundKeys.size(), Input.data() + InOffset, Output.data() + OutOffset);
+	}
+	else
 #endif
+	{
+		Encrypt1024(Input, InOffset, Output, OutOffset);
+		Encrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
+	}
 }
 
 //~~~Helper Functions~~~//
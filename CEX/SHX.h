@@ -321,6 +321,19 @@ private:
 	static void SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<ShxState> &State, std::unique_ptr<IKdf> &Generator);
 	static void StandardExpand(const SecureVector<byte> &Key, std::unique_ptr<ShxState> &State);
 
+#if defined(CEX_KERNEL_SIMD128)
+	static void DecryptW128(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output);
+	static void EncryptW128(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output);
+#endif
+#if defined(CEX_KERNEL_SIMD256)
+	static void DecryptW256(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output);
+	static void EncryptW256(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output);
+#endif
+#if defined(CEX_KERNEL_SIMD512)
+	static void DecryptW512(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output);
+	static void EncryptW512(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output);
+#endif
+
 	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
@@ -0,0 +1,34 @@
+#include "SHX.h"
+#include "Serpent.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD128) && !defined(__SSE4_1__) && !defined(CEX_COMPILER_MSC)
+#	error "SHXSimd128.cpp must be compiled with the SSE4.1 instruction set enabled (-msse4.1)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD128)
+#	include "Intrinsics.h"
+#	include "UInt128.h"
+#endif
+
+NAMESPACE_BLOCK
+
+#if defined(CEX_KERNEL_SIMD128)
+
+using namespace Cipher::Block::SerpentBase;
+using Numeric::UInt128;
+
+void SHX::DecryptW128(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output)
+{
+	// decrypts 4 blocks, the Serpent templates are instantiated here with internal linkage
+	DecryptW<UInt128>(Input, Output, RoundKeys, KeyCount);
+}
+
+void SHX::EncryptW128(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output)
+{
+	// encrypts 4 blocks, the Serpent templates are instantiated here with internal linkage
+	EncryptW<UInt128>(Input, Output, RoundKeys, KeyCount);
+}
+
+#endif
+
+NAMESPACE_BLOCKEND
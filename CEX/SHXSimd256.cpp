@@ -0,0 +1,33 @@
+#include "SHX.h"
+#include "Serpent.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "SHXSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "UInt256.h"
+#endif
+
+NAMESPACE_BLOCK
+
+#if defined(CEX_KERNEL_SIMD256)
+
+using namespace Cipher::Block::SerpentBase;
+using Numeric::UInt256;
+
+void SHX::DecryptW256(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output)
+{
+	// decrypts 8 blocks, the Serpent templates are instantiated here with internal linkage
+	DecryptW<UInt256>(Input, Output, RoundKeys, KeyCount);
+}
+
+void SHX::EncryptW256(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output)
+{
+	// encrypts 8 blocks, the Serpent templates are instantiated here with internal linkage
+	EncryptW<UInt256>(Input, Output, RoundKeys, KeyCount);
+}
+
+#endif
+
+NAMESPACE_BLOCKEND
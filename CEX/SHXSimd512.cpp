@@ -0,0 +1,33 @@
+#include "SHX.h"
+#include "Serpent.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD512) && !defined(__AVX512__)
+#	error "SHXSimd512.cpp must be compiled with the AVX512 instruction set enabled (/arch:AVX512 or -mavx512f)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
+#	include "UInt512.h"
+#endif
+
+NAMESPACE_BLOCK
+
+#if defined(CEX_KERNEL_SIMD512)
+
+using namespace Cipher::Block::SerpentBase;
+using Numeric::UInt512;
+
+void SHX::DecryptW512(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output)
+{
+	// decrypts 16 blocks, the Serpent templates are instantiated here with internal linkage
+	DecryptW<UInt512>(Input, Output, RoundKeys, KeyCount);
+}
+
+void SHX::EncryptW512(const uint* RoundKeys, size_t KeyCount, const byte* Input, byte* Output)
+{
+	// encrypts 16 blocks, the Serpent templates are instantiated here with internal linkage
+	EncryptW<UInt512>(Input, Output, RoundKeys, KeyCount);
+}
+
+#endif
+
+NAMESPACE_BLOCKEND
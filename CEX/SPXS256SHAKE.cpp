@@ -38,8 +38,10 @@ void SPXS256SHAKE::Generate(std::vector<byte> &PublicKey, std::vector<byte> &Pri
 		size_t,
 		const std::vector<byte> &,
 		const std::vector<byte> &,
-		uint, std::array<uint, 8> &,
-		size_t)> wotsgen = WOTS::WotsGenLeaf;
+		uint,
+		uint,
+		std::array<uint, 8> &,
+		size_t)> wotsgen = WOTS::WotsGenLeaves;
 
 	SphincsUtils::TreeHash(root, 0, authpath, 0, skseed, pkseed, 0, 0, SPX_TREE_HEIGHT, toptreeaddr, stack, heights, SPX_N, wotsgen);
 	// copy root and seeds to private key
@@ -101,8 +103,10 @@ size_t SPXS256SHAKE::Sign(std::vector<byte> &Signature, const std::vector<byte>
 		size_t,
 		const std::vector<byte> &,
 		const std::vector<byte> &,
-		uint, std::array<uint, 8> &,
-		size_t)> wotsgen = WOTS::WotsGenLeaf;
+		uint,
+		uint,
+		std::array<uint, 8> &,
+		size_t)> wotsgen = WOTS::WotsGenLeaves;
 
 	for (idx = 0; idx < SPX_D; ++idx)
 	{
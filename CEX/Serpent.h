@@ -20,6 +20,7 @@
 #define CEX_SERPENT_H
 
 #include "CexDomain.h"
+#include "IntegerTools.h"
 
 NAMESPACE_SERPENTBASE
 
@@ -27,20 +28,18 @@ NAMESPACE_SERPENTBASE
 /// internal
 /// 
 
-template<typename T, typename ArrayA, typename ArrayB>
-static void DecryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, ArrayB &Key)
+template<typename T>
+static void DecryptW(const byte* Input, byte* Output, const uint* Key, size_t KeyCount)
 {
-#if defined(__AVX__) || defined(__AVX2__) || defined(__AVX512__)
-
 	const size_t RNDCNT = 4;
 	const size_t INPOFF = T::size();
-	size_t kctr = Key.size();
+	size_t kctr = KeyCount;
 
 	// input round
-	T R0(Input, InOffset);
-	T R1(Input, InOffset + INPOFF);
-	T R2(Input, InOffset + (INPOFF * 2));
-	T R3(Input, InOffset + (INPOFF * 3));
+	T R0(Input, 0);
+	T R1(Input, INPOFF);
+	T R2(Input, INPOFF * 2);
+	T R3(Input, INPOFF * 3);
 	T::Transpose(R0, R1, R2, R3);
 
 	--kctr;
@@ -161,28 +160,24 @@ static void DecryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Ou
 	R0 ^= T(Key[kctr]);
 
 	T::Transpose(R0, R1, R2, R3);
-	R0.Store(Output, OutOffset);
-	R1.Store(Output, OutOffset + INPOFF);
-	R2.Store(Output, OutOffset + (INPOFF * 2));
-	R3.Store(Output, OutOffset + (INPOFF * 3));
-
-#endif
+	R0.Store(Output, 0);
+	R1.Store(Output, INPOFF);
+	R2.Store(Output, INPOFF * 2);
+	R3.Store(Output, INPOFF * 3);
 }
 
-template<typename T, typename ArrayA, typename ArrayB>
-static void EncryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, ArrayB &Key)
+template<typename T>
+static void EncryptW(const byte* Input, byte* Output, const uint* Key, size_t KeyCount)
 {
-#if defined(__AVX__) || defined(__AVX2__) || defined(__AVX512__)
-
-	const size_t RNDCNT = Key.size() - 5;
+	const size_t RNDCNT = KeyCount - 5;
 	const size_t INPOFF = T::size();
 	int kctr = -1;
 
 	// input round
-	T R0(Input, InOffset);
-	T R1(Input, InOffset + INPOFF);
-	T R2(Input, InOffset + (INPOFF * 2));
-	T R3(Input, InOffset + (INPOFF * 3));
+	T R0(Input, 0);
+	T R1(Input, INPOFF);
+	T R2(Input, INPOFF * 2);
+	T R3(Input, INPOFF * 3);
 	T::Transpose(R0, R1, R2, R3);
 
 	// process 8 round blocks
@@ -294,12 +289,10 @@ static void EncryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Ou
 	R3 ^= T(Key[kctr]);
 
 	T::Transpose(R0, R1, R2, R3);
-	R0.Store(Output, OutOffset);
-	R1.Store(Output, OutOffset + INPOFF);
-	R2.Store(Output, OutOffset + (INPOFF * 2));
-	R3.Store(Output, OutOffset + (INPOFF * 3));
-
-#endif
+	R0.Store(Output, 0);
+	R1.Store(Output, INPOFF);
+	R2.Store(Output, INPOFF * 2);
+	R3.Store(Output, INPOFF * 3);
 }
 
 template<typename T>
@@ -37,7 +37,11 @@ enum class SimdIntegers : byte
 	/// <summary>
 	/// AVX wrapper for unsigned 16bit integers
 	/// </summary>
-	UShort128 = 6
+	UShort128 = 6,
+	/// <summary>
+	/// AVX2 wrapper for unsigned 16bit integers
+	/// </summary>
+	UShort256 = 7
 };
 
 NAMESPACE_ENUMERATIONEND
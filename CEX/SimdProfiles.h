@@ -15,7 +15,7 @@ enum class SimdProfiles : byte
 	/// </summary>
 	None = 0,
 	/// <summary>
-	/// The system supports AVX intrinsics
+	/// The system supports SSE4.1 intrinsics
 	/// </summary>
 	Simd128 = 1,
 	/// <summary>
@@ -21,22 +21,8 @@
 
 #include "CexDomain.h"
 
-#if defined(__AVX2__)
-#	include "ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "ULong512.h"
-#endif
-
 NAMESPACE_DIGEST
 
-#if defined(__AVX2__)
-	using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-	using Numeric::ULong512;
-#endif
-
 	/// <summary>
 	/// Contains the Skein 256, 512, and 1024bit permutation functions.
 	/// <para>The function names are in the format; Permute-rounds-bits-suffix, ex. PemuteR72P256C, 72 rounds, permutes 256 bits, using the compact form of the function. \n
@@ -116,10 +102,11 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PemuteR96P512U(const std::array<ulong, 8> &Input, const std::array<ulong, 2> &Tweak, std::array<ulong, 8> &State);
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The vertically vectorized form of the Skein-512 72 round permutation function.
+	/// <para>Compiled in its own translation unit (SkeinSimd256) with AVX2 enabled, and selected at run-time with CpuDetect::SimdProfile().</para>
 	/// </summary>
 	/// 
 	/// <param name="Input">The input message array</param>
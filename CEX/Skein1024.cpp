@@ -2,6 +2,7 @@
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 #include "Skein.h"
 
 NAMESPACE_DIGEST
@@ -57,6 +58,7 @@ Skein1024::Skein1024(bool Parallel)
 		SkeinParams(Skein::SKEIN1024_DIGEST_SIZE, 0x00, 0x00))
 {
 	Initialize(m_dgtState, m_treeParams);
+	ParallelTuner::Apply(Digests::Skein1024, m_parallelProfile);
 }
 
 Skein1024::Skein1024(SkeinParams &Params)
@@ -69,6 +71,7 @@ Skein1024::Skein1024(SkeinParams &Params)
 	m_treeParams(Params)
 {
 	Initialize(m_dgtState, m_treeParams);
+	ParallelTuner::Apply(Digests::Skein1024, m_parallelProfile);
 }
 
 Skein1024::~Skein1024()
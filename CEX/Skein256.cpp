@@ -1,6 +1,7 @@
 #include "Skein256.h"
 #include "IntegerTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 #include "Skein.h"
 
 NAMESPACE_DIGEST
@@ -56,6 +57,7 @@ Skein256::Skein256(bool Parallel)
 		SkeinParams(Skein::SKEIN256_DIGEST_SIZE, 0x00, 0x00))
 {
 	Initialize(m_dgtState, m_treeParams);
+	ParallelTuner::Apply(Digests::Skein256, m_parallelProfile);
 }
 
 Skein256::Skein256(SkeinParams &Params)
@@ -68,6 +70,7 @@ Skein256::Skein256(SkeinParams &Params)
 	m_treeParams(Params)
 {
 	Initialize(m_dgtState, m_treeParams);
+	ParallelTuner::Apply(Digests::Skein256, m_parallelProfile);
 }
 
 Skein256::~Skein256()
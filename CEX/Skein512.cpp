@@ -1,7 +1,9 @@
 #include "Skein512.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 #include "Skein.h"
 
 NAMESPACE_DIGEST
@@ -57,6 +59,7 @@ Skein512::Skein512(bool Parallel)
 		SkeinParams(Skein::SKEIN512_DIGEST_SIZE, 0x00, 0x00))
 {
 	Initialize(m_dgtState, m_treeParams);
+	ParallelTuner::Apply(Digests::Skein512, m_parallelProfile);
 }
 
 Skein512::Skein512(SkeinParams &Params)
@@ -69,6 +72,7 @@ Skein512::Skein512(SkeinParams &Params)
 	m_treeParams(Params)
 {
 	Initialize(m_dgtState, m_treeParams);
+	ParallelTuner::Apply(Digests::Skein512, m_parallelProfile);
 }
 
 Skein512::~Skein512()
@@ -415,14 +419,20 @@ void Skein512::LoadState(Skein512State &State, std::array<ulong, 8> &Config)
 
 void Skein512::Permute(std::array<ulong, 8> &Message, Skein512State &State)
 {
-#if defined(__AVX2__)
-	Skein::PemuteR72P512V(Message, State.T, State.S);
-#else
-#	if defined(CEX_DIGEST_COMPACT)
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		Skein::PemuteR72P512V(Message, State.T, State.S);
+		return;
+	}
+#endif
+
+#if defined(CEX_DIGEST_COMPACT)
 	Skein::PemuteP512C(Message, State.T, State.S, 72);
-#	else
+#else
 	Skein::PemuteR72P512U(Message, State.T, State.S);
-#	endif
 #endif
 }
 
@@ -0,0 +1,648 @@
+#include "Skein.h"
+
+#if defined(CEX_SIMD_DISPATCH) && defined(CEX_KERNEL_SIMD256) && !defined(__AVX2__)
+#	error "SkeinSimd256.cpp must be compiled with the AVX2 instruction set enabled (/arch:AVX2 or -mavx2)"
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
+#	include "Intrinsics.h"
+#endif
+
+NAMESPACE_DIGEST
+
+#if defined(CEX_KERNEL_SIMD256)
+
+void Skein::PemuteR72P512V(const std::array<ulong, 8> &Input, const std::array<ulong, 2> &Tweak, std::array<ulong, 8> &State)
+{
+	const __m256i R1 = _mm256_set_epi64x(37, 19, 36, 46);
+	const __m256i R2 = _mm256_set_epi64x(42, 14, 27, 33);
+	const __m256i R3 = _mm256_set_epi64x(39, 36, 49, 17);
+	const __m256i R4 = _mm256_set_epi64x(56, 54, 9, 44);
+	const __m256i R5 = _mm256_set_epi64x(24, 34, 30, 39);
+	const __m256i R6 = _mm256_set_epi64x(17, 10, 50, 13);
+	const __m256i R7 = _mm256_set_epi64x(43, 39, 29, 25);
+	const __m256i R8 = _mm256_set_epi64x(22, 56, 35, 8);
+	const __m256i RFN = _mm256_set_epi64x(1, 0, 0, 0);
+	const ulong KS = State[0] ^ State[1] ^ State[2] ^ State[3] ^ State[4] ^ State[5] ^ State[6] ^ State[7] ^ 0x1BD11BDAA9FC1A22ULL;
+	const __m256i K0 = _mm256_set_epi64x(State[6], State[4], State[2], State[0]);
+	const __m256i K1 = _mm256_set_epi64x(State[7], State[5], State[3], State[1]);
+	const __m256i K2 = _mm256_set_epi64x(KS, State[6], State[4], State[2]);
+	const __m256i K3 = _mm256_set_epi64x(State[0], State[7], State[5], State[3]);
+	const __m256i K4 = _mm256_set_epi64x(State[1], KS, State[6], State[4]);
+	const __m256i K5 = _mm256_set_epi64x(State[2], State[0], State[7], State[5]);
+	const __m256i K6 = _mm256_set_epi64x(State[3], State[1], KS, State[6]);
+	const __m256i K7 = _mm256_set_epi64x(State[4], State[2], State[0], State[7]);
+	const __m256i K8 = _mm256_set_epi64x(State[5], State[3], State[1], KS);
+	const __m256i TS = _mm256_set_epi64x(Tweak[0], Tweak[1], Tweak[0] ^ Tweak[1], 0);
+
+	__m256i R0 = _mm256_set_epi64x(0, 0, 0, 0);
+	__m256i SHR;
+	__m256i X0 = _mm256_set_epi64x(Input[6], Input[4], Input[2], Input[0]);
+	__m256i X1 = _mm256_set_epi64x(Input[7], Input[5], Input[3], Input[1]);
+	__m256i T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	__m256i T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+
+	// rounds 0-7
+	X0 = _mm256_add_epi64(X0, K0);
+	X1 = _mm256_add_epi64(X1, K1);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(1, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 2, 0, 0));
+	X0 = _mm256_add_epi64(X0, K1);
+	X1 = _mm256_add_epi64(X1, K2);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(3, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 1, 0, 0));
+	// rounds 8-15
+	X0 = _mm256_add_epi64(X0, K2);
+	X1 = _mm256_add_epi64(X1, K3);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+	X0 = _mm256_add_epi64(X0, K3);
+	X1 = _mm256_add_epi64(X1, K4);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 16-23
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(1, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 2, 0, 0));
+	X0 = _mm256_add_epi64(X0, K4);
+	X1 = _mm256_add_epi64(X1, K5);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(3, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 1, 0, 0));
+	X0 = _mm256_add_epi64(X0, K5);
+	X1 = _mm256_add_epi64(X1, K6);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 24-31
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+	X0 = _mm256_add_epi64(X0, K6);
+	X1 = _mm256_add_epi64(X1, K7);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(1, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 2, 0, 0));
+	X0 = _mm256_add_epi64(X0, K7);
+	X1 = _mm256_add_epi64(X1, K8);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 32-39
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(3, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 1, 0, 0));
+	X0 = _mm256_add_epi64(X0, K8);
+	X1 = _mm256_add_epi64(X1, K0);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+	X0 = _mm256_add_epi64(X0, K0);
+	X1 = _mm256_add_epi64(X1, K1);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 40-47
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(1, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 2, 0, 0));
+	X0 = _mm256_add_epi64(X0, K1);
+	X1 = _mm256_add_epi64(X1, K2);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(3, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 1, 0, 0));
+	X0 = _mm256_add_epi64(X0, K2);
+	X1 = _mm256_add_epi64(X1, K3);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 48-55
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+	X0 = _mm256_add_epi64(X0, K3);
+	X1 = _mm256_add_epi64(X1, K4);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(1, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 2, 0, 0));
+	X0 = _mm256_add_epi64(X0, K4);
+	X1 = _mm256_add_epi64(X1, K5);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 56-63
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(3, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 1, 0, 0));
+	X0 = _mm256_add_epi64(X0, K5);
+	X1 = _mm256_add_epi64(X1, K6);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+	X0 = _mm256_add_epi64(X0, K6);
+	X1 = _mm256_add_epi64(X1, K7);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	// rounds 64-71
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(1, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 2, 0, 0));
+	X0 = _mm256_add_epi64(X0, K7);
+	X1 = _mm256_add_epi64(X1, K8);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R1);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R1), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R2);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R2), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R3);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R3), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R4);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R4), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(3, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 1, 0, 0));
+	X0 = _mm256_add_epi64(X0, K8);
+	X1 = _mm256_add_epi64(X1, K0);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R5);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R5), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R6);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R6), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R7);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R7), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+
+	SHR = _mm256_sub_epi64(_mm256_set1_epi64x(64), R8);
+	X0 = _mm256_add_epi64(X0, X1);
+	X1 = _mm256_or_si256(_mm256_sllv_epi64(X1, R8), _mm256_srlv_epi64(X1, SHR));
+	X1 = _mm256_xor_si256(X1, X0);
+	X0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(0, 3, 2, 1));
+	X1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(1, 2, 3, 0));
+	T0 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(2, 0, 0, 0));
+	T1 = _mm256_permute4x64_epi64(TS, _MM_SHUFFLE(0, 3, 0, 0));
+	X0 = _mm256_add_epi64(X0, K0);
+	X1 = _mm256_add_epi64(X1, K1);
+	X1 = _mm256_add_epi64(X1, R0);
+	X0 = _mm256_add_epi64(X0, T0);
+	X1 = _mm256_add_epi64(X1, T1);
+	R0 = _mm256_add_epi64(R0, RFN);
+	T0 = _mm256_permute4x64_epi64(X0, _MM_SHUFFLE(3, 1, 2, 0));
+	T1 = _mm256_permute4x64_epi64(X1, _MM_SHUFFLE(3, 1, 2, 0));
+	X0 = _mm256_unpacklo_epi64(T0, T1);
+	X1 = _mm256_unpackhi_epi64(T0, T1);
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[0]), X0);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[4]), X1);
+}
+
+#endif
+
+NAMESPACE_DIGESTEND
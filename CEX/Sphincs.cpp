@@ -1,5 +1,7 @@
 #include "Sphincs.h"
+#include "IntegerTools.h"
 #include "MemoryTools.h"
+#include "ParallelTools.h"
 #include "PrngFromName.h"
 #include "SPXS128SHAKE.h"
 #include "SPXS192SHAKE.h"
@@ -8,7 +10,9 @@
 NAMESPACE_SPHINCS
 
 using Enumeration::AsymmetricPrimitiveConvert;
+using Utility::IntegerTools;
 using Utility::MemoryTools;
+using Utility::ParallelTools;
 using Enumeration::SphincsParameterConvert;
 
 class Sphincs::SphincsState
@@ -36,6 +40,87 @@ public:
 		Signer = false;
 		Parameters = SphincsParameters::None;
 	}
+
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<const std::vector<byte>*> &PublicKeys, std::vector<byte> &Results)
+	{
+		const size_t CNT = Signatures.size();
+		const size_t THDCNT = IntegerTools::Min(IntegerTools::Max(ParallelTools::ProcessorCount(), static_cast<size_t>(1)), IntegerTools::Max(CNT, static_cast<size_t>(1)));
+		const size_t CNKLEN = (CNT + THDCNT - 1) / THDCNT;
+		const SphincsParameters PRMS = Parameters;
+		size_t i;
+		size_t vcnt;
+
+		Messages.resize(CNT);
+		Results.resize(CNT);
+
+		// each thread verifies a contiguous range of signatures, the hypertree 
+		// chains within each signature are hashed in parallel keccak lanes
+		ParallelTools::ParallelFor(0, THDCNT, [&Signatures, &Messages, &PublicKeys, &Results, CNT, CNKLEN, PRMS](size_t i)
+		{
+			const size_t OFT = i * CNKLEN;
+			size_t j;
+
+			for (j = OFT; j < IntegerTools::Min(OFT + CNKLEN, CNT); ++j)
+			{
+				Results[j] = Verify(Messages[j], Signatures[j], *PublicKeys[j], PRMS) ? 1 : 0;
+			}
+		});
+
+		vcnt = 0;
+
+		for (i = 0; i < CNT; ++i)
+		{
+			vcnt += Results[i];
+		}
+
+		return vcnt;
+	}
+
+	static bool Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const std::vector<byte> &PublicKey, SphincsParameters Params)
+	{
+		bool res;
+
+		res = false;
+		// a signature shorter than the base size has no message
+		Message.clear();
+
+		switch (Params)
+		{
+			case SphincsParameters::SPXS1S128SHAKE:
+			{
+				if (Signature.size() >= SPXS128SHAKE::SPHINCS_SIGNATURE_SIZE)
+				{
+					res = SPXS128SHAKE::Verify(Message, Signature, PublicKey);
+				}
+
+				break;
+			}
+			case SphincsParameters::SPXS2S192SHAKE:
+			{
+				if (Signature.size() >= SPXS192SHAKE::SPHINCS_SIGNATURE_SIZE)
+				{
+					res = SPXS192SHAKE::Verify(Message, Signature, PublicKey);
+				}
+
+				break;
+			}
+			case SphincsParameters::SPXS3S256SHAKE:
+			{
+				if (Signature.size() >= SPXS256SHAKE::SPHINCS_SIGNATURE_SIZE)
+				{
+					res = SPXS256SHAKE::Verify(Message, Signature, PublicKey);
+				}
+
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+
+		return res;
+	}
 };
 
 Sphincs::Sphincs(SphincsParameters Parameters, Prngs PrngType)
@@ -365,4 +450,60 @@ bool Sphincs::Verify(const std::vector<byte> &Signature, std::vector<byte> &Mess
 	return res;
 }
 
+size_t Sphincs::Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results)
+{
+	if (!m_sphincsState->Initialized)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The cipher has not been initialized!"), ErrorCodes::IllegalOperation);
+	}
+
+	if (m_sphincsState->Signer)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The signature scheme is not initialized for verification!"), ErrorCodes::NotInitialized);
+	}
+
+	const std::vector<byte> PUBK = m_publicKey->Polynomial();
+	std::vector<const std::vector<byte>*> pks(Signatures.size(), &PUBK);
+
+	return m_sphincsState->Verify(Signatures, Messages, pks, Results);
+}
+
+size_t Sphincs::Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results)
+{
+	if (KeyIndex.size() != Signatures.size())
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key index array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	std::vector<std::vector<byte>> kpol(PublicKeys.size());
+	std::vector<const std::vector<byte>*> pks(Signatures.size());
+	size_t i;
+
+	for (i = 0; i < PublicKeys.size(); ++i)
+	{
+		if (PublicKeys[i] == nullptr || PublicKeys[i]->PrimitiveType() != AsymmetricPrimitives::Sphincs || PublicKeys[i]->KeyClass() != AsymmetricKeyTypes::SignaturePublicKey)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key type is invalid!"), ErrorCodes::InvalidKey);
+		}
+		if (static_cast<SphincsParameters>(PublicKeys[i]->Parameters()) != m_sphincsState->Parameters)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key parameter set does not match this instance!"), ErrorCodes::InvalidKey);
+		}
+
+		kpol[i] = PublicKeys[i]->Polynomial();
+	}
+
+	for (i = 0; i < KeyIndex.size(); ++i)
+	{
+		if (KeyIndex[i] >= PublicKeys.size())
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key index is out of range!"), ErrorCodes::InvalidParam);
+		}
+
+		pks[i] = &kpol[KeyIndex[i]];
+	}
+
+	return m_sphincsState->Verify(Signatures, Messages, pks, Results);
+}
+
 NAMESPACE_SPHINCSEND
\ No newline at end of file
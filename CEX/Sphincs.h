@@ -82,6 +82,7 @@ using Enumeration::SphincsParameters;
 /// <item><description>The primary Prng is set through the constructor, as either an prng type-name (default BCR-AES256), which instantiates the function internally, or a pointer to a perisitant external instance of a Prng</description></item>
 /// <item><description>Use the Generate function to create a public/private key-pair, and the Sign function to sign a message</description></item>
 /// <item><description>The message-signature is tested using the Verify function, which checks the signature, populates the message array, and returns false on authentication failure</description></item>
+/// <item><description>A batch of signatures, under one or several public keys, is verified across the processor cores with the batch Verify functions, which return a result for each signature</description></item>
 /// </list>
 /// 
 /// <description>Guiding Publications:</description>
@@ -213,6 +214,38 @@ public:
 	/// 
 	/// <returns>Returns true if the signature matches, false for authentication failure</returns>
 	bool Verify(const std::vector<byte> &Signature, std::vector<byte> &Message) override;
+
+	/// <summary>
+	/// Verify a batch of signed messages with the public key used to initialize the signature scheme.
+	/// <para>The messages and results arrays are resized to the number of signatures; each result is 1 if the signature is authentic, or 0 on failure,
+	/// and the message of a failed signature is zeroed. The batch is distributed across the processor cores, and the hash chains of each signature are computed in parallel SHAKE lanes.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the signature scheme is not initialized for verification</exception>
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results) override;
+
+	/// <summary>
+	/// Verify a batch of signed messages under a set of public keys.
+	/// <para>Each signature is verified with the public key at its entry in the key index array.
+	/// The keys must use the parameter set of this instance, the signature scheme does not need to be initialized.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="PublicKeys">The public keys used to verify the signatures</param>
+	/// <param name="KeyIndex">The index of the public key used to verify each signature</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if a key is invalid, or the key index array is invalid</exception>
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results) override;
 };
 
 NAMESPACE_SPHINCSEND
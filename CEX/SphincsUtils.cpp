@@ -1,4 +1,5 @@
 #include "SphincsUtils.h"
+#include "CpuDetect.h"
 
 NAMESPACE_SPHINCS
 
@@ -40,6 +41,22 @@ void SphincsUtils::PrfAddress(std::vector<byte> &Output, size_t Offset, const st
 	XOF(k, 0, k.size(), Output, Offset, N, Keccak::KECCAK256_RATE_SIZE);
 }
 
+void SphincsUtils::PrfAddressW(std::vector<byte> &Output, size_t Offset, const std::vector<byte> &Key, const std::vector<std::array<uint, 8>> &Addresses, size_t Count, size_t N)
+{
+	const size_t SEEDLEN = N + SPX_ADDR_BYTES;
+	std::vector<byte> seeds(Count * SEEDLEN);
+	size_t i;
+
+	for (i = 0; i < Count; ++i)
+	{
+		MemoryTools::Copy(Key, 0, seeds, i * SEEDLEN, N);
+		SphincsUtils::AddressToBytes(seeds, (i * SEEDLEN) + N, Addresses[i]);
+	}
+
+	XOFW(seeds, 0, SEEDLEN, Output, Offset, N, Count, Keccak::KECCAK256_RATE_SIZE);
+	MemoryTools::Clear(seeds, 0, seeds.size());
+}
+
 void SphincsUtils::THash(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, const size_t InputBlocks,
 	const std::vector<byte> &PkSeed, std::array<uint, 8> & Address, std::vector<byte> &Buffer, std::vector<byte> &Mask, size_t N)
 {
@@ -66,38 +83,111 @@ void SphincsUtils::THash(std::vector<byte> &Output, size_t OutOffset, const std:
 	Keccak::XOFR24P1600(k, 0, k.size(), Output, OutOffset, N, Keccak::KECCAK256_RATE_SIZE);
 }
 
+void SphincsUtils::THashW(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, const size_t InputBlocks,
+	const std::vector<byte> &PkSeed, const std::vector<std::array<uint, 8>> &Addresses, size_t Count, size_t N)
+{
+	// the lane-batched form of THash; hashes Count consecutive inputs of InputBlocks * N bytes to Count consecutive outputs of N bytes
+	const size_t SEEDLEN = N + SPX_ADDR_BYTES;
+	const size_t BLKLEN = InputBlocks * N;
+	const size_t MSGLEN = SEEDLEN + BLKLEN;
+	std::vector<byte> mask(Count * BLKLEN);
+	std::vector<byte> msgs(Count * MSGLEN);
+	std::vector<byte> seeds(Count * SEEDLEN);
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < Count; ++i)
+	{
+		MemoryTools::Copy(PkSeed, 0, seeds, i * SEEDLEN, N);
+		SphincsUtils::AddressToBytes(seeds, (i * SEEDLEN) + N, Addresses[i]);
+	}
+
+	XOFW(seeds, 0, SEEDLEN, mask, 0, BLKLEN, Count, Keccak::KECCAK256_RATE_SIZE);
+
+	for (i = 0; i < Count; ++i)
+	{
+		MemoryTools::Copy(seeds, i * SEEDLEN, msgs, i * MSGLEN, SEEDLEN);
+
+		for (j = 0; j < BLKLEN; ++j)
+		{
+			msgs[(i * MSGLEN) + SEEDLEN + j] = Input[InOffset + (i * BLKLEN) + j] ^ mask[(i * BLKLEN) + j];
+		}
+	}
+
+	// the input is fully consumed, so the output may overlap it
+	XOFW(msgs, 0, MSGLEN, Output, OutOffset, N, Count, Keccak::KECCAK256_RATE_SIZE);
+}
+
 void SphincsUtils::TreeHash(std::vector<byte> &Root, size_t RootOffset, std::vector<byte> &Authpath, size_t AuthOffset, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed,
 	uint LeafIndex, uint IndexOffset, uint TreeHeight, std::array<uint, 8> & TreeAddress, std::vector<byte> &Stack, std::vector<uint> &Heights, size_t N,
 	std::function<void(std::vector<byte> &,
 		size_t,
 		const std::vector<byte> &,
 		const std::vector<byte> &,
-		uint, std::array<uint, 8> &,
+		uint,
+		uint,
+		std::array<uint, 8> &,
 		size_t)> &LeafGen)
 {
+	// the leaves are generated and reduced to a subtree root in lane-sized batches, 
+	// the subtree roots are then merged on the stack
+	const uint SUBHGT = (TreeHeight < SPX_TREEHASH_BATCH) ? TreeHeight : SPX_TREEHASH_BATCH;
+	const uint SUBLEN = (1UL << SUBHGT);
+	std::vector<std::array<uint, 8>> addrs(SUBLEN / 2);
 	std::vector<byte> buf(N + SPX_ADDR_BYTES + 2 * N);
-	std::vector<byte> leaf(N);
 	std::vector<byte> mask(2 * N);
+	std::vector<byte> nodes(SUBLEN * N);
 	size_t offset;
+	uint authidx;
+	uint hgt;
+	uint i;
 	uint idx;
+	uint nodecnt;
+	uint nodeidx;
 	uint treeidx;
 
 	offset = 0;
 
-	for (idx = 0; idx < static_cast<uint>(1 << TreeHeight); ++idx)
+	for (idx = 0; idx < static_cast<uint>(1UL << TreeHeight); idx += SUBLEN)
 	{
-		// add the next (fors or wots) leaf node to the stack
-		LeafGen(leaf, 0, SkSeed, PkSeed, idx + IndexOffset, TreeAddress, N);
-		MemoryTools::Copy(leaf, 0, Stack, offset * N, N);
-		++offset;
-		Heights[offset - 1] = 0;
+		// generate the next batch of (fors or wots) leaf nodes
+		LeafGen(nodes, 0, SkSeed, PkSeed, idx + IndexOffset, SUBLEN, TreeAddress, N);
 
-		// if this is a node we need for the auth path
-		if ((LeafIndex ^ 0x1) == idx)
+		// if this batch contains the leaf needed for the auth path
+		if ((LeafIndex ^ 0x1) >= idx && (LeafIndex ^ 0x1) < idx + SUBLEN)
 		{
-			MemoryTools::Copy(Stack, ((offset - 1) * N), Authpath, AuthOffset, N);
+			MemoryTools::Copy(nodes, ((LeafIndex ^ 0x1) - idx) * N, Authpath, AuthOffset, N);
+		}
+
+		// hash the node pairs of each layer of the batch together
+		for (hgt = 1; hgt <= SUBHGT; ++hgt)
+		{
+			nodecnt = (SUBLEN >> hgt);
+			nodeidx = (idx >> hgt);
+
+			for (i = 0; i < nodecnt; ++i)
+			{
+				addrs[i] = TreeAddress;
+				SetTreeHeight(addrs[i], hgt);
+				SetTreeIndex(addrs[i], nodeidx + i + (IndexOffset >> hgt));
+			}
+
+			THashW(nodes, 0, nodes, 0, 2, PkSeed, addrs, nodecnt, N);
+
+			// if this layer contains a node we need for the auth path
+			authidx = ((LeafIndex >> hgt) ^ 0x1);
+
+			if (authidx >= nodeidx && authidx < nodeidx + nodecnt)
+			{
+				MemoryTools::Copy(nodes, (authidx - nodeidx) * N, Authpath, AuthOffset + (N * hgt), N);
+			}
 		}
 
+		// add the batch root node to the stack
+		MemoryTools::Copy(nodes, 0, Stack, offset * N, N);
+		++offset;
+		Heights[offset - 1] = SUBHGT;
+
 		// while the top-most nodes are of equal height
 		while (offset >= 2 && Heights[offset - 1] == Heights[offset - 2])
 		{
@@ -143,4 +233,59 @@ void SphincsUtils::XOF(const std::vector<byte> &Input, size_t InOffset, size_t I
 	Keccak::XOFR24P1600(Input, InOffset, InLength, Output, OutOffset, OutLength, Rate);
 }
 
+void SphincsUtils::XOFW(const std::vector<byte> &Input, size_t InOffset, size_t InLength, std::vector<byte> &Output, size_t OutOffset, size_t OutLength, size_t Count, size_t Rate)
+{
+	// processes Count consecutive seeds of InLength bytes, writing Count consecutive outputs of OutLength bytes
+	size_t i;
+
+	i = 0;
+
+#if defined(CEX_KERNEL_SIMD256)
+
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+
+#	if defined(CEX_KERNEL_SIMD512)
+
+	if (SMDPRF == SimdProfiles::Simd512)
+	{
+		while (Count - i >= 8)
+		{
+			Keccak::XOFR24P8x1600(Input, InOffset + (i * InLength), InLength, Output, OutOffset + (i * OutLength), OutLength, Rate);
+			i += 8;
+		}
+	}
+
+#	endif
+
+	if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+	{
+		while (Count - i >= 4)
+		{
+			Keccak::XOFR24P4x1600(Input, InOffset + (i * InLength), InLength, Output, OutOffset + (i * OutLength), OutLength, Rate);
+			i += 4;
+		}
+
+		if (Count - i > 1)
+		{
+			// a partially filled vector is still faster than two or more sequential permutations
+			std::vector<byte> tmpi(4 * InLength, 0x00);
+			std::vector<byte> tmpo(4 * OutLength);
+
+			MemoryTools::Copy(Input, InOffset + (i * InLength), tmpi, 0, (Count - i) * InLength);
+			Keccak::XOFR24P4x1600(tmpi, 0, InLength, tmpo, 0, OutLength, Rate);
+			MemoryTools::Copy(tmpo, 0, Output, OutOffset + (i * OutLength), (Count - i) * OutLength);
+			MemoryTools::Clear(tmpi, 0, tmpi.size());
+			i = Count;
+		}
+	}
+
+#endif
+
+	while (i != Count)
+	{
+		Keccak::XOFR24P1600(Input, InOffset + (i * InLength), InLength, Output, OutOffset + (i * OutLength), OutLength, Rate);
+		++i;
+	}
+}
+
 NAMESPACE_SPHINCSEND
\ No newline at end of file
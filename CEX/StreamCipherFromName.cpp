@@ -148,7 +148,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCS:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::None);
@@ -162,7 +162,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCSH256:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::HMACSHA256);
@@ -176,7 +176,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCSH512:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::HMACSHA512);
@@ -190,7 +190,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCSK256:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::KMAC256);
@@ -204,7 +204,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCSK512:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::KMAC512);
@@ -218,7 +218,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCSK1024:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::KMAC1024);
@@ -232,7 +232,7 @@ IStreamCipher* StreamCipherFromName::GetInstance(StreamCiphers StreamCipherType)
 			}
 			case StreamCiphers::RCSP256:
 			{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 				if (dtc.AESNI())
 				{
 					cptr = new ACS(StreamAuthenticators::Poly1305);
@@ -124,7 +124,7 @@ bool SystemTools::HasRdRand()
 {
 	if (!HAS_RDRAND)
 	{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 		CpuDetect dtc;
 		HAS_RDRAND = dtc.RDRAND();
 #else
@@ -139,7 +139,7 @@ bool SystemTools::HasRdtsc()
 {
 	if (!TMR_RDTSC)
 	{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 		CpuDetect dtc;
 		TMR_RDTSC = dtc.RDTSCP();
 #else
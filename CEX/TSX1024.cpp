@@ -1,17 +1,13 @@
 #include "TSX1024.h"
+#include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MacFromName.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include "ParallelTuner.h"
 #include "SHAKE.h"
 #include "Threefish.h"
 
-#if defined(__AVX2__)
-#	include "ULong256.h"
-#elif defined(__AVX__)
-#	include "ULong128.h"
-#endif
-
 NAMESPACE_STREAM
 
 using Utility::IntegerTools;
@@ -70,6 +66,7 @@ TSX1024::TSX1024(StreamAuthenticators AuthenticatorType)
 		Helper::MacFromName::GetInstance(AuthenticatorType)),
 	m_parallelProfile(BLOCK_SIZE, true, STATE_PRECACHED, true)
 {
+	ParallelTuner::Apply(Enumeral(), m_parallelProfile);
 }
 
 TSX1024::~TSX1024()
@@ -399,11 +396,15 @@ void TSX1024::Generate(std::unique_ptr<TSX1024State> &State, std::array<ulong, 2
 
 	ctr = 0;
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD256)
+	const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+#endif
+
+#if defined(CEX_KERNEL_SIMD512)
 
 	const size_t AVX512BLK = 8 * BLOCK_SIZE;
 
-	if (Length >= AVX512BLK)
+	if (SMDPRF == SimdProfiles::Simd512 && Length >= AVX512BLK)
 	{
 		const size_t SEGALN = Length - (Length % AVX512BLK);
 		std::array<ulong, 16> ctr16;
@@ -436,17 +437,19 @@ void TSX1024::Generate(std::unique_ptr<TSX1024State> &State, std::array<ulong, 2
 			MemoryTools::Copy(Counter, 0, ctr16, 7, 8);
 			MemoryTools::Copy(Counter, 1, ctr16, 15, 8);
 			IntegerTools::LeIncrementW(Counter);
-			Threefish::PemuteP8x1024H(State->Key, ctr16, State->Tweak, tmp128, ROUND_COUNT);
-			MemoryTools::Copy(tmp128, 0, Output, OutOffset + ctr, AVX2BLK);
+			Threefish::PemuteP8x1024H(State->Key.data(), ctr16.data(), State->Tweak.data(), tmp128.data(), ROUND_COUNT);
+			MemoryTools::Copy(tmp128, 0, Output, OutOffset + ctr, AVX512BLK);
 			ctr += AVX512BLK;
 		}
 	}
 
-#elif defined(__AVX2__)
+#endif
+
+#if defined(CEX_KERNEL_SIMD256)
 
 	const size_t AVX2BLK = 4 * BLOCK_SIZE;
 
-	if (Length >= AVX2BLK)
+	if (SMDPRF == SimdProfiles::Simd256 && Length >= AVX2BLK)
 	{
 		const size_t SEGALN = Length - (Length % AVX2BLK);
 		std::array<ulong, 8> ctr8;
@@ -467,7 +470,7 @@ void TSX1024::Generate(std::unique_ptr<TSX1024State> &State, std::array<ulong, 2
 			MemoryTools::Copy(Counter, 0, ctr8, 3, 8);
 			MemoryTools::Copy(Counter, 1, ctr8, 7, 8);
 			IntegerTools::LeIncrementW(Counter);
-			Threefish::PemuteP4x1024H(State->Key, ctr8, State->Tweak, tmp64, ROUND_COUNT);
+			Threefish::PemuteP4x1024H(State->Key.data(), ctr8.data(), State->Tweak.data(), tmp64.data(), ROUND_COUNT);
 			MemoryTools::Copy(tmp64, 0, Output, OutOffset + ctr, AVX2BLK);
 			ctr += AVX2BLK;
 		}
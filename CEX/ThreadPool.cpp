@@ -0,0 +1,251 @@
+#include "ThreadPool.h"
+#include "ParallelTools.h"
+
+NAMESPACE_UTILITY
+
+const std::string ThreadPool::CLASS_NAME("ThreadPool");
+
+namespace
+{
+	// the queue index owned by the current thread, or NOQUEUE on threads outside the pool
+	const size_t NOQUEUE = static_cast<size_t>(~0ULL);
+	thread_local size_t WorkerQueue = NOQUEUE;
+}
+
+//~~~Constructor~~~//
+
+ThreadPool::ThreadPool(size_t Workers)
+	:
+	m_nextQueue(0),
+	m_pendingItems(0),
+	m_queues(0),
+	m_shutdown(false),
+	m_signal(),
+	m_signalLock(),
+	m_workers(0)
+{
+	size_t i;
+
+	for (i = 0; i < Workers; ++i)
+	{
+		m_queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+	}
+
+	for (i = 0; i < Workers; ++i)
+	{
+		m_workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_signalLock);
+		m_shutdown = true;
+	}
+
+	m_signal.notify_all();
+
+	for (size_t i = 0; i < m_workers.size(); ++i)
+	{
+		if (m_workers[i].joinable())
+		{
+			m_workers[i].join();
+		}
+	}
+
+	m_workers.clear();
+	m_queues.clear();
+}
+
+//~~~Accessors~~~//
+
+ThreadPool &ThreadPool::Instance()
+{
+	// the calling thread always executes one share of the loop
+	static ThreadPool pool(ParallelTools::ProcessorCount() > 1 ? ParallelTools::ProcessorCount() - 1 : 0);
+
+	return pool;
+}
+
+size_t ThreadPool::WorkerCount() const
+{
+	return m_workers.size();
+}
+
+//~~~Public Functions~~~//
+
+void ThreadPool::ParallelFor(size_t From, size_t To, const std::function<void(size_t)> &F)
+{
+	WorkItem item;
+	size_t i;
+
+	if (To <= From)
+	{
+		return;
+	}
+
+	if (m_workers.size() == 0 || To - From == 1)
+	{
+		for (i = From; i < To; ++i)
+		{
+			F(i);
+		}
+
+		return;
+	}
+
+	TaskGroup group(F, To - From);
+	const size_t OWNQ = WorkerQueue;
+
+	// counted before the items are visible, so a pop can never underflow the pending count
+	m_pendingItems += (To - From - 1);
+
+	// nested loops stay on the owners queue and are stolen by idle workers, external calls are spread across the queues
+	for (i = From + 1; i < To; ++i)
+	{
+		const size_t QIDX = (OWNQ != NOQUEUE) ? OWNQ : (m_nextQueue++ % m_queues.size());
+		std::lock_guard<std::mutex> lock(m_queues[QIDX]->Lock);
+		m_queues[QIDX]->Items.push_back({ &group, i });
+	}
+
+	{
+		// taking the lock orders the pending count with the workers wait predicate
+		std::lock_guard<std::mutex> lock(m_signalLock);
+	}
+
+	m_signal.notify_all();
+
+	// the calling thread processes the first index
+	Execute({ &group, From });
+
+	// help with the queued work until this group has completed
+	while (group.Remaining.load() != 0)
+	{
+		if (TryTake(OWNQ, item))
+		{
+			Execute(item);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	if (group.Error != nullptr)
+	{
+		std::rethrow_exception(group.Error);
+	}
+}
+
+//~~~Private Functions~~~//
+
+void ThreadPool::Execute(const WorkItem &Item)
+{
+	try
+	{
+		Item.Group->Function(Item.Index);
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> lock(Item.Group->ErrorLock);
+
+		if (Item.Group->Error == nullptr)
+		{
+			Item.Group->Error = std::current_exception();
+		}
+	}
+
+	// the group may be released by the waiting thread as soon as this reaches zero
+	--Item.Group->Remaining;
+}
+
+bool ThreadPool::TryPop(size_t Queue, WorkItem &Item)
+{
+	std::lock_guard<std::mutex> lock(m_queues[Queue]->Lock);
+	bool ret;
+
+	ret = false;
+
+	if (!m_queues[Queue]->Items.empty())
+	{
+		Item = m_queues[Queue]->Items.back();
+		m_queues[Queue]->Items.pop_back();
+		--m_pendingItems;
+		ret = true;
+	}
+
+	return ret;
+}
+
+bool ThreadPool::TrySteal(size_t Queue, WorkItem &Item)
+{
+	std::lock_guard<std::mutex> lock(m_queues[Queue]->Lock);
+	bool ret;
+
+	ret = false;
+
+	if (!m_queues[Queue]->Items.empty())
+	{
+		Item = m_queues[Queue]->Items.front();
+		m_queues[Queue]->Items.pop_front();
+		--m_pendingItems;
+		ret = true;
+	}
+
+	return ret;
+}
+
+bool ThreadPool::TryTake(size_t Queue, WorkItem &Item)
+{
+	const size_t QUECNT = m_queues.size();
+	const size_t QSTART = (Queue != NOQUEUE) ? Queue : 0;
+	size_t i;
+	bool ret;
+
+	ret = false;
+
+	if (m_pendingItems.load() != 0)
+	{
+		if (Queue != NOQUEUE)
+		{
+			ret = TryPop(Queue, Item);
+		}
+
+		for (i = 1; i <= QUECNT && !ret; ++i)
+		{
+			ret = TrySteal((QSTART + i) % QUECNT, Item);
+		}
+	}
+
+	return ret;
+}
+
+void ThreadPool::WorkerLoop(size_t Queue)
+{
+	WorkItem item;
+
+	WorkerQueue = Queue;
+
+	while (true)
+	{
+		if (TryTake(Queue, item))
+		{
+			Execute(item);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_signalLock);
+		m_signal.wait(lock, [this]()
+		{
+			return m_shutdown.load() || m_pendingItems.load() != 0;
+		});
+
+		if (m_shutdown.load())
+		{
+			break;
+		}
+	}
+}
+
+NAMESPACE_UTILITYEND
@@ -0,0 +1,124 @@
+#ifndef CEX_THREADPOOL_H
+#define CEX_THREADPOOL_H
+
+#include "CexDomain.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+NAMESPACE_UTILITY
+
+/// <summary>
+/// A process-wide persistent work-stealing thread pool.
+/// <para>The worker threads are created once on first use and live for the lifetime of the process.
+/// Each worker owns a double-ended queue; the owner pops work from the back of its own queue, idle workers steal from the front of the other queues.
+/// The calling thread of a parallel loop executes the first index itself and helps drain the queues while it waits, so nested parallel loops can not deadlock.</para>
+/// </summary>
+class ThreadPool final
+{
+private:
+
+	struct TaskGroup
+	{
+		TaskGroup(const std::function<void(size_t)> &Function, size_t Count)
+			:
+			Error(nullptr),
+			ErrorLock(),
+			Function(Function),
+			Remaining(Count)
+		{
+		}
+
+		std::exception_ptr Error;
+		std::mutex ErrorLock;
+		const std::function<void(size_t)> &Function;
+		std::atomic<size_t> Remaining;
+	};
+
+	struct WorkItem
+	{
+		TaskGroup* Group;
+		size_t Index;
+	};
+
+	struct WorkQueue
+	{
+		std::deque<WorkItem> Items;
+		std::mutex Lock;
+	};
+
+	static const std::string CLASS_NAME;
+
+	std::atomic<size_t> m_nextQueue;
+	std::atomic<size_t> m_pendingItems;
+	std::vector<std::unique_ptr<WorkQueue>> m_queues;
+	std::atomic<bool> m_shutdown;
+	std::condition_variable m_signal;
+	std::mutex m_signalLock;
+	std::vector<std::thread> m_workers;
+
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	ThreadPool(const ThreadPool&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// <summary>
+	/// Constructor: instantiate the pool with a fixed number of worker threads
+	/// </summary>
+	///
+	/// <param name="Workers">The number of persistent worker threads; if zero, all loops are executed on the calling thread</param>
+	explicit ThreadPool(size_t Workers);
+
+	/// <summary>
+	/// Destructor: signals and joins the worker threads
+	/// </summary>
+	~ThreadPool();
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The process-wide pool instance, sized to the number of processors minus the calling thread
+	/// </summary>
+	static ThreadPool &Instance();
+
+	/// <summary>
+	/// Read Only: The number of persistent worker threads
+	/// </summary>
+	size_t WorkerCount() const;
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Execute a function once for each index in the range, distributing the indices over the worker queues.
+	/// <para>The call blocks until every index has completed; the first exception thrown by the function is re-thrown on the calling thread.</para>
+	/// </summary>
+	///
+	/// <param name="From">The inclusive starting position</param>
+	/// <param name="To">The exclusive ending position</param>
+	/// <param name="F">The function delegate</param>
+	void ParallelFor(size_t From, size_t To, const std::function<void(size_t)> &F);
+
+private:
+
+	static void Execute(const WorkItem &Item);
+	bool TryPop(size_t Queue, WorkItem &Item);
+	bool TrySteal(size_t Queue, WorkItem &Item);
+	bool TryTake(size_t Queue, WorkItem &Item);
+	void WorkerLoop(size_t Queue);
+};
+
+NAMESPACE_UTILITYEND
+#endif
@@ -21,22 +21,8 @@
 
 #include "CexDomain.h"
 
-#if defined(__AVX2__)
-#	include "ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "ULong512.h"
-#endif
-
 NAMESPACE_STREAM
 
-#if defined(__AVX2__)
-using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-using Numeric::ULong512;
-#endif
-
 /// <summary>
 /// Contains the Threefish 256, 512, and 1024bit permutation functions.
 /// <para>The function names are in the format; Permute-rounds-bits-suffix, ex. PemuteR72P256C, 72 rounds, permutes 256 bits, using the compact form of the function. \n
@@ -46,122 +32,13 @@ using Numeric::ULong512;
 /// The H suffix denotes functions that take an SIMD wrapper class (ULongXXX) as the state values, and process state in SIMD parallel blocks.</para>
 /// <para>This class contains wide forms of the functions; PemuteP4x256H, PemuteP4x512H, and PemuteP4x1024H use AVX2 instructions. \n
 /// Experimental functions using AVX512 instructions are also implemented; PemuteP8x256H, PemuteP8x512H, and PemuteP8x1024H. \n
-/// These functions are not visible until run-time on some compiler platforms unless the compiler flag (__AVX2__ or __AVX512__) is explicitly declared.</para>
+/// The wide forms are compiled in their own translation units (ThreefishSimd256 and ThreefishSimd512), each built with its instruction set enabled; \n
+/// they take raw pointers so that no container or utility code is instantiated with a wider instruction set. \n
+/// When CEX_SIMD_DISPATCH is defined the callers select a wide form at run-time with CpuDetect::SimdProfile(), 
+/// otherwise they are only visible when the compiler flag (__AVX2__ or __AVX512__) is explicitly declared.</para>
 /// </summary>
 class Threefish
 {
-private:
-
-	// AVX2
-	template<typename T>
-	static void Store4xULL256(std::array<T, 4> &C, std::array<ulong, 16> &State)
-	{
-		std::array<ulong, 4> tmp;
-		size_t i;
-
-		for (i = 0; i < 4; ++i)
-		{
-			C[i].Store(tmp, 0);
-			State[i] = tmp[0];
-			State[i + 4] = tmp[1];
-			State[i + 8] = tmp[2];
-			State[i + 12] = tmp[3];
-		}
-	}
-
-	template<typename T>
-	static void Store8xULL256(std::array<T, 8> &C, std::array<ulong, 32> &State)
-	{
-		std::array<ulong, 4> tmp;
-		size_t i;
-
-		for (i = 0; i < 8; ++i)
-		{
-			C[i].Store(tmp, 0);
-			State[i] = tmp[0];
-			State[i + 8] = tmp[1];
-			State[i + 16] = tmp[2];
-			State[i + 24] = tmp[3];
-		}
-	}
-
-	template<typename T>
-	static void Store16xULL256(std::array<T, 16> &C, std::array<ulong, 64> &State)
-	{
-		std::array<ulong, 4> tmp;
-		size_t i;
-
-		for (i = 0; i < 16; ++i)
-		{
-			C[i].Store(tmp, 0);
-			State[i] = tmp[0];
-			State[i + 16] = tmp[1];
-			State[i + 32] = tmp[2];
-			State[i + 48] = tmp[3];
-		}
-	}
-
-	// AVX512
-	template<typename T>
-	static void Store4xULL512(std::array<T, 4> &C, std::array<ulong, 32> &State)
-	{
-		std::array<ulong, 8> tmp;
-		size_t i;
-
-		for (i = 0; i < 4; ++i)
-		{
-			C[i].Store(tmp, 0);
-			State[i] = tmp[0];
-			State[i + 4] = tmp[1];
-			State[i + 8] = tmp[2];
-			State[i + 12] = tmp[3];
-			State[i + 16] = tmp[4];
-			State[i + 20] = tmp[5];
-			State[i + 24] = tmp[6];
-			State[i + 30] = tmp[7];
-		}
-	}
-
-	template<typename T>
-	static void Store8xULL512(std::array<T, 8> &C, std::array<ulong, 64> &State)
-	{
-		std::array<ulong, 8> tmp;
-		size_t i;
-
-		for (i = 0; i < 8; ++i)
-		{
-			C[i].Store(tmp, 0);
-			State[i] = tmp[0];
-			State[i + 8] = tmp[1];
-			State[i + 16] = tmp[2];
-			State[i + 24] = tmp[3];
-			State[i + 32] = tmp[4];
-			State[i + 40] = tmp[5];
-			State[i + 48] = tmp[6];
-			State[i + 56] = tmp[7];
-		}
-	}
-
-	template<typename T>
-	static void Store16xULL512(std::array<T, 16> &C, std::array<ulong, 128> &State)
-	{
-		std::array<ulong, 8> tmp;
-		size_t i;
-
-		for (i = 0; i < 16; ++i)
-		{
-			C[i].Store(tmp, 0);
-			State[i] = tmp[0];
-			State[i + 16] = tmp[1];
-			State[i + 32] = tmp[2];
-			State[i + 48] = tmp[3];
-			State[i + 64] = tmp[4];
-			State[i + 80] = tmp[5];
-			State[i + 96] = tmp[6];
-			State[i + 112] = tmp[7];
-		}
-	}
-
 public:
 
 	//~~~Threefish-256~~~//
@@ -192,7 +69,7 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PemuteR72P256U(const std::array<ulong, 4> &Key, const std::array<ulong, 2> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 4> &State);
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized form of the Threefish-256 permutation function.
@@ -205,11 +82,11 @@ public:
 	/// <param name="Tweak">The cipher tweak array</param>
 	/// <param name="State">The permutations state array</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 72</param>
-	static void PemuteP4x256H(const std::array<ulong, 4> &Key, const std::array<ulong, 8> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 16> &State, size_t Rounds);
+	static void PemuteP4x256H(const ulong* Key, const ulong* Counter, const ulong* Tweak, ulong* State, size_t Rounds);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized form of the Threefish-256 permutation function.
@@ -222,7 +99,7 @@ public:
 	/// <param name="Tweak">The cipher tweak array</param>
 	/// <param name="State">The permutations state array</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 72</param>
-	static void PemuteP8x256H(const std::array<ulong, 4> &Key, const std::array<ulong, 16> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 32> &State, size_t Rounds);
+	static void PemuteP8x256H(const ulong* Key, const ulong* Counter, const ulong* Tweak, ulong* State, size_t Rounds);
 
 #endif
 
@@ -254,7 +131,7 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PemuteR96P512U(const std::array<ulong, 8> &Key, const std::array<ulong, 2> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 8> &State);
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized form of the Threefish-512 permutation function.
@@ -267,11 +144,11 @@ public:
 	/// <param name="Tweak">The cipher tweak array</param>
 	/// <param name="State">The permutations state array</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 96</param>
-	static void PemuteP4x512H(const std::array<ulong, 8> &Key, const std::array<ulong, 8> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 32> &State, size_t Rounds);
+	static void PemuteP4x512H(const ulong* Key, const ulong* Counter, const ulong* Tweak, ulong* State, size_t Rounds);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized form of the Threefish-512 permutation function.
@@ -284,7 +161,7 @@ public:
 	/// <param name="Tweak">The cipher tweak array</param>
 	/// <param name="State">The permutations state array</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 96</param>
-	static void PemuteP8x512H(const std::array<ulong, 8> &Key, const std::array<ulong, 16> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 64> &State, size_t Rounds);
+	static void PemuteP8x512H(const ulong* Key, const ulong* Counter, const ulong* Tweak, ulong* State, size_t Rounds);
 
 #endif
 
@@ -316,7 +193,7 @@ public:
 	/// <param name="State">The permutations state array</param>
 	static void PemuteR120P1024U(const std::array<ulong, 16> &Key, const std::array<ulong, 2> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 16> &State);
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
 	/// <summary>
 	/// The horizontally vectorized form of the Threefish-1024 permutation function.
@@ -329,11 +206,11 @@ public:
 	/// <param name="Tweak">The cipher tweak array</param>
 	/// <param name="State">The permutations state array</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 128</param>
-	static void PemuteP4x1024H(const std::array<ulong, 16> &Key, const std::array<ulong, 8> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 64> &State, size_t Rounds);
+	static void PemuteP4x1024H(const ulong* Key, const ulong* Counter, const ulong* Tweak, ulong* State, size_t Rounds);
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
 	/// <summary>
 	/// The horizontally vectorized form of the Threefish-1024 permutation function.
@@ -346,7 +223,7 @@ public:
 	/// <param name="Tweak">The cipher tweak array</param>
 	/// <param name="State">The permutations state array</param>
 	/// <param name="Rounds">The number of mixing rounds; the default is 128</param>
-	static void PemuteP8x1024H(const std::array<ulong, 16> &Key, const std::array<ulong, 16> &Counter, const std::array<ulong, 2> &Tweak, std::array<ulong, 128> &State, size_t Rounds);
+	static void PemuteP8x1024H(const ulong* Key, const ulong* Counter, const ulong* Tweak, ulong* State, size_t Rounds);
 
 #endif
 };
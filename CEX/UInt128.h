@@ -23,7 +23,7 @@
 #include "Intrinsics.h"
 #include "SimdIntegers.h"
 
-NAMESPACE_NUMERIC
+NAMESPACE_NUMERICSIMD
 
 using Enumeration::SimdIntegers;
 
@@ -760,6 +760,6 @@ public:
 	}
 };
 
-NAMESPACE_NUMERICEND
+NAMESPACE_NUMERICSIMDEND
 
 #endif
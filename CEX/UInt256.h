@@ -23,7 +23,7 @@
 #include "Intrinsics.h"
 #include "SimdIntegers.h"
 
-NAMESPACE_NUMERIC
+NAMESPACE_NUMERICSIMD
 
 using Enumeration::SimdIntegers;
 
@@ -803,5 +803,5 @@ private:
 	}
 };
 
-NAMESPACE_NUMERICEND
+NAMESPACE_NUMERICSIMDEND
 #endif
\ No newline at end of file
@@ -23,7 +23,7 @@
 #include "Intrinsics.h"
 #include "SimdIntegers.h"
 
-NAMESPACE_NUMERIC
+NAMESPACE_NUMERICSIMD
 
 using Enumeration::SimdIntegers;
 
@@ -169,7 +169,7 @@ public:
 	{
 		CEXASSERT(sizeof(uint) <= sizeof(Array::value_type), "The input array integer size must be less or equal to uint32");
 
-		zmm = _mm256_set_epi64x(static_cast<uint>(Input[Offset]),
+		ymm = _mm256_set_epi64x(static_cast<uint>(Input[Offset]),
 			static_cast<uint>(Input[Offset + (sizeof(uint) / sizeof(Array::value_type))]),
 			static_cast<uint>(Input[Offset + (sizeof(uint) / sizeof(Array::value_type) * 2)]),
 			static_cast<uint>(Input[Offset + (sizeof(uint) / sizeof(Array::value_type) * 3)]));
@@ -676,5 +676,5 @@ public:
 	}
 };
 
-NAMESPACE_NUMERICEND
+NAMESPACE_NUMERICSIMDEND
 #endif
\ No newline at end of file
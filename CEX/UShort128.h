@@ -23,7 +23,7 @@
 #include "Intrinsics.h"
 #include "SimdIntegers.h"
 
-NAMESPACE_NUMERIC
+NAMESPACE_NUMERICSIMD
 
 using Enumeration::SimdIntegers;
 
@@ -707,5 +707,5 @@ public:
 	}
 };
 
-NAMESPACE_NUMERICEND
+NAMESPACE_NUMERICSIMDEND
 #endif
\ No newline at end of file
@@ -0,0 +1,726 @@
+// The GPL version 3 License (GPLv3)
+// 
+// Copyright (c) 2019 vtdev.com
+// This file is part of the CEX Cryptographic library.
+// 
+// This program is free software : you can redistribute it and / or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CEX_USHORT256_H
+#define CEX_USHORT256_H
+
+#include "CexDomain.h"
+#include "Intrinsics.h"
+#include "SimdIntegers.h"
+
+NAMESPACE_NUMERICSIMD
+
+using Enumeration::SimdIntegers;
+
+/// <summary>
+/// An AVX2 256bit intrinsics wrapper.
+/// <para>Processes blocks of 16bit unsigned integers.</para>
+/// </summary>
+class UShort256
+{
+public:
+
+	/// <summary>
+	/// The internal m256i register value
+	/// </summary>
+	__m256i ymm;
+
+	//~~~ Constants~~~//
+
+	/// <summary>
+	/// A UShort256 initialized with 16x 16bit integers to the value one
+	/// </summary>
+	inline static const UShort256 ONE()
+	{
+		return UShort256(_mm256_set1_epi16(1));
+	}
+
+	/// <summary>
+	/// A UShort256 initialized with 16x 16bit integers to the value zero
+	/// </summary>
+	inline static const UShort256 ZERO()
+	{
+		return UShort256(_mm256_set1_epi16(0));
+	}
+
+	//~~~ Constructors~~~//
+
+	/// <summary>
+	/// Default constructor; does not initialize the register
+	/// </summary>
+	UShort256() 
+	{
+	}
+
+	/// <summary>
+	/// Initialize the register with an __m256i value
+	/// </summary>
+	///
+	/// <param name="X">The 128bit register</param>
+	explicit UShort256(__m256i const &X)
+	{
+		ymm = X;
+	}
+
+	/// <summary>
+	/// Initialize with an integer array
+	/// </summary>
+	///
+	/// <param name="Input">The source integer array; must be at least 256 bits in length</param>
+	/// <param name="Offset">The starting position within the Input array</param>
+	template<typename Array>
+	explicit UShort256(const Array &Input, size_t Offset)
+	{
+		ymm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&Input[Offset]));
+	}
+
+	/// <summary>
+	/// Initialize with 16 * 16bit unsigned integers
+	/// </summary>
+	///
+	/// <param name="X0">ushort 0</param>
+	/// <param name="X1">ushort 1</param>
+	/// <param name="X2">ushort 2</param>
+	/// <param name="X3">ushort 3</param>
+	/// <param name="X4">ushort 4</param>
+	/// <param name="X5">ushort 5</param>
+	/// <param name="X6">ushort 6</param>
+	/// <param name="X7">ushort 7</param>
+	/// <param name="X8">ushort 8</param>
+	/// <param name="X9">ushort 9</param>
+	/// <param name="X10">ushort 10</param>
+	/// <param name="X11">ushort 11</param>
+	/// <param name="X12">ushort 12</param>
+	/// <param name="X13">ushort 13</param>
+	/// <param name="X14">ushort 14</param>
+	/// <param name="X15">ushort 15</param>
+	explicit UShort256(ushort X0, ushort X1, ushort X2, ushort X3, ushort X4, ushort X5, ushort X6, ushort X7, ushort X8, ushort X9, ushort X10, ushort X11, ushort X12, ushort X13, ushort X14, ushort X15)
+	{
+		ymm = _mm256_set_epi16(X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12, X13, X14, X15);
+	}
+
+	/// <summary>
+	/// Initialize with 1 * 16bit unsigned integer; copied to every register
+	/// </summary>
+	///
+	/// <param name="X">The uint to add</param>
+	explicit UShort256(ushort X)
+	{
+		ymm = _mm256_set1_epi16(X);
+	}
+
+	/// <summary>
+	/// Read Only: The SIMD wrappers type name
+	/// </summary>
+	const SimdIntegers Enumeral()
+	{
+		return SimdIntegers::UShort256;
+	}
+
+	//~~~ Load and Store~~~//
+
+	/// <summary>
+	/// Load with 1 * 16bit unsigned integer; copied to every register
+	/// </summary>
+	///
+	/// <param name="X">Set all uint16 integers to this value</param>
+	inline void Load(ushort X)
+	{
+		ymm = _mm256_set1_epi16(X);
+	}
+
+	/// <summary>
+	/// Load an array into a register
+	/// </summary>
+	///
+	/// <param name="Input">The source integer array; must be at least 256 bits in length</param>
+	/// <param name="Offset">The starting position within the Input array</param>
+	template<typename Array>
+	inline void Load(const Array &Input, size_t Offset)
+	{
+		ymm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&Input[Offset]));
+	}
+
+	/// <summary>
+	/// Load with 16 * 16bit unsigned integers in Little Endian format
+	/// </summary>
+	///
+	/// <param name="X0">ushort 0</param>
+	/// <param name="X1">ushort 1</param>
+	/// <param name="X2">ushort 2</param>
+	/// <param name="X3">ushort 3</param>
+	/// <param name="X4">ushort 4</param>
+	/// <param name="X5">ushort 5</param>
+	/// <param name="X6">ushort 6</param>
+	/// <param name="X7">ushort 7</param>
+	/// <param name="X8">ushort 8</param>
+	/// <param name="X9">ushort 9</param>
+	/// <param name="X10">ushort 10</param>
+	/// <param name="X11">ushort 11</param>
+	/// <param name="X12">ushort 12</param>
+	/// <param name="X13">ushort 13</param>
+	/// <param name="X14">ushort 14</param>
+	/// <param name="X15">ushort 15</param>
+	inline void Load(ushort X0, ushort X1, ushort X2, ushort X3, ushort X4, ushort X5, ushort X6, ushort X7, ushort X8, ushort X9, ushort X10, ushort X11, ushort X12, ushort X13, ushort X14, ushort X15)
+	{
+		ymm = _mm256_set_epi16(X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12, X13, X14, X15);
+	}
+
+	/// <summary>
+	/// Store register in a T size integer array in Little Endian format
+	/// </summary>
+	///
+	/// <param name="Output">The destination integer array; must be at least 256 bits in length</param>
+	/// <param name="Offset">The starting position within the Output array</param>
+	template<typename Array>
+	inline void Store(Array &Output, size_t Offset) const
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Output[Offset]), ymm);
+	}
+
+	//~~~ Methods~~~//
+
+	/// <summary>
+	/// Returns the absolute value
+	/// </summary>
+	///
+	/// <param name="Value">The comparison integer</param>
+	/// 
+	/// <returns>The processed UShort256</returns>
+	inline static UShort256 Abs(const UShort256 &Value)
+	{
+		return UShort256(_mm256_abs_epi16(Value.ymm));
+	}
+
+	/// <summary>
+	/// Computes the bitwise AND of the 256-bit value in *this* and the bitwise NOT of the 256-bit value in X
+	/// </summary>
+	///
+	/// <param name="Value">The comparison integer</param>
+	/// 
+	/// <returns>The processed UShort256</returns>
+	inline UShort256 AndNot(const UShort256 &Value)
+	{
+		return UShort256(_mm256_andnot_si256(ymm, Value.ymm));
+	}
+
+	/// <summary>
+	/// Returns the bitwise negation of 16 16bit integers
+	/// </summary>
+	///
+	/// <param name="Value">The integers to negate</param>
+	/// 
+	/// <returns>The processed UShort256</returns>
+	inline static UShort256 Negate(const UShort256 &Value)
+	{
+		return UShort256(_mm256_sub_epi16(_mm256_set1_epi16(0), Value.ymm));
+	}
+
+	/// <summary>
+	/// Multiplies the 16 signed 16-bit integers and returns the high 16 bits of each 32-bit product
+	/// </summary>
+	///
+	/// <param name="X">The first operand</param>
+	/// <param name="Y">The second operand</param>
+	/// 
+	/// <returns>The processed UShort256</returns>
+	inline static UShort256 MulHi(const UShort256 &X, const UShort256 &Y)
+	{
+		return UShort256(_mm256_mulhi_epi16(X.ymm, Y.ymm));
+	}
+
+	/// <summary>
+	/// Computes the 16 bit left rotation of sixteen 16bit unsigned integers
+	/// </summary>
+	///
+	/// <param name="Shift">The shift degree; maximum is 16</param>
+	inline void RotL16(int Shift)
+	{
+		CEXASSERT(Shift <= 16, "Shift size is too large");
+		ymm = _mm256_or_si256(_mm256_slli_epi16(ymm, static_cast<int>(Shift)), _mm256_srli_epi16(ymm, static_cast<int>(16 - Shift)));
+	}
+
+	/// <summary>
+	/// Computes the 16 bit left rotation of sixteen 16bit unsigned integers
+	/// </summary>
+	///
+	/// <param name="Value">The integer to rotate</param>
+	/// <param name="Shift">The shift degree; maximum is 16</param>
+	/// 
+	/// <returns>The rotated UShort256</returns>
+	inline static UShort256 RotL16(const UShort256 &Value, const int Shift)
+	{
+		CEXASSERT(Shift <= 16, "Shift size is too large");
+		return UShort256(_mm256_or_si256(_mm256_slli_epi16(Value.ymm, static_cast<int>(Shift)), _mm256_srli_epi16(Value.ymm, static_cast<int>(16 - Shift))));
+	}
+
+	/// <summary>
+	/// Computes the 16 bit right rotation of sixteen 16bit unsigned integers
+	/// </summary>
+	///
+	/// <param name="Shift">The shift degree; maximum is 16</param>
+	inline void RotR16(int Shift)
+	{
+		CEXASSERT(Shift <= 16, "Shift size is too large");
+		RotL16(16 - Shift);
+	}
+
+	/// <summary>
+	/// Computes the 16 bit right rotation of sixteen 16bit unsigned integers
+	/// </summary>
+	///
+	/// <param name="Value">The integer to rotate</param>
+	/// <param name="Shift">The shift degree; maximum is 16</param>
+	/// 
+	/// <returns>The rotated UShort256</returns>
+	inline static UShort256 RotR16(const UShort256 &Value, const int Shift)
+	{
+		CEXASSERT(Shift <= 16, "Shift size is too large");
+		return RotL16(Value, 16 - Shift);
+	}
+
+	/// <summary>
+	/// Shifts the 16 signed 16-bit integers in a right by count bits while shifting in the sign bit
+	/// </summary>
+	///
+	/// <param name="Value">The base integer</param>
+	/// <param name="Shift">The shift degree; maximum is 16</param>
+	/// 
+	/// <returns>The processed UShort256</returns>
+	inline static UShort256 ShiftRA(const UShort256 &Value, const int Shift)
+	{
+		CEXASSERT(Shift <= 16, "Shift size is too large");
+		return UShort256(_mm256_srai_epi16(Value.ymm, Shift));
+	}
+
+	/// <summary>
+	/// Shifts the 16 signed or unsigned 16-bit integers in a right by count bits while shifting in zeros
+	/// </summary>
+	///
+	/// <param name="Value">The base integer</param>
+	/// <param name="Shift">The shift degree; maximum is 16</param>
+	/// 
+	/// <returns>The processed UShort256</returns>
+	inline static UShort256 ShiftRL(const UShort256 &Value, const int Shift)
+	{
+		CEXASSERT(Shift <= 16, "Shift size is too large");
+		return UShort256(_mm256_srli_epi16(Value.ymm, Shift));
+	}
+
+	/// <summary>
+	/// Performs a byte swap on 16 unsigned integers
+	/// </summary>
+	/// 
+	/// <returns>The byte swapped UShort256</returns>
+	inline UShort256 Swap() const
+	{
+		__m256i tmpX = ymm;
+
+		tmpX = _mm256_shufflehi_epi16(tmpX, _MM_SHUFFLE(2, 3, 0, 1));
+		tmpX = _mm256_shufflelo_epi16(tmpX, _MM_SHUFFLE(2, 3, 0, 1));
+
+		return UShort256(_mm256_or_si256(_mm256_srli_epi16(tmpX, 8), _mm256_slli_epi16(tmpX, 8)));
+	}
+
+	/// <summary>
+	/// Performs a byte swap on 16 unsigned integers
+	/// </summary>
+	/// 		
+	/// <param name="X">The UShort256 to process</param>
+	/// 
+	/// <returns>The byte swapped UShort256</returns>
+	inline static UShort256 Swap(UShort256 &X)
+	{
+		__m256i tmpX = X.ymm;
+
+		tmpX = _mm256_shufflehi_epi16(tmpX, _MM_SHUFFLE(2, 3, 0, 1));
+		tmpX = _mm256_shufflelo_epi16(tmpX, _MM_SHUFFLE(2, 3, 0, 1));
+
+		return UShort256(_mm256_or_si256(_mm256_srli_epi16(tmpX, 8), _mm256_slli_epi16(tmpX, 8)));
+	}
+
+	/// <summary>
+	/// Returns the length of the register in bytes
+	/// </summary>
+	///
+	/// <returns>The registers size</returns>
+	inline static const size_t size() { return sizeof(__m256i); }
+
+	//~~~ Operators~~~//
+
+	/// <summary>
+	/// Type cast operator
+	/// </summary>
+	operator __m256i() const
+	{
+		return ymm;
+	}
+
+	/// <summary>
+	/// Add two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to add</param>
+	inline UShort256 operator + (const UShort256 &X) const
+	{
+		return UShort256(_mm256_add_epi16(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Add a value to this integer
+	/// </summary>
+	///
+	/// <param name="X">The value to add</param>
+	inline void operator += (const UShort256 &X)
+	{
+		ymm = _mm256_add_epi16(ymm, X.ymm);
+	}
+
+	/// <summary>
+	/// Increase prefix operator
+	/// </summary>
+	inline UShort256 operator ++ ()
+	{
+		return UShort256(ymm) + ONE();
+	}
+
+	/// <summary>
+	/// Increase postfix operator
+	/// </summary>
+	inline UShort256 operator ++ (int)
+	{
+		return UShort256(ymm) + ONE();
+	}
+
+	/// <summary>
+	/// Subtract two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to subtract</param>
+	inline UShort256 operator - (const UShort256 &X) const
+	{
+		return UShort256(_mm256_sub_epi16(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Subtract a value from this integer
+	/// </summary>
+	///
+	/// <param name="X">The value to subtract</param>
+	inline void operator -= (const UShort256 &X)
+	{
+		ymm = _mm256_sub_epi16(ymm, X.ymm);
+	}
+
+	/// <summary>
+	/// Decrease prefix operator
+	/// </summary>
+	inline UShort256 operator -- ()
+	{
+		return UShort256(ymm) - ONE();
+	}
+
+	/// <summary>
+	/// Decrease postfix operator
+	/// </summary>
+	inline UShort256 operator -- (int)
+	{
+		return UShort256(ymm) - ONE();
+	}
+
+	/// <summary>
+	/// Multiply two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to multiply</param>
+	inline UShort256 operator * (const UShort256 &X) const
+	{
+		return UShort256(_mm256_mullo_epi16(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Multiply a value with this integer
+	/// </summary>
+	///
+	/// <param name="X">The value to multiply</param>
+	inline void operator *= (const UShort256 &X)
+	{
+		ymm = _mm256_mullo_epi16(ymm, X.ymm);
+	}
+
+	/// <summary>
+	/// Divide two integers
+	/// </summary>
+	///
+	/// <param name="X">The divisor value</param>
+	inline UShort256 operator / (const UShort256 &X) const
+	{
+		std::array<ushort, 16> tmpA;
+		std::array<ushort, 16> tmpB;
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&tmpA[0]), ymm);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&tmpB[0]), X.ymm);
+		CEXASSERT(tmpB[0] != 0 && tmpB[1] != 0 && tmpB[2] != 0 && tmpB[3] != 0 && tmpB[4] != 0 && tmpB[5] != 0 && tmpB[6] != 0 && tmpB[7] != 0 && tmpB[8] != 0 && tmpB[9] != 0 && tmpB[10] != 0 && tmpB[11] != 0 && tmpB[12] != 0 && tmpB[13] != 0 && tmpB[14] != 0 && tmpB[15] != 0, "Division by zero");
+
+		return UShort256(tmpA[15] / tmpB[15], tmpA[14] / tmpB[14], tmpA[13] / tmpB[13], tmpA[12] / tmpB[12], tmpA[11] / tmpB[11], tmpA[10] / tmpB[10], tmpA[9] / tmpB[9], tmpA[8] / tmpB[8], tmpA[7] / tmpB[7], tmpA[6] / tmpB[6], tmpA[5] / tmpB[5], tmpA[4] / tmpB[4], tmpA[3] / tmpB[3], tmpA[2] / tmpB[2], tmpA[1] / tmpB[1], tmpA[0] / tmpB[0]);
+	}
+
+	/// <summary>
+	/// Divide this integer by a value
+	/// </summary>
+	///
+	/// <param name="X">The divisor value</param>
+	inline void operator /= (const UShort256 &X)
+	{
+		std::array<ushort, 16> tmpA;
+		std::array<ushort, 16> tmpB;
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&tmpA[0]), ymm);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&tmpB[0]), X.ymm);
+		CEXASSERT(tmpB[0] != 0 && tmpB[1] != 0 && tmpB[2] != 0 && tmpB[3] != 0 && tmpB[4] != 0 && tmpB[5] != 0 && tmpB[6] != 0 && tmpB[7] != 0 && tmpB[8] != 0 && tmpB[9] != 0 && tmpB[10] != 0 && tmpB[11] != 0 && tmpB[12] != 0 && tmpB[13] != 0 && tmpB[14] != 0 && tmpB[15] != 0, "Division by zero");
+
+		ymm = _mm256_set_epi16(tmpA[15] / tmpB[15], tmpA[14] / tmpB[14], tmpA[13] / tmpB[13], tmpA[12] / tmpB[12], tmpA[11] / tmpB[11], tmpA[10] / tmpB[10], tmpA[9] / tmpB[9], tmpA[8] / tmpB[8], tmpA[7] / tmpB[7], tmpA[6] / tmpB[6], tmpA[5] / tmpB[5], tmpA[4] / tmpB[4], tmpA[3] / tmpB[3], tmpA[2] / tmpB[2], tmpA[1] / tmpB[1], tmpA[0] / tmpB[0]);
+	}
+
+	/// <summary>
+	/// Get the remainder from a division operation between two integers
+	/// </summary>
+	///
+	/// <param name="X">The divisor value</param>
+	inline UShort256 operator % (const UShort256 &X) const
+	{
+		return UShort256(UShort256(ymm) - ((UShort256(ymm) / X) * X));
+	}
+
+	/// <summary>
+	/// Get the remainder from a division operation
+	/// </summary>
+	///
+	/// <param name="X">The divisor value</param>
+	inline void operator %= (const UShort256 &X)
+	{
+		ymm = UShort256(UShort256(ymm) - ((UShort256(ymm) / X) * X)).ymm;
+	}
+
+	/// <summary>
+	/// Xor two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to Xor</param>
+	inline UShort256 operator ^ (const UShort256 &X) const
+	{
+		return UShort256(_mm256_xor_si256(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Xor this integer by a value
+	/// </summary>
+	///
+	/// <param name="X">The value to Xor</param>
+	inline void operator ^= (const UShort256 &X)
+	{
+		ymm = _mm256_xor_si256(ymm, X.ymm);
+	}
+
+	/// <summary>
+	/// Bitwise OR of two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to OR</param>
+	inline UShort256 operator | (const UShort256 &X) const
+	{
+		return UShort256(_mm256_or_si256(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Bitwise OR this integer
+	/// </summary>
+	///
+	/// <param name="X">The value to OR</param>
+	inline void operator |= (const UShort256 &X)
+	{
+		ymm = _mm256_or_si256(ymm, X.ymm);
+	}
+
+	/// <summary>
+	/// Logical OR of two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to OR</param>
+	inline UShort256 operator || (const UShort256 &X) const
+	{
+		return UShort256(ymm) | X;
+	}
+
+	/// <summary>
+	/// Bitwise AND of two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to AND</param>
+	inline UShort256 operator & (const UShort256 &X) const
+	{
+		return UShort256(_mm256_and_si256(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Bitwise AND this integer
+	/// </summary>
+	///
+	/// <param name="X">The value to AND</param>
+	inline void operator &= (const UShort256 &X)
+	{
+		ymm = _mm256_and_si256(ymm, X.ymm);
+	}
+
+	/// <summary>
+	/// Logical AND of two integers
+	/// </summary>
+	///
+	/// <param name="X">The value to AND</param>
+	inline UShort256 operator && (const UShort256 &X) const
+	{
+		return UShort256(ymm) & X;
+	}
+
+	/// <summary>
+	/// Greater than operator
+	/// </summary>
+	///
+	/// <param name="X">The values to compare</param>
+	inline UShort256 operator > (UShort256 const &X) const
+	{
+		return UShort256(_mm256_cmpgt_epi16(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Less than operator
+	/// </summary>
+	///
+	/// <param name="X">The values to compare</param>
+	inline UShort256 operator < (UShort256 const &X) const
+	{
+		return UShort256(_mm256_cmpgt_epi16(X.ymm, ymm));
+	}
+
+	/// <summary>
+	/// Greater than or equal operator
+	/// </summary>
+	///
+	/// <param name="X">The values to compare</param>
+	inline UShort256 operator >= (UShort256 const &X) const
+	{
+		return UShort256(UShort256(~(X > UShort256(ymm))));
+	}
+
+	/// <summary>
+	/// Less than operator or equal
+	/// </summary>
+	///
+	/// <param name="X">The values to compare</param>
+	inline UShort256 operator <= (UShort256 const &X) const
+	{
+		return X >= UShort256(ymm);
+	}
+
+	/// <summary>
+	/// Left shift two integers
+	/// </summary>
+	///
+	/// <param name="Shift">The shift position</param>
+	inline UShort256 operator << (int Shift) const
+	{
+		return UShort256(_mm256_slli_epi16(ymm, static_cast<int>(Shift)));
+	}
+
+	/// <summary>
+	/// Left shift this integer
+	/// </summary>
+	///
+	/// <param name="Shift">The shift position</param>
+	inline void operator <<= (int Shift)
+	{
+		ymm = _mm256_slli_epi16(ymm, Shift);
+	}
+
+	/// <summary>
+	/// Right shift two integers
+	/// </summary>
+	///
+	/// <param name="Shift">The shift position</param>
+	inline UShort256 operator >> (int Shift) const
+	{
+		return UShort256(_mm256_srli_epi16(ymm, static_cast<int>(Shift)));
+	}
+
+	/// <summary>
+	/// Right shift this integer
+	/// </summary>
+	///
+	/// <param name="Shift">The shift position</param>
+	inline void operator >>= (int Shift)
+	{
+		ymm = _mm256_srli_epi16(ymm, Shift);
+	}
+
+	/// <summary>
+	/// Bitwise NOT this integer
+	/// </summary>
+	inline UShort256 operator ~ () const
+	{
+		return UShort256(_mm256_xor_si256(ymm, _mm256_set1_epi32(0xFFFFFFFF)));
+	}
+
+	/// <summary>
+	/// Equals assignment operator
+	/// </summary>
+	///
+	/// <param name="X">The value to assign</param>
+	inline void operator = (const UShort256 &X)
+	{
+		ymm = X.ymm;
+	}
+
+	/// <summary>
+	/// Compare two sets of integers for equality, returns max integer size if equal
+	/// </summary>
+	///
+	/// <param name="X">The values to compare</param>
+	inline UShort256 operator == (UShort256 const &X) const
+	{
+		return UShort256(_mm256_cmpeq_epi16(ymm, X.ymm));
+	}
+
+	/// <summary>
+	/// Compare two sets of integers for inequality, returns max integer size if inequal
+	/// </summary>
+	inline UShort256 operator ! () const
+	{
+		return UShort256(_mm256_cmpeq_epi16(ymm, _mm256_setzero_si256()));
+	}
+
+	/// <summary>
+	/// Compare this integer for inequality, returns max integer size if inequal
+	/// </summary>
+	///
+	/// <param name="X">The values to compare</param>
+	inline UShort256 operator != (const UShort256 &X) const
+	{
+		return ~UShort256(_mm256_cmpeq_epi16(ymm, X.ymm));
+	}
+};
+
+NAMESPACE_NUMERICSIMDEND
+#endif
\ No newline at end of file
@@ -40,48 +40,50 @@ void WOTS::ChainLengths(std::vector<int32_t> &Lengths, const std::vector<byte> &
 	WotsChecksum(Lengths, SPX_WOTS_LEN1, Lengths, N);
 }
 
-void WOTS::GenChain(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, uint Start, uint Steps,
-	const std::vector<byte> &PkSeed, std::array<uint, 8> &Address, size_t N)
+void WOTS::GenChains(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, const std::vector<uint> &Starts, const std::vector<uint> &Steps,
+	const std::vector<byte> &PkSeed, const std::vector<std::array<uint, 8>> &Addresses, size_t Count, size_t N)
 {
-	std::vector<byte> buf(N + SPX_ADDR_BYTES + 1 * N);
-	std::vector<byte> mask(1 * N);
+	// computes Count chains in lock-step; at each hash position the active chains are gathered and hashed together
+	std::vector<std::array<uint, 8>> addrs(Count);
+	std::vector<byte> buf(Count * N);
+	std::vector<size_t> lanes(Count);
+	size_t i;
+	size_t lcnt;
 	uint idx;
 
 	// initialize out with the value at position 'start'
-	MemoryTools::Copy(Input, InOffset, Output, OutOffset, N);
-
-	// iterate 'steps' calls to the hash function
-	for (idx = Start; idx < (Start + Steps) && idx < SPX_WOTS_W; ++idx)
+	if (&Output != &Input || OutOffset != InOffset)
 	{
-		SphincsUtils::SetHashAddress(Address, idx);
-		THash(Output, OutOffset, Output, OutOffset, 1, PkSeed, Address, buf, mask, N);
+		MemoryTools::Copy(Input, InOffset, Output, OutOffset, Count * N);
 	}
-}
 
-void WOTS::THash(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, const size_t InputBlocks,
-	const std::vector<byte> &PkSeed, std::array<uint, 8> & Address, std::vector<byte> &Buffer, std::vector<byte> &Mask, size_t N)
-{
-	size_t i;
-
-	MemoryTools::Clear(Buffer, 0, Buffer.size());
-	MemoryTools::Clear(Mask, 0, Mask.size());
-	MemoryTools::Copy(PkSeed, 0, Buffer, 0, N);
-	SphincsUtils::AddressToBytes(Buffer, N, Address);
+	// iterate over the hash positions, advancing each chain whose range includes the position
+	for (idx = 0; idx < SPX_WOTS_W; ++idx)
+	{
+		lcnt = 0;
 
-	std::vector<byte> k(N + SPX_ADDR_BYTES);
-	MemoryTools::Copy(Buffer, 0, k, 0, k.size());
+		for (i = 0; i < Count; ++i)
+		{
+			if (idx >= Starts[i] && idx < Starts[i] + Steps[i])
+			{
+				lanes[lcnt] = i;
+				addrs[lcnt] = Addresses[i];
+				SphincsUtils::SetHashAddress(addrs[lcnt], idx);
+				MemoryTools::Copy(Output, OutOffset + (i * N), buf, lcnt * N, N);
+				++lcnt;
+			}
+		}
 
-	SphincsUtils::XOF(k, 0, k.size(), Mask, 0, InputBlocks * N, Keccak::KECCAK256_RATE_SIZE);
+		if (lcnt != 0)
+		{
+			SphincsUtils::THashW(buf, 0, buf, 0, 1, PkSeed, addrs, lcnt, N);
 
-	for (i = 0; i < InputBlocks * N; ++i)
-	{
-		Buffer[N + SPX_ADDR_BYTES + i] = Input[InOffset + i] ^ Mask[i];
+			for (i = 0; i < lcnt; ++i)
+			{
+				MemoryTools::Copy(buf, i * N, Output, OutOffset + (lanes[i] * N), N);
+			}
+		}
 	}
-
-	k.resize(N + SPX_ADDR_BYTES + InputBlocks * N);
-	MemoryTools::Copy(Buffer, 0, k, 0, k.size());
-
-	SphincsUtils::XOF(k, 0, k.size(), Output, OutOffset, N, Keccak::KECCAK256_RATE_SIZE);
 }
 
 void WOTS::WotsChecksum(std::vector<int32_t> &CSumBaseW, size_t BaseOffset, const std::vector<int32_t> &MsgBaseW, size_t N)
@@ -108,40 +110,66 @@ void WOTS::WotsChecksum(std::vector<int32_t> &CSumBaseW, size_t BaseOffset, cons
 	BaseW(CSumBaseW, BaseOffset, SPX_WOTS_LEN2, csumbytes);
 }
 
-void WOTS::WotsGenLeaf(std::vector<byte> &Leaf, size_t LeafOffset, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed, uint AddressIndex,
-	const std::array<uint, 8> & TreeAddress, size_t N)
+void WOTS::WotsGenLeaves(std::vector<byte> &Leaves, size_t LeafOffset, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed, uint AddressIndex,
+	uint LeafCount, const std::array<uint, 8> &TreeAddress, size_t N)
 {
 	const uint SPX_WOTS_LEN = ((8 * N / SPX_WOTS_LOGW) + SPX_WOTS_LEN2);
 	const uint SPX_WOTS_BYTES = (SPX_WOTS_LEN * N);
-	// computes the leaf at a given address. First generates the WOTS key pair, then computes leaf by hashing horizontally
-	std::vector<byte> buf(N + SPX_ADDR_BYTES + SPX_WOTS_LEN * N);
-	std::vector<byte> mask(SPX_WOTS_LEN * N);
-	std::vector<byte> pk(SPX_WOTS_BYTES);
+	// computes the leaves at a range of addresses. First generates the WOTS key pairs, then computes each leaf by hashing horizontally,
+	// the chains of all the key pairs are generated together so that the hash lanes stay filled
+	std::vector<std::array<uint, 8>> chainaddr(LeafCount * SPX_WOTS_LEN);
+	std::vector<std::array<uint, 8>> pkaddr(LeafCount);
+	std::vector<byte> pk(LeafCount * SPX_WOTS_BYTES);
+	std::vector<uint> starts(LeafCount * SPX_WOTS_LEN, 0);
+	std::vector<uint> steps(LeafCount * SPX_WOTS_LEN, SPX_WOTS_W - 1);
 	std::array<uint, 8> wotsaddr = { 0 };
 	std::array<uint, 8> wotspkaddr = { 0 };
+	uint idx;
+	uint leaf;
 
 	SphincsUtils::SetType(wotsaddr, SPX_ADDR_TYPE_WOTS);
 	SphincsUtils::SetType(wotspkaddr, SPX_ADDR_TYPE_WOTSPK);
 	SphincsUtils::CopySubtreeAddress(TreeAddress, wotsaddr);
-	SphincsUtils::SetKeypairAddress(wotsaddr, AddressIndex);
 
-	WotsGenPk(pk, SkSeed, PkSeed, wotsaddr, N);
-	SphincsUtils::CopyKeypairAddress(wotsaddr, wotspkaddr);
-	THash(Leaf, LeafOffset, pk, 0, SPX_WOTS_LEN, PkSeed, wotspkaddr, buf, mask, N);
+	for (leaf = 0; leaf < LeafCount; ++leaf)
+	{
+		SphincsUtils::SetKeypairAddress(wotsaddr, AddressIndex + leaf);
+		SphincsUtils::CopyKeypairAddress(wotsaddr, wotspkaddr);
+		pkaddr[leaf] = wotspkaddr;
+
+		for (idx = 0; idx < SPX_WOTS_LEN; ++idx)
+		{
+			chainaddr[(leaf * SPX_WOTS_LEN) + idx] = wotsaddr;
+			SphincsUtils::SetChainAddress(chainaddr[(leaf * SPX_WOTS_LEN) + idx], idx);
+		}
+	}
+
+	// generate the sk elements, then walk every chain to its end
+	SphincsUtils::PrfAddressW(pk, 0, SkSeed, chainaddr, chainaddr.size(), N);
+	GenChains(pk, 0, pk, 0, starts, steps, PkSeed, chainaddr, chainaddr.size(), N);
+	SphincsUtils::THashW(Leaves, LeafOffset, pk, 0, SPX_WOTS_LEN, PkSeed, pkaddr, LeafCount, N);
 }
 
 void WOTS::WotsGenPk(std::vector<byte> &PublicKey, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed, std::array<uint, 8> & Address, size_t N)
 {
 	const uint SPX_WOTS_LEN1 = (8 * N / SPX_WOTS_LOGW);
 	const uint SPX_WOTS_LEN = (SPX_WOTS_LEN1 + SPX_WOTS_LEN2);
+	std::vector<std::array<uint, 8>> chainaddr(SPX_WOTS_LEN);
+	std::vector<uint> starts(SPX_WOTS_LEN, 0);
+	std::vector<uint> steps(SPX_WOTS_LEN, SPX_WOTS_W - 1);
 	uint idx;
 
+	// make sure that the hash address is actually zeroed
+	SphincsUtils::SetHashAddress(Address, 0);
+
 	for (idx = 0; idx < SPX_WOTS_LEN; ++idx)
 	{
-		SphincsUtils::SetChainAddress(Address, idx);
-		WotsGenSk(PublicKey, idx * N, SkSeed, Address, N);
-		GenChain(PublicKey, idx * N, PublicKey, idx * N, 0, SPX_WOTS_W - 1, PkSeed, Address, N);
+		chainaddr[idx] = Address;
+		SphincsUtils::SetChainAddress(chainaddr[idx], idx);
 	}
+
+	SphincsUtils::PrfAddressW(PublicKey, 0, SkSeed, chainaddr, SPX_WOTS_LEN, N);
+	GenChains(PublicKey, 0, PublicKey, 0, starts, steps, PkSeed, chainaddr, SPX_WOTS_LEN, N);
 }
 
 void WOTS::WotsGenSk(std::vector<byte> &Key, size_t Offset, const std::vector<byte> &KeySeed, std::array<uint, 8> & WotsAddress, size_t N)
@@ -156,33 +184,48 @@ void WOTS::WotsPkFromSig(std::vector<byte> &PublicKey, const std::vector<byte> &
 	const std::vector<byte> &PrivateSeed, std::array<uint, 8> & Address, size_t N)
 {
 	const uint SPX_WOTS_LEN = ((8 * N / SPX_WOTS_LOGW) + SPX_WOTS_LEN2);
+	std::vector<std::array<uint, 8>> chainaddr(SPX_WOTS_LEN);
 	std::vector<int32_t> lengths(SPX_WOTS_LEN);
+	std::vector<uint> starts(SPX_WOTS_LEN);
+	std::vector<uint> steps(SPX_WOTS_LEN);
 	uint idx;
 
 	ChainLengths(lengths, Message, N);
 
 	for (idx = 0; idx < SPX_WOTS_LEN; ++idx)
 	{
-		SphincsUtils::SetChainAddress(Address, idx);
-		GenChain(PublicKey, idx * N, Signature, SigOffset + (idx * N), lengths[idx], (SPX_WOTS_W - 1) - lengths[idx], PrivateSeed, Address, N);
+		chainaddr[idx] = Address;
+		SphincsUtils::SetChainAddress(chainaddr[idx], idx);
+		starts[idx] = static_cast<uint>(lengths[idx]);
+		steps[idx] = static_cast<uint>((SPX_WOTS_W - 1) - lengths[idx]);
 	}
+
+	GenChains(PublicKey, 0, Signature, SigOffset, starts, steps, PrivateSeed, chainaddr, SPX_WOTS_LEN, N);
 }
 
 void WOTS::WotsSign(std::vector<byte> &Signature, size_t SigOffset, const std::vector<byte> &Message, const std::vector<byte> &SecretSeed,
 	const std::vector<byte> &PublicSeed, std::array<uint, 8> & Address, size_t N)
 {
 	const uint SPX_WOTS_LEN = ((8 * N / SPX_WOTS_LOGW) + SPX_WOTS_LEN2);
+	std::vector<std::array<uint, 8>> chainaddr(SPX_WOTS_LEN);
 	std::vector<int32_t> lengths(SPX_WOTS_LEN);
+	std::vector<uint> starts(SPX_WOTS_LEN, 0);
+	std::vector<uint> steps(SPX_WOTS_LEN);
 	uint idx;
 
 	ChainLengths(lengths, Message, N);
+	// make sure that the hash address is actually zeroed
+	SphincsUtils::SetHashAddress(Address, 0);
 
 	for (idx = 0; idx < SPX_WOTS_LEN; ++idx)
 	{
-		SphincsUtils::SetChainAddress(Address, idx);
-		WotsGenSk(Signature, SigOffset + (idx * N), SecretSeed, Address, N);
-		GenChain(Signature, SigOffset + (idx * N), Signature, SigOffset + (idx * N), 0, lengths[idx], PublicSeed, Address, N);
+		chainaddr[idx] = Address;
+		SphincsUtils::SetChainAddress(chainaddr[idx], idx);
+		steps[idx] = static_cast<uint>(lengths[idx]);
 	}
+
+	SphincsUtils::PrfAddressW(Signature, SigOffset, SecretSeed, chainaddr, SPX_WOTS_LEN, N);
+	GenChains(Signature, SigOffset, Signature, SigOffset, starts, steps, PublicSeed, chainaddr, SPX_WOTS_LEN, N);
 }
 
 NAMESPACE_SPHINCSEND
\ No newline at end of file
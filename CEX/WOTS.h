@@ -52,16 +52,13 @@ public:
 
 	static void ChainLengths(std::vector<int32_t> &Lengths, const std::vector<byte> &Message, size_t N);
 
-	static void GenChain(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, uint Start, uint Steps,
-		const std::vector<byte> &PkSeed, std::array<uint, 8> &Address, size_t N);
-
-	static void THash(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, const size_t InputBlocks,
-		const std::vector<byte> &PkSeed, std::array<uint, 8> &Address, std::vector<byte> &Buffer, std::vector<byte> &Mask, size_t N);
+	static void GenChains(std::vector<byte> &Output, size_t OutOffset, const std::vector<byte> &Input, size_t InOffset, const std::vector<uint> &Starts, const std::vector<uint> &Steps,
+		const std::vector<byte> &PkSeed, const std::vector<std::array<uint, 8>> &Addresses, size_t Count, size_t N);
 
 	static void WotsChecksum(std::vector<int32_t> &CSumBaseW, size_t BaseOffset, const std::vector<int32_t> &MsgBaseW, size_t N);
 
-	static void WotsGenLeaf(std::vector<byte> &Leaf, size_t LeafOffset, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed, uint AddressIndex,
-		const std::array<uint, 8> &TreeAddress, size_t N);
+	static void WotsGenLeaves(std::vector<byte> &Leaves, size_t LeafOffset, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed, uint AddressIndex,
+		uint LeafCount, const std::array<uint, 8> &TreeAddress, size_t N);
 
 	static void WotsGenPk(std::vector<byte> &PublicKey, const std::vector<byte> &SkSeed, const std::vector<byte> &PkSeed, std::array<uint, 8> &Address, size_t N);
 
@@ -1,5 +1,7 @@
 #include "XMSS.h"
+#include "IntegerTools.h"
 #include "MemoryTools.h"
+#include "ParallelTools.h"
 #include "PrngFromName.h"
 #include "XMSSCore.h"
 #include "XmssUtils.h"
@@ -7,51 +9,98 @@
 NAMESPACE_XMSS
 
 using Enumeration::AsymmetricPrimitiveConvert;
+using Utility::IntegerTools;
 using Utility::MemoryTools;
+using Utility::ParallelTools;
 using Enumeration::XmssParameterConvert;
 
 class XMSS::XmssState
 {
 public:
 
+	std::vector<byte> SecretKey;
 	bool Destroyed;
 	bool Initialized;
 	bool Signer;
+	bool Traversal;
 	XmssParameters Parameters;
 
-	XmssState(XmssParameters Params, bool Destroy)
+	XmssState(XmssParameters Params, bool Destroy, bool Traverse)
 		:
+		SecretKey(0),
 		Destroyed(Destroy),
 		Initialized(false),
 		Signer(false),
+		Traversal(Traverse),
 		Parameters(Params)
 	{
 	}
 
 	~XmssState()
 	{
+		MemoryTools::Clear(SecretKey, 0, SecretKey.size());
 		Destroyed = false;
 		Initialized = false;
 		Signer = false;
+		Traversal = false;
 		Parameters = XmssParameters::None;
 	}
+
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<const std::vector<byte>*> &PublicKeys, std::vector<byte> &Results)
+	{
+		const size_t CNT = Signatures.size();
+		const size_t THDCNT = IntegerTools::Min(IntegerTools::Max(ParallelTools::ProcessorCount(), static_cast<size_t>(1)), IntegerTools::Max(CNT, static_cast<size_t>(1)));
+		const size_t CNKLEN = (CNT + THDCNT - 1) / THDCNT;
+		const XmssParameters PRMS = Parameters;
+		size_t i;
+		size_t vcnt;
+
+		Messages.resize(CNT);
+		Results.resize(CNT);
+
+		// each thread verifies a contiguous range of signatures
+		ParallelTools::ParallelFor(0, THDCNT, [&Signatures, &Messages, &PublicKeys, &Results, CNT, CNKLEN, PRMS](size_t i)
+		{
+			const size_t OFT = i * CNKLEN;
+			size_t j;
+
+			for (j = OFT; j < IntegerTools::Min(OFT + CNKLEN, CNT); ++j)
+			{
+				Results[j] = XmssCore::Verify(Messages[j], Signatures[j], *PublicKeys[j], PRMS) ? 1 : 0;
+
+				if (Results[j] == 0)
+				{
+					MemoryTools::Clear(Messages[j], 0, Messages[j].size());
+				}
+			}
+		});
+
+		vcnt = 0;
+
+		for (i = 0; i < CNT; ++i)
+		{
+			vcnt += Results[i];
+		}
+
+		return vcnt;
+	}
 };
 
-XMSS::XMSS(XmssParameters Parameters, Prngs PrngType)
+XMSS::XMSS(XmssParameters Parameters, Prngs PrngType, bool Traversal)
 	:
 	m_xmssState(new XmssState(Parameters != XmssParameters::None ? Parameters :
 		throw CryptoAsymmetricException(AsymmetricPrimitiveConvert::ToName(AsymmetricPrimitives::XMSS), std::string("Constructor"), std::string("The ModuleLWE parameter set is invalid!"), ErrorCodes::InvalidParam),
-		true)),
+		true, Traversal)),
 	m_rndGenerator(PrngType != Prngs::None ? Helper::PrngFromName::GetInstance(PrngType) :
 		throw CryptoAsymmetricException(AsymmetricPrimitiveConvert::ToName(AsymmetricPrimitives::XMSS), std::string("Constructor"), std::string("The prng type can not be none!"), ErrorCodes::InvalidParam))
 {
 }
 
-XMSS::XMSS(XmssParameters Parameters, IPrng* Rng)
+XMSS::XMSS(XmssParameters Parameters, IPrng* Rng, bool Traversal)
 	:
 	m_xmssState(new XmssState(Parameters != XmssParameters::None ? Parameters :
 		throw CryptoAsymmetricException(AsymmetricPrimitiveConvert::ToName(AsymmetricPrimitives::XMSS), std::string("Constructor"), std::string("The ModuleLWE parameter set is invalid!"), ErrorCodes::InvalidParam),
-		false)),
+		false, Traversal)),
 	m_rndGenerator(Rng != nullptr ? Rng :
 		throw CryptoAsymmetricException(AsymmetricPrimitiveConvert::ToName(AsymmetricPrimitives::XMSS), std::string("Constructor"), std::string("The prng can not be null!"), ErrorCodes::InvalidParam))
 {
@@ -216,7 +265,7 @@ AsymmetricKeyPair* XMSS::Generate()
 	std::vector<byte> pk(0);
 	std::vector<byte> sk(0);
 
-	XmssCore::Generate(pk, sk, m_rndGenerator, m_xmssState->Parameters);
+	XmssCore::Generate(pk, sk, m_rndGenerator, m_xmssState->Parameters, m_xmssState->Traversal);
 
 	AsymmetricKey* apk = new AsymmetricKey(pk, AsymmetricPrimitives::XMSS, AsymmetricKeyTypes::SignaturePublicKey, static_cast<AsymmetricParameters>(m_xmssState->Parameters));
 	AsymmetricKey* ask = new AsymmetricKey(sk, AsymmetricPrimitives::XMSS, AsymmetricKeyTypes::SignaturePrivateKey, static_cast<AsymmetricParameters>(m_xmssState->Parameters));
@@ -245,6 +294,8 @@ const void XMSS::Initialize(AsymmetricKey* Key)
 	{
 		m_privateKey = std::unique_ptr<AsymmetricKey>(Key);
 		m_xmssState->Parameters = static_cast<XmssParameters>(m_privateKey->Parameters());
+		// the working copy of the key advances with each signature
+		m_xmssState->SecretKey = m_privateKey->Polynomial();
 		m_xmssState->Signer = true;
 	}
 
@@ -270,11 +321,28 @@ size_t XMSS::Sign(const std::vector<byte> &Message, std::vector<byte> &Signature
 
 	size_t slen;
 
-	slen = XmssCore::Sign(Signature, Message, m_privateKey->Polynomial(), m_rndGenerator, m_xmssState->Parameters);
+	slen = XmssCore::Sign(Signature, Message, m_xmssState->SecretKey, m_rndGenerator, m_xmssState->Parameters);
+
+	if (slen == 0)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Sign"), std::string("The private key is exhausted, or the traversal state is invalid!"), ErrorCodes::InvalidKey);
+	}
 
 	return slen;
 }
 
+AsymmetricKey* XMSS::UpdatedKey()
+{
+	if (!m_xmssState->Initialized || !m_xmssState->Signer)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("UpdatedKey"), std::string("The signature scheme is not initialized for signing!"), ErrorCodes::NotInitialized);
+	}
+
+	AsymmetricKey* ask = new AsymmetricKey(m_xmssState->SecretKey, m_privateKey->PrimitiveType(), AsymmetricKeyTypes::SignaturePrivateKey, m_privateKey->Parameters());
+
+	return ask;
+}
+
 bool XMSS::Verify(const std::vector<byte> &Signature, std::vector<byte> &Message)
 {
 	if (!m_xmssState->Initialized)
@@ -296,4 +364,60 @@ bool XMSS::Verify(const std::vector<byte> &Signature, std::vector<byte> &Message
 	return res;
 }
 
+size_t XMSS::Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results)
+{
+	if (!m_xmssState->Initialized)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The cipher has not been initialized!"), ErrorCodes::IllegalOperation);
+	}
+
+	if (m_xmssState->Signer)
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The signature scheme is not initialized for verification!"), ErrorCodes::NotInitialized);
+	}
+
+	const std::vector<byte> PUBK = m_publicKey->Polynomial();
+	std::vector<const std::vector<byte>*> pks(Signatures.size(), &PUBK);
+
+	return m_xmssState->Verify(Signatures, Messages, pks, Results);
+}
+
+size_t XMSS::Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results)
+{
+	if (KeyIndex.size() != Signatures.size())
+	{
+		throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key index array size is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	std::vector<std::vector<byte>> kpol(PublicKeys.size());
+	std::vector<const std::vector<byte>*> pks(Signatures.size());
+	size_t i;
+
+	for (i = 0; i < PublicKeys.size(); ++i)
+	{
+		if (PublicKeys[i] == nullptr || PublicKeys[i]->PrimitiveType() != AsymmetricPrimitives::XMSS || PublicKeys[i]->KeyClass() != AsymmetricKeyTypes::SignaturePublicKey)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key type is invalid!"), ErrorCodes::InvalidKey);
+		}
+		if (static_cast<XmssParameters>(PublicKeys[i]->Parameters()) != m_xmssState->Parameters)
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key parameter set does not match this instance!"), ErrorCodes::InvalidKey);
+		}
+
+		kpol[i] = PublicKeys[i]->Polynomial();
+	}
+
+	for (i = 0; i < KeyIndex.size(); ++i)
+	{
+		if (KeyIndex[i] >= PublicKeys.size())
+		{
+			throw CryptoAsymmetricException(Name(), std::string("Verify"), std::string("The key index is out of range!"), ErrorCodes::InvalidParam);
+		}
+
+		pks[i] = &kpol[KeyIndex[i]];
+	}
+
+	return m_xmssState->Verify(Signatures, Messages, pks, Results);
+}
+
 NAMESPACE_XMSSEND
\ No newline at end of file
@@ -83,6 +83,8 @@ using Enumeration::XmssParameters;
 /// <item><description>The signature schemes operational mode (signing/verifying) is determined by the IAsymmetricKey key-type used to Initialize the cipher; the Public key is used for verification, and use the Private for signing a message.</description></item>
 /// <item><description>Use the Generate function to create a public/private key-pair, and the Sign function to sign a message</description></item>
 /// <item><description>The message-signature is tested using the Verify function, which checks the signature, populates the message array, and returns false on authentication failure</description></item>
+/// <item><description>XMSS is stateful; the leaf index in the private key advances with every signature, and the UpdatedKey function returns the key that must be stored before the signature is released</description></item>
+/// <item><description>An optional BDS traversal state can be appended to generated private keys through the constructor; it caches the authentication path nodes, reducing the cost of a signature from a full subtree computation to O(h) hashes</description></item>
 /// </list>
 /// 
 /// <description>Guiding Publications:</description>
@@ -90,6 +92,7 @@ using Enumeration::XmssParameters;
 /// <item><description>RFC 8391 XMSS: <a href="https://tools.ietf.org/html/rfc8391">The eXtended Merkle Signature Scheme</a>.</description></item>
 /// <item><description>XMSS: <a href="https://eprint.iacr.org/2011/484.pdf">A Practical Forward Secure Signature Scheme</a> based on Minimal Security Assumptions.</description></item>
 /// <item><description>XMSS/XMSS-MT <a href="https://github.com/XMSS/xmss-reference">Reference code</a>.</description></item>
+/// <item><description>Buchmann, Dahmen, Schneider: Merkle Tree Traversal Revisited (BDS traversal).</description></item>
 /// </list>
 /// </remarks>
 class XMSS final : public IAsymmetricSign
@@ -120,9 +123,10 @@ public:
 	/// 
 	/// <param name="Parameters">The XMSS parameter set; default is XMSSSHA256H16</param>
 	/// <param name="PrngType">The random prng provider; default is Block-cipher Counter Rng (BCR)</param>
+	/// <param name="Traversal">Append the versioned BDS traversal state to generated private keys; default is false</param>
 	/// 
 	/// <exception cref="CryptoAsymmetricException">Thrown if an invalid prng, or parameter set is specified</exception>
-	XMSS(XmssParameters Parameters = XmssParameters::XMSSSHA256H16, Prngs PrngType = Prngs::BCR);
+	XMSS(XmssParameters Parameters = XmssParameters::XMSSSHA256H16, Prngs PrngType = Prngs::BCR, bool Traversal = false);
 
 	/// <summary>
 	/// Constructor: instantiate this class using an external Prng instance
@@ -130,9 +134,10 @@ public:
 	///
 	/// <param name="Parameters">The parameter set enumeration name</param>
 	/// <param name="Rng">A pointer to the seed Prng function</param>
+	/// <param name="Traversal">Append the versioned BDS traversal state to generated private keys; default is false</param>
 	/// 
 	/// <exception cref="CryptoAsymmetricException">Thrown if an invalid prng, or parameter set is specified</exception>
-	XMSS(XmssParameters Parameters, IPrng* Rng);
+	XMSS(XmssParameters Parameters, IPrng* Rng, bool Traversal = false);
 
 	/// <summary>
 	/// Finalizer: destroys the containers objects
@@ -202,8 +207,21 @@ public:
 	/// <param name="Signature">The output signature array containing the signature and message</param>
 	/// 
 	/// <returns>Returns the size of the signed message</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Throws if the private key is exhausted, or its traversal state is invalid</exception>
 	size_t Sign(const std::vector<byte> &Message, std::vector<byte> &Signature) override;
 
+	/// <summary>
+	/// Get the private key in its current state.
+	/// <para>The leaf index, and the traversal state if present, advance with every signature.
+	/// The updated key must replace the stored private key before a signature is released, a key index must never be used twice.</para>
+	/// </summary>
+	/// 
+	/// <returns>A new private key; the caller is responsible for its destruction</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Throws if the scheme is not initialized for signing</exception>
+	AsymmetricKey* UpdatedKey();
+
 	/// <summary>
 	/// Verify a signed message and return the message array
 	/// </summary>
@@ -213,6 +231,38 @@ public:
 	/// 
 	/// <returns>Returns true if the signature matches, false for authentication failure</returns>
 	bool Verify(const std::vector<byte> &Signature, std::vector<byte> &Message) override;
+
+	/// <summary>
+	/// Verify a batch of signed messages with the public key used to initialize the signature scheme.
+	/// <para>The messages and results arrays are resized to the number of signatures; each result is 1 if the signature is authentic, or 0 on failure,
+	/// and the message of a failed signature is zeroed. The batch is distributed across the processor cores.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if the signature scheme is not initialized for verification</exception>
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, std::vector<byte> &Results) override;
+
+	/// <summary>
+	/// Verify a batch of signed messages under a set of public keys.
+	/// <para>Each signature is verified with the public key at its entry in the key index array.
+	/// The keys must use the parameter set of this instance, the signature scheme does not need to be initialized.</para>
+	/// </summary>
+	/// 
+	/// <param name="Signatures">The signed messages to verify</param>
+	/// <param name="Messages">The output messages, in the order of the signatures</param>
+	/// <param name="PublicKeys">The public keys used to verify the signatures</param>
+	/// <param name="KeyIndex">The index of the public key used to verify each signature</param>
+	/// <param name="Results">The output verification results, in the order of the signatures</param>
+	/// 
+	/// <returns>Returns the number of authentic signatures</returns>
+	/// 
+	/// <exception cref="CryptoAsymmetricException">Thrown if a key is invalid, or the key index array is invalid</exception>
+	size_t Verify(const std::vector<std::vector<byte>> &Signatures, std::vector<std::vector<byte>> &Messages, const std::vector<AsymmetricKey*> &PublicKeys, const std::vector<size_t> &KeyIndex, std::vector<byte> &Results) override;
 };
 
 NAMESPACE_SPHINCSEND
@@ -618,7 +618,7 @@ void XmssCore::UllToBytes(std::vector<byte> &Output, size_t Offset, size_t Lengt
 	} while (i != 0);
 }
 
-ulong XmssCore::BytesToUll(const std::vector<byte> &Input, size_t Length)
+ulong XmssCore::BytesToUll(const std::vector<byte> &Input, size_t Offset, size_t Length)
 {
 	ulong ret;
 	size_t i;
@@ -627,7 +627,7 @@ ulong XmssCore::BytesToUll(const std::vector<byte> &Input, size_t Length)
 
 	for (i = 0; i < Length; ++i)
 	{
-		ret |= ((ulong)Input[i]) << (8 * (Length - 1 - i));
+		ret |= ((ulong)Input[Offset + i]) << (8 * (Length - 1 - i));
 	}
 
 	return ret;
@@ -1045,7 +1045,7 @@ int32_t XmssCore::XmssMtCoreSignOpen(const XmssParams &Params, std::vector<byte>
 
 	MsgLength = SigLength - Params.SignatureSize;
 	// convert the index bytes from the signature to an integer
-	idx = BytesToUll(Signature, Params.IndexSize);
+	idx = BytesToUll(Signature, 0, Params.IndexSize);
 	// put the message all the way at the end of the m buffer, so that we can
 	// prepend the required other inputs for the hash function
 	MemoryTools::Copy(Signature, Params.SignatureSize, Message, Params.SignatureSize, MsgLength);
@@ -1198,6 +1198,7 @@ int32_t XmssCore::XmssMtCoreKeyPair(const XmssParams &Params, std::vector<byte>
 
 	std::vector<byte> authpath(Params.TreeHeight * Params.N);
 	std::vector<byte> pkseed(Params.N);
+	std::vector<byte> skseed(Params.N);
 	std::array<uint, 8> toptreeaddr = { 0 };
 	size_t skoft;
 	int32_t ret;
@@ -1215,8 +1216,18 @@ int32_t XmssCore::XmssMtCoreKeyPair(const XmssParams &Params, std::vector<byte>
 	MemoryTools::Copy(SecretKey, skoft + (3 * Params.N), PublicKey, XMSS_OID_LEN + Params.N, Params.N);
 	MemoryTools::Copy(SecretKey, skoft + (3 * Params.N), pkseed, 0, Params.N);
 
-	// compute root node of the top-most subtree
-	TreeHash(Params, PublicKey, XMSS_OID_LEN, authpath, 0, SecretKey, skoft, pkseed, 0, toptreeaddr);
+	if (SecretKey.size() > XMSS_OID_LEN + Params.SecretKeySize)
+	{
+		// the key is sized for a traversal state; the root is computed while building the state of each layer
+		MemoryTools::Copy(SecretKey, skoft, skseed, 0, Params.N);
+		BdsKeyPair(Params, PublicKey, SecretKey, skseed, pkseed);
+	}
+	else
+	{
+		// compute root node of the top-most subtree
+		TreeHash(Params, PublicKey, XMSS_OID_LEN, authpath, 0, SecretKey, skoft, pkseed, 0, toptreeaddr);
+	}
+
 	MemoryTools::Copy(PublicKey, XMSS_OID_LEN, SecretKey, skoft + (2 * Params.N), Params.N);
 	ret = 0;
 
@@ -1234,11 +1245,13 @@ int32_t XmssCore::XmssMtCoreSign(const XmssParams &Params, std::vector<byte> &Se
 	std::vector<byte> skseed(Params.N);
 	std::vector<byte> skprf(Params.N);
 	ulong idx;
+	ulong maxidx;
 	size_t skoft;
 	size_t smoft;
 	uint i;
 	uint idxleaf;
 	int32_t ret;
+	bool bdsstate;
 
 	skoft = XMSS_OID_LEN;
 	MemoryTools::Copy(SecretKey, skoft + Params.IndexSize, skseed, 0, Params.N);
@@ -1246,61 +1259,699 @@ int32_t XmssCore::XmssMtCoreSign(const XmssParams &Params, std::vector<byte> &Se
 	MemoryTools::Copy(SecretKey, skoft + Params.IndexSize + (2 * Params.N), pubroot, 0, Params.N);
 	MemoryTools::Copy(SecretKey, skoft + Params.IndexSize + (3 * Params.N), pubseed, 0, Params.N);
 
-	ret = -1;
-	SetType(otsaddr, XMSS_ADDR_TYPE_OTS);
+	// read the current index from the secret key
+	idx = BytesToUll(SecretKey, skoft, Params.IndexSize);
+	bdsstate = (SecretKey.size() > XMSS_OID_LEN + Params.SecretKeySize);
 
-	// already put the message in the right place, to make it easier to prepend
-	// things when computing the hash over the message
-	MemoryTools::Copy(Message, 0, Signature, Params.SignatureSize, MsgLength);
-	SigLength = Params.SignatureSize + MsgLength;
+	maxidx = (Params.FullHeight < 64) ? (1ULL << Params.FullHeight) - 1 : ~0ULL;
 
-	// read and use the current index from the secret key
-	idx = (uint)BytesToUll(Signature, Params.IndexSize);
-	MemoryTools::Copy(SecretKey, skoft, Signature, 0, Params.IndexSize);
+	// as in the reference, the last index 2^h-1 can still be used, unless the index field has no larger value
+	// left to mark the key as exhausted (the reference h = 64 case)
+	if (idx > maxidx || (Params.IndexSize * 8 <= Params.FullHeight && idx == maxidx))
+	{
+		// the key has been exhausted
+		ret = -2;
+	}
+	else if (bdsstate && (SecretKey.size() != XMSS_OID_LEN + Params.SecretKeySize + BdsSkBytes(Params) ||
+		SecretKey[XMSS_OID_LEN + Params.SecretKeySize] != XMSS_BDS_VERSION))
+	{
+		// the traversal state is truncated, or was written by an unknown version
+		ret = -3;
+	}
+	else
+	{
+		SetType(otsaddr, XMSS_ADDR_TYPE_OTS);
 
-	// Note: the secret key can be updated here
-	// increment the index in the secret key
-	UllToBytes(SecretKey, skoft, Params.IndexSize, idx + 1);
+		// already put the message in the right place, to make it easier to prepend
+		// things when computing the hash over the message
+		MemoryTools::Copy(Message, 0, Signature, Params.SignatureSize, MsgLength);
+		SigLength = Params.SignatureSize + MsgLength;
+		MemoryTools::Copy(SecretKey, skoft, Signature, 0, Params.IndexSize);
 
-	// compute the digest randomization value. */
-	UllToBytes(idx32, 0, XMSS_PRFCTR_SIZE, idx);
-	Prf(Params, Signature, Params.IndexSize, idx32, skprf, 0);
+		// Note: the secret key can be updated here
+		// increment the index in the secret key
+		UllToBytes(SecretKey, skoft, Params.IndexSize, idx + 1);
 
-	// compute the message hash
-	HashMessage(Params, root, Signature, Params.IndexSize, pubroot, idx, Signature, Params.SignatureSize - 4 * Params.N, MsgLength);
-	smoft = Params.IndexSize + Params.N;
+		// compute the digest randomization value. */
+		UllToBytes(idx32, 0, XMSS_PRFCTR_SIZE, idx);
+		Prf(Params, Signature, Params.IndexSize, idx32, skprf, 0);
+
+		// compute the message hash
+		HashMessage(Params, root, Signature, Params.IndexSize, pubroot, idx, Signature, Params.SignatureSize - 4 * Params.N, MsgLength);
+		smoft = Params.IndexSize + Params.N;
+
+		if (bdsstate)
+		{
+			// the authentication paths are read from the traversal state, which is then advanced to the next index
+			BdsSign(Params, SecretKey, Signature, smoft, root, idx, skseed, pubseed);
+		}
+		else
+		{
+			for (i = 0; i < Params.D; i++)
+			{
+				idxleaf = (idx & ((1ULL << Params.TreeHeight) - 1ULL));
+				idx = idx >> Params.TreeHeight;
+
+				SetLayerAddress(otsaddr, i);
+				SetTreeAddress(otsaddr, idx);
+				SetOtsAddress(otsaddr, idxleaf);
+
+				// get a seed for the WOTS keypair
+				GetSeed(Params, otsseed, skseed, 0, otsaddr);
+
+				// compute a WOTS signature
+				// initially, root = mhash, but on subsequent iterations it is the root of the subtree below the currently processed subtree
+				WotsSign(Params, Signature, smoft, root, otsseed, pubseed, otsaddr);
+				smoft += Params.WotsSignatureSize;
+
+				// compute the authentication path for the used WOTS leaf
+				TreeHash(Params, root, 0, Signature, smoft, skseed, 0, pubseed, idxleaf, otsaddr);
+				smoft += Params.TreeHeight * Params.N;
+			}
+		}
+
+		ret = 0;
+	}
+
+	return ret;
+}
+
+// xmss_core_fast.c //
+
+void XmssCore::BdsInitialize(const XmssParams &Params, XmssBdsState &State)
+{
+	const uint THCNT = Params.TreeHeight - Params.BdsK;
+	uint i;
+
+	State.Auth.resize(Params.TreeHeight * Params.N);
+	State.Keep.resize((Params.TreeHeight >> 1) * Params.N);
+	State.Retain.resize(((1UL << Params.BdsK) - Params.BdsK - 1) * Params.N);
+	State.Stack.resize((Params.TreeHeight + 1) * Params.N);
+	State.StackLevels.resize(Params.TreeHeight + 1);
+	State.TreeHash.resize(THCNT);
+	State.NextLeaf = 0;
+	State.StackOffset = 0;
+
+	for (i = 0; i < THCNT; ++i)
+	{
+		State.TreeHash[i].Node.resize(Params.N);
+		State.TreeHash[i].Completed = 1;
+		State.TreeHash[i].Height = i;
+		State.TreeHash[i].NextIndex = 0;
+		State.TreeHash[i].StackUsage = 0;
+	}
+}
+
+size_t XmssCore::BdsSkBytes(const XmssParams &Params)
+{
+	// the version byte, the current and next tree states of each layer, and the cached WOTS signatures of the upper layers
+	return 1 + ((2 * Params.D - 1) * BdsStateBytes(Params)) + ((Params.D - 1) * Params.WotsSignatureSize);
+}
+
+size_t XmssCore::BdsStateBytes(const XmssParams &Params)
+{
+	return ((Params.TreeHeight + 1) * Params.N) +
+		4 +
+		(Params.TreeHeight + 1) +
+		(Params.TreeHeight * Params.N) +
+		((Params.TreeHeight >> 1) * Params.N) +
+		((Params.TreeHeight - Params.BdsK) * (7 + Params.N)) +
+		(((1UL << Params.BdsK) - Params.BdsK - 1) * Params.N) +
+		4;
+}
+
+void XmssCore::BdsSerialize(const XmssParams &Params, std::vector<byte> &SecretKey, const std::vector<XmssBdsState> &States, const std::vector<byte> &WotsSigs)
+{
+	size_t i;
+
+	SecretKey[XMSS_OID_LEN + Params.SecretKeySize] = XMSS_BDS_VERSION;
+
+	for (i = 0; i < States.size(); ++i)
+	{
+		BdsSerializeState(Params, SecretKey, States[i], i);
+	}
+
+	for (i = 0; i < Params.D - 1; ++i)
+	{
+		BdsSerializeWots(Params, SecretKey, WotsSigs, i);
+	}
+}
+
+void XmssCore::BdsSerializeState(const XmssParams &Params, std::vector<byte> &SecretKey, const XmssBdsState &State, size_t Index)
+{
+	size_t j;
+	size_t skoft;
+
+	// the states follow the version byte in a fixed size layout, so a single state can be rewritten in place
+	skoft = XMSS_OID_LEN + Params.SecretKeySize + 1 + (Index * BdsStateBytes(Params));
+
+	MemoryTools::Copy(State.Stack, 0, SecretKey, skoft, State.Stack.size());
+	skoft += State.Stack.size();
+	UllToBytes(SecretKey, skoft, 4, State.StackOffset);
+	skoft += 4;
+
+	for (j = 0; j < State.StackLevels.size(); ++j)
+	{
+		SecretKey[skoft] = static_cast<byte>(State.StackLevels[j]);
+		++skoft;
+	}
+
+	MemoryTools::Copy(State.Auth, 0, SecretKey, skoft, State.Auth.size());
+	skoft += State.Auth.size();
+	MemoryTools::Copy(State.Keep, 0, SecretKey, skoft, State.Keep.size());
+	skoft += State.Keep.size();
+
+	for (j = 0; j < State.TreeHash.size(); ++j)
+	{
+		SecretKey[skoft] = static_cast<byte>(State.TreeHash[j].Height);
+		UllToBytes(SecretKey, skoft + 1, 4, State.TreeHash[j].NextIndex);
+		SecretKey[skoft + 5] = static_cast<byte>(State.TreeHash[j].StackUsage);
+		SecretKey[skoft + 6] = static_cast<byte>(State.TreeHash[j].Completed);
+		MemoryTools::Copy(State.TreeHash[j].Node, 0, SecretKey, skoft + 7, Params.N);
+		skoft += 7 + Params.N;
+	}
 
+	MemoryTools::Copy(State.Retain, 0, SecretKey, skoft, State.Retain.size());
+	skoft += State.Retain.size();
+	UllToBytes(SecretKey, skoft, 4, State.NextLeaf);
+}
+
+void XmssCore::BdsSerializeWots(const XmssParams &Params, std::vector<byte> &SecretKey, const std::vector<byte> &WotsSigs, size_t Index)
+{
+	size_t skoft;
+
+	// the cached WOTS signatures follow the 2d-1 tree states
+	skoft = XMSS_OID_LEN + Params.SecretKeySize + 1 + ((2 * Params.D - 1) * BdsStateBytes(Params)) + (Index * Params.WotsSignatureSize);
+	MemoryTools::Copy(WotsSigs, Index * Params.WotsSignatureSize, SecretKey, skoft, Params.WotsSignatureSize);
+}
+
+void XmssCore::BdsDeserialize(const XmssParams &Params, std::vector<XmssBdsState> &States, std::vector<byte> &WotsSigs, const std::vector<byte> &SecretKey)
+{
+	size_t i;
+	size_t j;
+	size_t skoft;
+
+	// skip the version byte, it is checked by the caller
+	skoft = XMSS_OID_LEN + Params.SecretKeySize + 1;
+
+	for (i = 0; i < States.size(); ++i)
+	{
+		BdsInitialize(Params, States[i]);
+
+		MemoryTools::Copy(SecretKey, skoft, States[i].Stack, 0, States[i].Stack.size());
+		skoft += States[i].Stack.size();
+		States[i].StackOffset = static_cast<uint>(BytesToUll(SecretKey, skoft, 4));
+		skoft += 4;
+
+		for (j = 0; j < States[i].StackLevels.size(); ++j)
+		{
+			States[i].StackLevels[j] = SecretKey[skoft];
+			++skoft;
+		}
+
+		MemoryTools::Copy(SecretKey, skoft, States[i].Auth, 0, States[i].Auth.size());
+		skoft += States[i].Auth.size();
+		MemoryTools::Copy(SecretKey, skoft, States[i].Keep, 0, States[i].Keep.size());
+		skoft += States[i].Keep.size();
+
+		for (j = 0; j < States[i].TreeHash.size(); ++j)
+		{
+			States[i].TreeHash[j].Height = SecretKey[skoft];
+			States[i].TreeHash[j].NextIndex = static_cast<uint>(BytesToUll(SecretKey, skoft + 1, 4));
+			States[i].TreeHash[j].StackUsage = SecretKey[skoft + 5];
+			States[i].TreeHash[j].Completed = SecretKey[skoft + 6];
+			MemoryTools::Copy(SecretKey, skoft + 7, States[i].TreeHash[j].Node, 0, Params.N);
+			skoft += 7 + Params.N;
+		}
+
+		MemoryTools::Copy(SecretKey, skoft, States[i].Retain, 0, States[i].Retain.size());
+		skoft += States[i].Retain.size();
+		States[i].NextLeaf = static_cast<uint>(BytesToUll(SecretKey, skoft, 4));
+		skoft += 4;
+	}
+
+	MemoryTools::Copy(SecretKey, skoft, WotsSigs, 0, WotsSigs.size());
+}
+
+void XmssCore::TreeHashInit(const XmssParams &Params, std::vector<byte> &Node, XmssBdsState &State, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed,
+	const std::array<uint, 8> &Address)
+{
+	uint i;
+
+	for (i = 0; i < Params.TreeHeight - Params.BdsK; ++i)
+	{
+		State.TreeHash[i].Height = i;
+		State.TreeHash[i].Completed = 1;
+		State.TreeHash[i].StackUsage = 0;
+	}
+
+	// building the whole tree leaf by leaf stores the first authentication path, the first right node of each treehash instance and the retained nodes
+	while (BdsStateUpdate(Params, State, SkSeed, PubSeed, Address) == 0)
+	{
+	}
+
+	MemoryTools::Copy(State.Stack, 0, Node, 0, Params.N);
+	State.NextLeaf = 0;
+	State.StackOffset = 0;
+}
+
+uint XmssCore::TreeHashMinHeightOnStack(const XmssParams &Params, const XmssBdsState &State, const XmssTreeHash &TreeHash)
+{
+	uint i;
+	uint r;
+
+	r = Params.TreeHeight;
+
+	for (i = 0; i < TreeHash.StackUsage; ++i)
+	{
+		if (State.StackLevels[State.StackOffset - i - 1] < r)
+		{
+			r = State.StackLevels[State.StackOffset - i - 1];
+		}
+	}
+
+	return r;
+}
+
+void XmssCore::TreeHashUpdate(const XmssParams &Params, XmssTreeHash &TreeHash, XmssBdsState &State, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed,
+	const std::array<uint, 8> &Address)
+{
+	std::vector<byte> nodebuffer(2 * Params.N);
+	std::array<uint, 8> ltreeaddr = { 0 };
+	std::array<uint, 8> nodeaddr = { 0 };
+	std::array<uint, 8> otsaddr = { 0 };
+	uint nodeh;
+
+	CopySubtreeAdress(otsaddr, Address);
+	CopySubtreeAdress(ltreeaddr, Address);
+	CopySubtreeAdress(nodeaddr, Address);
 	SetType(otsaddr, XMSS_ADDR_TYPE_OTS);
+	SetType(ltreeaddr, XMSS_ADDR_TYPE_LTREE);
+	SetType(nodeaddr, XMSS_ADDR_TYPE_HASHTREE);
+
+	SetLtreeAddress(ltreeaddr, TreeHash.NextIndex);
+	SetOtsAddress(otsaddr, TreeHash.NextIndex);
+	GenLeafWots(Params, nodebuffer, 0, SkSeed, 0, PubSeed, ltreeaddr, otsaddr);
+	nodeh = 0;
 
-	for (i = 0; i < Params.D; i++)
+	// merge the new leaf with the nodes this instance has on the shared stack
+	while (TreeHash.StackUsage > 0 && State.StackLevels[State.StackOffset - 1] == nodeh)
 	{
-		idxleaf = (idx & ((1ULL << Params.TreeHeight) - 1ULL));
-		idx = idx >> Params.TreeHeight;
+		MemoryTools::Copy(nodebuffer, 0, nodebuffer, Params.N, Params.N);
+		MemoryTools::Copy(State.Stack, (State.StackOffset - 1) * Params.N, nodebuffer, 0, Params.N);
+		SetTreeHeight(nodeaddr, nodeh);
+		SetTreeIndex(nodeaddr, TreeHash.NextIndex >> (nodeh + 1));
+		ThashH(Params, nodebuffer, 0, nodebuffer, 0, PubSeed, nodeaddr);
+		++nodeh;
+		--TreeHash.StackUsage;
+		--State.StackOffset;
+	}
 
-		SetLayerAddress(otsaddr, i);
-		SetTreeAddress(otsaddr, idx);
-		SetOtsAddress(otsaddr, idxleaf);
+	if (nodeh == TreeHash.Height)
+	{
+		// this also implies that the instance has no nodes left on the stack
+		MemoryTools::Copy(nodebuffer, 0, TreeHash.Node, 0, Params.N);
+		TreeHash.Completed = 1;
+	}
+	else
+	{
+		MemoryTools::Copy(nodebuffer, 0, State.Stack, State.StackOffset * Params.N, Params.N);
+		++TreeHash.StackUsage;
+		State.StackLevels[State.StackOffset] = nodeh;
+		++State.StackOffset;
+		++TreeHash.NextIndex;
+	}
+}
 
-		// get a seed for the WOTS keypair
-		GetSeed(Params, otsseed, skseed, 0, otsaddr);
+uint XmssCore::BdsTreeHashUpdate(const XmssParams &Params, XmssBdsState &State, uint Updates, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed,
+	const std::array<uint, 8> &Address)
+{
+	const uint THCNT = Params.TreeHeight - Params.BdsK;
+	uint i;
+	uint j;
+	uint level;
+	uint lmin;
+	uint low;
+	uint used;
 
-		// compute a WOTS signature
-		// initially, root = mhash, but on subsequent iterations it is the root of the subtree below the currently processed subtree
-		WotsSign(Params, Signature, smoft, root, otsseed, pubseed, otsaddr);
-		smoft += Params.WotsSignatureSize;
+	used = 0;
+
+	for (j = 0; j < Updates; ++j)
+	{
+		lmin = Params.TreeHeight;
+		level = THCNT;
+
+		// update the unfinished instance with the lowest node on the stack
+		for (i = 0; i < THCNT; ++i)
+		{
+			if (State.TreeHash[i].Completed != 0)
+			{
+				low = Params.TreeHeight;
+			}
+			else if (State.TreeHash[i].StackUsage == 0)
+			{
+				low = i;
+			}
+			else
+			{
+				low = TreeHashMinHeightOnStack(Params, State, State.TreeHash[i]);
+			}
+
+			if (low < lmin)
+			{
+				level = i;
+				lmin = low;
+			}
+		}
 
-		// compute the authentication path for the used WOTS leaf
-		TreeHash(Params, root, 0, Signature, smoft, skseed, 0, pubseed, idxleaf, otsaddr);
-		smoft += Params.TreeHeight * Params.N;
+		if (level == THCNT)
+		{
+			break;
+		}
+
+		TreeHashUpdate(Params, State.TreeHash[level], State, SkSeed, PubSeed, Address);
+		++used;
 	}
 
+	return Updates - used;
+}
 
-	ret = 0;
+int32_t XmssCore::BdsStateUpdate(const XmssParams &Params, XmssBdsState &State, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed, const std::array<uint, 8> &Address)
+{
+	const uint THCNT = Params.TreeHeight - Params.BdsK;
+	std::array<uint, 8> ltreeaddr = { 0 };
+	std::array<uint, 8> nodeaddr = { 0 };
+	std::array<uint, 8> otsaddr = { 0 };
+	uint idx;
+	uint nodeh;
+	int32_t ret;
+
+	idx = State.NextLeaf;
+	ret = -1;
+
+	if (idx != (1UL << Params.TreeHeight))
+	{
+		CopySubtreeAdress(otsaddr, Address);
+		CopySubtreeAdress(ltreeaddr, Address);
+		CopySubtreeAdress(nodeaddr, Address);
+		SetType(otsaddr, XMSS_ADDR_TYPE_OTS);
+		SetType(ltreeaddr, XMSS_ADDR_TYPE_LTREE);
+		SetType(nodeaddr, XMSS_ADDR_TYPE_HASHTREE);
+
+		SetOtsAddress(otsaddr, idx);
+		SetLtreeAddress(ltreeaddr, idx);
+		GenLeafWots(Params, State.Stack, State.StackOffset * Params.N, SkSeed, 0, PubSeed, ltreeaddr, otsaddr);
+		State.StackLevels[State.StackOffset] = 0;
+		++State.StackOffset;
+
+		while (State.StackOffset > 1 && State.StackLevels[State.StackOffset - 1] == State.StackLevels[State.StackOffset - 2])
+		{
+			nodeh = State.StackLevels[State.StackOffset - 1];
+
+			// store the first authentication path, the first right node of each treehash instance, and the retained nodes
+			if ((idx >> nodeh) == 1)
+			{
+				MemoryTools::Copy(State.Stack, (State.StackOffset - 1) * Params.N, State.Auth, nodeh * Params.N, Params.N);
+			}
+			else if (nodeh < THCNT && (idx >> nodeh) == 3)
+			{
+				MemoryTools::Copy(State.Stack, (State.StackOffset - 1) * Params.N, State.TreeHash[nodeh].Node, 0, Params.N);
+			}
+			else if (nodeh >= THCNT)
+			{
+				MemoryTools::Copy(State.Stack, (State.StackOffset - 1) * Params.N, State.Retain,
+					((1UL << (Params.TreeHeight - 1 - nodeh)) + nodeh - Params.TreeHeight + (((idx >> nodeh) - 3) >> 1)) * Params.N, Params.N);
+			}
+
+			SetTreeHeight(nodeaddr, nodeh);
+			SetTreeIndex(nodeaddr, idx >> (nodeh + 1));
+			ThashH(Params, State.Stack, (State.StackOffset - 2) * Params.N, State.Stack, (State.StackOffset - 2) * Params.N, PubSeed, nodeaddr);
+			++State.StackLevels[State.StackOffset - 2];
+			--State.StackOffset;
+		}
+
+		++State.NextLeaf;
+		ret = 0;
+	}
 
 	return ret;
 }
 
-void XmssCore::Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters)
+void XmssCore::BdsRound(const XmssParams &Params, XmssBdsState &State, uint LeafIdx, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed, const std::array<uint, 8> &Address)
+{
+	const uint THCNT = Params.TreeHeight - Params.BdsK;
+	std::vector<byte> buf(2 * Params.N);
+	std::array<uint, 8> ltreeaddr = { 0 };
+	std::array<uint, 8> nodeaddr = { 0 };
+	std::array<uint, 8> otsaddr = { 0 };
+	uint i;
+	uint offset;
+	uint rowidx;
+	uint startidx;
+	uint tau;
+
+	CopySubtreeAdress(otsaddr, Address);
+	CopySubtreeAdress(ltreeaddr, Address);
+	CopySubtreeAdress(nodeaddr, Address);
+	SetType(otsaddr, XMSS_ADDR_TYPE_OTS);
+	SetType(ltreeaddr, XMSS_ADDR_TYPE_LTREE);
+	SetType(nodeaddr, XMSS_ADDR_TYPE_HASHTREE);
+
+	// tau is the height of the first left node above the leaf
+	tau = Params.TreeHeight;
+
+	for (i = 0; i < Params.TreeHeight; ++i)
+	{
+		if (((LeafIdx >> i) & 1) == 0)
+		{
+			tau = i;
+			break;
+		}
+	}
+
+	if (tau > 0)
+	{
+		MemoryTools::Copy(State.Auth, (tau - 1) * Params.N, buf, 0, Params.N);
+		// this must be read before the keep nodes are refreshed
+		MemoryTools::Copy(State.Keep, ((tau - 1) >> 1) * Params.N, buf, Params.N, Params.N);
+	}
+
+	if (((LeafIdx >> (tau + 1)) & 1) == 0 && tau < Params.TreeHeight - 1)
+	{
+		MemoryTools::Copy(State.Auth, tau * Params.N, State.Keep, (tau >> 1) * Params.N, Params.N);
+	}
+
+	if (tau == 0)
+	{
+		SetLtreeAddress(ltreeaddr, LeafIdx);
+		SetOtsAddress(otsaddr, LeafIdx);
+		GenLeafWots(Params, State.Auth, 0, SkSeed, 0, PubSeed, ltreeaddr, otsaddr);
+	}
+	else
+	{
+		SetTreeHeight(nodeaddr, tau - 1);
+		SetTreeIndex(nodeaddr, LeafIdx >> tau);
+		ThashH(Params, State.Auth, tau * Params.N, buf, 0, PubSeed, nodeaddr);
+
+		// the nodes below tau are taken from the completed treehash instances and the retained nodes
+		for (i = 0; i < tau; ++i)
+		{
+			if (i < THCNT)
+			{
+				MemoryTools::Copy(State.TreeHash[i].Node, 0, State.Auth, i * Params.N, Params.N);
+			}
+			else
+			{
+				offset = (1UL << (Params.TreeHeight - 1 - i)) + i - Params.TreeHeight;
+				rowidx = ((LeafIdx >> i) - 1) >> 1;
+				MemoryTools::Copy(State.Retain, (offset + rowidx) * Params.N, State.Auth, i * Params.N, Params.N);
+			}
+		}
+
+		// and those instances are restarted on the next right node of their height
+		for (i = 0; i < ((tau < THCNT) ? tau : THCNT); ++i)
+		{
+			startidx = LeafIdx + 1 + (3 * (1UL << i));
+
+			if (startidx < (1UL << Params.TreeHeight))
+			{
+				State.TreeHash[i].Height = i;
+				State.TreeHash[i].NextIndex = startidx;
+				State.TreeHash[i].Completed = 0;
+				State.TreeHash[i].StackUsage = 0;
+			}
+		}
+	}
+}
+
+void XmssCore::BdsKeyPair(const XmssParams &Params, std::vector<byte> &PublicKey, std::vector<byte> &SecretKey, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed)
+{
+	std::vector<XmssBdsState> states(2 * Params.D - 1);
+	std::vector<byte> otsseed(Params.N);
+	std::vector<byte> root(Params.N);
+	std::vector<byte> wotssigs((Params.D - 1) * Params.WotsSignatureSize);
+	std::array<uint, 8> addr = { 0 };
+	uint i;
+
+	for (i = 0; i < states.size(); ++i)
+	{
+		BdsInitialize(Params, states[i]);
+	}
+
+	// build the first tree of each lower layer, and sign its root with the first WOTS key of the layer above
+	for (i = 0; i < Params.D - 1; ++i)
+	{
+		SetLayerAddress(addr, i);
+		TreeHashInit(Params, root, states[i], SkSeed, PubSeed, addr);
+		SetLayerAddress(addr, i + 1);
+		GetSeed(Params, otsseed, SkSeed, 0, addr);
+		WotsSign(Params, wotssigs, i * Params.WotsSignatureSize, root, otsseed, PubSeed, addr);
+	}
+
+	// the address now points to the single tree on the top layer
+	SetLayerAddress(addr, Params.D - 1);
+	TreeHashInit(Params, root, states[Params.D - 1], SkSeed, PubSeed, addr);
+	MemoryTools::Copy(root, 0, PublicKey, XMSS_OID_LEN, Params.N);
+
+	BdsSerialize(Params, SecretKey, states, wotssigs);
+}
+
+void XmssCore::BdsSign(const XmssParams &Params, std::vector<byte> &SecretKey, std::vector<byte> &Signature, size_t SigOffset, const std::vector<byte> &Root, ulong Idx,
+	const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed)
+{
+	std::vector<XmssBdsState> states(2 * Params.D - 1);
+	std::vector<byte> otsseed(Params.N);
+	std::vector<byte> wotssigs((Params.D - 1) * Params.WotsSignatureSize);
+	std::array<uint, 8> addr = { 0 };
+	std::array<uint, 8> otsaddr = { 0 };
+	std::vector<bool> chgs(2 * Params.D - 1, false);
+	std::vector<bool> chgw(Params.D - 1, false);
+	ulong idxtree;
+	uint i;
+	uint idxleaf;
+	uint j;
+	uint rmdu;
+	uint updates;
+	int32_t needswap;
+
+	BdsDeserialize(Params, states, wotssigs, SecretKey);
+
+	// the lowest layer signs the message hash
+	idxtree = Idx >> Params.TreeHeight;
+	idxleaf = static_cast<uint>(Idx & ((1ULL << Params.TreeHeight) - 1));
+	SetType(otsaddr, XMSS_ADDR_TYPE_OTS);
+	SetLayerAddress(otsaddr, 0);
+	SetTreeAddress(otsaddr, idxtree);
+	SetOtsAddress(otsaddr, idxleaf);
+	GetSeed(Params, otsseed, SkSeed, 0, otsaddr);
+	WotsSign(Params, Signature, SigOffset, Root, otsseed, PubSeed, otsaddr);
+	SigOffset += Params.WotsSignatureSize;
+
+	// the authentication path was computed during the previous round
+	MemoryTools::Copy(states[0].Auth, 0, Signature, SigOffset, Params.TreeHeight * Params.N);
+	SigOffset += Params.TreeHeight * Params.N;
+
+	// the upper layers only change when a subtree is exhausted, their WOTS signatures are cached in the state
+	for (i = 1; i < Params.D; ++i)
+	{
+		MemoryTools::Copy(wotssigs, (i - 1) * Params.WotsSignatureSize, Signature, SigOffset, Params.WotsSignatureSize);
+		SigOffset += Params.WotsSignatureSize;
+		MemoryTools::Copy(states[i].Auth, 0, Signature, SigOffset, Params.TreeHeight * Params.N);
+		SigOffset += Params.TreeHeight * Params.N;
+	}
+
+	// advance the states for the next index
+	updates = (Params.TreeHeight - Params.BdsK) >> 1;
+	needswap = -1;
+	SetTreeAddress(addr, idxtree + 1);
+
+	// the mandatory update of the next tree on the lowest layer does not count towards the (h - k) / 2 updates
+	if ((1 + idxtree) * (1ULL << Params.TreeHeight) + idxleaf < (1ULL << Params.FullHeight))
+	{
+		BdsStateUpdate(Params, states[Params.D], SkSeed, PubSeed, addr);
+		chgs[Params.D] = true;
+	}
+
+	for (i = 0; i < Params.D; ++i)
+	{
+		if (((Idx + 1) & ((1ULL << ((i + 1) * Params.TreeHeight)) - 1)) != 0)
+		{
+			// not at the end of a tree on this layer
+			idxleaf = static_cast<uint>((Idx >> (Params.TreeHeight * i)) & ((1ULL << Params.TreeHeight) - 1));
+			idxtree = (Idx >> (Params.TreeHeight * (i + 1)));
+			SetLayerAddress(addr, i);
+			SetTreeAddress(addr, idxtree);
+
+			if (static_cast<int32_t>(i) == needswap + 1)
+			{
+				BdsRound(Params, states[i], idxleaf, SkSeed, PubSeed, addr);
+				chgs[i] = true;
+			}
+
+			rmdu = BdsTreeHashUpdate(Params, states[i], updates, SkSeed, PubSeed, addr);
+			chgs[i] = chgs[i] || (rmdu != updates);
+			updates = rmdu;
+			SetTreeAddress(addr, idxtree + 1);
+
+			// if a next tree exists on this layer, spend a remaining update on it
+			if ((1 + idxtree) * (1ULL << Params.TreeHeight) + idxleaf < (1ULL << (Params.FullHeight - (Params.TreeHeight * i))))
+			{
+				if (i > 0 && updates > 0 && states[Params.D + i].NextLeaf < (1ULL << Params.FullHeight))
+				{
+					BdsStateUpdate(Params, states[Params.D + i], SkSeed, PubSeed, addr);
+					chgs[Params.D + i] = true;
+					--updates;
+				}
+			}
+		}
+		else if (Idx < (1ULL << Params.FullHeight) - 1)
+		{
+			// the tree on this layer is exhausted; the completed next tree becomes current, and its root is signed by the layer above
+			std::swap(states[Params.D + i], states[i]);
+
+			SetLayerAddress(otsaddr, i + 1);
+			SetTreeAddress(otsaddr, (Idx + 1) >> ((i + 2) * Params.TreeHeight));
+			SetOtsAddress(otsaddr, static_cast<uint>(((Idx >> ((i + 1) * Params.TreeHeight)) + 1) & ((1ULL << Params.TreeHeight) - 1)));
+			GetSeed(Params, otsseed, SkSeed, 0, otsaddr);
+			WotsSign(Params, wotssigs, i * Params.WotsSignatureSize, states[i].Stack, otsseed, PubSeed, otsaddr);
+
+			states[Params.D + i].StackOffset = 0;
+			states[Params.D + i].NextLeaf = 0;
+			chgs[i] = true;
+			chgs[Params.D + i] = true;
+			chgw[i] = true;
+
+			// the WOTS signature counts as one update; as in the reference the count is unsigned,
+			// so a layer swap that exhausts it leaves the upper layers free to finish every pending update
+			--updates;
+			needswap = static_cast<int32_t>(i);
+
+			for (j = 0; j < Params.TreeHeight - Params.BdsK; ++j)
+			{
+				states[i].TreeHash[j].Completed = 1;
+			}
+		}
+	}
+
+	// only the states and signatures that were advanced are written back to the key
+	for (i = 0; i < states.size(); ++i)
+	{
+		if (chgs[i])
+		{
+			BdsSerializeState(Params, SecretKey, states[i], i);
+		}
+	}
+
+	for (i = 0; i < chgw.size(); ++i)
+	{
+		if (chgw[i])
+		{
+			BdsSerializeWots(Params, SecretKey, wotssigs, i);
+		}
+	}
+}
+
+void XmssCore::Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters, bool Traversal)
 	{
 		uint oid;
 
@@ -1311,7 +1962,8 @@ void XmssCore::Generate(std::vector<byte> &PublicKey, std::vector<byte> &Private
 			XmssParams params;
 			XmssParseOid(params, oid);
 			PublicKey.resize(params.PublicKeySize + sizeof(oid));
-			PrivateKey.resize(params.SecretKeySize + sizeof(oid));
+			// the optional traversal state is appended to the private key
+			PrivateKey.resize(params.SecretKeySize + sizeof(oid) + (Traversal ? BdsSkBytes(params) : 0));
 			XmssKeyPair(PublicKey, PrivateKey, oid, Rng);
 		}
 		else
@@ -1319,33 +1971,40 @@ void XmssCore::Generate(std::vector<byte> &PublicKey, std::vector<byte> &Private
 			XmssParams params;
 			XmssMtParseOid(params, oid);
 			PublicKey.resize(params.PublicKeySize + sizeof(oid));
-			PrivateKey.resize(params.SecretKeySize + sizeof(oid));
+			PrivateKey.resize(params.SecretKeySize + sizeof(oid) + (Traversal ? BdsSkBytes(params) : 0));
 			XmssMtKeyPair(PublicKey, PrivateKey, oid, Rng);
 		}
 	}
 
-size_t XmssCore::Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters)
+size_t XmssCore::Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters)
 	{
 		size_t smlen;
 		uint oid;
+		int32_t ret;
 
 		smlen = 0;
 		oid = XmssUtils::ToOid(Parameters);
-		std::vector<byte> sk2 = PrivateKey;
 
+		// the private key index, and the traversal state if present, are updated in place
 		if (XmssUtils::IsXMSS(Parameters))
 		{
 			XmssParams params;
 			XmssParseOid(params, oid);
 			Signature.resize(params.SignatureSize + Message.size());
-			XmssSign(sk2, Signature, smlen, Message, Message.size());
+			ret = XmssSign(PrivateKey, Signature, smlen, Message, Message.size());
 		}
 		else
 		{
 			XmssParams params;
 			XmssMtParseOid(params, oid);
 			Signature.resize(params.SignatureSize + Message.size());
-			XmssMtSign(sk2, Signature, smlen, Message, Message.size());
+			ret = XmssMtSign(PrivateKey, Signature, smlen, Message, Message.size());
+		}
+
+		if (ret != 0)
+		{
+			// the key is exhausted, or the traversal state is invalid
+			smlen = 0;
 		}
 
 		return smlen;
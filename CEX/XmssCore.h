@@ -30,6 +30,7 @@ private:
 	static const uint XMSS_SHA2_512 = 1;
 	static const uint XMSS_SHAKE_128 = 2;
 	static const uint XMSS_SHAKE_256 = 3;
+	static const byte XMSS_BDS_VERSION = 1;
 
 	typedef struct
 	{
@@ -51,6 +52,27 @@ private:
 		uint WotsLogW;
 	} XmssParams;
 
+	typedef struct
+	{
+		std::vector<byte> Node;
+		uint Completed;
+		uint Height;
+		uint NextIndex;
+		uint StackUsage;
+	} XmssTreeHash;
+
+	typedef struct
+	{
+		std::vector<byte> Auth;
+		std::vector<byte> Keep;
+		std::vector<byte> Retain;
+		std::vector<byte> Stack;
+		std::vector<uint> StackLevels;
+		std::vector<XmssTreeHash> TreeHash;
+		uint NextLeaf;
+		uint StackOffset;
+	} XmssBdsState;
+
 	// hash.c //
 
 	static void AddressToBytes(std::vector<byte> &Input, const std::array<uint, 8> &Address);
@@ -102,7 +124,7 @@ private:
 
 	static void UllToBytes(std::vector<byte> &Output, size_t Offset, size_t Length, ulong Input);
 
-	static ulong BytesToUll(const std::vector<byte> &Input, size_t Length);
+	static ulong BytesToUll(const std::vector<byte> &Input, size_t Offset, size_t Length);
 
 	// wots.c //
 
@@ -170,11 +192,47 @@ private:
 
 	static int32_t XmssMtCoreSign(const XmssParams &Params, std::vector<byte> &SecretKey, std::vector<byte> &Signature, size_t &SigLength, const std::vector<byte> &Message, size_t MsgLength);
 
+	// xmss_core_fast.c //
+
+	static void BdsInitialize(const XmssParams &Params, XmssBdsState &State);
+
+	static size_t BdsSkBytes(const XmssParams &Params);
+
+	static size_t BdsStateBytes(const XmssParams &Params);
+
+	static void BdsSerialize(const XmssParams &Params, std::vector<byte> &SecretKey, const std::vector<XmssBdsState> &States, const std::vector<byte> &WotsSigs);
+
+	static void BdsSerializeState(const XmssParams &Params, std::vector<byte> &SecretKey, const XmssBdsState &State, size_t Index);
+
+	static void BdsSerializeWots(const XmssParams &Params, std::vector<byte> &SecretKey, const std::vector<byte> &WotsSigs, size_t Index);
+
+	static void BdsDeserialize(const XmssParams &Params, std::vector<XmssBdsState> &States, std::vector<byte> &WotsSigs, const std::vector<byte> &SecretKey);
+
+	static void TreeHashInit(const XmssParams &Params, std::vector<byte> &Node, XmssBdsState &State, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed,
+		const std::array<uint, 8> &Address);
+
+	static uint TreeHashMinHeightOnStack(const XmssParams &Params, const XmssBdsState &State, const XmssTreeHash &TreeHash);
+
+	static void TreeHashUpdate(const XmssParams &Params, XmssTreeHash &TreeHash, XmssBdsState &State, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed,
+		const std::array<uint, 8> &Address);
+
+	static uint BdsTreeHashUpdate(const XmssParams &Params, XmssBdsState &State, uint Updates, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed,
+		const std::array<uint, 8> &Address);
+
+	static int32_t BdsStateUpdate(const XmssParams &Params, XmssBdsState &State, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed, const std::array<uint, 8> &Address);
+
+	static void BdsRound(const XmssParams &Params, XmssBdsState &State, uint LeafIdx, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed, const std::array<uint, 8> &Address);
+
+	static void BdsKeyPair(const XmssParams &Params, std::vector<byte> &PublicKey, std::vector<byte> &SecretKey, const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed);
+
+	static void BdsSign(const XmssParams &Params, std::vector<byte> &SecretKey, std::vector<byte> &Signature, size_t SigOffset, const std::vector<byte> &Root, ulong Idx,
+		const std::vector<byte> &SkSeed, const std::vector<byte> &PubSeed);
+
 public:
 
-	static void Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters);
+	static void Generate(std::vector<byte> &PublicKey, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters, bool Traversal = false);
 
-	static size_t Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, const std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters);
+	static size_t Sign(std::vector<byte> &Signature, const std::vector<byte> &Message, std::vector<byte> &PrivateKey, std::unique_ptr<Prng::IPrng> &Rng, XmssParameters Parameters);
 
 	static bool Verify(std::vector<byte> &Message, const std::vector<byte> &Signature, const std::vector<byte> &PublicKey, XmssParameters Parameters);
 };
@@ -2,6 +2,7 @@
 #include "../CEX/EAX.h"
 #include "../CEX/GCM.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/OCB.h"
 #include "../CEX/SecureRandom.h"
 
 namespace Test
@@ -11,6 +12,7 @@ namespace Test
 	using Exception::CryptoCipherModeException;
 	using Cipher::Block::Mode::EAX;
 	using Cipher::Block::Mode::GCM;
+	using Cipher::Block::Mode::OCB;
 	using Cipher::Block::IBlockCipher;
 	using Utility::IntegerTools;
 	using Cipher::SymmetricKeySize;
@@ -64,7 +66,7 @@ namespace Test
 		{
 			// test all exception handlers for correct operation
 			Exception();
-			OnProgress(std::string("AeadTest: Passed EAX and GCM exception handling tests.."));
+			OnProgress(std::string("AeadTest: Passed EAX, GCM and OCB exception handling tests.."));
 
 			EAX* eax1 = new EAX(Enumeration::BlockCiphers::AES);
 			Kat(eax1, m_key[0], m_nonce[0], m_associatedText[0], m_plainText[0], m_cipherText[0], m_expectedCode[0]);
@@ -127,11 +129,56 @@ namespace Test
 			delete gcm3;
 			OnProgress(std::string("AeadTest: Passed GCM parallel tests.."));
 
+			GCM* gcm5 = new GCM(Enumeration::BlockCiphers::AES);
+			Segmented(gcm5);
+			delete gcm5;
+			OnProgress(std::string("AeadTest: Passed GCM segmented transform tests.."));
+
 			GCM* gcm4 = new GCM(Enumeration::BlockCiphers::AES);
 			Stress(gcm4);
 			delete gcm4;
 			OnProgress(std::string("AeadTest: Passed GCM stress tests.."));
 
+			OCB* ocb1 = new OCB(Enumeration::BlockCiphers::AES);
+			Kat(ocb1, m_key[28], m_nonce[28], m_associatedText[28], m_plainText[28], m_cipherText[28], m_expectedCode[28]);
+			Kat(ocb1, m_key[29], m_nonce[29], m_associatedText[29], m_plainText[29], m_cipherText[29], m_expectedCode[29]);
+			Kat(ocb1, m_key[30], m_nonce[30], m_associatedText[30], m_plainText[30], m_cipherText[30], m_expectedCode[30]);
+			Kat(ocb1, m_key[31], m_nonce[31], m_associatedText[31], m_plainText[31], m_cipherText[31], m_expectedCode[31]);
+			Kat(ocb1, m_key[32], m_nonce[32], m_associatedText[32], m_plainText[32], m_cipherText[32], m_expectedCode[32]);
+			Kat(ocb1, m_key[33], m_nonce[33], m_associatedText[33], m_plainText[33], m_cipherText[33], m_expectedCode[33]);
+			Kat(ocb1, m_key[34], m_nonce[34], m_associatedText[34], m_plainText[34], m_cipherText[34], m_expectedCode[34]);
+			Kat(ocb1, m_key[35], m_nonce[35], m_associatedText[35], m_plainText[35], m_cipherText[35], m_expectedCode[35]);
+			Kat(ocb1, m_key[36], m_nonce[36], m_associatedText[36], m_plainText[36], m_cipherText[36], m_expectedCode[36]);
+			Kat(ocb1, m_key[37], m_nonce[37], m_associatedText[37], m_plainText[37], m_cipherText[37], m_expectedCode[37]);
+			Kat(ocb1, m_key[38], m_nonce[38], m_associatedText[38], m_plainText[38], m_cipherText[38], m_expectedCode[38]);
+			Kat(ocb1, m_key[39], m_nonce[39], m_associatedText[39], m_plainText[39], m_cipherText[39], m_expectedCode[39]);
+			Kat(ocb1, m_key[40], m_nonce[40], m_associatedText[40], m_plainText[40], m_cipherText[40], m_expectedCode[40]);
+			Kat(ocb1, m_key[41], m_nonce[41], m_associatedText[41], m_plainText[41], m_cipherText[41], m_expectedCode[41]);
+			Kat(ocb1, m_key[42], m_nonce[42], m_associatedText[42], m_plainText[42], m_cipherText[42], m_expectedCode[42]);
+			Kat(ocb1, m_key[43], m_nonce[43], m_associatedText[43], m_plainText[43], m_cipherText[43], m_expectedCode[43]);
+			delete ocb1;
+			OnProgress(std::string("AeadTest: Passed OCB known answer comparison tests.."));
+
+			OCB* ocb2 = new OCB(Enumeration::BlockCiphers::AES);
+			Incremental(ocb2);
+			delete ocb2;
+			OnProgress(std::string("AeadTest: Passed OCB auto incrementing tests.."));
+
+			OCB* ocb3 = new OCB(Enumeration::BlockCiphers::AES);
+			Parallel(ocb3);
+			delete ocb3;
+			OnProgress(std::string("AeadTest: Passed OCB parallel tests.."));
+
+			OCB* ocb4 = new OCB(Enumeration::BlockCiphers::AES);
+			Segmented(ocb4);
+			delete ocb4;
+			OnProgress(std::string("AeadTest: Passed OCB segmented transform tests.."));
+
+			OCB* ocb5 = new OCB(Enumeration::BlockCiphers::AES);
+			Stress(ocb5);
+			delete ocb5;
+			OnProgress(std::string("AeadTest: Passed OCB stress tests.."));
+
 			return SUCCESS;
 		}
 		catch (TestException const &ex)
@@ -180,6 +227,20 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::None);
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Exception handling failure! -AE11"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test every modes pointer constructor for invalid cipher //
 
 		try
@@ -210,6 +271,20 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(nullptr);
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Exception handling failure! -AE12"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test every modes initialization with an invalid key size //
 
 		try
@@ -252,6 +327,26 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize() + 1);
+			std::vector<byte> nonce(ks.NonceSize());
+			SymmetricKey kp(key, nonce);
+
+			cpr.Initialize(true, kp);
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE13"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test each modes initialization with an invalid nonce size //
 
 		try
@@ -294,6 +389,26 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize());
+			std::vector<byte> nonce(0);
+			SymmetricKey kp(key, nonce);
+
+			cpr.Initialize(true, kp);
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE14"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test each mode for invalid parallel options //
 
 		try
@@ -338,6 +453,27 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize());
+			std::vector<byte> nonce(ks.NonceSize());
+			SymmetricKey kp(key, nonce);
+
+			cpr.Initialize(true, kp);
+			cpr.ParallelMaxDegree(9999);
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE15"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test each mode for uninitialized finalize call //
 
 		try
@@ -378,6 +514,25 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			std::vector<byte> tag(0);
+
+			// call finalize on an uninitialized cipher
+			tag.resize(cpr.MaxTagSize());
+			cpr.Finalize(tag, 0, tag.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE16"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test each mode for invalid tag size //
 
 		try
@@ -428,6 +583,30 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize());
+			std::vector<byte> nonce(ks.NonceSize());
+			SymmetricKey kp(key, nonce);
+			std::vector<byte> tag(0);
+
+			// use an invalid mac-tag size when calling finalize
+			tag.resize(1);
+			cpr.Initialize(true, kp);
+			cpr.Finalize(tag, 0, tag.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE17"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test each mode uninitialized associated data calls //
 
 		try
@@ -466,6 +645,24 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			std::vector<byte> aad(16);
+
+			// set associated data on an uninitialized cipher
+			cpr.SetAssociatedData(aad, 0, aad.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE18"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test overlapping set associated data calls //
 
 		try
@@ -518,6 +715,31 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize());
+			std::vector<byte> nonce(ks.NonceSize());
+			SymmetricKey kp(key, nonce);
+			std::vector<byte> aad(16);
+
+			cpr.Initialize(true, kp);
+			// set associated data for this stream
+			cpr.SetAssociatedData(aad, 0, aad.size());
+			// set associated data again, without calling finalize to reset the state
+			cpr.SetAssociatedData(aad, 0, aad.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE19"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test uninitialized verify call //
 
 		try
@@ -556,6 +778,24 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			std::vector<byte> tag(cpr.MaxTagSize());
+
+			// call verify without initializing or processing data
+			cpr.Verify(tag, 0, tag.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE20"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test illegal verify call in encrypt operation mode  //
 
 		try
@@ -606,6 +846,30 @@ namespace Test
 			throw;
 		}
 
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize());
+			std::vector<byte> nonce(ks.NonceSize());
+			SymmetricKey kp(key, nonce);
+			std::vector<byte> tag(cpr.MaxTagSize());
+
+			// initialize for encryption
+			cpr.Initialize(true, kp);
+			// call verify in wrong operation mode
+			cpr.Verify(tag, 0, tag.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE21"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
 		// test verify call with invalid tag size  //
 
 		try
@@ -661,6 +925,33 @@ namespace Test
 		{
 			throw;
 		}
+
+		try
+		{
+			OCB cpr(Enumeration::BlockCiphers::AES);
+			SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+			std::vector<byte> key(ks.KeySize());
+			std::vector<byte> nonce(ks.NonceSize());
+			SymmetricKey kp(key, nonce);
+			std::vector<byte> inp(cpr.BlockSize());
+			std::vector<byte> otp(cpr.BlockSize());
+			std::vector<byte> tag(1);
+
+			// initialize for decryption
+			cpr.Initialize(false, kp);
+			cpr.Transform(inp, 0, otp, 0, inp.size());
+			// the tag is sized too small
+			cpr.Verify(tag, 0, tag.size());
+
+			throw TestException(std::string("Exception"), AeadModeConvert::ToName(AeadModes::OCB), std::string("Threefish"), std::string("Exception handling failure! -AE22"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
 	}
 
 	void AeadTest::Kat(IAeadMode* Cipher, std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<byte> &AssociatedText, std::vector<byte> &PlainText,
@@ -846,6 +1137,60 @@ namespace Test
 		}
 	}
 
+	void AeadTest::Segmented(IAeadMode* Cipher)
+	{
+		const size_t BLKLEN = 16;
+		std::vector<byte> data;
+		std::vector<byte> enc1;
+		std::vector<byte> enc2;
+		std::vector<byte> key(32);
+		std::vector<SymmetricKeySize> keySizes = Cipher->LegalKeySizes();
+		std::vector<byte> nonce(keySizes[0].NonceSize());
+		std::vector<byte> assoc;
+		Prng::SecureRandom rng;
+		size_t j;
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			// lengths that cover the 8 and 4 block paths, and a partial final block
+			const size_t MSGLEN = rng.NextUInt32(4096, 1);
+			const size_t ADLEN = rng.NextUInt32(512, 1);
+
+			data.resize(MSGLEN);
+			assoc.resize(ADLEN);
+			rng.Generate(data);
+			rng.Generate(nonce);
+			rng.Generate(key);
+			rng.Generate(assoc);
+			SymmetricKey kp(key, nonce);
+
+			// one transform call
+			enc1.resize(MSGLEN + Cipher->MaxTagSize());
+			Cipher->ParallelProfile().IsParallel() = false;
+			Cipher->Initialize(true, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+			Cipher->Transform(data, 0, enc1, 0, data.size());
+			Cipher->Finalize(enc1, MSGLEN, Cipher->MaxTagSize());
+
+			// a transform call per block
+			enc2.resize(MSGLEN + Cipher->MaxTagSize());
+			Cipher->Initialize(true, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+
+			for (j = 0; j < MSGLEN; j += BLKLEN)
+			{
+				Cipher->Transform(data, j, enc2, j, IntegerTools::Min(BLKLEN, MSGLEN - j));
+			}
+
+			Cipher->Finalize(enc2, MSGLEN, Cipher->MaxTagSize());
+
+			if (enc1 != enc2)
+			{
+				throw TestException(std::string("Segmented"), Cipher->Name(), std::string("AeadTest: Encrypted output is not equal! -AS1"));
+			}
+		}
+	}
+
 	void AeadTest::Stress(IAeadMode* Cipher)
 	{
 		SymmetricKeySize keySize = Cipher->LegalKeySizes()[0];
@@ -925,9 +1270,26 @@ namespace Test
 			std::string("FEFFE9928665731C6D6A8F9467308308FEFFE9928665731C6D6A8F9467308308"),
 			std::string("FEFFE9928665731C6D6A8F9467308308FEFFE9928665731C6D6A8F9467308308"),
 			std::string("FEFFE9928665731C6D6A8F9467308308FEFFE9928665731C6D6A8F9467308308"),
-			std::string("FEFFE9928665731C6D6A8F9467308308FEFFE9928665731C6D6A8F9467308308")
+			std::string("FEFFE9928665731C6D6A8F9467308308FEFFE9928665731C6D6A8F9467308308"),
+			// ocb
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F")
 		};
-		HexConverter::Decode(key, 28, m_key);
+		HexConverter::Decode(key, 44, m_key);
 
 		const std::vector<std::string> nonce =
 		{
@@ -960,9 +1322,26 @@ namespace Test
 			std::string("CAFEBABEFACEDBADDECAF888"),
 			std::string("CAFEBABEFACEDBADDECAF888"),
 			std::string("CAFEBABEFACEDBAD"),
-			std::string("9313225DF88406E555909C5AFF5269AA6A7A9538534F7DA1E4C303D2A318A728C3C0C95156809539FCF0E2429A6B525416AEDBF5A0DE6A57A637B39B")
+			std::string("9313225DF88406E555909C5AFF5269AA6A7A9538534F7DA1E4C303D2A318A728C3C0C95156809539FCF0E2429A6B525416AEDBF5A0DE6A57A637B39B"),
+			// ocb
+			std::string("BBAA99887766554433221100"),
+			std::string("BBAA99887766554433221101"),
+			std::string("BBAA99887766554433221102"),
+			std::string("BBAA99887766554433221103"),
+			std::string("BBAA99887766554433221104"),
+			std::string("BBAA99887766554433221105"),
+			std::string("BBAA99887766554433221106"),
+			std::string("BBAA99887766554433221107"),
+			std::string("BBAA99887766554433221108"),
+			std::string("BBAA99887766554433221109"),
+			std::string("BBAA9988776655443322110A"),
+			std::string("BBAA9988776655443322110B"),
+			std::string("BBAA9988776655443322110C"),
+			std::string("BBAA9988776655443322110D"),
+			std::string("BBAA9988776655443322110E"),
+			std::string("BBAA9988776655443322110F")
 		};
-		HexConverter::Decode(nonce, 28, m_nonce);
+		HexConverter::Decode(nonce, 44, m_nonce);
 
 		const std::vector<std::string> associated =
 		{
@@ -995,9 +1374,26 @@ namespace Test
 			std::string(""),
 			std::string("FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2"),
 			std::string("FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2"),
-			std::string("FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2")
+			std::string("FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2"),
+			// ocb
+			std::string(""),
+			std::string("0001020304050607"),
+			std::string("0001020304050607"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F1011121314151617"),
+			std::string("000102030405060708090A0B0C0D0E0F1011121314151617"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F2021222324252627"),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F2021222324252627"),
+			std::string("")
 		};
-		HexConverter::Decode(associated, 28, m_associatedText);
+		HexConverter::Decode(associated, 44, m_associatedText);
 
 		const std::vector<std::string> plain =
 		{
@@ -1030,9 +1426,26 @@ namespace Test
 			std::string("D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A721C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B391AAFD255"),
 			std::string("D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A721C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B39"),
 			std::string("D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A721C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B39"),
-			std::string("D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A721C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B39")
+			std::string("D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A721C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B39"),
+			// ocb
+			std::string(""),
+			std::string("0001020304050607"),
+			std::string(""),
+			std::string("0001020304050607"),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F"),
+			std::string("000102030405060708090A0B0C0D0E0F1011121314151617"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F1011121314151617"),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F2021222324252627"),
+			std::string(""),
+			std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F2021222324252627")
 		};
-		HexConverter::Decode(plain, 28, m_plainText);
+		HexConverter::Decode(plain, 44, m_plainText);
 
 		const std::vector<std::string> cipher =
 		{
@@ -1065,9 +1478,26 @@ namespace Test
 			std::string("522DC1F099567D07F47F37A32A84427D643A8CDCBFE5C0C97598A2BD2555D1AA8CB08E48590DBB3DA7B08B1056828838C5F61E6393BA7A0ABCC9F662898015ADB094DAC5D93471BDEC1A502270E3CC6C"),
 			std::string("522DC1F099567D07F47F37A32A84427D643A8CDCBFE5C0C97598A2BD2555D1AA8CB08E48590DBB3DA7B08B1056828838C5F61E6393BA7A0ABCC9F66276FC6ECE0F4E1768CDDF8853BB2D551B"),
 			std::string("C3762DF1CA787D32AE47C13BF19844CBAF1AE14D0B976AFAC52FF7D79BBA9DE0FEB582D33934A4F0954CC2363BC73F7862AC430E64ABE499F47C9B1F3A337DBF46A792C45E454913FE2EA8F2"),
-			std::string("5A8DEF2F0C9E53F1F75D7853659E2A20EEB2B22AAFDE6419A058AB4F6F746BF40FC0C3B780F244452DA3EBF1C5D82CDEA2418997200EF82E44AE7E3FA44A8266EE1C8EB0C8B5D4CF5AE9F19A")
+			std::string("5A8DEF2F0C9E53F1F75D7853659E2A20EEB2B22AAFDE6419A058AB4F6F746BF40FC0C3B780F244452DA3EBF1C5D82CDEA2418997200EF82E44AE7E3FA44A8266EE1C8EB0C8B5D4CF5AE9F19A"),
+			// ocb
+			std::string("785407BFFFC8AD9EDCC5520AC9111EE6"),
+			std::string("6820B3657B6F615A5725BDA0D3B4EB3A257C9AF1F8F03009"),
+			std::string("81017F8203F081277152FADE694A0A00"),
+			std::string("45DD69F8F5AAE72414054CD1F35D82760B2CD00D2F99BFA9"),
+			std::string("571D535B60B277188BE5147170A9A22C3AD7A4FF3835B8C5701C1CCEC8FC3358"),
+			std::string("8CF761B6902EF764462AD86498CA6B97"),
+			std::string("5CE88EC2E0692706A915C00AEB8B2396F40E1C743F52436BDF06D8FA1ECA343D"),
+			std::string("1CA2207308C87C010756104D8840CE1952F09673A448A122C92C62241051F57356D7F3C90BB0E07F"),
+			std::string("6DC225A071FC1B9F7C69F93B0F1E10DE"),
+			std::string("221BD0DE7FA6FE993ECCD769460A0AF2D6CDED0C395B1C3CE725F32494B9F914D85C0B1EB38357FF"),
+			std::string("BD6F6C496201C69296C11EFD138A467ABD3C707924B964DEAFFC40319AF5A48540FBBA186C5553C68AD9F592A79A4240"),
+			std::string("FE80690BEE8A485D11F32965BC9D2A32"),
+			std::string("2942BFC773BDA23CABC6ACFD9BFD5835BD300F0973792EF46040C53F1432BCDFB5E1DDE3BC18A5F840B52E653444D5DF"),
+			std::string("D5CA91748410C1751FF8A2F618255B68A0A12E093FF454606E59F9C1D0DDC54B65E8628E568BAD7AED07BA06A4A69483A7035490C5769E60"),
+			std::string("C5CD9D1850C141E358649994EE701B68"),
+			std::string("4412923493C57D5DE0D700F753CCE0D1D2D95060122E9F15A5DDBFC5787E50B5CC55EE507BCB084E479AD363AC366B95A98CA5F3000B1479")
 		};
-		HexConverter::Decode(cipher, 28, m_cipherText);
+		HexConverter::Decode(cipher, 44, m_cipherText);
 
 		const std::vector<std::string> code =
 		{
@@ -1100,9 +1530,26 @@ namespace Test
 			std::string("B094DAC5D93471BDEC1A502270E3CC6C"),
 			std::string("76FC6ECE0F4E1768CDDF8853BB2D551B"),
 			std::string("3A337DBF46A792C45E454913FE2EA8F2"),
-			std::string("A44A8266EE1C8EB0C8B5D4CF5AE9F19A")
+			std::string("A44A8266EE1C8EB0C8B5D4CF5AE9F19A"),
+			// ocb
+			std::string("785407BFFFC8AD9EDCC5520AC9111EE6"),
+			std::string("5725BDA0D3B4EB3A257C9AF1F8F03009"),
+			std::string("81017F8203F081277152FADE694A0A00"),
+			std::string("14054CD1F35D82760B2CD00D2F99BFA9"),
+			std::string("3AD7A4FF3835B8C5701C1CCEC8FC3358"),
+			std::string("8CF761B6902EF764462AD86498CA6B97"),
+			std::string("F40E1C743F52436BDF06D8FA1ECA343D"),
+			std::string("C92C62241051F57356D7F3C90BB0E07F"),
+			std::string("6DC225A071FC1B9F7C69F93B0F1E10DE"),
+			std::string("E725F32494B9F914D85C0B1EB38357FF"),
+			std::string("40FBBA186C5553C68AD9F592A79A4240"),
+			std::string("FE80690BEE8A485D11F32965BC9D2A32"),
+			std::string("B5E1DDE3BC18A5F840B52E653444D5DF"),
+			std::string("ED07BA06A4A69483A7035490C5769E60"),
+			std::string("C5CD9D1850C141E358649994EE701B68"),
+			std::string("479AD363AC366B95A98CA5F3000B1479")
 		};
-		HexConverter::Decode(code, 28, m_expectedCode);
+		HexConverter::Decode(code, 44, m_expectedCode);
 		/*lint -restore */
 	}
 
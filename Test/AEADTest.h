@@ -99,6 +99,13 @@ namespace Test
 		///
 		/// <param name="Cipher">The cipher instance</param>
 		void Parallel(IAeadMode* Cipher);
+
+		/// <summary>
+		/// Compare a single large transform to block sized transforms for equivalence; exercises the multi-block authentication path
+		/// </summary>
+		///
+		/// <param name="Cipher">The cipher instance</param>
+		void Segmented(IAeadMode* Cipher);
 		
 		/// <summary>
 		/// Test operations in a looping stress test
@@ -233,7 +233,7 @@ namespace Test
 
 	bool AesAvsTest::HasAESNI()
 	{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 		CpuDetect dtc;
 
 		return dtc.AVX() && dtc.AESNI();
@@ -56,6 +56,7 @@ namespace Test
 		try
 		{
 			std::string ctr = TestUtils::ToString(DEF_TEST_ITER);
+			std::string bctr = TestUtils::ToString(DEF_TEST_ITER * 10);
 			Prngs rngType = Prngs::BCR;
 
 			// RingLWE
@@ -68,16 +69,42 @@ namespace Test
 			OnProgress(std::string("***Decrypting " + ctr + " messages using RingLWE RLWES1Q12289N1024***"));
 			RlweDecryptLoop(RLWEParameters::RLWES1Q12289N1024, DEF_TEST_ITER, rngType);
 
+			OnProgress(std::string("***Encrypting and decrypting " + bctr + " messages in a batch using RingLWE RLWES1Q12289N1024***"));
+			RingLWE rlwe(RLWEParameters::RLWES1Q12289N1024, rngType);
+			KemBatchLoop(&rlwe, DEF_TEST_ITER * 10);
+
 			// McEliece
 			OnProgress(std::string("***Generating " + ctr + " Keypairs using McEliece MPKCS1N4096T62***"));
 			MpkcGenerateLoop(MPKCParameters::MPKCS1N4096T62, DEF_TEST_ITER, rngType);
 
+			OnProgress(std::string("***Generating " + ctr + " Keypairs using McEliece MPKCS1N6960T119***"));
+			MpkcGenerateLoop(MPKCParameters::MPKCS1N6960T119, DEF_TEST_ITER, rngType);
+
+			OnProgress(std::string("***Generating " + ctr + " Keypairs using McEliece MPKCS1N8192T128***"));
+			MpkcGenerateLoop(MPKCParameters::MPKCS1N8192T128, DEF_TEST_ITER, rngType);
+
 			OnProgress(std::string("***Encrypting " + ctr + " messages using McEliece MPKCS1N4096T62***"));
 			MpkcEncryptLoop(MPKCParameters::MPKCS1N4096T62, DEF_TEST_ITER, rngType);
 
+			OnProgress(std::string("***Encrypting " + ctr + " messages using McEliece MPKCS1N6960T119***"));
+			MpkcEncryptLoop(MPKCParameters::MPKCS1N6960T119, DEF_TEST_ITER, rngType);
+
+			OnProgress(std::string("***Encrypting " + ctr + " messages using McEliece MPKCS1N8192T128***"));
+			MpkcEncryptLoop(MPKCParameters::MPKCS1N8192T128, DEF_TEST_ITER, rngType);
+
 			OnProgress(std::string("***Decrypting " + ctr + " messages using McEliece MPKCS1N4096T62***"));
 			MpkcDecryptLoop(MPKCParameters::MPKCS1N4096T62, DEF_TEST_ITER, rngType);
 
+			OnProgress(std::string("***Decrypting " + ctr + " messages using McEliece MPKCS1N6960T119***"));
+			MpkcDecryptLoop(MPKCParameters::MPKCS1N6960T119, DEF_TEST_ITER, rngType);
+
+			OnProgress(std::string("***Decrypting " + ctr + " messages using McEliece MPKCS1N8192T128***"));
+			MpkcDecryptLoop(MPKCParameters::MPKCS1N8192T128, DEF_TEST_ITER, rngType);
+
+			OnProgress(std::string("***Encrypting and decrypting " + ctr + " messages in a batch using McEliece MPKCS1N4096T62***"));
+			McEliece mpkc(MPKCParameters::MPKCS1N4096T62, rngType);
+			KemBatchLoop(&mpkc, DEF_TEST_ITER);
+
 			// ModuleLWE
 			OnProgress(std::string("***Generating " + ctr + " Keypairs using ModuleLWE MLWES2Q3329N256***"));
 			MlweGenerateLoop(MLWEParameters::MLWES2Q3329N256, DEF_TEST_ITER, rngType);
@@ -88,6 +115,13 @@ namespace Test
 			OnProgress(std::string("***Decrypting " + ctr + " messages using ModuleLWE MLWES2Q3329N256***"));
 			MlweDecryptLoop(MLWEParameters::MLWES2Q3329N256, DEF_TEST_ITER, rngType);
 
+			OnProgress(std::string("***Decrypting " + ctr + " messages using ModuleLWE MLWES2Q3329N256 with the key initialized per message***"));
+			MlweDecryptColdLoop(MLWEParameters::MLWES2Q3329N256, DEF_TEST_ITER, rngType);
+
+			OnProgress(std::string("***Encrypting and decrypting " + bctr + " messages in a batch using ModuleLWE MLWES2Q3329N256***"));
+			ModuleLWE mlwe(MLWEParameters::MLWES2Q3329N256, rngType);
+			KemBatchLoop(&mlwe, DEF_TEST_ITER * 10);
+
 			// NTRUPrime
 			OnProgress(std::string("***Generating " + ctr + " Keypairs using NTRUPrime NTRUS1LQ4591N761***"));
 			NtruGenerateLoop(NTRUParameters::NTRUS2SQ4591N761, DEF_TEST_ITER, rngType);
@@ -107,6 +141,10 @@ namespace Test
 			OnProgress(std::string("***Decrypting " + ctr + " messages using NTRUPrime NTRUS2SQ4591N761***"));
 			NtruDecryptLoop(NTRUParameters::NTRUS2SQ4591N761, DEF_TEST_ITER, rngType);
 
+			OnProgress(std::string("***Encrypting and decrypting " + bctr + " messages in a batch using NTRUPrime NTRUS2SQ4591N761***"));
+			NTRUPrime ntru(NTRUParameters::NTRUS2SQ4591N761, rngType);
+			KemBatchLoop(&ntru, DEF_TEST_ITER * 10);
+
 			OnProgress(std::string("### Asymmetric Signature Scheme Speed Tests:"));
 			OnProgress(std::string(""));
 
@@ -222,6 +260,88 @@ namespace Test
 		OnProgress(std::string(""));
 	}
 
+	void AsymmetricSpeedTest::KemBatchLoop(IAsymmetricCipher* Cipher, size_t Count)
+	{
+		std::vector<byte> cpt(0);
+		std::vector<byte> sec1(0);
+		std::vector<byte> sec2(0);
+		AsymmetricKeyPair* kp;
+		uint64_t dur;
+		uint64_t start;
+		bool status;
+
+		kp = Cipher->Generate();
+		Cipher->Initialize(kp->PublicKey());
+
+		start = TestUtils::GetTimeMs64();
+		Cipher->Encapsulate(cpt, sec1, Count);
+		dur = TestUtils::GetTimeMs64() - start;
+
+		std::string nlen = TestUtils::ToString(Count);
+		std::string secs = TestUtils::ToString((double)dur / 1000.0);
+		std::string ksec = TestUtils::ToString(GetUnitsPerSecond(dur != 0 ? dur : 1, Count));
+		std::string resp = std::string("Encrypted " + nlen + " messages in a batch in " + secs + " seconds, avg. " + ksec + " encrypted per second");
+
+		OnProgress(resp);
+
+		Cipher->Initialize(kp->PrivateKey());
+
+		start = TestUtils::GetTimeMs64();
+		status = Cipher->Decapsulate(cpt, sec2, Count);
+		dur = TestUtils::GetTimeMs64() - start;
+
+		delete kp;
+
+		if (!status || sec1 != sec2)
+		{
+			throw TestException(CLASSNAME, std::string("KemBatchLoop"), Cipher->Name(), std::string("The batch shared secrets do not match! -AK1"));
+		}
+
+		secs = TestUtils::ToString((double)dur / 1000.0);
+		ksec = TestUtils::ToString(GetUnitsPerSecond(dur != 0 ? dur : 1, Count));
+		resp = std::string("Decrypted " + nlen + " messages in a batch in " + secs + " seconds, avg. " + ksec + " decrypted per second");
+
+		OnProgress(resp);
+		OnProgress(std::string(""));
+	}
+
+	void AsymmetricSpeedTest::MlweDecryptColdLoop(MLWEParameters Params, size_t Loops, Prngs PrngType)
+	{
+		std::vector<byte> cpt(0);
+		std::vector<byte> sec1(32);
+		std::vector<byte> sec2(32);
+		Prng::IPrng* rng = Helper::PrngFromName::GetInstance(PrngType);
+		ModuleLWE asyCpr(Params, rng);
+		AsymmetricKeyPair* kp;
+
+		kp = asyCpr.Generate();
+		asyCpr.Initialize(kp->PublicKey());
+		asyCpr.Encapsulate(cpt, sec1);
+
+		uint64_t start = TestUtils::GetTimeMs64();
+
+		// the key expansion is repeated for every message, as when the key is not cached
+		for (size_t i = 0; i < Loops; ++i)
+		{
+			ModuleLWE cpr(Params, rng);
+			cpr.Initialize(kp->PrivateKey());
+			cpr.Decapsulate(cpt, sec2);
+		}
+
+		uint64_t dur = TestUtils::GetTimeMs64() - start;
+
+		delete kp;
+		delete rng;
+
+		std::string nlen = TestUtils::ToString(Loops);
+		std::string secs = TestUtils::ToString((double)dur / 1000.0);
+		std::string ksec = TestUtils::ToString(GetUnitsPerSecond(dur, Loops));
+		std::string resp = std::string("Decrypted " + nlen + " messages in " + secs + " seconds, avg. " + ksec + " decrypted per second");
+
+		OnProgress(resp);
+		OnProgress(std::string(""));
+	}
+
 	void AsymmetricSpeedTest::MlweDecryptLoop(MLWEParameters Params, size_t Loops, Prngs PrngType)
 	{
 		std::vector<byte> cpt(0);
@@ -4,6 +4,7 @@
 #include "ITest.h"
 #include "../CEX/AsymmetricPrimitives.h"
 #include "../CEX/DilithiumParameters.h"
+#include "../CEX/IAsymmetricCipher.h"
 #include "../CEX/IBlockCipher.h"
 #include "../CEX/MLWEParameters.h"
 #include "../CEX/MPKCParameters.h"
@@ -16,6 +17,7 @@ namespace Test
 {
 	using Enumeration::BlockCiphers;
 	using Enumeration::DilithiumParameters;
+	using Asymmetric::IAsymmetricCipher;
 	using Cipher::Block::IBlockCipher;
 	using Enumeration::MLWEParameters;
 	using Enumeration::MPKCParameters;
@@ -80,9 +82,11 @@ namespace Test
 		void DlmGenerateLoop(DilithiumParameters Params, size_t Loops, Prngs PrngType);
 		void DlmSignLoop(DilithiumParameters Params, size_t Loops, Prngs PrngType);
 		void DlmVerifyLoop(DilithiumParameters Params, size_t Loops, Prngs PrngType);
+		void KemBatchLoop(IAsymmetricCipher* Cipher, size_t Count);
 		void MpkcDecryptLoop(MPKCParameters Params, size_t Loops, Prngs PrngType);
 		void MpkcEncryptLoop(MPKCParameters Params, size_t Loops, Prngs PrngType);
 		void MpkcGenerateLoop(MPKCParameters Params, size_t Loops, Prngs PrngType);
+		void MlweDecryptColdLoop(MLWEParameters Params, size_t Loops, Prngs PrngType);
 		void MlweDecryptLoop(MLWEParameters Params, size_t Loops, Prngs PrngType);
 		void MlweEncryptLoop(MLWEParameters Params, size_t Loops, Prngs PrngType);
 		void MlweGenerateLoop(MLWEParameters Params, size_t Loops, Prngs PrngType);
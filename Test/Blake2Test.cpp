@@ -11,16 +11,6 @@
 #include <fstream>
 #include <string>
 
-#if defined(__AVX2__)
-#	include "../CEX/UInt256.h"
-#	include "../CEX/ULong256.h"
-#endif
-
-#if defined(__AVX512__)
-#	include "../CEX/UInt512.h"
-#	include "../CEX/ULong512.h"
-#endif
-
 namespace Test
 {
 	using Digest::Blake;
@@ -31,14 +21,7 @@ namespace Test
 	using Utility::IntegerTools;
 	using Utility::MemoryTools;
 	using Prng::SecureRandom;
-#if defined(__AVX2__)
-	using Numeric::UInt256;
-	using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-	using Numeric::UInt512;
-	using Numeric::ULong512;
-#endif
+	using Enumeration::SimdProfiles;
 
 	using namespace TestFiles::Blake2Kat;
 
@@ -259,72 +242,93 @@ namespace Test
 
 	void Blake2Test::PermutationR10P512()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::vector<byte> input(64, 128U);
 		std::array<uint, 8> iv{ 0, 1, 2, 3, 4, 5, 6, 7 };
 		std::array<uint, 8> state1;
 		std::array<uint, 8> state2;
-		std::array<uint, 8> state3;
+		size_t i;
 
 		MemoryTools::Clear(state1, 0, 8 * sizeof(uint));
 		MemoryTools::Clear(state2, 0, 8 * sizeof(uint));
-		MemoryTools::Clear(state3, 0, 8 * sizeof(uint));
 
 		Blake::PermuteR10P512C(input, 0, state1, iv);
 		Blake::PermuteR10P512U(input, 0, state2, iv);
 
-#if defined(__AVX2__)
+		if (state1 != state2)
+		{
+			throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P512U"), std::string("Permutation output is not equal! -BCS1"));
+		}
 
-		Blake::PermuteR10P512V(input, 0, state3, iv);
+#if defined(CEX_KERNEL_SIMD128)
 
-		if (state1 != state3)
+		if (SMDPRF != SimdProfiles::None)
 		{
-			throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P512"), std::string("Permutation output is not equal! -BCS1"));
+			std::array<uint, 8> state3;
+
+			MemoryTools::Clear(state3, 0, 8 * sizeof(uint));
+			Blake::PermuteR10P512V(input.data(), state3.data(), iv.data());
+
+			if (state1 != state3)
+			{
+				throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P512V"), std::string("Permutation output is not equal! -BCS2"));
+			}
 		}
 
 #endif
 
-		if (state1 != state2)
-		{
-			throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P512"), std::string("Permutation output is not equal! -BCS2"));
-		}
+#if defined(CEX_KERNEL_SIMD256)
 
-#if defined(__AVX2__)
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			// word n of lane k is at (n * 8) + k
+			std::vector<byte> input256(8 * 64, 128U);
+			std::array<uint, 8 * 8> iv256;
+			std::array<uint, 8 * 8> state256;
 
-		std::vector<byte> input256(512, 128UL);
-		std::vector<UInt256> iv256{ UInt256(0), UInt256(1), UInt256(2), UInt256(3), UInt256(4), UInt256(5), UInt256(6), UInt256(7) };
-		std::vector<UInt256> state256(8, UInt256(0));
+			MemoryTools::Clear(state256, 0, state256.size() * sizeof(uint));
 
-		Blake::PermuteR10P8x512H(input256, 0, state256, iv256);
+			for (i = 0; i < iv256.size(); ++i)
+			{
+				iv256[i] = iv[i / 8];
+			}
 
-		std::vector<uint> state256ul(32);
-		std::memcpy(state256ul.data(), state256.data(), 32 * sizeof(uint));
+			Blake::PermuteR10P8x512H(input256.data(), state256.data(), iv256.data());
 
-		for (size_t i = 0; i < 32; ++i)
-		{
-			if (state256ul[i] != state1[i / 8])
+			for (i = 0; i < state256.size(); ++i)
 			{
-				throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P8x512H"), std::string("Permutation output is not equal! -BCS3"));
+				if (state256[i] != state1[i / 8])
+				{
+					throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P8x512H"), std::string("Permutation output is not equal! -BCS3"));
+				}
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
-		std::vector<byte> input512(1024, 128U);
-		std::vector<UInt512> iv512{ UInt512(0), UInt512(1), UInt512(2), UInt512(3), UInt512(4), UInt512(5), UInt512(6), UInt512(7) };
-		std::vector<UInt512> state512(8, UInt512(0));
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::vector<byte> input512(16 * 64, 128U);
+			std::array<uint, 16 * 8> iv512;
+			std::array<uint, 16 * 8> state512;
 
-		Blake::PermuteR10P16x512H(input512, 0, state512, iv512);
+			MemoryTools::Clear(state512, 0, state512.size() * sizeof(uint));
 
-		std::vector<uint> state512ul(64);
-		std::memcpy(state512ul.data(), state512.data(), 64 * sizeof(uint));
+			for (i = 0; i < iv512.size(); ++i)
+			{
+				iv512[i] = iv[i / 16];
+			}
 
-		for (size_t i = 0; i < 64; ++i)
-		{
-			if (state512ul[i] != state1[i / 16])
+			Blake::PermuteR10P16x512H(input512.data(), state512.data(), iv512.data());
+
+			for (i = 0; i < state512.size(); ++i)
 			{
-				throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P16x512H"), std::string("Permutation output is not equal! -BCS4"));
+				if (state512[i] != state1[i / 16])
+				{
+					throw TestException(std::string("PermutationR10P512"), std::string("PermuteR10P16x512H"), std::string("Permutation output is not equal! -BCS4"));
+				}
 			}
 		}
 
@@ -333,72 +337,93 @@ namespace Test
 
 	void Blake2Test::PermutationR12P1024()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::vector<byte> input(128, 128U);
 		std::array<ulong, 8> iv{ 0, 1, 2, 3, 4, 5, 6, 7 };
 		std::array<ulong, 8> state1;
 		std::array<ulong, 8> state2;
-		std::array<ulong, 8> state3;
+		size_t i;
 
-		std::memset(state1.data(), 0, 8 * sizeof(ulong));
-		std::memset(state2.data(), 0, 8 * sizeof(ulong));
-		std::memset(state3.data(), 0, 8 * sizeof(ulong));
+		MemoryTools::Clear(state1, 0, 8 * sizeof(ulong));
+		MemoryTools::Clear(state2, 0, 8 * sizeof(ulong));
 
 		Blake::PermuteR12P1024C(input, 0, state1, iv);
 		Blake::PermuteR12P1024U(input, 0, state2, iv);
 
-#if defined(__AVX2__)
+		if (state1 != state2)
+		{
+			throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P1024U"), std::string("Permutation output is not equal! -BCL1"));
+		}
 
-		Blake::PermuteR12P1024V(input, 0, state3, iv);
+#if defined(CEX_KERNEL_SIMD128)
 
-		if (state1 != state3)
+		if (SMDPRF != SimdProfiles::None)
 		{
-			throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P1024"), std::string("Permutation output is not equal! -BCL1"));
+			std::array<ulong, 8> state3;
+
+			MemoryTools::Clear(state3, 0, 8 * sizeof(ulong));
+			Blake::PermuteR12P1024V(input.data(), state3.data(), iv.data());
+
+			if (state1 != state3)
+			{
+				throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P1024V"), std::string("Permutation output is not equal! -BCL2"));
+			}
 		}
 
 #endif
 
-		if (state1 != state2)
-		{
-			throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P1024"), std::string("Permutation output is not equal! -BCL2"));
-		}
+#if defined(CEX_KERNEL_SIMD256)
 
-#if defined(__AVX2__)
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			// word n of lane k is at (n * 4) + k
+			std::vector<byte> input256(4 * 128, 128U);
+			std::array<ulong, 4 * 8> iv256;
+			std::array<ulong, 4 * 8> state256;
 
-		std::vector<byte> input256(512, 128U);
-		std::vector<ULong256> iv256{ ULong256(0), ULong256(1), ULong256(2), ULong256(3), ULong256(4), ULong256(5), ULong256(6), ULong256(7) };
-		std::vector<ULong256> state256(8, ULong256(0));
+			MemoryTools::Clear(state256, 0, state256.size() * sizeof(ulong));
 
-		Blake::PermuteR12P4x1024H(input256, 0, state256, iv256);
+			for (i = 0; i < iv256.size(); ++i)
+			{
+				iv256[i] = iv[i / 4];
+			}
 
-		std::vector<ulong> state256ull(32);
-		MemoryTools::Copy(state256, 0, state256ull, 0, 32 * sizeof(ulong));
+			Blake::PermuteR12P4x1024H(input256.data(), state256.data(), iv256.data());
 
-		for (size_t i = 0; i < 32; ++i)
-		{
-			if (state256ull[i] != state1[i / 4])
+			for (i = 0; i < state256.size(); ++i)
 			{
-				throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P4x1024H"), std::string("Permutation output is not equal! -BCL3"));
+				if (state256[i] != state1[i / 4])
+				{
+					throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P4x1024H"), std::string("Permutation output is not equal! -BCL3"));
+				}
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
-		std::vector<byte> input512(1024, 128U);
-		std::vector<ULong512> iv512{ ULong512(0), ULong512(1), ULong512(2), ULong512(3), ULong512(4), ULong512(5), ULong512(6), ULong512(7) };
-		std::vector<ULong512> state512(8, ULong512(0));
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::vector<byte> input512(8 * 128, 128U);
+			std::array<ulong, 8 * 8> iv512;
+			std::array<ulong, 8 * 8> state512;
 
-		Blake::PermuteR12P8x1024H(input512, 0, state512, iv512);
+			MemoryTools::Clear(state512, 0, state512.size() * sizeof(ulong));
 
-		std::vector<ulong> state512ull(64);
-		MemoryTools::Copy(state512, 0, state512ull, 0, 64 * sizeof(ulong));
+			for (i = 0; i < iv512.size(); ++i)
+			{
+				iv512[i] = iv[i / 8];
+			}
 
-		for (size_t i = 0; i < 64; ++i)
-		{
-			if (state512ull[i] != state1[i / 8])
+			Blake::PermuteR12P8x1024H(input512.data(), state512.data(), iv512.data());
+
+			for (i = 0; i < state512.size(); ++i)
 			{
-				throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P8x1024H"), std::string("Permutation output is not equal! -BCL4"));
+				if (state512[i] != state1[i / 8])
+				{
+					throw TestException(std::string("PermutationR12P1024"), std::string("PermuteR12P8x1024H"), std::string("Permutation output is not equal! -BCL4"));
+				}
 			}
 		}
 
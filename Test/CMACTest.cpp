@@ -80,6 +80,9 @@ namespace Test
 			Stress(cmacaes);
 			OnProgress(std::string("CMACTest: Passed CMAC stress tests.."));
 
+			Batch(cmacaes);
+			OnProgress(std::string("CMACTest: Passed CMAC batch tests.."));
+
 			delete cmacaes;
 
 			CMAC* cmacahxh256 = new CMAC(BlockCiphers::RHXH256);
@@ -122,6 +125,55 @@ namespace Test
 		}
 	}
 
+	void CMACTest::Batch(CMAC* Generator)
+	{
+		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
+		std::vector<std::vector<byte>> msgs;
+		std::vector<std::vector<byte>> otpb;
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> otps(Generator->TagSize());
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			// a message count that exercises full, partial, and refilled lane sets
+			const size_t MSGCNT = static_cast<size_t>(rnd.NextUInt32(32, 1));
+
+			msgs.resize(MSGCNT);
+			IntegerTools::Fill(key, 0, key.size(), rnd);
+			SymmetricKey kp(key);
+
+			for (j = 0; j < MSGCNT; ++j)
+			{
+				// include empty, partial-block, and block-aligned messages
+				const size_t MSGLEN = (j % 4 == 0) ? static_cast<size_t>(rnd.NextUInt32(4, 0)) * 16 : static_cast<size_t>(rnd.NextUInt32(MINM_ALLOC, 0));
+				msgs[j].resize(MSGLEN);
+				IntegerTools::Fill(msgs[j], 0, msgs[j].size(), rnd);
+			}
+
+			Generator->Initialize(kp);
+			Generator->Compute(msgs, otpb);
+
+			if (otpb.size() != MSGCNT)
+			{
+				throw TestException(std::string("Batch"), Generator->Name(), std::string("The batch output count is invalid! -CB1"));
+			}
+
+			for (j = 0; j < MSGCNT; ++j)
+			{
+				Generator->Initialize(kp);
+				Generator->Compute(msgs[j], otps);
+
+				if (otpb[j] != otps)
+				{
+					throw TestException(std::string("Batch"), Generator->Name(), std::string("The batch output is not equal to the sequential output! -CB2"));
+				}
+			}
+		}
+	}
+
 	void CMACTest::Exception()
 	{
 		// test constructor -1
@@ -2,10 +2,12 @@
 #define CEXTEST_CMACTEST_H
 
 #include "ITest.h"
+#include "../CEX/CMAC.h"
 #include "../CEX/IMac.h"
 
 namespace Test
 {
+	using Mac::CMAC;
 	using Mac::IMac;
 
 	/// <summary>
@@ -55,6 +57,13 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare the interleaved multi-message Compute output with sequentially processed messages of random count and length
+		/// </summary>
+		/// 
+		/// <param name="Generator">The mac generator instance</param>
+		void Batch(CMAC* Generator);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
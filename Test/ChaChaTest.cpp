@@ -1,5 +1,6 @@
 #include "ChaChaTest.h"
 #include "../CEX/ChaCha.h"
+#include "../CEX/CpuDetect.h"
 #include "../CEX/CSX256.h"
 #include "../CEX/CSX512.h"
 #include "../CEX/IntegerTools.h"
@@ -7,12 +8,6 @@
 #include "../CEX/SecureRandom.h"
 #include "../CEX/SymmetricKey.h"
 
-#if defined(__AVX2__)
-#	include "../CEX/ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "../CEX/ULong512.h"
-#endif
 
 namespace Test
 {
@@ -27,13 +22,7 @@ namespace Test
 	using Cipher::SymmetricKey;
 	using Cipher::SymmetricKeySize;
 
-#if defined(__AVX2__)
-	using Numeric::ULong256;
-#endif
-
-#if defined(__AVX512__)
-	using Numeric::ULong512;
-#endif
+	using Enumeration::SimdProfiles;
 
 	const std::string ChaChaTest::CLASSNAME = "ChaChaTest";
 	const std::string ChaChaTest::DESCRIPTION = "Tests the 256 and 512 bit versions of the ChaCha stream cipher (CSX256 and CSX512) authenticated stream ciphers.";
@@ -293,65 +282,7 @@ namespace Test
 			throw TestException(std::string("CompareP256"), std::string("PermuteP512"), std::string("Permutation output is not equal! -CP1"));
 		}
 
-#if defined(__AVX__)
-
-		std::array<uint, 8> counter8{ 128, 128, 128, 128, 1, 1, 1, 1 };
-		std::vector<byte> output3(256);
-
-		ChaCha::PermuteP4x512H(output3, 0, counter8, state, ROUNDS);
-
-		for (size_t i = 0; i < 256; i += 64)
-		{
-			for (size_t j = 0; j < 64; ++j)
-			{
-				if (output3[i + j] != output1[j])
-				{
-					throw TestException(std::string("CompareP256"), std::string("PermuteP4x512H"), std::string("Permutation output is not equal! -CP2"));
-				}
-			}
-		}
-
-#endif
-
-#if defined(__AVX2__)
-
-		std::array<uint, 16> counter16{ 128, 128, 128, 128, 128, 128, 128, 128, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::vector<byte> output4(512);
-
-		ChaCha::PermuteP8x512H(output4, 0, counter16, state, ROUNDS);
-
-		for (size_t i = 0; i < 512; i += 64)
-		{
-			for (size_t j = 0; j < 64; ++j)
-			{
-				if (output4[i + j] != output1[j])
-				{
-					throw TestException(std::string("CompareP256"), std::string("PermuteP8x512H"), std::string("Permutation output is not equal! -CP3"));
-				}
-			}
-		}
-
-#endif
-
-#if defined(__AVX512__)
-
-		std::array<uint, 32> counter32{ 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::vector<byte> output5(1024);
-
-		ChaCha::PermuteP16x512H(output5, 0, counter16, state, ROUNDS);
-
-		for (size_t i = 0; i < 1024; i += 64)
-		{
-			for (size_t j = 0; j < 64; ++j)
-			{
-				if (output5[i + j] != output1[j])
-				{
-					throw TestException(std::string("CompareP256"), std::string("PermuteP16x512H"), std::string("Permutation output is not equal! -CP4"));
-				}
-			}
-		}
-
-#endif
+		CompareW(std::string("CompareP256"), ROUNDS);
 	}
 
 	void ChaChaTest::CompareP512()
@@ -361,69 +292,87 @@ namespace Test
 #else
 		const size_t ROUNDS = 40;
 #endif
-		std::array<uint, 2> counter{ 128, 1 };
-		std::vector<byte> output1(64);
-		std::array<uint, 14> state;
 
-		MemoryTools::Clear(state, 0, state.size() * sizeof(uint));
+		CompareW(std::string("CompareP512"), ROUNDS);
+	}
 
-		ChaCha::PermuteP512C(output1, 0, counter, state, ROUNDS);
+	void ChaChaTest::CompareW(const std::string &Function, size_t Rounds)
+	{
+		// every lane of the wide permutations is compared with the compact permutation keyed with that lane's counter
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+		std::array<uint, 14> state;
+		std::array<uint, 2> tmpc;
+		std::vector<uint> ctr(32);
+		std::vector<byte> exp(16 * 64);
+		std::vector<byte> otp(16 * 64);
+		SecureRandom rnd;
+		size_t i;
 
-#if defined(__AVX__)
+		for (i = 0; i < state.size(); ++i)
+		{
+			state[i] = rnd.NextUInt32();
+		}
 
-		std::array<uint, 8> counter8{ 128, 128, 128, 128, 1, 1, 1, 1 };
-		std::vector<byte> output2(256);
+		rnd.Fill(ctr, 0, ctr.size());
 
-		ChaCha::PermuteP4x512H(output2, 0, counter8, state, ROUNDS);
+#if defined(CEX_KERNEL_SIMD128)
 
-		for (size_t i = 0; i < 256; i += 64)
+		if (SMDPRF != SimdProfiles::None)
 		{
-			for (size_t j = 0; j < 64; ++j)
+			for (i = 0; i < 4; ++i)
 			{
-				if (output2[i + j] != output1[j])
-				{
-					throw TestException(std::string("CompareP512"), std::string("PermuteP4x512H"), std::string("Permutation output is not equal! -CP1"));
-				}
+				tmpc[0] = ctr[i];
+				tmpc[1] = ctr[i + 4];
+				ChaCha::PermuteP512C(exp, i * 64, tmpc, state, Rounds);
+			}
+
+			ChaCha::PermuteP4x512H(otp.data(), ctr.data(), state.data(), Rounds);
+
+			if (!IntegerTools::Compare(exp, 0, otp, 0, 4 * 64))
+			{
+				throw TestException(Function, std::string("PermuteP4x512H"), std::string("Permutation output is not equal! -CW1"));
 			}
 		}
 
 #endif
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD256)
 
-		std::array<uint, 16> counter16{ 128, 128, 128, 128, 128, 128, 128, 128, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::vector<byte> output3(512);
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			for (i = 0; i < 8; ++i)
+			{
+				tmpc[0] = ctr[i];
+				tmpc[1] = ctr[i + 8];
+				ChaCha::PermuteP512C(exp, i * 64, tmpc, state, Rounds);
+			}
 
-		ChaCha::PermuteP8x512H(output3, 0, counter16, state, ROUNDS);
+			ChaCha::PermuteP8x512H(otp.data(), ctr.data(), state.data(), Rounds);
 
-		for (size_t i = 0; i < 512; i += 64)
-		{
-			for (size_t j = 0; j < 64; ++j)
+			if (!IntegerTools::Compare(exp, 0, otp, 0, 8 * 64))
 			{
-				if (output3[i + j] != output1[j])
-				{
-					throw TestException(std::string("CompareP512"), std::string("PermuteP8x512H"), std::string("Permutation output is not equal! -CP2"));
-				}
+				throw TestException(Function, std::string("PermuteP8x512H"), std::string("Permutation output is not equal! -CW2"));
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
-		std::array<uint, 32> counter32{ 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::vector<byte> output4(1024);
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			for (i = 0; i < 16; ++i)
+			{
+				tmpc[0] = ctr[i];
+				tmpc[1] = ctr[i + 16];
+				ChaCha::PermuteP512C(exp, i * 64, tmpc, state, Rounds);
+			}
 
-		ChaCha::PermuteP16x512H(output4, 0, counter16, state, ROUNDS);
+			ChaCha::PermuteP16x512H(otp.data(), ctr.data(), state.data(), Rounds);
 
-		for (size_t i = 0; i < 1024; i += 64)
-		{
-			for (size_t j = 0; j < 64; ++j)
+			if (!IntegerTools::Compare(exp, 0, otp, 0, 16 * 64))
 			{
-				if (output4[i + j] != output1[j])
-				{
-					throw TestException(std::string("CompareP512"), std::string("PermuteP16x512H"), std::string("Permutation output is not equal! -CP3"));
-				}
+				throw TestException(Function, std::string("PermuteP16x512H"), std::string("Permutation output is not equal! -CW3"));
 			}
 		}
 
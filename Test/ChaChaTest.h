@@ -160,6 +160,7 @@ namespace Test
 
 	private:
 
+		void CompareW(const std::string &Function, size_t Rounds);
 		void Initialize();
 		void OnProgress(const std::string &Data);
 	};
@@ -155,6 +155,9 @@ namespace Test
 			Stress(ofbm);
 			OnProgress(std::string("Passed OFB stress tests.."));
 
+			Batch(cbcm);
+			OnProgress(std::string("Passed CBC batch encryption tests.."));
+
 			delete cbcm;
 			delete cfbm;
 			delete ctrm;
@@ -178,6 +181,81 @@ namespace Test
 		}
 	}
 
+	void CipherModeTest::Batch(CBC* Cipher)
+	{
+		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+
+		std::vector<std::vector<byte>> inp;
+		std::vector<std::vector<byte>> nonce;
+		std::vector<std::vector<byte>> otp;
+		std::vector<byte> cpt;
+		std::vector<byte> key(ks.KeySize());
+		SecureRandom rnd;
+		const bool PRLSTATE = Cipher->ParallelProfile().IsParallel();
+		const size_t PRLDEG = Cipher->ParallelProfile().ParallelMaxDegree();
+		size_t i;
+		size_t j;
+		size_t k;
+
+		// two threads, so the batch below always meets the multi-threaded thresholds, even on a single core machine
+		Cipher->ParallelProfile().SetMaxDegree(2);
+
+		const size_t PRLLEN = Cipher->ParallelProfile().ParallelBlockSize() - (Cipher->ParallelProfile().ParallelBlockSize() % Cipher->BlockSize());
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			// a message count that exercises full, partial, and refilled lane sets, with at least 8 messages per thread
+			const size_t MSGCNT = static_cast<size_t>(rnd.NextUInt32(64, 16));
+
+			inp.resize(MSGCNT);
+			nonce.resize(MSGCNT);
+			IntegerTools::Fill(key, 0, key.size(), rnd);
+
+			for (j = 0; j < MSGCNT; ++j)
+			{
+				// variable length block-aligned messages, some of them empty
+				const size_t MSGLEN = static_cast<size_t>(rnd.NextUInt32(MINM_ALLOC * 32, 0));
+				const size_t ALNLEN = MSGLEN - (MSGLEN % Cipher->BlockSize());
+
+				// the first message alone reaches the parallel block size
+				inp[j].resize(j == 0 ? PRLLEN + ALNLEN : ALNLEN);
+				nonce[j].resize(ks.NonceSize());
+				IntegerTools::Fill(inp[j], 0, inp[j].size(), rnd);
+				IntegerTools::Fill(nonce[j], 0, nonce[j].size(), rnd);
+			}
+
+			// alternate between the multi-threaded and sequential batch paths
+			for (k = 0; k < 2; ++k)
+			{
+				Cipher->ParallelProfile().IsParallel() = (k == 0);
+				SymmetricKey kp(key, nonce[0]);
+				Cipher->Initialize(true, kp);
+				Cipher->EncryptBatch(nonce, inp, otp);
+
+				if (otp.size() != MSGCNT)
+				{
+					throw TestException(std::string("Batch"), Cipher->Name(), std::string("The batch output count is invalid! -TB1"));
+				}
+
+				for (j = 0; j < MSGCNT; ++j)
+				{
+					SymmetricKey kpm(key, nonce[j]);
+					cpt.resize(inp[j].size());
+					Cipher->Initialize(true, kpm);
+					Cipher->Transform(inp[j], 0, cpt, 0, cpt.size());
+
+					if (otp[j] != cpt)
+					{
+						throw TestException(std::string("Batch"), Cipher->Name(), std::string("The batch output is not equal to the sequential output! -TB2"));
+					}
+				}
+			}
+		}
+
+		Cipher->ParallelProfile().SetMaxDegree(PRLDEG);
+		Cipher->ParallelProfile().IsParallel() = PRLSTATE;
+	}
+
 	void CipherModeTest::Exception()
 	{
 		// test every modes enumeration constructors for invalid block-cipher type //
@@ -2,10 +2,12 @@
 #define CEXTEST_CIPHERMODETEST_H
 
 #include "ITest.h"
+#include "../CEX/CBC.h"
 #include "../CEX/ICipherMode.h"
 
 namespace Test
 {
+	using Cipher::Block::Mode::CBC;
 	using Cipher::Block::Mode::ICipherMode;
 
     /// <summary>
@@ -64,6 +66,13 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare the CBC multi-message EncryptBatch output with sequentially encrypted messages, in parallel and sequential modes
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The CBC mode instance pointer</param>
+		void Batch(CBC* Cipher);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
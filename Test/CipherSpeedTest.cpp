@@ -11,6 +11,7 @@
 #include "../CEX/OFB.h"
 #include "../CEX/EAX.h"
 #include "../CEX/GCM.h"
+#include "../CEX/OCB.h"
 #include "../CEX/ACS.h"
 #include "../CEX/CSX256.h"
 #include "../CEX/CSX512.h"
@@ -19,6 +20,7 @@
 #include "../CEX/TSX256.h"
 #include "../CEX/TSX512.h"
 #include "../CEX/TSX1024.h"
+#include "../CEX/ParallelTools.h"
 
 namespace Test
 {
@@ -95,8 +97,24 @@ namespace Test
 			OnProgress(std::string("***AES-OFB Sequential Encryption***"));
 			OFBSpeedTest(true, false);
 
+			OnProgress(std::string("### PARALLEL DISPATCH TESTS ###"));
+			OnProgress(std::string("### Measures the thread-pool dispatch overhead of the parallel CTR mode"));
+			OnProgress(std::string("### Compares sequential and parallel throughput with 16KB to 1MB parallel blocks"));
+			OnProgress(std::string(""));
+
+			OnProgress(std::string("***Empty ParallelFor dispatch latency***"));
+			DispatchLatencyTest(100000);
+			OnProgress(std::string("***AES-CTR 16KB parallel blocks***"));
+			ParallelDispatchSpeedTest(16384);
+			OnProgress(std::string("***AES-CTR 64KB parallel blocks***"));
+			ParallelDispatchSpeedTest(65536);
+			OnProgress(std::string("***AES-CTR 256KB parallel blocks***"));
+			ParallelDispatchSpeedTest(262144);
+			OnProgress(std::string("***AES-CTR 1MB parallel blocks***"));
+			ParallelDispatchSpeedTest(1048576);
+
 			OnProgress(std::string("### AEAD Authenticated Cipher Modes ###"));
-			OnProgress(std::string("### Tests speeds of EAX and GCM authenticated modes"));
+			OnProgress(std::string("### Tests speeds of EAX, GCM and OCB authenticated modes"));
 			OnProgress(std::string("### Uses the standard rounds and a 256 bit key"));
 			OnProgress(std::string(""));
 
@@ -104,12 +122,21 @@ namespace Test
 			EAXSpeedTest(true, false);
 			OnProgress(std::string("***AES-EAX Parallel Encryption***"));
 			EAXSpeedTest(true, true);
+			OnProgress(std::string("***AES-EAX Sequential Encryption, 64KB messages***"));
+			EAXSpeedTest(true, false, 65536);
+			OnProgress(std::string("***AES-EAX Sequential Decryption, 64KB messages***"));
+			EAXSpeedTest(false, false, 65536);
 
 			OnProgress(std::string("***AES-GCM Sequential Encryption***"));
 			GCMSpeedTest(true, false);
 			OnProgress(std::string("***AES-GCM Parallel Encryption***"));
 			GCMSpeedTest(true, true);
 
+			OnProgress(std::string("***AES-OCB Sequential Encryption***"));
+			OCBSpeedTest(true, false);
+			OnProgress(std::string("***AES-OCB Parallel Encryption***"));
+			OCBSpeedTest(true, true);
+
 			OnProgress(std::string("### STREAM CIPHER TESTS ###"));
 			OnProgress(std::string("### Tests speeds of Salsa and ChaCha stream ciphers"));
 			OnProgress(std::string("### Uses default of 20 rounds, 256 bit key"));
@@ -282,15 +309,112 @@ namespace Test
 		}
 	}
 
+	//*** Parallel Dispatch Tests ***//
+
+	void CipherSpeedTest::DispatchLatencyTest(size_t Loops)
+	{
+		const size_t PRLDEG = Utility::ParallelTools::ProcessorCount();
+		std::vector<size_t> tmpv(PRLDEG, 0);
+		std::string resp;
+		uint64_t dur;
+		uint64_t start;
+		size_t i;
+
+		start = TestUtils::GetTimeMs64();
+
+		for (i = 0; i < Loops; ++i)
+		{
+			Utility::ParallelTools::ParallelFor(0, PRLDEG, [&tmpv](size_t j)
+			{
+				++tmpv[j];
+			});
+		}
+
+		dur = TestUtils::GetTimeMs64() - start;
+		resp = std::string(TestUtils::ToString(Loops) + " dispatches over " + TestUtils::ToString(Utility::ParallelTools::ParallelWorkers() + 1) + " threads in " +
+			TestUtils::ToString((double)dur / 1000.0) + " seconds, avg. " + TestUtils::ToString(((double)dur * 1000.0) / (double)Loops) + " microseconds per dispatch");
+		OnProgress(resp);
+		OnProgress(std::string(""));
+	}
+
+	void CipherSpeedTest::ParallelDispatchSpeedTest(size_t BlockSize)
+	{
+		Cipher::SymmetricKey* keyParam = TestUtils::GetRandomKey(32, 16);
+		IBlockCipher* eng;
+
+		if (HAS_AESNI)
+		{
+			eng = new AHX();
+		}
+		else
+		{
+			eng = new RHX();
+		}
+
+		CTR* cpr = new CTR(eng);
+		cpr->Initialize(true, *keyParam);
+		cpr->ParallelProfile().IsParallel() = true;
+		cpr->ParallelProfile().SetBlockSize(BlockSize);
+
+		const size_t BLKLEN = cpr->ParallelProfile().ParallelBlockSize();
+		const size_t SMPLEN = MB100 - (MB100 % BLKLEN);
+		const size_t CALLS = SMPLEN / BLKLEN;
+		std::vector<byte> buffer1(BLKLEN, 0x00);
+		std::vector<byte> buffer2(BLKLEN, 0x00);
+		std::string resp;
+		uint64_t pdur;
+		uint64_t sdur;
+		uint64_t start;
+		size_t lctr;
+
+		// sequential baseline over the same buffer size
+		cpr->ParallelProfile().IsParallel() = false;
+		lctr = 0;
+		start = TestUtils::GetTimeMs64();
+
+		while (lctr < SMPLEN)
+		{
+			cpr->Transform(buffer1, 0, buffer2, 0, buffer1.size());
+			lctr += buffer1.size();
+		}
+
+		sdur = TestUtils::GetTimeMs64() - start;
+
+		// parallel, one pool dispatch per transform call
+		cpr->ParallelProfile().IsParallel() = true;
+		lctr = 0;
+		start = TestUtils::GetTimeMs64();
+
+		while (lctr < SMPLEN)
+		{
+			cpr->Transform(buffer1, 0, buffer2, 0, buffer1.size());
+			lctr += buffer1.size();
+		}
+
+		pdur = TestUtils::GetTimeMs64() - start;
+
+		resp = std::string("Block size " + TestUtils::ToString(BLKLEN) + " bytes, " + TestUtils::ToString(CALLS) + " calls: sequential avg. " +
+			TestUtils::ToString(GetBytesPerSecond(sdur, SMPLEN) / MB1) + " MB per Second, parallel avg. " +
+			TestUtils::ToString(GetBytesPerSecond(pdur, SMPLEN) / MB1) + " MB per Second, " +
+			TestUtils::ToString(((double)pdur * 1000.0) / (double)CALLS) + " microseconds per parallel call");
+		OnProgress(resp);
+		OnProgress(std::string(""));
+
+		delete cpr;
+		delete eng;
+		delete keyParam;
+	}
+
 	//*** AEAD Mode Tests ***//
 
-	void CipherSpeedTest::EAXSpeedTest(bool Encrypt, bool Parallel)
+	void CipherSpeedTest::EAXSpeedTest(bool Encrypt, bool Parallel, size_t MessageSize)
 	{
+		// multi-block messages exercise the interleaved (AES-NI) or two-pass (RHX) CTR/CMAC loop, single blocks measure the per-call cost
 		if (HAS_AESNI)
 		{
 			AHX* eng = new AHX();
 			EAX* cpr = new EAX(eng);
-			ParallelBlockLoop(cpr, Encrypt, Parallel, MB100, 32, 16, 10, m_progressEvent);
+			ParallelBlockLoop(cpr, Encrypt, Parallel, MB100, 32, 16, 10, m_progressEvent, MessageSize);
 			delete cpr;
 			delete eng;
 		}
@@ -298,7 +422,7 @@ namespace Test
 		{
 			RHX* eng = new RHX();
 			EAX* cpr = new EAX(eng);
-			ParallelBlockLoop(cpr, Encrypt, Parallel, MB100, 32, 16, 10, m_progressEvent);
+			ParallelBlockLoop(cpr, Encrypt, Parallel, MB100, 32, 16, 10, m_progressEvent, MessageSize);
 			delete cpr;
 			delete eng;
 		}
@@ -324,6 +448,27 @@ namespace Test
 		}
 	}
 
+	void CipherSpeedTest::OCBSpeedTest(bool Encrypt, bool Parallel)
+	{
+		// the OCB nonce is limited to 15 bytes, use the recommended 12 byte nonce
+		if (HAS_AESNI)
+		{
+			AHX* eng = new AHX();
+			OCB* cpr = new OCB(eng);
+			ParallelBlockLoop(cpr, Encrypt, Parallel, MB100, 32, 12, 10, m_progressEvent);
+			delete cpr;
+			delete eng;
+		}
+		else
+		{
+			RHX* eng = new RHX();
+			OCB* cpr = new OCB(eng);
+			ParallelBlockLoop(cpr, Encrypt, Parallel, MB100, 32, 12, 10, m_progressEvent);
+			delete cpr;
+			delete eng;
+		}
+	}
+
 	//*** Stream Cipher Tests ***//
 
 	void CipherSpeedTest::CSX256SpeedTest()
@@ -396,7 +541,7 @@ namespace Test
 
 	bool CipherSpeedTest::HasAESNI()
 	{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 		CpuDetect dtc;
 
 		return dtc.AVX() && dtc.AESNI();
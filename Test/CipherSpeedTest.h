@@ -58,9 +58,10 @@ namespace Test
 	private:
 
 		template<typename T>
-		static void ParallelBlockLoop(T* Cipher, bool Encrypt, bool Parallel, size_t SampleSize, size_t KeySize, size_t IvSize, size_t Loops, TestEventHandler &Handler)
+		static void ParallelBlockLoop(T* Cipher, bool Encrypt, bool Parallel, size_t SampleSize, size_t KeySize, size_t IvSize, size_t Loops, TestEventHandler &Handler, size_t MessageSize = 0)
 		{
-			const size_t BLKLEN = Parallel ? Cipher->ParallelBlockSize() : Cipher->BlockSize();
+			// a non-zero message size overrides the block size passed to each transform call
+			const size_t BLKLEN = (MessageSize != 0) ? MessageSize : (Parallel ? Cipher->ParallelBlockSize() : Cipher->BlockSize());
 			const size_t ALNLEN = SampleSize - (SampleSize % BLKLEN);
 			std::vector<byte> buffer1(BLKLEN, 0x00);
 			std::vector<byte> buffer2(BLKLEN, 0x00);
@@ -162,12 +163,15 @@ namespace Test
 		void TSX512SpeedTest();
 		void TSX1024SpeedTest();
 		void CounterSpeedTest();
-		void EAXSpeedTest(bool Encrypt, bool Parallel);
+		void DispatchLatencyTest(size_t Loops);
+		void EAXSpeedTest(bool Encrypt, bool Parallel, size_t MessageSize = 0);
 		void GCMSpeedTest(bool Encrypt, bool Parallel);
 		static uint64_t GetBytesPerSecond(uint64_t DurationTicks, uint64_t DataSize);
 		void ICMSpeedTest(bool Encrypt, bool Parallel);
+		void OCBSpeedTest(bool Encrypt, bool Parallel);
 		void OFBSpeedTest(bool Encrypt, bool Parallel);
 		void OnProgress(const std::string &Data);
+		void ParallelDispatchSpeedTest(size_t BlockSize);
 		void RHXSpeedTest(size_t KeySize = 32);
 		void SHXSpeedTest(size_t KeySize = 32);
 	};
@@ -2,6 +2,9 @@
 #include "../CEX/IDigest.h"
 #include "../CEX/DigestFromName.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/SHA2.h"
+#include "../CEX/SHA256.h"
+#include "../CEX/SHA512.h"
 
 namespace Test
 {
@@ -74,6 +77,13 @@ namespace Test
 			OnProgress(std::string("***The parallel SHA2 512 digest***"));
 			DigestBlockLoop(Digests::SHA512, MB100, 10, true);
 
+			OnProgress(std::string("### Multi-Buffer SHA2 Speed Tests: independent 64 to 1024 byte messages ###"));
+
+			OnProgress(std::string("***Sequential SHA2 256 Compute calls compared to the SHA2 256 multi-buffer batch***"));
+			DigestBatchLoop(Digests::SHA256, 100000, 1024);
+			OnProgress(std::string("***Sequential SHA2 512 Compute calls compared to the SHA2 512 multi-buffer batch***"));
+			DigestBatchLoop(Digests::SHA512, 100000, 1024);
+
 			OnProgress(std::string("***The sequential Skein 256 digest***"));
 			DigestBlockLoop(Digests::Skein256, MB100);
 			OnProgress(std::string("***The parallel Skein 256 digest***"));
@@ -142,6 +152,75 @@ namespace Test
 		OnProgress(std::string(""));
 	}
 
+	void DigestSpeedTest::DigestBatchLoop(Enumeration::Digests DigestType, size_t Count, size_t MaxLength, size_t Loops)
+	{
+		const bool IS256 = (DigestType == Enumeration::Digests::SHA256);
+		std::vector<std::vector<byte>> msgs(Count);
+		std::vector<std::vector<byte>> hashes(Count);
+		Digest::IDigest* dgt;
+		std::string resp;
+		uint64_t bdur;
+		uint64_t len;
+		uint64_t sdur;
+		uint64_t start;
+		size_t i;
+		size_t j;
+
+		if (IS256)
+		{
+			dgt = new Digest::SHA256();
+		}
+		else
+		{
+			dgt = new Digest::SHA512();
+		}
+
+		// unrelated records of varying lengths
+		len = 0;
+
+		for (i = 0; i < Count; ++i)
+		{
+			msgs[i].resize(64 + (i * 61) % (MaxLength - 63));
+			hashes[i].resize(dgt->DigestSize());
+			TestUtils::GetRandom(msgs[i]);
+			len += msgs[i].size();
+		}
+
+		start = TestUtils::GetTimeMs64();
+
+		for (j = 0; j < Loops; ++j)
+		{
+			for (i = 0; i < Count; ++i)
+			{
+				dgt->Compute(msgs[i], hashes[i]);
+			}
+		}
+
+		sdur = TestUtils::GetTimeMs64() - start;
+		start = TestUtils::GetTimeMs64();
+
+		for (j = 0; j < Loops; ++j)
+		{
+			if (IS256)
+			{
+				Digest::SHA2::Compute256xN(msgs, hashes);
+			}
+			else
+			{
+				Digest::SHA2::Compute512xN(msgs, hashes);
+			}
+		}
+
+		bdur = TestUtils::GetTimeMs64() - start;
+		delete dgt;
+
+		resp = std::string(TestUtils::ToString(Count * Loops) + " messages, sequential " + TestUtils::ToString((double)sdur / 1000.0) + " seconds, avg. " +
+			TestUtils::ToString(GetBytesPerSecond(sdur, len * Loops) / MB1) + " MB per Second; multi-buffer " + TestUtils::ToString((double)bdur / 1000.0) + " seconds, avg. " +
+			TestUtils::ToString(GetBytesPerSecond(bdur, len * Loops) / MB1) + " MB per Second");
+		OnProgress(resp);
+		OnProgress(std::string(""));
+	}
+
 	uint64_t DigestSpeedTest::GetBytesPerSecond(uint64_t DurationTicks, uint64_t DataSize)
 	{
 		double sec = (double)DurationTicks / 1000.0;
@@ -55,6 +55,7 @@ namespace Test
 
 	private:
 
+		void DigestBatchLoop(Enumeration::Digests DigestType, size_t Count, size_t MaxLength, size_t Loops = DEFITER);
 		void DigestBlockLoop(Enumeration::Digests DigestType, size_t SampleSize, size_t Loops = DEFITER, bool Parallel = false);
 		uint64_t GetBytesPerSecond(uint64_t DurationTicks, uint64_t DataSize);
 		void OnProgress(const std::string &Data);
@@ -68,6 +68,8 @@ namespace Test
 			OnProgress(std::string("DilithiumTest: Passed signature cipher-text and message verification known answer tests.."));
 			Authentication();
 			OnProgress(std::string("DilithiumTest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("DilithiumTest: Passed batch verification tests.."));
 			Exception();
 			OnProgress(std::string("DilithiumTest: Passed exception handling test.."));
 			PrivateKey();
@@ -125,6 +127,22 @@ namespace Test
 		}
 	}
 
+	void DilithiumTest::Batch()
+	{
+		const size_t CNT = 9;
+		std::vector<DilithiumParameters> params = { DilithiumParameters::DLMS1N256Q8380417, DilithiumParameters::DLMS2N256Q8380417, DilithiumParameters::DLMS3N256Q8380417 };
+		size_t i;
+
+		for (i = 0; i < params.size(); ++i)
+		{
+			Dilithium sgn1(params[i]);
+			Dilithium sgn2(params[i]);
+			Dilithium sgn3(params[i]);
+
+			TestUtils::SignatureBatch(&sgn1, &sgn2, &sgn3, CNT, std::string("DB"));
+		}
+	}
+
 	void DilithiumTest::Exception()
 	{
 		// test invalid constructor parameters -sphincs parameters
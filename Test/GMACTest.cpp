@@ -1,4 +1,6 @@
 #include "GMACTest.h"
+#include "../CEX/CMUL.h"
+#include "../CEX/CpuDetect.h"
 #include "../CEX/GMAC.h"
 #include "../CEX/IntegerTools.h"
 #include "../CEX/SecureRandom.h"
@@ -7,6 +9,7 @@
 namespace Test
 {
 	using Enumeration::BlockCiphers;
+	using Numeric::CMUL;
 	using Exception::CryptoMacException;
 	using Mac::GMAC;
 	using Utility::IntegerTools;
@@ -67,6 +70,9 @@ namespace Test
 			Kat(m_key[10], m_nonce[10], m_message[10], m_expected[10]);
 			OnProgress(std::string("GMACTest: Passed GMAC known answer vector tests.."));
 
+			Multiply();
+			OnProgress(std::string("GMACTest: Passed CMUL aggregated multiply tests.."));
+
 			GMAC* gen = new GMAC(BlockCiphers::AES);
 
 			Params(gen);
@@ -252,6 +258,90 @@ namespace Test
 		}
 	}
 
+	void GMACTest::Multiply()
+	{
+		const size_t MSGLEN = CMUL::CMUL_TABLE_SIZE * CMUL::CMUL_BLOCK_SIZE;
+		std::array<ulong, CMUL::CMUL_STATE_SIZE * CMUL::CMUL_TABLE_SIZE> tbl;
+		std::array<ulong, CMUL::CMUL_STATE_SIZE> hkey;
+		std::array<ulong, CMUL::CMUL_STATE_SIZE> tmpk;
+		std::array<byte, CMUL::CMUL_BLOCK_SIZE> otp1;
+		std::array<byte, CMUL::CMUL_BLOCK_SIZE> otp2;
+		std::array<byte, CMUL::CMUL_BLOCK_SIZE> otp3;
+		std::array<byte, CMUL::CMUL_BLOCK_SIZE> tmph;
+		std::vector<byte> hash(CMUL::CMUL_BLOCK_SIZE);
+		std::vector<byte> msg(MSGLEN);
+		CpuDetect dtc;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t k;
+
+		// the aggregated functions require the carry-less multiply instructions
+		if (!dtc.CMUL() || !dtc.AVX())
+		{
+			return;
+		}
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			IntegerTools::Fill(hash, 0, hash.size(), rnd);
+			IntegerTools::Fill(msg, 0, msg.size(), rnd);
+			hkey[0] = IntegerTools::BeBytesTo64(hash, 0);
+			hkey[1] = IntegerTools::BeBytesTo64(hash, sizeof(ulong));
+			IntegerTools::Fill(hash, 0, hash.size(), rnd);
+
+			// the table holds H^8..H^1 in descending order
+			IntegerTools::Be64ToBytes(hkey[0], tmph, 0);
+			IntegerTools::Be64ToBytes(hkey[1], tmph, sizeof(ulong));
+			tbl[(CMUL::CMUL_TABLE_SIZE - 1) * CMUL::CMUL_STATE_SIZE] = hkey[0];
+			tbl[((CMUL::CMUL_TABLE_SIZE - 1) * CMUL::CMUL_STATE_SIZE) + 1] = hkey[1];
+
+			for (j = CMUL::CMUL_TABLE_SIZE - 1; j != 0; --j)
+			{
+				tmpk = hkey;
+				CMUL::PermuteR128P128C(tmpk, tmph);
+				tbl[(j - 1) * CMUL::CMUL_STATE_SIZE] = IntegerTools::BeBytesTo64(tmph, 0);
+				tbl[((j - 1) * CMUL::CMUL_STATE_SIZE) + 1] = IntegerTools::BeBytesTo64(tmph, sizeof(ulong));
+			}
+
+			// the sequential multiply is the reference
+			for (j = 0; j < CMUL::CMUL_BLOCK_SIZE; ++j)
+			{
+				otp1[j] = hash[j];
+				otp2[j] = hash[j];
+				otp3[j] = hash[j];
+			}
+
+			for (j = 0; j < CMUL::CMUL_TABLE_SIZE; ++j)
+			{
+				for (k = 0; k < CMUL::CMUL_BLOCK_SIZE; ++k)
+				{
+					otp1[k] ^= msg[(j * CMUL::CMUL_BLOCK_SIZE) + k];
+				}
+
+				tmpk = hkey;
+				CMUL::PermuteR128P128C(tmpk, otp1);
+			}
+
+			// two 4 block multiplies with the 128-bit instructions
+			CMUL::PermuteR128P512V(tbl, msg, 0, otp2);
+			CMUL::PermuteR128P512V(tbl, msg, 4 * CMUL::CMUL_BLOCK_SIZE, otp2);
+
+			if (otp1 != otp2)
+			{
+				throw TestException(std::string("Multiply"), std::string("CMUL"), std::string("The 4 block multiply does not match the sequential output! -GM1"));
+			}
+
+			// one 8 block multiply; uses the VPCLMULQDQ kernel when CMUL::WideProfile() is Simd512
+			CMUL::PermuteR128P1024V(tbl, msg, 0, otp3);
+
+			if (otp2 != otp3)
+			{
+				throw TestException(std::string("Multiply"), std::string("CMUL"), std::string("The 8 block multiply does not match the 4 block output! -GM2"));
+			}
+		}
+	}
+
 	void GMACTest::OnProgress(const std::string &Data)
 	{
 		m_progressEvent(Data);
@@ -71,6 +71,11 @@ namespace Test
 		/// <param name="Expected">The expected mac code</param>
 		void Kat(std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<byte> &Message, std::vector<byte> &Expected);
 
+		/// <summary>
+		/// Compare the aggregated 4 and 8 block CMUL multiply functions, and the VPCLMULQDQ kernel when it is selected, to the sequential multiply
+		/// </summary>
+		void Multiply();
+
 		/// <summary>
 		/// Test the different initialization options
 		/// </summary>
@@ -1,4 +1,5 @@
 #include "KeccakTest.h"
+#include "../CEX/CpuDetect.h"
 #include "../CEX/IntegerTools.h"
 #include "../CEX/Keccak.h"
 #include "../CEX/Keccak256.h"
@@ -7,14 +8,6 @@
 #include "../CEX/MemoryTools.h"
 #include "../CEX/SecureRandom.h"
 
-#if defined(__AVX2__)
-#	include "../CEX/ULong256.h"
-#endif
-
-#if defined(__AVX512__)
-#	include "../CEX/ULong512.h"
-#endif
-
 namespace Test
 {
 	using Exception::CryptoDigestException;
@@ -22,16 +15,9 @@ namespace Test
 	using Utility::MemoryTools;
 	using Prng::SecureRandom;
 	using Cipher::SymmetricKey;
+	using Enumeration::SimdProfiles;
 	using namespace Digest;
 
-#if defined(__AVX2__)
-	using Numeric::ULong256;
-#endif
-
-#if defined(__AVX512__)
-	using Numeric::ULong512;
-#endif
-
 	const std::string KeccakTest::CLASSNAME = "KeccakTest";
 	const std::string KeccakTest::DESCRIPTION = "SHA-3 Vector KATs; tests the 256, 512, and 1024 versions of Keccak.";
 	const std::string KeccakTest::SUCCESS = "SUCCESS! All Keccak tests have executed succesfully.";
@@ -81,6 +67,8 @@ namespace Test
 			OnProgress(std::string("KeccakTest: Passed Keccak 24-round permutation variants equivalence test.."));
 			PermutationR48();
 			OnProgress(std::string("KeccakTest: Passed Keccak 48-round permutation variants equivalence test.."));
+			WideXof();
+			OnProgress(std::string("KeccakTest: Passed Keccak multi-lane XOF equivalence test.."));
 
 			Keccak256* dgt256s = new Keccak256(false);
 			Kat(dgt256s, m_message[0], m_expected[0]);
@@ -366,8 +354,10 @@ namespace Test
 
 	void KeccakTest::PermutationR24()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::array<ulong, 25> state1;
 		std::array<ulong, 25> state2;
+		size_t i;
 
 		MemoryTools::Clear(state1, 0, 25 * sizeof(ulong));
 		MemoryTools::Clear(state2, 0, 25 * sizeof(ulong));
@@ -377,42 +367,45 @@ namespace Test
 
 		if (state1 != state2)
 		{
-			throw TestException(std::string("PermutationR24"), std::string("PermuteR24P1600"), std::string("Permutation output is not equal!"));
+			throw TestException(std::string("PermutationR24"), std::string("PermuteR24P1600"), std::string("Permutation output is not equal! -KR1"));
 		}
 
-#if defined(__AVX2__)
-
-		std::vector<ULong256> state256(25, ULong256(0));
+#if defined(CEX_KERNEL_SIMD256)
 
-		Keccak::PermuteR24P4x1600H(state256);
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			// word n of lane k is at (n * 4) + k
+			std::array<ulong, 100> state256;
 
-		std::vector<ulong> state256ull(100);
-		std::memcpy(state256ull.data(), state256.data(), 100 * sizeof(ulong));
+			MemoryTools::Clear(state256, 0, 100 * sizeof(ulong));
+			Keccak::PermuteR24P4x1600H(state256.data());
 
-		for (size_t i = 0; i < 25; ++i)
-		{
-			if (state256ull[i] != state1[i / 4])
+			for (i = 0; i < 100; ++i)
 			{
-				throw TestException(std::string("PermutationR24"), std::string("PermuteR24P4x1600H"), std::string("Permutation output is not equal!"));
+				if (state256[i] != state1[i / 4])
+				{
+					throw TestException(std::string("PermutationR24"), std::string("PermuteR24P4x1600H"), std::string("Permutation output is not equal! -KR2"));
+				}
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
-
-		std::vector<ULong512> state512(25, ULong512(0));
+#if defined(CEX_KERNEL_SIMD512)
 
-		Keccak::PermuteR24P8x1600H(state512);
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 200> state512;
 
-		std::vector<ulong> state512ull(100);
-		std::memcpy(state512ull.data(), state512.data(), 200 * sizeof(ulong));
+			MemoryTools::Clear(state512, 0, 200 * sizeof(ulong));
+			Keccak::PermuteR24P8x1600H(state512.data());
 
-		for (size_t i = 0; i < 25; ++i)
-		{
-			if (state512ull[i] != state1[i / 8])
+			for (i = 0; i < 200; ++i)
 			{
-				throw TestException(std::string("PermutationR24"), std::string("PermuteR24P8x1600H"), std::string("Permutation output is not equal!"));
+				if (state512[i] != state1[i / 8])
+				{
+					throw TestException(std::string("PermutationR24"), std::string("PermuteR24P8x1600H"), std::string("Permutation output is not equal! -KR3"));
+				}
 			}
 		}
 
@@ -421,8 +414,10 @@ namespace Test
 
 	void KeccakTest::PermutationR48()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::array<ulong, 25> state1;
 		std::array<ulong, 25> state2;
+		size_t i;
 
 		MemoryTools::Clear(state1, 0, 25 * sizeof(ulong));
 		MemoryTools::Clear(state2, 0, 25 * sizeof(ulong));
@@ -432,42 +427,45 @@ namespace Test
 
 		if (state1 != state2)
 		{
-			throw TestException(std::string("PermutationR48"), std::string("PermuteR48P1600"), std::string("Permutation output is not equal!"));
+			throw TestException(std::string("PermutationR48"), std::string("PermuteR48P1600"), std::string("Permutation output is not equal! -KR5"));
 		}
 
-#if defined(__AVX2__)
-
-		std::vector<ULong256> state256(25, ULong256(0));
+#if defined(CEX_KERNEL_SIMD256)
 
-		Keccak::PermuteR48P4x1600H(state256);
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			// word n of lane k is at (n * 4) + k
+			std::array<ulong, 100> state256;
 
-		std::vector<ulong> state256ull(100);
-		MemoryTools::Copy(state256, 0, state256ull, 0, 100 * sizeof(ulong));
+			MemoryTools::Clear(state256, 0, 100 * sizeof(ulong));
+			Keccak::PermuteR48P4x1600H(state256.data());
 
-		for (size_t i = 0; i < 25; ++i)
-		{
-			if (state256ull[i] != state1[i / 4])
+			for (i = 0; i < 100; ++i)
 			{
-				throw TestException(std::string("PermutationR48"), std::string("PermuteR48P4x1600H"), std::string("Permutation output is not equal!"));
+				if (state256[i] != state1[i / 4])
+				{
+					throw TestException(std::string("PermutationR48"), std::string("PermuteR48P4x1600H"), std::string("Permutation output is not equal! -KR6"));
+				}
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
-
-		std::vector<ULong512> state512(25, ULong512(0));
+#if defined(CEX_KERNEL_SIMD512)
 
-		Keccak::PermuteR48P8x1600H(state512);
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 200> state512;
 
-		std::vector<ulong> state512ull(100);
-		MemoryTools::Copy(state512, 0, state512ull, 0, 200 * sizeof(ulong));
+			MemoryTools::Clear(state512, 0, 200 * sizeof(ulong));
+			Keccak::PermuteR48P8x1600H(state512.data());
 
-		for (size_t i = 0; i < 25; ++i)
-		{
-			if (state512ull[i] != state1[i / 8])
+			for (i = 0; i < 200; ++i)
 			{
-				throw TestException(std::string("PermutationR48"), std::string("PermuteR48P8x1600H"), std::string("Permutation output is not equal!"));
+				if (state512[i] != state1[i / 8])
+				{
+					throw TestException(std::string("PermutationR48"), std::string("PermuteR48P8x1600H"), std::string("Permutation output is not equal! -KR7"));
+				}
 			}
 		}
 
@@ -540,6 +538,62 @@ namespace Test
 
 	//~~~Private Functions~~~//
 
+	void KeccakTest::WideXof()
+	{
+#if defined(CEX_KERNEL_SIMD256)
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
+		const std::vector<size_t> INPLEN = { 0, 48, 135, 136, 300 };
+		const std::vector<size_t> OTPLEN = { 16, 136, 500 };
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t k;
+
+		if (SMDPRF != SimdProfiles::Simd256 && SMDPRF != SimdProfiles::Simd512)
+		{
+			return;
+		}
+
+		for (i = 0; i < INPLEN.size(); ++i)
+		{
+			for (j = 0; j < OTPLEN.size(); ++j)
+			{
+				std::vector<byte> inp(8 * INPLEN[i]);
+				std::vector<byte> exp(8 * OTPLEN[j]);
+				std::vector<byte> otp(8 * OTPLEN[j]);
+
+				rnd.Generate(inp);
+
+				for (k = 0; k < 8; ++k)
+				{
+					Keccak::XOFR24P1600(inp, k * INPLEN[i], INPLEN[i], exp, k * OTPLEN[j], OTPLEN[j], Keccak::KECCAK256_RATE_SIZE);
+				}
+
+				Keccak::XOFR24P4x1600(inp, 0, INPLEN[i], otp, 0, OTPLEN[j], Keccak::KECCAK256_RATE_SIZE);
+				Keccak::XOFR24P4x1600(inp, 4 * INPLEN[i], INPLEN[i], otp, 4 * OTPLEN[j], OTPLEN[j], Keccak::KECCAK256_RATE_SIZE);
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("WideXof"), std::string("XOFR24P4x1600"), std::string("XOF output is not equal! -KW1"));
+				}
+
+#	if defined(CEX_KERNEL_SIMD512)
+				if (SMDPRF == SimdProfiles::Simd512)
+				{
+					MemoryTools::Clear(otp, 0, otp.size());
+					Keccak::XOFR24P8x1600(inp, 0, INPLEN[i], otp, 0, OTPLEN[j], Keccak::KECCAK256_RATE_SIZE);
+
+					if (otp != exp)
+					{
+						throw TestException(std::string("WideXof"), std::string("XOFR24P8x1600"), std::string("XOF output is not equal! -KW2"));
+					}
+				}
+#	endif
+			}
+		}
+#endif
+	}
+
 	void KeccakTest::Initialize()
 	{
 		/*lint -save -e417 */
@@ -114,6 +114,11 @@ namespace Test
 		/// </summary>
 		void TreeParams();
 
+		/// <summary>
+		/// Compare the vectorized multi-lane XOF functions to the sequential SHAKE output for equivalence
+		/// </summary>
+		void WideXof();
+
 	private:
 
 		void Initialize();
@@ -0,0 +1,127 @@
+#include "MacSpeedTest.h"
+#include "../CEX/IMac.h"
+#include "../CEX/MacFromName.h"
+#include "../CEX/SymmetricKey.h"
+
+namespace Test
+{
+	using Cipher::SymmetricKey;
+	using Cipher::SymmetricKeySize;
+
+	const std::string MacSpeedTest::CLASSNAME = "MacSpeedTest";
+	const std::string MacSpeedTest::DESCRIPTION = "MAC Speed Tests.";
+	const std::string MacSpeedTest::MESSAGE = "COMPLETE! Speed tests have executed succesfully.";
+
+	MacSpeedTest::MacSpeedTest()
+		:
+		m_progressEvent()
+	{
+	}
+
+	MacSpeedTest::~MacSpeedTest()
+	{
+	}
+
+	const std::string MacSpeedTest::Description()
+	{
+		return DESCRIPTION;
+	}
+
+	TestEventHandler &MacSpeedTest::Progress()
+	{
+		return m_progressEvent;
+	}
+
+	std::string MacSpeedTest::Run()
+	{
+		using namespace Enumeration;
+
+		try
+		{
+			using Enumeration::Macs;
+
+			OnProgress(std::string("### Message Authentication Code Speed Tests: 10 loops * 100MB ###"));
+
+			OnProgress(std::string("***The Poly1305 MAC with 64 byte updates***"));
+			MacBlockLoop(Macs::Poly1305, MB100, 64);
+			OnProgress(std::string("***The Poly1305 MAC with 16KB updates***"));
+			MacBlockLoop(Macs::Poly1305, MB100, 16 * 1024);
+
+			OnProgress(std::string("***The GMAC MAC with 16KB updates***"));
+			MacBlockLoop(Macs::GMAC, MB100, 16 * 1024);
+
+			OnProgress(std::string("***The HMAC SHA2 256 MAC with 16KB updates***"));
+			MacBlockLoop(Macs::HMACSHA256, MB100, 16 * 1024);
+
+			OnProgress(std::string("***The KMAC 256 MAC with 16KB updates***"));
+			MacBlockLoop(Macs::KMAC256, MB100, 16 * 1024);
+
+			return MESSAGE;
+		}
+		catch (CryptoException &ex)
+		{
+			throw TestException(CLASSNAME, ex.Location(), ex.Origin(), ex.Message());
+		}
+		catch (std::exception const &ex)
+		{
+			throw TestException(CLASSNAME, std::string("Unknown Origin"), std::string(ex.what()));
+		}
+	}
+
+	uint64_t MacSpeedTest::GetBytesPerSecond(uint64_t DurationTicks, uint64_t DataSize)
+	{
+		double sec = (double)DurationTicks / 1000.0;
+		double sze = (double)DataSize;
+
+		return (uint64_t)(sze / sec);
+	}
+
+	void MacSpeedTest::MacBlockLoop(Enumeration::Macs MacType, size_t SampleSize, size_t BufferSize, size_t Loops)
+	{
+		Mac::IMac* gen = Helper::MacFromName::GetInstance(MacType);
+		SymmetricKeySize ks = gen->LegalKeySizes()[0];
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.NonceSize());
+		std::vector<byte> code(gen->TagSize(), 0);
+		std::vector<byte> buffer(BufferSize, 0);
+
+		TestUtils::GetRandom(key);
+		TestUtils::GetRandom(nonce);
+		SymmetricKey kp(key, nonce);
+		gen->Initialize(kp);
+
+		uint64_t start = TestUtils::GetTimeMs64();
+
+		for (size_t i = 0; i < Loops; ++i)
+		{
+			size_t counter = 0;
+			uint64_t lstart = TestUtils::GetTimeMs64();
+
+			while (counter < SampleSize)
+			{
+				gen->Update(buffer, 0, buffer.size());
+				counter += buffer.size();
+			}
+			std::string calc = TestUtils::ToString((TestUtils::GetTimeMs64() - lstart) / 1000.0);
+			OnProgress(calc);
+		}
+		gen->Finalize(code, 0);
+		delete gen;
+
+		uint64_t dur = TestUtils::GetTimeMs64() - start;
+		uint64_t len = Loops * SampleSize;
+		uint64_t rate = GetBytesPerSecond(dur, len);
+		std::string glen = TestUtils::ToString(len / GB1);
+		std::string mbps = TestUtils::ToString((rate / MB1));
+		std::string secs = TestUtils::ToString((double)dur / 1000.0);
+		std::string resp = std::string(glen + "GB in " + secs + " seconds, avg. " + mbps + " MB per Second");
+
+		OnProgress(resp);
+		OnProgress(std::string(""));
+	}
+
+	void MacSpeedTest::OnProgress(const std::string &Data)
+	{
+		m_progressEvent(Data);
+	}
+}
@@ -68,6 +68,8 @@ namespace Test
 
 			Authentication();
 			OnProgress(std::string("McElieceTest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("McElieceTest: Passed batch encapsulation and decapsulation tests.."));
 			CipherText();
 			OnProgress(std::string("McElieceTest: Passed cipher-text integrity test.."));
 			Exception();
@@ -76,6 +78,8 @@ namespace Test
 			OnProgress(std::string("McElieceTest: Passed cipher-text and shared-secret known answer tests.."));
 			PublicKey();
 			OnProgress(std::string("McElieceTest: Passed public key integrity test.."));
+			PublicKeyView();
+			OnProgress(std::string("McElieceTest: Passed public key view test.."));
 			Serialization();
 			OnProgress(std::string("McElieceTest: Passed key serialization tests.."));
 			Stress();
@@ -158,6 +162,21 @@ namespace Test
 		delete kp3;
 	}
 
+	void McElieceTest::Batch()
+	{
+		// an odd count leaves a partial range on the last thread
+		const size_t BCHCNT = 5;
+		std::vector<MPKCParameters> params = { MPKCParameters::MPKCS1N4096T62 };
+		size_t i;
+
+		for (i = 0; i < params.size(); ++i)
+		{
+			McEliece cpr(params[i]);
+
+			TestUtils::CipherBatch(&cpr, BCHCNT, std::string("MB"));
+		}
+	}
+
 	void McElieceTest::CipherText()
 	{
 		std::vector<byte> cpt(0);
@@ -493,6 +512,53 @@ namespace Test
 		delete kp3;
 	}
 
+	void McElieceTest::PublicKeyView()
+	{
+		const size_t HDRLEN = 3;
+		std::vector<byte> cpt(0);
+		std::vector<byte> ssk1(0);
+		std::vector<byte> ssk2(0);
+
+		McEliece cpr(MPKCParameters::MPKCS1N6960T119);
+		AsymmetricKeyPair* kp = cpr.Generate();
+		SecureVector<byte> skey = AsymmetricKey::Serialize(*kp->PublicKey());
+
+		// view the polynomial in place, following the serialized key header
+		AsymmetricKey* pkv = new AsymmetricKey(skey.data() + HDRLEN, skey.size() - HDRLEN, AsymmetricPrimitives::McEliece, AsymmetricKeyTypes::CipherPublicKey, static_cast<AsymmetricParameters>(MPKCParameters::MPKCS1N6960T119));
+
+		if (pkv->Polynomial() != kp->PublicKey()->Polynomial() || pkv->PolynomialView() != skey.data() + HDRLEN)
+		{
+			throw TestException(std::string("PublicKeyView"), cpr.Name(), std::string("Public key view test has failed! -MV1"));
+		}
+
+		cpr.Initialize(pkv);
+		cpr.Encapsulate(cpt, ssk1);
+		cpr.Initialize(kp->PrivateKey());
+
+		if (!cpr.Decapsulate(cpt, ssk2) || ssk1 != ssk2)
+		{
+			throw TestException(std::string("PublicKeyView"), cpr.Name(), std::string("Public key view test has failed! -MV2"));
+		}
+
+		// private keys can not be viewed
+		try
+		{
+			AsymmetricKey skv(skey.data() + HDRLEN, skey.size() - HDRLEN, AsymmetricPrimitives::McEliece, AsymmetricKeyTypes::CipherPrivateKey, static_cast<AsymmetricParameters>(MPKCParameters::MPKCS1N6960T119));
+
+			throw TestException(std::string("PublicKeyView"), cpr.Name(), std::string("Exception handling failure! -MV3"));
+		}
+		catch (CryptoAsymmetricException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		delete kp;
+		delete pkv;
+	}
+
 	void McElieceTest::Serialization()
 	{
 		SecureVector<byte> skey(0);
@@ -61,6 +61,11 @@ namespace Test
 		/// </summary>
 		void Authentication();
 
+		/// <summary>
+		/// Compare batch encapsulation and decapsulation to the single message functions
+		/// </summary>
+		void Batch();
+
 		/// <summary>
 		/// Tests the ciphers decryption function for invalid cipher-text in a looping stress test
 		/// </summary>
@@ -86,6 +91,11 @@ namespace Test
 		/// </summary>
 		void PublicKey();
 
+		/// <summary>
+		/// Tests encapsulation with a read-only public key view, and rejection of private key views
+		/// </summary>
+		void PublicKeyView();
+
 		/// <summary>
 		/// Tests the ciphers key serialization function using a looping stress test
 		/// </summary>
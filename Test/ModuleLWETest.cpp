@@ -65,6 +65,8 @@ namespace Test
 
 			Authentication();
 			OnProgress(std::string("ModuleLWETest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("ModuleLWETest: Passed batch encapsulation and decapsulation tests.."));
 			CipherText();
 			OnProgress(std::string("ModuleLWETest: Passed cipher-text integrity test.."));
 			Exception();
@@ -154,6 +156,21 @@ namespace Test
 		delete kp3;
 	}
 
+	void ModuleLWETest::Batch()
+	{
+		// an odd count exercises the partial lane group
+		const size_t BCHCNT = 9;
+		std::vector<MLWEParameters> params = { MLWEParameters::MLWES1Q3329N256, MLWEParameters::MLWES2Q3329N256, MLWEParameters::MLWES3Q3329N256 };
+		size_t i;
+
+		for (i = 0; i < params.size(); ++i)
+		{
+			ModuleLWE cpr(params[i]);
+
+			TestUtils::CipherBatch(&cpr, BCHCNT, std::string("MB"));
+		}
+	}
+
 	void ModuleLWETest::CipherText()
 	{
 		std::vector<byte> cpt(0);
@@ -61,6 +61,11 @@ namespace Test
 		/// </summary>
 		void Authentication();
 
+		/// <summary>
+		/// Compare batch encapsulation and decapsulation to the single message functions
+		/// </summary>
+		void Batch();
+
 		/// <summary>
 		/// Tests the ciphers decryption function for invalid cipher-text in a looping stress test
 		/// </summary>
@@ -65,6 +65,8 @@ namespace Test
 
 			Authentication();
 			OnProgress(std::string("NTRUTest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("NTRUTest: Passed batch encapsulation and decapsulation tests.."));
 			CipherText();
 			OnProgress(std::string("NTRUTest: Passed cipher-text integrity test.."));
 			Exception();
@@ -136,6 +138,21 @@ namespace Test
 		delete kp2;
 	}
 
+	void NTRUTest::Batch()
+	{
+		// an odd count leaves a partial range on the last thread
+		const size_t BCHCNT = 9;
+		std::vector<NTRUParameters> params = { NTRUParameters::NTRUS1SQ4621N653, NTRUParameters::NTRUS2SQ4591N761, NTRUParameters::NTRUS3SQ5167N857 };
+		size_t i;
+
+		for (i = 0; i < params.size(); ++i)
+		{
+			NTRUPrime cpr(params[i]);
+
+			TestUtils::CipherBatch(&cpr, BCHCNT, std::string("NB"));
+		}
+	}
+
 	void NTRUTest::CipherText()
 	{
 		std::vector<byte> cpt(0);
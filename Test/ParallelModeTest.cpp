@@ -7,12 +7,15 @@
 #include "../CEX/EAX.h"
 #include "../CEX/GCM.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/ParallelTuner.h"
 #include "../CEX/SecureRandom.h"
+#include <cstdio>
 
 namespace Test
 {
 	using namespace Cipher::Block::Mode;
 	using Utility::IntegerTools;
+	using CEX::ParallelTuner;
 	using Prng::SecureRandom;
 	using Cipher::SymmetricKey;
 	using Cipher::SymmetricKeySize;
@@ -71,6 +74,9 @@ namespace Test
 			OnProgress(std::string("ParallelModeTest: Passed ICM parallel to sequential equivalence test.."));
 			delete cpr4;
 
+			Profile();
+			OnProgress(std::string("ParallelModeTest: Passed calibrated profile save, restore and equivalence test.."));
+
 			EAX* cpr5 = new EAX(Enumeration::BlockCiphers::AES);
 			Stress(cpr5, true);
 			OnProgress(std::string("ParallelModeTest: Passed EAX parallel to sequential equivalence test.."));
@@ -97,6 +103,50 @@ namespace Test
 		}
 	}
 
+	void ParallelModeTest::Profile()
+	{
+		const std::string PRFPTH = "ParallelModeTest.profile";
+		bool prl;
+		size_t pbs;
+		size_t prd;
+
+		ParallelTuner::Clear();
+		// a small sample keeps the calibration short
+		ParallelTuner::Calibrate(Enumeration::CipherModes::CTR, Enumeration::BlockCiphers::AES, 1024 * 1024);
+
+		CTR cpr1(Enumeration::BlockCiphers::AES);
+		prl = cpr1.ParallelProfile().IsParallel();
+		pbs = cpr1.ParallelProfile().ParallelBlockSize();
+		prd = cpr1.ParallelProfile().ParallelMaxDegree();
+		ParallelTuner::Save(PRFPTH);
+		ParallelTuner::Clear();
+
+		CTR cpr2(Enumeration::BlockCiphers::AES);
+
+		if (!cpr2.ParallelProfile().IsDefault())
+		{
+			throw TestException(std::string("Profile"), cpr2.Name(), std::string("The profile was applied after being cleared! -PP1"));
+		}
+
+		if (!ParallelTuner::Load(PRFPTH))
+		{
+			throw TestException(std::string("Profile"), cpr2.Name(), std::string("The profile file could not be loaded! -PP2"));
+		}
+
+		CTR* cpr3 = new CTR(Enumeration::BlockCiphers::AES);
+
+		if (cpr3->ParallelProfile().IsParallel() != prl || cpr3->ParallelProfile().ParallelBlockSize() != pbs || cpr3->ParallelProfile().ParallelMaxDegree() != prd)
+		{
+			delete cpr3;
+			throw TestException(std::string("Profile"), cpr2.Name(), std::string("The restored profile does not match the calibrated profile! -PP3"));
+		}
+
+		Stress(cpr3, true);
+		delete cpr3;
+		ParallelTuner::Clear();
+		std::remove(PRFPTH.c_str());
+	}
+
 	void ParallelModeTest::Stress(ICipherMode* Cipher, bool Encryption)
 	{
 		const size_t MINSMP = Cipher->ParallelProfile().ParallelBlockSize();
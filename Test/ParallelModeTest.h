@@ -56,6 +56,11 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Calibrates a cipher mode with the ParallelTuner, and tests that a saved profile is restored by the constructor and produces equivalent output
+		/// </summary>
+		void Profile();
+
 		/// <summary>
 		/// Compares synchronous to parallel processed random-sized, pseudo-random array transformations and their inverse in a looping [TEST_CYCLES] stress-test
 		/// </summary>
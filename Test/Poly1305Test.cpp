@@ -80,6 +80,9 @@ namespace Test
 			Stress(gen);
 			OnProgress(std::string("Poly1305Test: Passed Poly1305stress tests.."));
 
+			Vector(gen);
+			OnProgress(std::string("Poly1305Test: Passed Poly1305 vector and scalar equivalence tests.."));
+
 			delete gen;
 
 			return SUCCESS;
@@ -407,4 +410,72 @@ namespace Test
 			}
 		}
 	}
+
+	void Poly1305Test::Vector(IMac* Generator)
+	{
+		const uint MAXMSG = 1024;
+		const uint MAXUPD = 255;
+		const size_t SCLLEN = 15;
+		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
+		std::vector<byte> code1(Generator->TagSize());
+		std::vector<byte> code2(Generator->TagSize());
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> msg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t len;
+
+		msg.reserve(MAXMSG);
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			const size_t MSGLEN = static_cast<size_t>(rnd.NextUInt32(MAXMSG, 1));
+			msg.resize(MSGLEN);
+
+			IntegerTools::Fill(key, 0, key.size(), rnd);
+			IntegerTools::Fill(msg, 0, msg.size(), rnd);
+			SymmetricKey kp(key);
+
+			// the expected tag; a 15 byte update never reaches a lane threshold, so every block is absorbed by the scalar chain
+			Generator->Initialize(kp);
+
+			for (j = 0; j < MSGLEN; j += SCLLEN)
+			{
+				len = (MSGLEN - j < SCLLEN) ? MSGLEN - j : SCLLEN;
+				Generator->Update(msg, j, len);
+			}
+
+			Generator->Finalize(code1, 0);
+
+			// a single update, the aligned blocks are absorbed by the vector lanes
+			Generator->Initialize(kp);
+			Generator->Update(msg, 0, MSGLEN);
+			Generator->Finalize(code2, 0);
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Vector"), Generator->Name(), std::string("The vector output does not match the scalar output! -PV1"));
+			}
+
+			// odd-sized incremental updates, mixing the buffered, scalar, and vector paths
+			Generator->Initialize(kp);
+			j = 0;
+
+			while (j != MSGLEN)
+			{
+				len = static_cast<size_t>(rnd.NextUInt32(MAXUPD, 1)) | 1;
+				len = (MSGLEN - j < len) ? MSGLEN - j : len;
+				Generator->Update(msg, j, len);
+				j += len;
+			}
+
+			Generator->Finalize(code2, 0);
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Vector"), Generator->Name(), std::string("The incremental output does not match the scalar output! -PV2"));
+			}
+		}
+	}
 }
@@ -91,6 +91,11 @@ namespace Test
 		/// </summary>
 		void Stress(IMac* Generator);
 
+		/// <summary>
+		/// Compare the vector lane output with the scalar block chain, using random message lengths that cross the 64 and 128 byte lane thresholds
+		/// </summary>
+		void Vector(IMac* Generator);
+
 	private:
 
 		void Initialize();
@@ -615,7 +615,7 @@ namespace Test
 
 	bool RCSTest::HasAESNI()
 	{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 		CpuDetect dtc;
 
 		return dtc.AVX() && dtc.AESNI();
@@ -186,6 +186,45 @@ namespace Test
 
 			OnProgress(std::string("RijndaelTest: Passed Rijndael extended Monte Carlo tests.."));
 
+			if (m_aesniTest)
+			{
+				// the 4, 8 and 16 block transforms use the vaes engines when available, the aes-ni block transform is the reference
+				AHX* cpr1 = new AHX();
+				Wide(cpr1);
+				delete cpr1;
+				AHX* cpr2 = new AHX(BlockCipherExtensions::HKDF256);
+				Wide(cpr2);
+				delete cpr2;
+				AHX* cpr3 = new AHX(BlockCipherExtensions::HKDF512);
+				Wide(cpr3);
+				delete cpr3;
+				AHX* cpr4 = new AHX(BlockCipherExtensions::SHAKE256);
+				Wide(cpr4);
+				delete cpr4;
+				AHX* cpr5 = new AHX(BlockCipherExtensions::SHAKE512);
+				Wide(cpr5);
+				delete cpr5;
+
+				OnProgress(std::string("RijndaelTest: Passed Rijndael AES-NI wide transform equivalence tests.."));
+			}
+
+			RHX* cpr6 = new RHX();
+			Wide(cpr6);
+			delete cpr6;
+			RHX* cpr7 = new RHX(BlockCipherExtensions::HKDF256);
+			Wide(cpr7);
+			delete cpr7;
+			RHX* cpr8 = new RHX(BlockCipherExtensions::HKDF512);
+			Wide(cpr8);
+			delete cpr8;
+			RHX* cpr9 = new RHX(BlockCipherExtensions::SHAKE256);
+			Wide(cpr9);
+			delete cpr9;
+			RHX* cpr10 = new RHX(BlockCipherExtensions::SHAKE512);
+			Wide(cpr10);
+			delete cpr10;
+			OnProgress(std::string("RijndaelTest: Passed Rijndael wide transform equivalence tests.."));
+
 			if (m_aesniTest)
 			{
 				CTR* cpr1 = new CTR(BlockCiphers::AES);
@@ -411,11 +450,102 @@ namespace Test
 		}
 	}
 
+	void RijndaelTest::Wide(IBlockCipher* Cipher)
+	{
+		const size_t BLKLEN = 16;
+		const size_t SMPLEN = 256;
+		std::vector<Cipher::SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		std::vector<byte> exp(SMPLEN);
+		std::vector<byte> inp(SMPLEN);
+		std::vector<byte> otp(SMPLEN);
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t k;
+
+		for (i = 0; i < ks.size(); ++i)
+		{
+			std::vector<byte> key(ks[i].KeySize());
+
+			for (j = 0; j < TEST_CYCLES; ++j)
+			{
+				IntegerTools::Fill(key, 0, key.size(), rnd);
+				IntegerTools::Fill(inp, 0, inp.size(), rnd);
+				SymmetricKey kp(key);
+
+				// the sequential block transform is the reference
+				Cipher->Initialize(true, kp);
+
+				for (k = 0; k < SMPLEN; k += BLKLEN)
+				{
+					Cipher->Transform(inp, k, exp, k);
+				}
+
+				for (k = 0; k < SMPLEN; k += 4 * BLKLEN)
+				{
+					Cipher->Transform512(inp, k, otp, k);
+				}
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Encryption output is not equal! -RW1"));
+				}
+
+				for (k = 0; k < SMPLEN; k += 8 * BLKLEN)
+				{
+					Cipher->Transform1024(inp, k, otp, k);
+				}
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Encryption output is not equal! -RW2"));
+				}
+
+				Cipher->Transform2048(inp, 0, otp, 0);
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Encryption output is not equal! -RW3"));
+				}
+
+				// the inverse, each width must restore the plaintext
+				Cipher->Initialize(false, kp);
+
+				for (k = 0; k < SMPLEN; k += 4 * BLKLEN)
+				{
+					Cipher->Transform512(exp, k, otp, k);
+				}
+
+				if (otp != inp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Decryption output is not equal! -RW4"));
+				}
+
+				for (k = 0; k < SMPLEN; k += 8 * BLKLEN)
+				{
+					Cipher->Transform1024(exp, k, otp, k);
+				}
+
+				if (otp != inp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Decryption output is not equal! -RW5"));
+				}
+
+				Cipher->Transform2048(exp, 0, otp, 0);
+
+				if (otp != inp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Decryption output is not equal! -RW6"));
+				}
+			}
+		}
+	}
+
 	//~~~Private Functions~~~//
 
 	bool RijndaelTest::HasAESNI()
 	{
-#if defined(__AVX__)
+#if defined(CEX_AVX_INTRINSICS)
 		CpuDetect dtc;
 
 		return dtc.AVX() && dtc.AESNI();
@@ -107,6 +107,13 @@ namespace Test
 		/// <param name="Cipher">The cipher instance pointer</param>
 		void Stress(ICipherMode* Cipher);
 
+		/// <summary>
+		/// Compares the 4, 8 and 16 block transforms to the sequential block transform, for every legal key size and in both directions
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The block cipher instance pointer</param>
+		void Wide(IBlockCipher* Cipher);
+
     private:
 
 		static bool HasAESNI();
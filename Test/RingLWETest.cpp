@@ -65,6 +65,8 @@ namespace Test
 
 			Authentication();
 			OnProgress(std::string("RingLWETest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("RingLWETest: Passed batch encapsulation and decapsulation tests.."));
 			CipherText();
 			OnProgress(std::string("RingLWETest: Passed cipher-text integrity test.."));
 			Exception();
@@ -136,6 +138,21 @@ namespace Test
 		delete kp2;
 	}
 
+	void RingLWETest::Batch()
+	{
+		// an odd count leaves a partial range on the last thread
+		const size_t BCHCNT = 9;
+		std::vector<RLWEParameters> params = { RLWEParameters::RLWES1Q12289N1024, RLWEParameters::RLWES2Q12289N2048 };
+		size_t i;
+
+		for (i = 0; i < params.size(); ++i)
+		{
+			RingLWE cpr(params[i]);
+
+			TestUtils::CipherBatch(&cpr, BCHCNT, std::string("RB"));
+		}
+	}
+
 	void RingLWETest::CipherText()
 	{
 		std::vector<byte> cpt(0);
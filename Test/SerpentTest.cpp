@@ -101,6 +101,14 @@ namespace Test
 			OnProgress(std::string("SerpentTest: Passed Serpent stress tests.."));
 			delete cpr;
 
+			SHX* cpr9 = new SHX();
+			Wide(cpr9);
+			delete cpr9;
+			SHX* cpr10 = new SHX(BlockCipherExtensions::HKDF512);
+			Wide(cpr10);
+			delete cpr10;
+			OnProgress(std::string("SerpentTest: Passed Serpent multi-block to sequential equivalence tests.."));
+
 			return SUCCESS;
 		}
 		catch (TestException const &ex)
@@ -552,6 +560,97 @@ namespace Test
 		}
 	}
 
+	void SerpentTest::Wide(IBlockCipher* Cipher)
+	{
+		const size_t BLKLEN = 16;
+		const size_t SMPLEN = 256;
+		std::vector<Cipher::SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		std::vector<byte> exp(SMPLEN);
+		std::vector<byte> inp(SMPLEN);
+		std::vector<byte> otp(SMPLEN);
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t k;
+
+		for (i = 0; i < ks.size(); ++i)
+		{
+			std::vector<byte> key(ks[i].KeySize());
+
+			for (j = 0; j < TEST_CYCLES; ++j)
+			{
+				IntegerTools::Fill(key, 0, key.size(), rnd);
+				IntegerTools::Fill(inp, 0, inp.size(), rnd);
+				SymmetricKey kp(key);
+
+				// the sequential block transform is the reference
+				Cipher->Initialize(true, kp);
+
+				for (k = 0; k < SMPLEN; k += BLKLEN)
+				{
+					Cipher->Transform(inp, k, exp, k);
+				}
+
+				for (k = 0; k < SMPLEN; k += 4 * BLKLEN)
+				{
+					Cipher->Transform512(inp, k, otp, k);
+				}
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Encryption output is not equal! -SW1"));
+				}
+
+				for (k = 0; k < SMPLEN; k += 8 * BLKLEN)
+				{
+					Cipher->Transform1024(inp, k, otp, k);
+				}
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Encryption output is not equal! -SW2"));
+				}
+
+				Cipher->Transform2048(inp, 0, otp, 0);
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Encryption output is not equal! -SW3"));
+				}
+
+				// the inverse, each width must restore the plaintext
+				Cipher->Initialize(false, kp);
+
+				for (k = 0; k < SMPLEN; k += 4 * BLKLEN)
+				{
+					Cipher->Transform512(exp, k, otp, k);
+				}
+
+				if (otp != inp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Decryption output is not equal! -SW4"));
+				}
+
+				for (k = 0; k < SMPLEN; k += 8 * BLKLEN)
+				{
+					Cipher->Transform1024(exp, k, otp, k);
+				}
+
+				if (otp != inp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Decryption output is not equal! -SW5"));
+				}
+
+				Cipher->Transform2048(exp, 0, otp, 0);
+
+				if (otp != inp)
+				{
+					throw TestException(std::string("Wide"), Cipher->Name(), std::string("Decryption output is not equal! -SW6"));
+				}
+			}
+		}
+	}
+
 	//~~~Private Functions~~~//
 
 	void SerpentTest::Initialize()
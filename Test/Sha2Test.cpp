@@ -6,30 +6,13 @@
 #include "../CEX/SHA256.h"
 #include "../CEX/SHA512.h"
 
-#if defined(__AVX2__)
-#	include "../CEX/UInt256.h"
-#	include "../CEX/ULong256.h"
-#endif
-
-#if defined(__AVX512__)
-#	include "../CEX/UInt512.h"
-#	include "../CEX/ULong512.h"
-#endif
-
 namespace Test
 {
 	using Exception::CryptoDigestException;
 	using Utility::IntegerTools;
 	using Utility::MemoryTools;
 	using Prng::SecureRandom;
-#if defined(__AVX2__)
-	using Numeric::UInt256;
-	using Numeric::ULong256;
-#endif
-#if defined(__AVX512__)
-	using Numeric::UInt512;
-	using Numeric::ULong512;
-#endif
+	using Enumeration::SimdProfiles;
 	using Digest::SHA2;
 	using Digest::SHA256;
 	using Digest::SHA512; 
@@ -121,6 +104,9 @@ namespace Test
 			PermutationR80();
 			OnProgress(std::string("SHA2Test: Passed Sha2-512 permutation variants equivalence test.."));
 
+			MultiBuffer();
+			OnProgress(std::string("SHA2Test: Passed SHA2 multi-buffer equivalence tests.."));
+
 			TreeParams();
 			OnProgress(std::string("SHA2Test: Passed SHA2Params parameter serialization test.."));
 
@@ -306,6 +292,61 @@ namespace Test
 		}
 	}
 
+	void SHA2Test::MultiBuffer()
+	{
+		const size_t MSGCNT = 37;
+		const size_t MAXSMP = 1024;
+		std::vector<std::vector<byte>> msgs(MSGCNT);
+		std::vector<std::vector<byte>> otp;
+		std::vector<byte> exp;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			// includes empty and block boundary sized messages
+			const size_t INPLEN = (i < 3) ? i * 64 : static_cast<size_t>(rnd.NextUInt32(MAXSMP, 0));
+			msgs[i].resize(INPLEN);
+			IntegerTools::Fill(msgs[i], 0, msgs[i].size(), rnd);
+		}
+
+		SHA2::Compute256xN(msgs, otp);
+
+		if (otp.size() != MSGCNT)
+		{
+			throw TestException(std::string("MultiBuffer"), std::string("SHA2-256"), std::string("Multi-buffer output count is invalid! -SM1"));
+		}
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			exp.resize(32);
+			SHA2::Compute256(msgs[i], 0, msgs[i].size(), exp, 0);
+
+			if (otp[i] != exp)
+			{
+				throw TestException(std::string("MultiBuffer"), std::string("SHA2-256"), std::string("Multi-buffer output is not equal! -SM2"));
+			}
+		}
+
+		SHA2::Compute512xN(msgs, otp);
+
+		if (otp.size() != MSGCNT)
+		{
+			throw TestException(std::string("MultiBuffer"), std::string("SHA2-512"), std::string("Multi-buffer output count is invalid! -SM3"));
+		}
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			exp.resize(64);
+			SHA2::Compute512(msgs[i], 0, msgs[i].size(), exp, 0);
+
+			if (otp[i] != exp)
+			{
+				throw TestException(std::string("MultiBuffer"), std::string("SHA2-512"), std::string("Multi-buffer output is not equal! -SM4"));
+			}
+		}
+	}
+
 	void SHA2Test::Parallel(IDigest* Digest)
 	{
 		const size_t MINSMP = 2048;
@@ -353,9 +394,11 @@ namespace Test
 
 	void SHA2Test::PermutationR64()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::vector<byte> input(64, 128U);
 		std::array<uint, 8> state1;
 		std::array<uint, 8> state2;
+		size_t i;
 
 		MemoryTools::Clear(state1, 0, 8 * sizeof(uint));
 		MemoryTools::Clear(state2, 0, 8 * sizeof(uint));
@@ -365,44 +408,64 @@ namespace Test
 
 		if (state1 != state2)
 		{
-			throw TestException(std::string("PermutationR64"), std::string("PermuteR64P512"), std::string("Permutation output is not equal!"));
+			throw TestException(std::string("PermutationR64"), std::string("PermuteR64P512"), std::string("Permutation output is not equal! -SR1"));
 		}
 
-#if defined(__AVX2__)
+#if defined(CEX_KERNEL_SIMD128)
 
-		std::vector<byte> input256(512, 128U);
-		std::vector<UInt256> state256(8, UInt256(0));
+		CpuDetect dtc;
 
-		SHA2::PermuteR64P8x512H(input256, 0, state256);
-
-		std::vector<uint> state256ul(32);
-		std::memcpy(state256ul.data(), state256.data(), 32 * sizeof(uint));
-
-		for (size_t i = 0; i < 32; ++i)
+		if (dtc.SHA())
 		{
-			if (state256ul[i] != state1[i / 8])
+			MemoryTools::Clear(state2, 0, 8 * sizeof(uint));
+			SHA2::PermuteR64P512V(input.data(), state2.data());
+
+			if (state1 != state2)
 			{
-				throw TestException(std::string("PermutationR64"), std::string("PermuteR64P8x512H"), std::string("Permutation output is not equal!"));
+				throw TestException(std::string("PermutationR64"), std::string("PermuteR64P512V"), std::string("Permutation output is not equal! -SR2"));
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
+		// the wide states are interleaved; word n of lane i is at state[(n * lanes) + i]
+#if defined(CEX_KERNEL_SIMD256)
+
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			std::vector<byte> input256(512, 128U);
+			std::array<uint, 64> state256;
+
+			MemoryTools::Clear(state256, 0, 64 * sizeof(uint));
+			SHA2::PermuteR64P8x512H(input256.data(), state256.data());
 
-		std::vector<byte> input512(1024, 128U);
-		std::vector<UInt512> state512(8, UInt512(0));
+			for (i = 0; i < 64; ++i)
+			{
+				if (state256[i] != state1[i / 8])
+				{
+					throw TestException(std::string("PermutationR64"), std::string("PermuteR64P8x512H"), std::string("Permutation output is not equal! -SR3"));
+				}
+			}
+		}
 
-		SHA2::PermuteR64P16x512H(input512, 0, state512);
+#endif
 
-		std::vector<uint> state512ul(64);
-		std::memcpy(state512ul.data(), state512.data(), 64 * sizeof(uint));
+#if defined(CEX_KERNEL_SIMD512)
 
-		for (size_t i = 0; i < 64; ++i)
+		if (SMDPRF == SimdProfiles::Simd512)
 		{
-			if (state512ul[i] != state1[i / 16])
+			std::vector<byte> input512(1024, 128U);
+			std::array<uint, 128> state512;
+
+			MemoryTools::Clear(state512, 0, 128 * sizeof(uint));
+			SHA2::PermuteR64P16x512H(input512.data(), state512.data());
+
+			for (i = 0; i < 128; ++i)
 			{
-				throw TestException(std::string("PermutationR64"), std::string("PermuteR64P16x512H"), std::string("Permutation output is not equal!"));
+				if (state512[i] != state1[i / 16])
+				{
+					throw TestException(std::string("PermutationR64"), std::string("PermuteR64P16x512H"), std::string("Permutation output is not equal! -SR4"));
+				}
 			}
 		}
 
@@ -411,12 +474,14 @@ namespace Test
 
 	void SHA2Test::PermutationR80()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::vector<byte> input(128, 128U);
 		std::array<ulong, 8> state1;
 		std::array<ulong, 8> state2;
+		size_t i;
 
-		std::memset(state1.data(), 0, 8 * sizeof(ulong));
-		std::memset(state2.data(), 0, 8 * sizeof(ulong));
+		MemoryTools::Clear(state1, 0, 8 * sizeof(ulong));
+		MemoryTools::Clear(state2, 0, 8 * sizeof(ulong));
 
 		SHA2::PermuteR80P1024C(input, 0, state1);
 		SHA2::PermuteR80P1024U(input, 0, state2);
@@ -426,41 +491,43 @@ namespace Test
 			throw TestException(std::string("PermutationR80"), std::string("PermuteR80P1024"), std::string("Permutation output is not equal! -SP1"));
 		}
 
-#if defined(__AVX2__)
-
-		std::vector<byte> input256(512, 128U);
-		std::vector<ULong256> state256(8, ULong256(0));
+#if defined(CEX_KERNEL_SIMD256)
 
-		SHA2::PermuteR80P4x1024H(input256, 0, state256);
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			std::vector<byte> input256(512, 128U);
+			std::array<ulong, 32> state256;
 
-		std::vector<ulong> state256ull(32);
-		MemoryTools::Copy(state256, 0, state256ull, 0, 32 * sizeof(ulong));
+			MemoryTools::Clear(state256, 0, 32 * sizeof(ulong));
+			SHA2::PermuteR80P4x1024H(input256.data(), state256.data());
 
-		for (size_t i = 0; i < 32; ++i)
-		{
-			if (state256ull[i] != state1[i / 4])
+			for (i = 0; i < 32; ++i)
 			{
-				throw TestException(std::string("PermutationR80"), std::string("PermuteR80P4x1024H"), std::string("Permutation output is not equal! -SP2"));
+				if (state256[i] != state1[i / 4])
+				{
+					throw TestException(std::string("PermutationR80"), std::string("PermuteR80P4x1024H"), std::string("Permutation output is not equal! -SP2"));
+				}
 			}
 		}
 
 #endif
 
-#if defined(__AVX512__)
+#if defined(CEX_KERNEL_SIMD512)
 
-		std::vector<byte> input512(1024, 128U);
-		std::vector<ULong512> state512(8, ULong512(0));
-
-		SHA2::PermuteR80P8x1024H(input512, 0, state512);
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::vector<byte> input512(1024, 128U);
+			std::array<ulong, 64> state512;
 
-		std::vector<ulong> state512ull(64);
-		MemoryTools::Copy(state512, 0, state512ull, 0, 64 * sizeof(ulong));
+			MemoryTools::Clear(state512, 0, 64 * sizeof(ulong));
+			SHA2::PermuteR80P8x1024H(input512.data(), state512.data());
 
-		for (size_t i = 0; i < 64; ++i)
-		{
-			if (state512ull[i] != state1[i / 8])
+			for (i = 0; i < 64; ++i)
 			{
-				throw TestException(std::string("PermutationR80"), std::string("PermuteR80P8x1024H"), std::string("Permutation output is not equal! -SP3"));
+				if (state512[i] != state1[i / 8])
+				{
+					throw TestException(std::string("PermutationR80"), std::string("PermuteR80P8x1024H"), std::string("Permutation output is not equal! -SP3"));
+				}
 			}
 		}
 
@@ -79,6 +79,11 @@ namespace Test
 		/// <param name="Expected">The expected output vector</param>
 		void Kat(IDigest* Digest, std::vector<byte> &Input, std::vector<byte> &Expected);
 
+		/// <summary>
+		/// Compare the multi-buffer SHA-256 and SHA-512 batch functions to the sequential digest output, using randomly sized messages
+		/// </summary>
+		void MultiBuffer();
+
 		/// <summary>
 		/// Compares synchronous to parallel random-sized, pseudo-random arrays in a looping [TEST_CYCLES] stress-test
 		/// </summary>
@@ -1,7 +1,10 @@
 #include "SimdWrapperTest.h"
+#include "../CEX/CpuDetect.h"
 
 namespace Test
 {
+	using Enumeration::SimdProfiles;
+
 	const std::string SimdWrapperTest::CLASSNAME = "SymmetricKeyGeneratorTest";
 	const std::string SimdWrapperTest::DESCRIPTION = "Simd wrapper test; tests the output of SIMD wrapper functions.";
 	const std::string SimdWrapperTest::SUCCESS = "SUCCESS! All Simd wrapper tests have executed succesfully.";
@@ -30,6 +33,9 @@ namespace Test
 	{
 		try
 		{
+			SimdProfileCheck();
+			OnProgress(std::string("SimdWrapperTest: Passed the SIMD profile detection tests.."));
+
 #if defined(__AVX512__)
 			SimdMathCheck<Numeric::UInt512>();
 			OnProgress(std::string("SimdWrapperTest: Passed UInt512 comparison tests.."));
@@ -57,6 +63,49 @@ namespace Test
 		}
 	}
 
+	void SimdWrapperTest::SimdProfileCheck()
+	{
+		CpuDetect dtc;
+		const SimdProfiles PRF = CpuDetect::SimdProfile();
+
+		// the profile is resolved once and is constant
+		if (CpuDetect::SimdProfile() != PRF)
+		{
+			throw TestException(std::string("SimdProfileCheck"), std::string("SimdProfile"), std::string("The SIMD profile has changed! -SP1"));
+		}
+
+		// the 512-bit profile also runs the 256-bit kernels
+		if (PRF == SimdProfiles::Simd512 && (!dtc.AVX512F() || !dtc.AVX2()))
+		{
+			throw TestException(std::string("SimdProfileCheck"), std::string("SimdProfile"), std::string("The AVX512 profile was selected on an unsupported processor! -SP2"));
+		}
+
+		if (PRF == SimdProfiles::Simd256 && !dtc.AVX2())
+		{
+			throw TestException(std::string("SimdProfileCheck"), std::string("SimdProfile"), std::string("The AVX2 profile was selected on an unsupported processor! -SP3"));
+		}
+
+		if (PRF != SimdProfiles::None && !dtc.SSE41())
+		{
+			throw TestException(std::string("SimdProfileCheck"), std::string("SimdProfile"), std::string("A SIMD profile was selected on an unsupported processor! -SP4"));
+		}
+
+#if defined(CEX_KERNEL_SIMD128)
+		// a processor with SSE4.1 must select at least the 128-bit kernels
+		if (PRF == SimdProfiles::None && dtc.SSE41())
+		{
+			throw TestException(std::string("SimdProfileCheck"), std::string("SimdProfile"), std::string("The SSE4.1 profile was not selected! -SP5"));
+		}
+#endif
+
+#if !defined(CEX_KERNEL_SIMD512)
+		if (PRF == SimdProfiles::Simd512)
+		{
+			throw TestException(std::string("SimdProfileCheck"), std::string("SimdProfile"), std::string("The AVX512 profile was selected without the AVX512 kernels! -SP6"));
+		}
+#endif
+	}
+
 	void SimdWrapperTest::OnProgress(const std::string &Data)
 	{
 		m_progressEvent(Data);
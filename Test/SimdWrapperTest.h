@@ -55,6 +55,11 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compares the run-time SIMD profile to the instruction sets reported by the processor
+		/// </summary>
+		void SimdProfileCheck();
+
 	private:
 
 		static std::vector<uint> Convert(std::vector<byte> &Input)
@@ -68,6 +68,8 @@ namespace Test
 			OnProgress(std::string("SphincsTest: Passed signature cipher-text and message verification known answer tests.."));
 			Authentication();
 			OnProgress(std::string("SphincsTest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("SphincsTest: Passed batch verification tests.."));
 			Exception();
 			OnProgress(std::string("SphincsTest: Passed exception handling test.."));
 			PrivateKey();
@@ -125,6 +127,22 @@ namespace Test
 		}
 	}
 
+	void SphincsTest::Batch()
+	{
+		const size_t CNT = 5;
+		std::vector<SphincsParameters> params = { SphincsParameters::SPXS1S128SHAKE };
+		size_t i;
+
+		for (i = 0; i < params.size(); ++i)
+		{
+			Sphincs sgn1(params[i]);
+			Sphincs sgn2(params[i]);
+			Sphincs sgn3(params[i]);
+
+			TestUtils::SignatureBatch(&sgn1, &sgn2, &sgn3, CNT, std::string("SB"));
+		}
+	}
+
 	void SphincsTest::Exception()
 	{
 		// test invalid constructor parameters -sphincs parameters
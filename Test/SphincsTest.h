@@ -61,6 +61,11 @@ namespace Test
 		/// </summary>
 		void Authentication();
 
+		/// <summary>
+		/// Tests batch verification with one and with several public keys
+		/// </summary>
+		void Batch();
+
 		/// <summary>
 		/// Tests the ciphers exception handling functions
 		/// </summary>
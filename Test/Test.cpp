@@ -104,6 +104,7 @@
 #include "../Test/HMACTest.h"
 #include "../Test/HCGTest.h"
 #include "../Test/ITest.h"
+#include "../Test/MacSpeedTest.h"
 #include "../Test/MacStreamTest.h"
 #include "../Test/McElieceTest.h"
 #include "../Test/MemUtilsTest.h"
@@ -367,6 +368,9 @@ int main()
 	}
 	PrintHeader("", "");
 
+#if defined(CEX_SIMD_DISPATCH)
+	PrintHeader("The SIMD kernels are selected at run-time, the widest instruction set supported by this system is used.");
+#else
 	if (hasAvx2)
 	{
 #if !defined(__AVX2__)
@@ -389,6 +393,7 @@ int main()
 	{
 		PrintHeader("The minimum SIMD intrinsics support (AVX) was not detected, intrinsics have been disabled!");
 	}
+#endif
 	PrintHeader("", "");
 
 	try
@@ -530,6 +535,16 @@ int main()
 		}
 		ConsoleUtils::WriteLine("");
 
+		if (TestConfirm("Press 'Y' then Enter to run Message Authentication Code Speed Tests, any other key to cancel: "))
+		{
+			TestRun(new MacSpeedTest());
+		}
+		else
+		{
+			ConsoleUtils::WriteLine("MAC Speed tests were Cancelled..");
+		}
+		ConsoleUtils::WriteLine("");
+
 		if (TestConfirm("Press 'Y' then Enter to run Asymmetric Cipher Speed Tests, any other key to cancel: "))
 		{
 			TestRun(new AsymmetricSpeedTest());
@@ -1,6 +1,8 @@
 #include "TestUtils.h"
 #include "TestException.h"
 #include "../CEX/CexDomain.h"
+#include "../CEX/AsymmetricKey.h"
+#include "../CEX/AsymmetricKeyPair.h"
 #include "../CEX/CSP.h"
 #if defined(_WIN32)
 #	include <Windows.h>
@@ -8,11 +10,15 @@
 #	include <sys/types.h>
 #	include <sys/time.h>
 #endif
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 namespace Test
 {
+	using CEX::Asymmetric::AsymmetricKey;
+	using CEX::Asymmetric::AsymmetricKeyPair;
 	using CEX::Provider::CSP;
 
 #define	ex(x) (((x) < -BIGX) ? 0.0 : exp(x))
@@ -44,6 +50,87 @@ namespace Test
 		return PoChiSq(chisq, 255);
 	}
 
+	void TestUtils::CipherBatch(IAsymmetricCipher* Cipher, size_t Count, const std::string &Code)
+	{
+		// the key pairs are released on every exit; the sizes are set once the generator has loaded the parameters
+		std::unique_ptr<AsymmetricKeyPair> kp1(Cipher->Generate());
+		const size_t CPTLEN = Cipher->CipherTextSize();
+		const size_t SECLEN = Cipher->SharedSecretSize();
+		std::vector<byte> cpt(0);
+		std::vector<byte> dkey(32);
+		std::vector<byte> sec1(0);
+		std::vector<byte> sec2(0);
+		std::vector<byte> tmpc(0);
+		std::vector<byte> tmps(0);
+		std::unique_ptr<AsymmetricKeyPair> kp2(nullptr);
+		CEX::Prng::SecureRandom rnd;
+		size_t i;
+
+		Cipher->Initialize(kp1->PublicKey());
+		Cipher->Encapsulate(cpt, sec1, Count);
+
+		if (cpt.size() != Count * CPTLEN || sec1.size() != Count * SECLEN)
+		{
+			throw TestException(std::string("Batch"), Cipher->Name(), std::string("The batch output size is invalid! -") + Code + std::string("1"));
+		}
+
+		Cipher->Initialize(kp1->PrivateKey());
+
+		if (!Cipher->Decapsulate(cpt, sec2, Count))
+		{
+			throw TestException(std::string("Batch"), Cipher->Name(), std::string("Batch authentication has failed! -") + Code + std::string("2"));
+		}
+
+		if (sec1 != sec2)
+		{
+			throw TestException(std::string("Batch"), Cipher->Name(), std::string("Batch shared secrets are not equal! -") + Code + std::string("3"));
+		}
+
+		// every cipher-text in the batch must decapsulate with the single message function
+		for (i = 0; i < Count; ++i)
+		{
+			tmpc.assign(cpt.begin() + (i * CPTLEN), cpt.begin() + ((i + 1) * CPTLEN));
+
+			if (!Cipher->Decapsulate(tmpc, tmps) || !std::equal(tmps.begin(), tmps.end(), sec1.begin() + (i * SECLEN)))
+			{
+				throw TestException(std::string("Batch"), Cipher->Name(), std::string("Batch and single decapsulation are not equal! -") + Code + std::string("4"));
+			}
+		}
+
+		// an altered cipher-text fails the batch, and only its own secret changes
+		rnd.Generate(cpt, (Count / 2) * CPTLEN, 4);
+
+		if (Cipher->Decapsulate(cpt, sec2, Count))
+		{
+			throw TestException(std::string("Batch"), Cipher->Name(), std::string("Batch authentication has failed! -") + Code + std::string("5"));
+		}
+
+		for (i = 0; i < Count; ++i)
+		{
+			if (std::equal(sec2.begin() + (i * SECLEN), sec2.begin() + ((i + 1) * SECLEN), sec1.begin() + (i * SECLEN)) != (i != Count / 2))
+			{
+				throw TestException(std::string("Batch"), Cipher->Name(), std::string("Batch rejection is invalid! -") + Code + std::string("6"));
+			}
+		}
+
+		// with a domain key the caller sizes the secrets; the cipher takes ownership of the keys, so a new pair is generated
+		kp2.reset(Cipher->Generate());
+		rnd.Generate(dkey);
+		Cipher->DomainKey() = dkey;
+		sec1.resize(Count * 64);
+		sec2.resize(Count * 64);
+		Cipher->Initialize(kp2->PublicKey());
+		Cipher->Encapsulate(cpt, sec1, Count);
+		Cipher->Initialize(kp2->PrivateKey());
+
+		if (!Cipher->Decapsulate(cpt, sec2, Count) || sec1 != sec2)
+		{
+			throw TestException(std::string("Batch"), Cipher->Name(), std::string("Batch domain key secrets are not equal! -") + Code + std::string("7"));
+		}
+
+		Cipher->DomainKey().clear();
+	}
+
 	void TestUtils::CopyVector(const std::vector<int> &SrcArray, size_t SrcIndex, std::vector<int> &DstArray, size_t DstIndex, size_t Length)
 	{
 		std::memcpy(&DstArray[DstIndex], &SrcArray[SrcIndex], Length * sizeof(SrcArray[SrcIndex]));
@@ -383,6 +470,108 @@ namespace Test
 		std::reverse(Data.begin(), Data.end());
 	}
 
+	void TestUtils::SignatureBatch(IAsymmetricSign* Signer1, IAsymmetricSign* Signer2, IAsymmetricSign* Verifier, size_t Count, const std::string &Code)
+	{
+		std::vector<std::vector<byte>> msgs(Count);
+		std::vector<std::vector<byte>> sigs(Count);
+		std::vector<std::vector<byte>> vmsg(0);
+		std::vector<AsymmetricKey*> keys(2);
+		std::vector<size_t> kidx(Count);
+		std::vector<byte> res(0);
+		CEX::Prng::SecureRandom rnd;
+		AsymmetricKeyPair* kp1;
+		AsymmetricKeyPair* kp2;
+		size_t i;
+		size_t vcnt;
+
+		kp1 = Signer1->Generate();
+		kp2 = Signer1->Generate();
+		Signer1->Initialize(kp1->PrivateKey());
+		Signer2->Initialize(kp2->PrivateKey());
+
+		// the last message differs in length from the others
+		for (i = 0; i < Count; ++i)
+		{
+			msgs[i].resize(i == Count - 1 ? 17 : 32);
+			rnd.Generate(msgs[i]);
+			kidx[i] = i % 2;
+		}
+
+		// batch verification with the initialized key
+		for (i = 0; i < Count; ++i)
+		{
+			Signer1->Sign(msgs[i], sigs[i]);
+		}
+
+		Verifier->Initialize(kp1->PublicKey());
+		vcnt = Verifier->Verify(sigs, vmsg, res);
+
+		if (vcnt != Count || vmsg.size() != Count || res.size() != Count)
+		{
+			throw TestException(std::string("Batch"), Signer1->Name(), std::string("Batch verification test failed! -") + Code + std::string("1"));
+		}
+
+		for (i = 0; i < Count; ++i)
+		{
+			if (res[i] != 1 || vmsg[i] != msgs[i])
+			{
+				throw TestException(std::string("Batch"), Signer1->Name(), std::string("Batch verification test failed! -") + Code + std::string("2"));
+			}
+		}
+
+		// a tampered signature fails alone
+		sigs[1][0] ^= 0x01;
+		vcnt = Verifier->Verify(sigs, vmsg, res);
+		sigs[1][0] ^= 0x01;
+
+		if (vcnt != Count - 1 || res[1] != 0 || res[0] != 1 || vmsg[0] != msgs[0])
+		{
+			throw TestException(std::string("Batch"), Signer1->Name(), std::string("Batch verification test failed! -") + Code + std::string("3"));
+		}
+
+		// batch verification under two keys
+		for (i = 0; i < Count; ++i)
+		{
+			if (kidx[i] == 0)
+			{
+				Signer1->Sign(msgs[i], sigs[i]);
+			}
+			else
+			{
+				Signer2->Sign(msgs[i], sigs[i]);
+			}
+		}
+
+		keys[0] = kp1->PublicKey();
+		keys[1] = kp2->PublicKey();
+		vcnt = Verifier->Verify(sigs, vmsg, keys, kidx, res);
+
+		if (vcnt != Count)
+		{
+			throw TestException(std::string("Batch"), Signer1->Name(), std::string("Batch verification test failed! -") + Code + std::string("4"));
+		}
+
+		for (i = 0; i < Count; ++i)
+		{
+			if (res[i] != 1 || vmsg[i] != msgs[i])
+			{
+				throw TestException(std::string("Batch"), Signer1->Name(), std::string("Batch verification test failed! -") + Code + std::string("5"));
+			}
+		}
+
+		// a signature checked against the wrong key fails
+		kidx[0] = 1;
+		vcnt = Verifier->Verify(sigs, vmsg, keys, kidx, res);
+
+		if (vcnt != Count - 1 || res[0] != 0)
+		{
+			throw TestException(std::string("Batch"), Signer1->Name(), std::string("Batch verification test failed! -") + Code + std::string("6"));
+		}
+
+		delete kp1;
+		delete kp2;
+	}
+
 	bool TestUtils::SuccesiveZeros(const std::vector<byte> &Input, size_t Threshold)
 	{
 		size_t c;
@@ -4,11 +4,15 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include "../CEX/IAsymmetricCipher.h"
+#include "../CEX/IAsymmetricSign.h"
 #include "../CEX/SecureRandom.h"
 #include "../CEX/SymmetricKey.h"
 
 namespace Test
 {
+	using CEX::Asymmetric::IAsymmetricCipher;
+	using CEX::Asymmetric::Sign::IAsymmetricSign;
 	using CEX::Cipher::SymmetricKey;
 
 	class TestUtils final
@@ -298,6 +302,7 @@ namespace Test
 		/// Internal ///
 
 		static double ChiSquare(std::vector<byte> &Input);
+		static void CipherBatch(IAsymmetricCipher* Cipher, size_t Count, const std::string &Code);
 		static void CopyVector(const std::vector<int> &SrcArray, size_t SrcIndex, std::vector<int> &DstArray, size_t DstIndex, size_t Length);
 		static bool IsEqual(std::vector<byte> &A, std::vector<byte> &B);
 		static uint64_t GetTimeMs64();
@@ -309,6 +314,7 @@ namespace Test
 		static bool Read(const std::string &FilePath, std::string &Contents);
 		static std::vector<byte> Reduce(std::vector<byte> Seed);
 		static void Reverse(std::vector<byte> &Data);
+		static void SignatureBatch(IAsymmetricSign* Signer1, IAsymmetricSign* Signer2, IAsymmetricSign* Verifier, size_t Count, const std::string &Code);
 		static bool SuccesiveZeros(const std::vector<byte> &Input, size_t Threshold = 4);
 
 private:
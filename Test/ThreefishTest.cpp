@@ -1,4 +1,5 @@
 #include "ThreefishTest.h"
+#include "../CEX/CpuDetect.h"
 #include "../CEX/IntegerTools.h"
 #include "../CEX/MemoryTools.h"
 #include "../CEX/SecureRandom.h"
@@ -8,12 +9,6 @@
 #include "../CEX/TSX512.h"
 #include "../CEX/TSX1024.h"
 
-#if defined(__AVX2__)
-#	include "../CEX/ULong256.h"
-#endif
-#if defined(__AVX512__)
-#	include "../CEX/ULong512.h"
-#endif
 
 namespace Test
 {
@@ -29,13 +24,7 @@ namespace Test
 	using Cipher::Stream::TSX512;
 	using Cipher::Stream::TSX1024;
 
-#if defined(__AVX2__)
-	using Numeric::ULong256;
-#endif
-
-#if defined(__AVX512__)
-	using Numeric::ULong512;
-#endif
+	using Enumeration::SimdProfiles;
 
 	const std::string ThreefishTest::CLASSNAME = "ThreefishTest";
 	const std::string ThreefishTest::DESCRIPTION = "Tests the 256, 512, and 1024 bit versions of the ThreeFish stream cipher (TSX256, TSX512, TSX1024) authenticated stream ciphers.";
@@ -310,12 +299,14 @@ namespace Test
 
 	void ThreefishTest::CompareP256()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::array<ulong, 2> counter{ 128, 1 };
 		std::array<ulong, 4> key;
 		std::array<ulong, 2> tweak;
 		std::array<ulong, 4> state1;
 		std::array<ulong, 4> state2;
 		SecureRandom rnd;
+		size_t i;
 
 		IntegerTools::Fill(key, 0, 4, rnd);
 		IntegerTools::Fill(tweak, 0, 2, rnd);
@@ -330,20 +321,24 @@ namespace Test
 			throw TestException(std::string("CompareP256"), std::string("PemuteP256"), std::string("Permutation output is not equal! -TP1"));
 		}
 
-#if defined(__AVX2__)
-
-		std::array<ulong, 8> counter8{ 128, 128, 128, 128, 1, 1, 1, 1 };
-		std::array<ulong, 16> state3;
+		// every lane of the wide permutations is compared with the compact permutation using that lane's counter
+#if defined(CEX_KERNEL_SIMD256)
 
-		MemoryTools::Clear(state3, 0, 16 * sizeof(ulong));
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 8> counter8;
+			std::array<ulong, 16> state3;
 
-		Threefish::PemuteP4x256H(key, counter8, tweak, state3, 72);
+			IntegerTools::Fill(counter8, 0, 8, rnd);
+			Threefish::PemuteP4x256H(key.data(), counter8.data(), tweak.data(), state3.data(), 72);
 
-		for (size_t i = 0; i < 16; i += 4)
-		{
-			for (size_t j = 0; j < 4; ++j)
+			for (i = 0; i < 4; ++i)
 			{
-				if (state3[i + j] != state1[j])
+				counter[0] = counter8[i];
+				counter[1] = counter8[i + 4];
+				Threefish::PemuteP256C(key, counter, tweak, state1, 72);
+
+				if (!IntegerTools::Compare(state1, 0, state3, i * 4, 4))
 				{
 					throw TestException(std::string("CompareP256"), std::string("PemuteP4x256H"), std::string("Permutation output is not equal! -TP2"));
 				}
@@ -352,20 +347,23 @@ namespace Test
 
 #endif
 
-#if defined(__AVX512__)
-
-		std::array<ulong, 16> counter16{ 128, 128, 128, 128, 128, 128, 128, 128, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::array<ulong, 32> state4;
+#if defined(CEX_KERNEL_SIMD512)
 
-		MemoryTools::Clear(state4, 0, 32 * sizeof(ulong));
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 16> counter16;
+			std::array<ulong, 32> state4;
 
-		Threefish::PemuteP8x256H(key, counter16, tweak, state4, 72);
+			IntegerTools::Fill(counter16, 0, 16, rnd);
+			Threefish::PemuteP8x256H(key.data(), counter16.data(), tweak.data(), state4.data(), 72);
 
-		for (size_t i = 0; i < 32; i += 8)
-		{
-			for (size_t j = 0; j < 8; ++j)
+			for (i = 0; i < 8; ++i)
 			{
-				if (state3[i + j] != state1[j])
+				counter[0] = counter16[i];
+				counter[1] = counter16[i + 8];
+				Threefish::PemuteP256C(key, counter, tweak, state1, 72);
+
+				if (!IntegerTools::Compare(state1, 0, state4, i * 4, 4))
 				{
 					throw TestException(std::string("CompareP256"), std::string("PemuteP8x256H"), std::string("Permutation output is not equal! -TP3"));
 				}
@@ -377,12 +375,14 @@ namespace Test
 
 	void ThreefishTest::CompareP512()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::array<ulong, 2> counter{ 128, 1 };
 		std::array<ulong, 8> key;
 		std::array<ulong, 2> tweak;
 		std::array<ulong, 8> state1;
 		std::array<ulong, 8> state2;
 		SecureRandom rnd;
+		size_t i;
 
 		IntegerTools::Fill(key, 0, 8, rnd);
 		IntegerTools::Fill(tweak, 0, 2, rnd);
@@ -397,20 +397,24 @@ namespace Test
 			throw TestException(std::string("CompareP512"), std::string("PemuteP512"), std::string("Permutation output is not equal! -TP1"));
 		}
 
-#if defined(__AVX2__)
-
-		std::array<ulong, 8> counter8{ 128, 128, 128, 128, 1, 1, 1, 1 };
-		std::array<ulong, 32> state3;
+		// every lane of the wide permutations is compared with the compact permutation using that lane's counter
+#if defined(CEX_KERNEL_SIMD256)
 
-		MemoryTools::Clear(state3, 0, 32 * sizeof(ulong));
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 8> counter8;
+			std::array<ulong, 32> state3;
 
-		Threefish::PemuteP4x512H(key, counter8, tweak, state3, 96);
+			IntegerTools::Fill(counter8, 0, 8, rnd);
+			Threefish::PemuteP4x512H(key.data(), counter8.data(), tweak.data(), state3.data(), 96);
 
-		for (size_t i = 0; i < 32; i += 8)
-		{
-			for (size_t j = 0; j < 8; ++j)
+			for (i = 0; i < 4; ++i)
 			{
-				if (state3[i + j] != state1[j])
+				counter[0] = counter8[i];
+				counter[1] = counter8[i + 4];
+				Threefish::PemuteP512C(key, counter, tweak, state1, 96);
+
+				if (!IntegerTools::Compare(state1, 0, state3, i * 8, 8))
 				{
 					throw TestException(std::string("CompareP512"), std::string("PemuteP4x512H"), std::string("Permutation output is not equal! -TP2"));
 				}
@@ -419,20 +423,23 @@ namespace Test
 
 #endif
 
-#if defined(__AVX512__)
-
-		std::array<ulong, 16> counter16{ 128, 128, 128, 128, 128, 128, 128, 128, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::array<ulong, 64> state4;
+#if defined(CEX_KERNEL_SIMD512)
 
-		MemoryTools::Clear(state4, 0, 64 * sizeof(ulong));
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 16> counter16;
+			std::array<ulong, 64> state4;
 
-		Threefish::PemuteP8x512H(key, counter16, tweak, state4, 96);
+			IntegerTools::Fill(counter16, 0, 16, rnd);
+			Threefish::PemuteP8x512H(key.data(), counter16.data(), tweak.data(), state4.data(), 96);
 
-		for (size_t i = 0; i < 64; i += 16)
-		{
-			for (size_t j = 0; j < 16; ++j)
+			for (i = 0; i < 8; ++i)
 			{
-				if (state3[i + j] != state1[j])
+				counter[0] = counter16[i];
+				counter[1] = counter16[i + 8];
+				Threefish::PemuteP512C(key, counter, tweak, state1, 96);
+
+				if (!IntegerTools::Compare(state1, 0, state4, i * 8, 8))
 				{
 					throw TestException(std::string("CompareP512"), std::string("PemuteP8x512H"), std::string("Permutation output is not equal! -TP3"));
 				}
@@ -440,45 +447,50 @@ namespace Test
 		}
 
 #endif
-
 	}
 
 	void ThreefishTest::CompareP1024()
 	{
+		const SimdProfiles SMDPRF = CpuDetect::SimdProfile();
 		std::array<ulong, 2> counter{ 128, 1 };
 		std::array<ulong, 16> key;
 		std::array<ulong, 2> tweak;
 		std::array<ulong, 16> state1;
 		std::array<ulong, 16> state2;
 		SecureRandom rnd;
+		size_t i;
 
 		IntegerTools::Fill(key, 0, 16, rnd);
 		IntegerTools::Fill(tweak, 0, 2, rnd);
 		MemoryTools::Clear(state1, 0, 16 * sizeof(ulong));
 		MemoryTools::Clear(state2, 0, 16 * sizeof(ulong));
 
-		Threefish::PemuteR120P1024U(key, counter, tweak, state2);
 		Threefish::PemuteP1024C(key, counter, tweak, state1, 120);
+		Threefish::PemuteR120P1024U(key, counter, tweak, state2);
 
 		if (state1 != state2)
 		{
 			throw TestException(std::string("CompareP1024"), std::string("PemuteP1024"), std::string("Permutation output is not equal! -TP1"));
 		}
 
-#if defined(__AVX2__)
-		
-		std::array<ulong, 8> counter8{ 128, 128, 128, 128, 1, 1, 1, 1 };
-		std::array<ulong, 64> state3;
+		// every lane of the wide permutations is compared with the compact permutation using that lane's counter
+#if defined(CEX_KERNEL_SIMD256)
 
-		MemoryTools::Clear(state3, 0, 64 * sizeof(ulong));
+		if (SMDPRF == SimdProfiles::Simd256 || SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 8> counter8;
+			std::array<ulong, 64> state3;
 
-		Threefish::PemuteP4x1024H(key, counter8, tweak, state3, 120);
+			IntegerTools::Fill(counter8, 0, 8, rnd);
+			Threefish::PemuteP4x1024H(key.data(), counter8.data(), tweak.data(), state3.data(), 120);
 
-		for (size_t i = 0; i < 64; i += 16)
-		{
-			for (size_t j = 0; j < 16; ++j)
+			for (i = 0; i < 4; ++i)
 			{
-				if (state3[i + j] != state1[j])
+				counter[0] = counter8[i];
+				counter[1] = counter8[i + 4];
+				Threefish::PemuteP1024C(key, counter, tweak, state1, 120);
+
+				if (!IntegerTools::Compare(state1, 0, state3, i * 16, 16))
 				{
 					throw TestException(std::string("CompareP1024"), std::string("PemuteP4x1024H"), std::string("Permutation output is not equal! -TP2"));
 				}
@@ -487,20 +499,23 @@ namespace Test
 
 #endif
 
-#if defined(__AVX512__)
-
-		std::array<ulong, 16> counter16{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 };
-		std::array<ulong, 128> state4;
+#if defined(CEX_KERNEL_SIMD512)
 
-		MemoryTools::Clear(state4, 0, 128 * sizeof(ulong));
+		if (SMDPRF == SimdProfiles::Simd512)
+		{
+			std::array<ulong, 16> counter16;
+			std::array<ulong, 128> state4;
 
-		Threefish::PemuteP8x1024H(key, counter16, tweak, state4, 120);
+			IntegerTools::Fill(counter16, 0, 16, rnd);
+			Threefish::PemuteP8x1024H(key.data(), counter16.data(), tweak.data(), state4.data(), 120);
 
-		for (size_t i = 0; i < 128; ++i)
-		{
-			for (size_t j = 0; j < 16; ++j)
+			for (i = 0; i < 8; ++i)
 			{
-				if (state4[i + j] != state1[j])
+				counter[0] = counter16[i];
+				counter[1] = counter16[i + 8];
+				Threefish::PemuteP1024C(key, counter, tweak, state1, 120);
+
+				if (!IntegerTools::Compare(state1, 0, state4, i * 16, 16))
 				{
 					throw TestException(std::string("CompareP1024"), std::string("PemuteP8x1024H"), std::string("Permutation output is not equal! -TP3"));
 				}
@@ -508,7 +523,6 @@ namespace Test
 		}
 
 #endif
-
 	}
 
 	void ThreefishTest::Exception(IStreamCipher* Cipher)
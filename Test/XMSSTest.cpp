@@ -68,6 +68,8 @@ namespace Test
 			OnProgress(std::string("XMSSTest: Passed signature cipher-text and message verification known answer tests.."));
 			Authentication();
 			OnProgress(std::string("XMSSTest: Passed message authentication test.."));
+			Batch();
+			OnProgress(std::string("XMSSTest: Passed batch verification tests.."));
 			Exception();
 			OnProgress(std::string("XMSSTest: Passed exception handling test.."));
 			PrivateKey();
@@ -80,6 +82,10 @@ namespace Test
 			OnProgress(std::string("XMSSTest: Passed signature tamper test.."));
 			Stress();
 			OnProgress(std::string("XMSSTest: Passed encryption and decryption stress tests.."));
+			Traversal();
+			OnProgress(std::string("XMSSTest: Passed traversal state signature equivalence tests.."));
+			Exhaustion();
+			OnProgress(std::string("XMSSTest: Passed key exhaustion tests.."));
 
 			return SUCCESS;
 		}
@@ -125,6 +131,16 @@ namespace Test
 		}
 	}
 
+	void XMSSTest::Batch()
+	{
+		const size_t CNT = 5;
+		XMSS sgn1(XmssParameters::XMSSSHA256H10);
+		XMSS sgn2(XmssParameters::XMSSSHA256H10);
+		XMSS sgn3(XmssParameters::XMSSSHA256H10);
+
+		TestUtils::SignatureBatch(&sgn1, &sgn2, &sgn3, CNT, std::string("XB"));
+	}
+
 	void XMSSTest::Exception()
 	{
 		// test invalid constructor parameters -sphincs parameters
@@ -248,6 +264,57 @@ namespace Test
 		}
 	}
 
+	void XMSSTest::Exhaustion()
+	{
+		// the H10 key has 1024 one-time keys, the last index 2^h-1 is a valid signing index
+		const size_t SIGCNT = 1024;
+
+		SecureRandom rnd;
+		NistRng gen;
+		std::vector<byte> msg1(32);
+		std::vector<byte> msg2(0);
+		std::vector<byte> sig(0);
+		size_t i;
+
+		gen.Initialize(m_rngseed);
+		XMSS sgn1(XmssParameters::XMSSSHA256H10, &gen, true);
+		XMSS sgn2(XmssParameters::XMSSSHA256H10);
+		AsymmetricKeyPair* kp = sgn1.Generate();
+
+		sgn1.Initialize(kp->PrivateKey());
+
+		for (i = 0; i < SIGCNT; ++i)
+		{
+			rnd.Generate(msg1);
+			sgn1.Sign(msg1, sig);
+		}
+
+		// the signature of the last index is valid
+		sgn2.Initialize(kp->PublicKey());
+
+		if (!sgn2.Verify(sig, msg2) || msg1 != msg2)
+		{
+			throw TestException(std::string("Exhaustion"), sgn1.Name(), std::string("Failed the last index authentication test! -XE1"));
+		}
+
+		// the exhausted key is rejected
+		try
+		{
+			sgn1.Sign(msg1, sig);
+
+			throw TestException(std::string("Exhaustion"), sgn1.Name(), std::string("Exception handling failure! -XE2"));
+		}
+		catch (CryptoAsymmetricException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		delete kp;
+	}
+
 	void XMSSTest::Integrity()
 	{
 		std::vector<byte> cpt(0);
@@ -675,9 +742,9 @@ namespace Test
 
 		AsymmetricKeyPair* kp = sgn.Generate();
 
-		// alter private key
+		// alter the private key seed; the oid and leaf index precede it
 		std::vector<byte> sk1 = kp->PrivateKey()->Polynomial();
-		gen.Generate(sk1, 0, 16);
+		gen.Generate(sk1, 8, 16);
 		AsymmetricKey* sk2 = new AsymmetricKey(sk1, AsymmetricPrimitives::XMSS, AsymmetricKeyTypes::SignaturePrivateKey, static_cast<AsymmetricParameters>(XmssParameters::XMSSSHA256H10));
 
 		sgn.Initialize(sk2);
@@ -839,6 +906,97 @@ namespace Test
 		}
 	}
 
+	void XMSSTest::Traversal()
+	{
+		// the subtree height is 5, so the signatures cross into the second lowest-layer tree
+		const size_t SIGCNT = 36;
+
+		SecureRandom rnd;
+		NistRng gen1;
+		NistRng gen2;
+		std::vector<byte> msg1(32);
+		std::vector<byte> msg2(0);
+		std::vector<byte> sig1(0);
+		std::vector<byte> sig2(0);
+		size_t i;
+
+		gen1.Initialize(m_rngseed);
+		gen2.Initialize(m_rngseed);
+
+		XMSS sgn1(XmssParameters::XMSSMTSHA256H20D4, &gen1);
+		XMSS sgn2(XmssParameters::XMSSMTSHA256H20D4, &gen2, true);
+
+		AsymmetricKeyPair* kp1 = sgn1.Generate();
+		AsymmetricKeyPair* kp2 = sgn2.Generate();
+
+		// the traversal state is appended to an otherwise identical key
+		if (kp1->PublicKey()->Polynomial() != kp2->PublicKey()->Polynomial())
+		{
+			throw TestException(std::string("Traversal"), sgn2.Name(), std::string("Public keys do not match! -XT1"));
+		}
+
+		const size_t SKLEN = kp1->PrivateKey()->Polynomial().size();
+		// the signer takes ownership of the key, keep a copy for the version test
+		std::vector<byte> sk = kp2->PrivateKey()->Polynomial();
+
+		if (sk.size() <= SKLEN)
+		{
+			throw TestException(std::string("Traversal"), sgn2.Name(), std::string("The private key has no traversal state! -XT2"));
+		}
+
+		sgn1.Initialize(kp1->PrivateKey());
+		sgn2.Initialize(kp2->PrivateKey());
+
+		for (i = 0; i < SIGCNT; ++i)
+		{
+			rnd.Generate(msg1);
+			sgn1.Sign(msg1, sig1);
+			sgn2.Sign(msg1, sig2);
+
+			if (sig1 != sig2)
+			{
+				throw TestException(std::string("Traversal"), sgn2.Name(), std::string("Signature arrays do not match! -XT3"));
+			}
+
+			if (i == SIGCNT / 2)
+			{
+				// persist the updated key and its state, and continue signing with the restored key
+				AsymmetricKey* upk = sgn2.UpdatedKey();
+				SecureVector<byte> skey = AsymmetricKey::Serialize(*upk);
+				sgn2.Initialize(AsymmetricKey::DeSerialize(skey));
+				delete upk;
+			}
+		}
+
+		sgn2.Initialize(kp2->PublicKey());
+
+		if (!sgn2.Verify(sig2, msg2) || msg1 != msg2)
+		{
+			throw TestException(std::string("Traversal"), sgn2.Name(), std::string("Failed authentication test! -XT4"));
+		}
+
+		// a state written by an unknown version is rejected
+		try
+		{
+			XMSS sgn3(XmssParameters::XMSSMTSHA256H20D4);
+			sk[SKLEN] = 0xFF;
+			sgn3.Initialize(new AsymmetricKey(sk, AsymmetricPrimitives::XMSS, AsymmetricKeyTypes::SignaturePrivateKey, static_cast<AsymmetricParameters>(XmssParameters::XMSSMTSHA256H20D4)));
+			sgn3.Sign(msg1, sig1);
+
+			throw TestException(std::string("Traversal"), sgn3.Name(), std::string("Exception handling failure! -XT5"));
+		}
+		catch (CryptoAsymmetricException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		delete kp1;
+		delete kp2;
+	}
+
 	void XMSSTest::Initialize()
 	{
 		/*lint -save -e417 */
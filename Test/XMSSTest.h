@@ -61,11 +61,21 @@ namespace Test
 		/// </summary>
 		void Authentication();
 
+		/// <summary>
+		/// Tests batch verification with one and with several public keys
+		/// </summary>
+		void Batch();
+
 		/// <summary>
 		/// Tests the ciphers exception handling functions
 		/// </summary>
 		void Exception();
 
+		/// <summary>
+		/// Sign with every one-time key of a traversal key, including the last index, and test that the exhausted key is rejected
+		/// </summary>
+		void Exhaustion();
+
 		/// <summary>
 		/// Compare the shared-secret, cipher-text, public and private key vectors to known answer outputs
 		/// </summary>
@@ -101,6 +111,11 @@ namespace Test
 		/// </summary>
 		void Stress();
 
+		/// <summary>
+		/// Compare signatures generated with the BDS traversal state to stateless signatures over consecutive indices, including a persisted state and a subtree change
+		/// </summary>
+		void Traversal();
+
 	private:
 
 		void Initialize();